@@ -14,6 +14,15 @@ layout (std140) uniform EngineUBO
     float   ubo_Time;
 };
 
+/* Per instance model matrices, filled by the engine when drawables sharing a mesh and a material are batched */
+layout(std430, binding = 1) buffer InstanceSSBO
+{
+    mat4 ssbo_Instances[];
+};
+
+/* Index of the first instance in ssbo_Instances, or -1 when drawing a single mesh with ubo_Model */
+uniform int ubo_InstanceOffset = -1;
+
 out VS_OUT
 {
     vec3 FragPos;
@@ -23,8 +32,10 @@ out VS_OUT
 
 void main()
 {
-    vs_out.FragPos      = vec3(ubo_Model * vec4(geo_Pos, 1.0));
-    vs_out.Normal       = normalize(mat3(transpose(inverse(ubo_Model))) * geo_Normal);
+    mat4 model = ubo_InstanceOffset < 0 ? ubo_Model : ssbo_Instances[ubo_InstanceOffset + gl_InstanceID];
+
+    vs_out.FragPos      = vec3(model * vec4(geo_Pos, 1.0));
+    vs_out.Normal       = normalize(mat3(transpose(inverse(model))) * geo_Normal);
     vs_out.TexCoords    = geo_TexCoords;
 
     gl_Position = ubo_Projection * ubo_View * vec4(vs_out.FragPos, 1.0);
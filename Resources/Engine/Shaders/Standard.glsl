@@ -17,6 +17,15 @@ layout (std140) uniform EngineUBO
     float   ubo_Time;
 };
 
+/* Per instance model matrices, filled by the engine when drawables sharing a mesh and a material are batched */
+layout(std430, binding = 1) buffer InstanceSSBO
+{
+    mat4 ssbo_Instances[];
+};
+
+/* Index of the first instance in ssbo_Instances, or -1 when drawing a single mesh with ubo_Model */
+uniform int ubo_InstanceOffset = -1;
+
 /* Information passed to the fragment shader */
 out VS_OUT
 {
@@ -30,17 +39,19 @@ out VS_OUT
 
 void main()
 {
+    mat4 model = ubo_InstanceOffset < 0 ? ubo_Model : ssbo_Instances[ubo_InstanceOffset + gl_InstanceID];
+
     vs_out.TBN = mat3
     (
-        normalize(vec3(ubo_Model * vec4(geo_Tangent,   0.0))),
-        normalize(vec3(ubo_Model * vec4(geo_Bitangent, 0.0))),
-        normalize(vec3(ubo_Model * vec4(geo_Normal,    0.0)))
+        normalize(vec3(model * vec4(geo_Tangent,   0.0))),
+        normalize(vec3(model * vec4(geo_Bitangent, 0.0))),
+        normalize(vec3(model * vec4(geo_Normal,    0.0)))
     );
 
     mat3 TBNi = transpose(vs_out.TBN);
 
-    vs_out.FragPos          = vec3(ubo_Model * vec4(geo_Pos, 1.0));
-    vs_out.Normal           = normalize(mat3(transpose(inverse(ubo_Model))) * geo_Normal);
+    vs_out.FragPos          = vec3(model * vec4(geo_Pos, 1.0));
+    vs_out.Normal           = normalize(mat3(transpose(inverse(model))) * geo_Normal);
     vs_out.TexCoords        = geo_TexCoords;
     vs_out.TangentViewPos   = TBNi * ubo_ViewPos;
     vs_out.TangentFragPos   = TBNi * vs_out.FragPos;
@@ -17,12 +17,18 @@ layout (std140) uniform EngineUBO
     mat4    ubo_View;
     mat4    ubo_Projection;
     vec3    ubo_ViewPos;
-    // float   ubo_Time;
-	// mat4    ubo_preserve;
-    int     ubo_boneCount;
-    mat4    ubo_bones[64];
+    float   ubo_Time;
 };
 
+/* Bone palettes of every skinned mesh drawn by the current render pass, filled once per pass by the engine */
+layout(std430, binding = 2) buffer BonePaletteSSBO
+{
+    mat4    ssbo_Bones[];
+};
+
+/* Index of the first bone of the drawn mesh in ssbo_Bones, or -1 when the mesh isn't animated */
+uniform int ubo_BoneOffset = -1;
+
 /* Information passed to the fragment shader */
 out VS_OUT
 {
@@ -56,13 +62,13 @@ void main()
 	// 		boneCount +=1;
 	// 	}		
 	// }
-	if(ubo_boneCount == 0)
+	if(ubo_BoneOffset < 0)
 		boneAcc = mat4(1.0);
     else
         for(int i = 0; i < 4; i++)
         {
             int boneID = geo_BoneID[i];
-            boneAcc += geo_BoneWeight[i]*ubo_bones[boneID - 1];	
+            boneAcc += geo_BoneWeight[i]*ssbo_Bones[ubo_BoneOffset + boneID - 1];	
         }
 
     vs_out.FragPos          = vec3(ubo_Model * vec4(geo_Pos, 1.0));
@@ -84,8 +90,7 @@ layout (std140) uniform EngineUBO
     mat4    ubo_View;
     mat4    ubo_Projection;
     vec3    ubo_ViewPos;
-    int     ubo_boneCount;
-    mat4    ubo_bones[64];
+    float   ubo_Time;
 };
 
 /* Information passed from the fragment shader */
@@ -14,6 +14,15 @@ layout (std140) uniform EngineUBO
     float   ubo_Time;
 };
 
+/* Per instance model matrices, filled by the engine when drawables sharing a mesh and a material are batched */
+layout(std430, binding = 1) buffer InstanceSSBO
+{
+    mat4 ssbo_Instances[];
+};
+
+/* Index of the first instance in ssbo_Instances, or -1 when drawing a single mesh with ubo_Model */
+uniform int ubo_InstanceOffset = -1;
+
 out VS_OUT
 {
     vec2 TexCoords;
@@ -21,9 +30,11 @@ out VS_OUT
 
 void main()
 {
+    mat4 model = ubo_InstanceOffset < 0 ? ubo_Model : ssbo_Instances[ubo_InstanceOffset + gl_InstanceID];
+
     vs_out.TexCoords = geo_TexCoords;
 
-    gl_Position = ubo_Projection * ubo_View * ubo_Model * vec4(geo_Pos, 1.0);
+    gl_Position = ubo_Projection * ubo_View * model * vec4(geo_Pos, 1.0);
 }
 
 #shader fragment
@@ -9,17 +9,21 @@
 #include <unordered_map>
 #include <chrono>
 #include <mutex>
+#include <atomic>
+#include <memory>
 
 
 #include "OvAnalytics/Profiling/ProfilerReport.h"
+#include "OvAnalytics/Profiling/ProfilerFrame.h"
+#include "OvAnalytics/Profiling/ProfilerEventBuffer.h"
+#include "OvAnalytics/Profiling/ProfilerTraceWriter.h"
 
 namespace OvAnalytics::Profiling
 {
-	/* Forward declaration of the profiler spy structure */
-	struct ProfilerSpy;
-
 	/**
-	* The profiler collect data about the running program
+	* The profiler collect data about the running program.
+	* Spies record their scopes into a ring buffer owned by their thread (No lock, no allocation), and
+	* the profiler collects these events once per frame to build the history and the frame timeline
 	*/
 	class Profiler final
 	{
@@ -40,16 +44,33 @@ namespace OvAnalytics::Profiling
 		void ClearHistory();
 
 		/**
-		* Update the profiler
-		* @param p_deltaTime
+		* Update the profiler (Collect the scopes recorded since the last update into a new frame).
+		* Durations come from the profiler clock, so no frame time is needed
+		*/
+		void Update();
+
+		/**
+		* Returns the timeline of the last collected frame
+		*/
+		const ProfilerFrame& GetLastFrame() const;
+
+		/**
+		* Stream the next frames collected by Update() to a Chrome Trace Event JSON file.
+		* The profiler is enabled for the duration of the capture. Returns false if the file can't be opened
+		* @param p_filePath
+		* @param p_frameCount
+		*/
+		static bool StartCapture(const std::string& p_filePath, uint32_t p_frameCount);
+
+		/**
+		* Returns true if a capture is in progress
 		*/
-		void Update(float p_deltaTime);
+		static bool IsCapturing();
 
 		/**
-		* Save the given spy collected data to the profiler history
-		* @param p_spy (Spy to collect data from)
+		* Returns the event buffer of the calling thread, creating it on the first call
 		*/
-		static void Save(ProfilerSpy& p_spy);
+		static ProfilerEventBuffer& GetThreadBuffer();
 
 		/**
 		* Verify if the profiler is currently enabled
@@ -71,18 +92,63 @@ namespace OvAnalytics::Profiling
 		*/
 		static void Disable();
 
+	private:
+		struct ThreadContext;
+
+		struct ActionHistory
+		{
+			double duration = 0.0;
+			uint64_t calls = 0;
+		};
+
+		/**
+		* Consume the events of every thread buffer
+		* @param p_record (If false, events are only consumed to keep track of the opened scopes)
+		*/
+		static void CollectEvents(bool p_record);
+
+		/**
+		* Measure the profiler clock frequency against the steady clock
+		*/
+		static void CalibrateClock();
+
+		/**
+		* Convert profiler clock ticks to steady clock nanoseconds
+		* @param p_ticks
+		*/
+		static int64_t ToNanoseconds(int64_t p_ticks);
+
 	private:
 		/* Time relatives */
 		std::chrono::steady_clock::time_point m_lastTime;
 
 		/* Profiler settings */
-		static bool __ENABLED;
-
-		/* Collected data */
-		static std::mutex									__SAVE_MUTEX;
-		static std::unordered_map<std::string, double>		__ELPASED_HISTORY;
-		static std::unordered_map<std::string, uint64_t>	__CALLS_COUNTER;
-		static std::vector<std::thread::id>					__WORKING_THREADS;
-		static uint32_t										__ELAPSED_FRAMES;
+		static std::atomic<bool> __ENABLED;
+
+		/* Profiler clock calibration */
+		static int64_t	__CLOCK_ORIGIN_TICKS;
+		static int64_t	__CLOCK_ORIGIN_TIME;
+		static double	__TICKS_PER_NANOSECOND;
+
+		/* Thread buffers (The mutex is only taken when a thread records its first scope and when collecting events) */
+		static std::mutex										__THREADS_MUTEX;
+		static std::vector<std::unique_ptr<ThreadContext>>		__THREADS;
+
+		/* Collected data (Profiler thread only) */
+		static std::unordered_map<const char*, ActionHistory>	__ACTIONS_HISTORY;
+		static std::vector<std::thread::id>						__WORKING_THREADS;
+		static uint32_t											__ELAPSED_FRAMES;
+		static uint64_t											__DROPPED_SCOPES;
+		static ProfilerFrame									__LAST_FRAME;
+
+		/* Capture */
+		static std::unique_ptr<ProfilerTraceWriter>				__CAPTURE_WRITER;
+		static uint32_t											__CAPTURE_REMAINING_FRAMES;
+		static bool												__ENABLED_BEFORE_CAPTURE;
 	};
-}
\ No newline at end of file
+}
+
+inline bool OvAnalytics::Profiling::Profiler::IsEnabled()
+{
+	return __ENABLED.load(std::memory_order_relaxed);
+}
@@ -0,0 +1,137 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#if defined(_M_X64) || defined(_M_IX86)
+#include <intrin.h>
+#define OV_PROFILER_USE_TSC
+#elif defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define OV_PROFILER_USE_TSC
+#endif
+
+namespace OvAnalytics::Profiling
+{
+	/**
+	* Scope event recorded by a profiler spy. A null name marks the end of the last opened scope.
+	* The timestamp is in profiler clock ticks (See ProfilerEventBuffer::GetTimestamp())
+	*/
+	struct ProfilerEvent final
+	{
+		const char* name;
+		int64_t timestamp;
+	};
+
+	/**
+	* Fixed size ring buffer of profiler events owned by a single thread.
+	* The owner thread is the only writer and the profiler is the only reader, so no lock is needed
+	*/
+	class ProfilerEventBuffer final
+	{
+	public:
+		static constexpr uint32_t Capacity = 1u << 13;
+
+		/**
+		* Create an event buffer for the calling thread
+		*/
+		ProfilerEventBuffer();
+
+		/**
+		* Record the beginning of a scope (Owner thread only).
+		* Returns false if the buffer is too full to guarantee that the matching end event will fit, in which case
+		* the scope is dropped and EndScope() must not be called for it
+		* @param p_name (Must be a string with static storage duration, its address is used as the scope identifier)
+		*/
+		bool BeginScope(const char* p_name);
+
+		/**
+		* Record the end of the last scope successfully begun (Owner thread only)
+		*/
+		void EndScope();
+
+		/**
+		* Append every pending event to the given vector (Profiler thread only)
+		* @param p_events
+		*/
+		void Consume(std::vector<ProfilerEvent>& p_events);
+
+		/**
+		* Returns the number of scopes dropped because the buffer was full since the last call (Profiler thread only)
+		*/
+		uint32_t ConsumeDroppedScopes();
+
+		/**
+		* Returns the identifier of the thread owning this buffer
+		*/
+		std::thread::id GetThreadID() const;
+
+		/**
+		* Returns the current profiler clock ticks. The time stamp counter is used when available since it is
+		* much cheaper to read than the system clock, the profiler converts ticks to nanoseconds when collecting events
+		*/
+		static int64_t GetTimestamp();
+
+	private:
+		void Push(const char* p_name);
+
+	private:
+		const std::thread::id m_threadID;
+		ProfilerEvent m_events[Capacity];
+
+		/* Owner thread data */
+		alignas(64) std::atomic<uint32_t> m_writeIndex = 0;
+		uint32_t m_openScopes = 0;
+		std::atomic<uint32_t> m_droppedScopes = 0;
+
+		/* Profiler thread data */
+		alignas(64) std::atomic<uint32_t> m_readIndex = 0;
+	};
+}
+
+inline bool OvAnalytics::Profiling::ProfilerEventBuffer::BeginScope(const char* p_name)
+{
+	const uint32_t pending = m_writeIndex.load(std::memory_order_relaxed) - m_readIndex.load(std::memory_order_acquire);
+
+	/* Keep room for this event and for the end event of every opened scope, so scopes never lose their end */
+	if (pending + m_openScopes + 2 > Capacity)
+	{
+		m_droppedScopes.fetch_add(1, std::memory_order_relaxed);
+		return false;
+	}
+
+	++m_openScopes;
+	Push(p_name);
+	return true;
+}
+
+inline void OvAnalytics::Profiling::ProfilerEventBuffer::EndScope()
+{
+	--m_openScopes;
+	Push(nullptr);
+}
+
+inline void OvAnalytics::Profiling::ProfilerEventBuffer::Push(const char* p_name)
+{
+	const uint32_t writeIndex = m_writeIndex.load(std::memory_order_relaxed);
+	m_events[writeIndex & (Capacity - 1)] = { p_name, GetTimestamp() };
+	m_writeIndex.store(writeIndex + 1, std::memory_order_release);
+}
+
+inline int64_t OvAnalytics::Profiling::ProfilerEventBuffer::GetTimestamp()
+{
+#ifdef OV_PROFILER_USE_TSC
+	return static_cast<int64_t>(__rdtsc());
+#else
+	return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+}
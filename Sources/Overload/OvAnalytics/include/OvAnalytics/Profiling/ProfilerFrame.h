@@ -0,0 +1,46 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+
+namespace OvAnalytics::Profiling
+{
+	/**
+	* Timeline of the scopes recorded by every thread during the last collected frame
+	*/
+	struct ProfilerFrame final
+	{
+		/**
+		* Recorded scope. Times are in nanoseconds, on the profiler clock
+		*/
+		struct Scope final
+		{
+			const char* name;
+			int64_t start;
+			int64_t end;		// Collection time if the scope was still running
+			uint32_t depth;
+			int32_t parent;		// Index of the enclosing scope in the thread scopes, -1 if it started in a previous frame or if there is none
+		};
+
+		/**
+		* Scopes of a thread, in the order they began (Children always follow their parent)
+		*/
+		struct Thread final
+		{
+			std::thread::id id;
+			std::vector<Scope> scopes;
+		};
+
+		int64_t start = 0;
+		int64_t end = 0;
+		std::vector<Thread> threads;
+	};
+}
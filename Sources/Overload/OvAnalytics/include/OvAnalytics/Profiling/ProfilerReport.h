@@ -7,6 +7,8 @@
 #pragma once
 
 #include <vector>
+#include <string>
+#include <cstdint>
 
 
 namespace OvAnalytics::Profiling
@@ -30,6 +32,7 @@ namespace OvAnalytics::Profiling
 		double				elaspedTime		= 0.0;
 		uint16_t			workingThreads	= 0u;
 		uint32_t			elapsedFrames	= 0u;
+		uint64_t			droppedScopes	= 0u;
 		std::vector<Action> actions;
 	};
 }
\ No newline at end of file
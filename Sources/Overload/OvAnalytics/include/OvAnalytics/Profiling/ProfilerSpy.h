@@ -6,21 +6,16 @@
 
 #pragma once
 
-#include <string>
-#include <chrono>
-
-
 #include "OvAnalytics/Profiling/Profiler.h"
-#include "OvAnalytics/Profiling/ProfilerSpy.h"
 
 /**
 * This macro allow the creation of profiler spies
 * Any spy will die and send data to the profiler at
-* the end of the scope where this macro get called
+* the end of the scope where this macro get called.
+* The name must be a string literal (Its address identifies the scope)
 */
 #define PROFILER_SPY(name)\
-		std::unique_ptr<OvAnalytics::Profiling::ProfilerSpy> __profiler_spy__ = \
-		OvAnalytics::Profiling::Profiler::IsEnabled() ? std::make_unique<OvAnalytics::Profiling::ProfilerSpy>(name) : nullptr
+		OvAnalytics::Profiling::ProfilerSpy __profiler_spy__(name)
 
 namespace OvAnalytics::Profiling
 {
@@ -33,18 +28,37 @@ namespace OvAnalytics::Profiling
 	{
 		/**
 		* Create the profiler spy with the given name.
+		* If the profiler is enabled, the beginning of the scope is recorded in the thread event buffer
 		* @param p_name
 		*/
-		ProfilerSpy(const std::string& p_name);
+		ProfilerSpy(const char* p_name);
 
 		/**
 		* Destroy the profiler spy.
-		* On destruction, his collected data will be saved in the profiler
+		* On destruction, the end of the scope is recorded in the thread event buffer
 		*/
 		~ProfilerSpy();
 
-		const	std::string								name;
-		const	std::chrono::steady_clock::time_point	start;
-				std::chrono::steady_clock::time_point	end;
+		ProfilerSpy(const ProfilerSpy&) = delete;
+		ProfilerSpy& operator=(const ProfilerSpy&) = delete;
+
+		ProfilerEventBuffer* buffer = nullptr;
 	};
-}
\ No newline at end of file
+}
+
+inline OvAnalytics::Profiling::ProfilerSpy::ProfilerSpy(const char* p_name)
+{
+	if (Profiler::IsEnabled())
+	{
+		auto& threadBuffer = Profiler::GetThreadBuffer();
+
+		if (threadBuffer.BeginScope(p_name))
+			buffer = &threadBuffer;
+	}
+}
+
+inline OvAnalytics::Profiling::ProfilerSpy::~ProfilerSpy()
+{
+	if (buffer)
+		buffer->EndScope();
+}
@@ -0,0 +1,82 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#pragma once
+
+#include <string>
+#include <fstream>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+#include "OvAnalytics/Profiling/ProfilerFrame.h"
+
+namespace OvAnalytics::Profiling
+{
+	/**
+	* Stream profiler frames to a Chrome Trace Event JSON file (Readable by chrome://tracing, Perfetto...).
+	* Frames are serialized and written by a background thread, so writing a frame never blocks the profiled program
+	*/
+	class ProfilerTraceWriter final
+	{
+	public:
+		/**
+		* Open the given file and start the writing thread
+		* @param p_filePath
+		*/
+		ProfilerTraceWriter(const std::string& p_filePath);
+
+		/**
+		* Wait for every pending frame to be written, then close the file
+		*/
+		~ProfilerTraceWriter();
+
+		/**
+		* Queue the given frame for writing
+		* @param p_frame
+		*/
+		void Write(const ProfilerFrame& p_frame);
+
+		/**
+		* Stop accepting frames. The writing thread completes the file in the background
+		*/
+		void Close();
+
+		/**
+		* Returns true if the file has been opened successfully
+		*/
+		bool IsValid() const;
+
+		/**
+		* Returns the path of the written file
+		*/
+		const std::string& GetFilePath() const;
+
+	private:
+		void Run();
+		void WriteFrame(const ProfilerFrame& p_frame);
+		void BeginEvent();
+		void WriteEventName(const char* p_name);
+		uint32_t GetThreadIndex(std::thread::id p_thread);
+		double ToMicroseconds(int64_t p_time) const;
+
+	private:
+		const std::string m_filePath;
+		std::ofstream m_file;
+
+		std::thread m_thread;
+		std::mutex m_mutex;
+		std::condition_variable m_condition;
+		std::vector<ProfilerFrame> m_pendingFrames;
+		bool m_closed = false;
+
+		/* Writing thread data */
+		int64_t m_origin = 0;
+		uint32_t m_writtenFrames = 0;
+		bool m_firstEvent = true;
+		std::vector<std::thread::id> m_threads;
+	};
+}
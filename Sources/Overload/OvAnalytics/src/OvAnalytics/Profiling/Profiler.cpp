@@ -8,21 +8,48 @@
 #include <iomanip>
 #include <map>
 #include <string>
+#include <algorithm>
 
 #include "OvAnalytics/Profiling/Profiler.h"
 #include "OvAnalytics/Profiling/ProfilerSpy.h"
 
-bool											OvAnalytics::Profiling::Profiler::__ENABLED;
-std::mutex										OvAnalytics::Profiling::Profiler::__SAVE_MUTEX;
-std::unordered_map<std::string, double>			OvAnalytics::Profiling::Profiler::__ELPASED_HISTORY;
-std::unordered_map<std::string, uint64_t>		OvAnalytics::Profiling::Profiler::__CALLS_COUNTER;
-std::vector<std::thread::id>					OvAnalytics::Profiling::Profiler::__WORKING_THREADS;
-uint32_t										OvAnalytics::Profiling::Profiler::__ELAPSED_FRAMES;
+/**
+* Event buffer of a thread, with the scopes the profiler saw begin but not end yet
+*/
+struct OvAnalytics::Profiling::Profiler::ThreadContext
+{
+	struct OpenedScope
+	{
+		const char* name;
+		int64_t start;
+		int32_t frameScope; // Index in the current frame thread scopes, -1 if the scope began in a previous frame
+	};
+
+	ProfilerEventBuffer buffer;
+	std::vector<OpenedScope> openedScopes;
+};
+
+std::atomic<bool>																		OvAnalytics::Profiling::Profiler::__ENABLED = false;
+int64_t																					OvAnalytics::Profiling::Profiler::__CLOCK_ORIGIN_TICKS;
+int64_t																					OvAnalytics::Profiling::Profiler::__CLOCK_ORIGIN_TIME;
+double																					OvAnalytics::Profiling::Profiler::__TICKS_PER_NANOSECOND = 1.0;
+std::mutex																				OvAnalytics::Profiling::Profiler::__THREADS_MUTEX;
+std::vector<std::unique_ptr<OvAnalytics::Profiling::Profiler::ThreadContext>>			OvAnalytics::Profiling::Profiler::__THREADS;
+std::unordered_map<const char*, OvAnalytics::Profiling::Profiler::ActionHistory>		OvAnalytics::Profiling::Profiler::__ACTIONS_HISTORY;
+std::vector<std::thread::id>															OvAnalytics::Profiling::Profiler::__WORKING_THREADS;
+uint32_t																				OvAnalytics::Profiling::Profiler::__ELAPSED_FRAMES;
+uint64_t																				OvAnalytics::Profiling::Profiler::__DROPPED_SCOPES;
+OvAnalytics::Profiling::ProfilerFrame													OvAnalytics::Profiling::Profiler::__LAST_FRAME;
+std::unique_ptr<OvAnalytics::Profiling::ProfilerTraceWriter>							OvAnalytics::Profiling::Profiler::__CAPTURE_WRITER;
+uint32_t																				OvAnalytics::Profiling::Profiler::__CAPTURE_REMAINING_FRAMES;
+bool																					OvAnalytics::Profiling::Profiler::__ENABLED_BEFORE_CAPTURE;
 
 OvAnalytics::Profiling::Profiler::Profiler()
 {
-	m_lastTime = std::chrono::high_resolution_clock::now();
+	m_lastTime = std::chrono::steady_clock::now();
 	__ENABLED = false;
+
+	CalibrateClock();
 }
 
 OvAnalytics::Profiling::ProfilerReport OvAnalytics::Profiling::Profiler::GenerateReport()
@@ -32,75 +59,237 @@ OvAnalytics::Profiling::ProfilerReport OvAnalytics::Profiling::Profiler::Generat
 	if (__ELAPSED_FRAMES == 0)
 		return report;
 
-	std::chrono::duration<double> elapsed = std::chrono::high_resolution_clock::now() - m_lastTime;
+	std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - m_lastTime;
 
-	report.workingThreads = static_cast<uint16_t>((__WORKING_THREADS.size() - 1) / __ELAPSED_FRAMES);
+	report.workingThreads = static_cast<uint16_t>(__WORKING_THREADS.size());
 	report.elapsedFrames = __ELAPSED_FRAMES;
 	report.elaspedTime = elapsed.count();
+	report.droppedScopes = __DROPPED_SCOPES;
 
-	std::multimap<double, std::string, std::greater<double>> sortedHistory;
+	/* The same name can be used by different spies (Different string addresses), so actions are merged by name */
+	std::unordered_map<std::string, ActionHistory> mergedHistory;
+
+	for (auto& [name, history] : __ACTIONS_HISTORY)
+	{
+		auto& merged = mergedHistory[name];
+		merged.duration += history.duration;
+		merged.calls += history.calls;
+	}
+
+	std::multimap<double, std::pair<std::string, uint64_t>, std::greater<double>> sortedHistory;
 
 	/* Fill the sorted history with the current history (Auto sort) */
-	for (auto& data : __ELPASED_HISTORY)
-		sortedHistory.insert(std::pair<double, std::string>(data.second, data.first));
+	for (auto& [name, history] : mergedHistory)
+		sortedHistory.insert({ history.duration, { name, history.calls } });
 
 	/* Add every actions to the report */
 	for (auto& data : sortedHistory)
-		report.actions.push_back({ data.second, data.first, (data.first / elapsed.count()) * 100.0, __CALLS_COUNTER[data.second] });
+		report.actions.push_back({ data.second.first, data.first, (data.first / elapsed.count()) * 100.0, data.second.second });
 
 	return report;
 }
 
 void OvAnalytics::Profiling::Profiler::ClearHistory()
 {
-	__ELPASED_HISTORY.clear();
-	__CALLS_COUNTER.clear();
+	/* Events recorded before the clear are dropped, but their scopes are still tracked so the following ones stay paired */
+	CollectEvents(false);
+
+	__ACTIONS_HISTORY.clear();
 	__WORKING_THREADS.clear();
 	__ELAPSED_FRAMES = 0;
+	__DROPPED_SCOPES = 0;
 
-	m_lastTime = std::chrono::high_resolution_clock::now();
+	m_lastTime = std::chrono::steady_clock::now();
 }
 
-void OvAnalytics::Profiling::Profiler::Update(float p_deltaTime)
+void OvAnalytics::Profiling::Profiler::Update()
 {
 	if (IsEnabled())
 	{
 		++__ELAPSED_FRAMES;
 	}
+
+	CollectEvents(true);
+
+	if (__CAPTURE_REMAINING_FRAMES > 0)
+	{
+		__CAPTURE_WRITER->Write(__LAST_FRAME);
+
+		if (--__CAPTURE_REMAINING_FRAMES == 0)
+		{
+			/* The writer completes the file in the background, it is released by the next capture */
+			__CAPTURE_WRITER->Close();
+			__ENABLED = __ENABLED_BEFORE_CAPTURE;
+		}
+	}
 }
 
-void OvAnalytics::Profiling::Profiler::Save(OvAnalytics::Profiling::ProfilerSpy& p_spy)
+const OvAnalytics::Profiling::ProfilerFrame& OvAnalytics::Profiling::Profiler::GetLastFrame() const
 {
-	__SAVE_MUTEX.lock();
+	return __LAST_FRAME;
+}
+
+bool OvAnalytics::Profiling::Profiler::StartCapture(const std::string& p_filePath, uint32_t p_frameCount)
+{
+	if (p_frameCount == 0)
+		return false;
 
-	/* Check if this thread is already registered */
-	if (std::find(__WORKING_THREADS.begin(), __WORKING_THREADS.end(), std::this_thread::get_id()) == __WORKING_THREADS.end())
-		__WORKING_THREADS.push_back(std::this_thread::get_id());
+	/* Waits for the previous capture to be written, if any */
+	__CAPTURE_WRITER = std::make_unique<ProfilerTraceWriter>(p_filePath);
 
-	if (__ELPASED_HISTORY.find(p_spy.name) != __ELPASED_HISTORY.end())
+	if (!__CAPTURE_WRITER->IsValid())
 	{
-		__ELPASED_HISTORY[p_spy.name] += std::chrono::duration<double>(p_spy.end - p_spy.start).count();
+		__CAPTURE_WRITER.reset();
+
+		if (__CAPTURE_REMAINING_FRAMES > 0)
+		{
+			__CAPTURE_REMAINING_FRAMES = 0;
+			__ENABLED = __ENABLED_BEFORE_CAPTURE;
+		}
+
+		return false;
 	}
-	else
+
+	if (__CAPTURE_REMAINING_FRAMES == 0)
+		__ENABLED_BEFORE_CAPTURE = IsEnabled();
+
+	__CAPTURE_REMAINING_FRAMES = p_frameCount;
+	__ENABLED = true;
+
+	/* Discard the events recorded before the capture, so the first captured frame starts now */
+	CollectEvents(false);
+
+	return true;
+}
+
+bool OvAnalytics::Profiling::Profiler::IsCapturing()
+{
+	return __CAPTURE_REMAINING_FRAMES > 0;
+}
+
+OvAnalytics::Profiling::ProfilerEventBuffer& OvAnalytics::Profiling::Profiler::GetThreadBuffer()
+{
+	/* Contexts are never released, so a thread buffer stays valid until every event has been collected */
+	thread_local ProfilerEventBuffer* threadBuffer = nullptr;
+
+	if (!threadBuffer)
 	{
-		__ELPASED_HISTORY[p_spy.name] = std::chrono::duration<double>(p_spy.end - p_spy.start).count();
+		std::lock_guard<std::mutex> lock(__THREADS_MUTEX);
+		__THREADS.push_back(std::make_unique<ThreadContext>());
+		threadBuffer = &__THREADS.back()->buffer;
 	}
 
-	if (__CALLS_COUNTER.find(p_spy.name) != __CALLS_COUNTER.end())
+	return *threadBuffer;
+}
+
+void OvAnalytics::Profiling::Profiler::CollectEvents(bool p_record)
+{
+	static std::vector<ProfilerEvent> events;
+
+	std::lock_guard<std::mutex> lock(__THREADS_MUTEX);
+
+	CalibrateClock();
+
+	const int64_t now = ToNanoseconds(ProfilerEventBuffer::GetTimestamp());
+
+	__LAST_FRAME.start = __LAST_FRAME.end;
+	__LAST_FRAME.end = now;
+
+	if (p_record)
+		__LAST_FRAME.threads.resize(__THREADS.size());
+	else
+		__LAST_FRAME.threads.clear();
+
+	for (size_t i = 0; i < __THREADS.size(); ++i)
 	{
-		++__CALLS_COUNTER[p_spy.name];
+		auto& context = *__THREADS[i];
+
+		events.clear();
+		context.buffer.Consume(events);
+
+		for (auto& openedScope : context.openedScopes)
+			openedScope.frameScope = -1;
+
+		if (!p_record)
+		{
+			/* Only keep track of the scopes nesting */
+			for (const auto& event : events)
+			{
+				if (event.name)
+					context.openedScopes.push_back({ event.name, ToNanoseconds(event.timestamp), -1 });
+				else if (!context.openedScopes.empty())
+					context.openedScopes.pop_back();
+			}
+
+			context.buffer.ConsumeDroppedScopes();
+			continue;
+		}
+
+		auto& thread = __LAST_FRAME.threads[i];
+		thread.id = context.buffer.GetThreadID();
+		thread.scopes.clear();
+
+		for (const auto& event : events)
+		{
+			const int64_t timestamp = ToNanoseconds(event.timestamp);
+
+			if (event.name)
+			{
+				const int32_t parent = context.openedScopes.empty() ? -1 : context.openedScopes.back().frameScope;
+				const uint32_t depth = static_cast<uint32_t>(context.openedScopes.size());
+
+				context.openedScopes.push_back({ event.name, timestamp, static_cast<int32_t>(thread.scopes.size()) });
+				thread.scopes.push_back({ event.name, timestamp, now, depth, parent });
+			}
+			else if (!context.openedScopes.empty())
+			{
+				const auto openedScope = context.openedScopes.back();
+				context.openedScopes.pop_back();
+
+				auto& history = __ACTIONS_HISTORY[openedScope.name];
+				history.duration += static_cast<double>(timestamp - openedScope.start) * 1e-9;
+				++history.calls;
+
+				if (openedScope.frameScope != -1)
+					thread.scopes[openedScope.frameScope].end = timestamp;
+			}
+		}
+
+		__DROPPED_SCOPES += context.buffer.ConsumeDroppedScopes();
+
+		if (!events.empty() && std::find(__WORKING_THREADS.begin(), __WORKING_THREADS.end(), thread.id) == __WORKING_THREADS.end())
+			__WORKING_THREADS.push_back(thread.id);
 	}
-	else
+}
+
+void OvAnalytics::Profiling::Profiler::CalibrateClock()
+{
+	const auto getTime = []
+	{
+		return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+	};
+
+	if (__CLOCK_ORIGIN_TIME == 0)
 	{
-		__CALLS_COUNTER[p_spy.name] = 1;
+		__CLOCK_ORIGIN_TICKS = ProfilerEventBuffer::GetTimestamp();
+		__CLOCK_ORIGIN_TIME = getTime();
+
+		#ifdef OV_PROFILER_USE_TSC
+		/* Wait a bit to get a first estimation of the frequency, it is then refined on every collection */
+		while (getTime() - __CLOCK_ORIGIN_TIME < 2000000);
+		#endif
 	}
 
-	__SAVE_MUTEX.unlock();
+	const int64_t ticks = ProfilerEventBuffer::GetTimestamp();
+	const int64_t time = getTime();
+
+	if (time > __CLOCK_ORIGIN_TIME)
+		__TICKS_PER_NANOSECOND = static_cast<double>(ticks - __CLOCK_ORIGIN_TICKS) / static_cast<double>(time - __CLOCK_ORIGIN_TIME);
 }
 
-bool OvAnalytics::Profiling::Profiler::IsEnabled()
+int64_t OvAnalytics::Profiling::Profiler::ToNanoseconds(int64_t p_ticks)
 {
-	return __ENABLED;
+	return __CLOCK_ORIGIN_TIME + static_cast<int64_t>(static_cast<double>(p_ticks - __CLOCK_ORIGIN_TICKS) / __TICKS_PER_NANOSECOND);
 }
 
 void OvAnalytics::Profiling::Profiler::ToggleEnable()
@@ -116,4 +305,4 @@ void OvAnalytics::Profiling::Profiler::Enable()
 void OvAnalytics::Profiling::Profiler::Disable()
 {
 	__ENABLED = false;
-}
\ No newline at end of file
+}
@@ -0,0 +1,33 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#include "OvAnalytics/Profiling/ProfilerEventBuffer.h"
+
+OvAnalytics::Profiling::ProfilerEventBuffer::ProfilerEventBuffer() :
+	m_threadID(std::this_thread::get_id())
+{
+}
+
+void OvAnalytics::Profiling::ProfilerEventBuffer::Consume(std::vector<ProfilerEvent>& p_events)
+{
+	const uint32_t readIndex = m_readIndex.load(std::memory_order_relaxed);
+	const uint32_t writeIndex = m_writeIndex.load(std::memory_order_acquire);
+
+	for (uint32_t i = readIndex; i != writeIndex; ++i)
+		p_events.push_back(m_events[i & (Capacity - 1)]);
+
+	m_readIndex.store(writeIndex, std::memory_order_release);
+}
+
+uint32_t OvAnalytics::Profiling::ProfilerEventBuffer::ConsumeDroppedScopes()
+{
+	return m_droppedScopes.exchange(0, std::memory_order_relaxed);
+}
+
+std::thread::id OvAnalytics::Profiling::ProfilerEventBuffer::GetThreadID() const
+{
+	return m_threadID;
+}
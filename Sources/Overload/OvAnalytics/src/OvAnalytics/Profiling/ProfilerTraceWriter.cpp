@@ -0,0 +1,185 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#include <algorithm>
+#include <cstdio>
+
+#include "OvAnalytics/Profiling/ProfilerTraceWriter.h"
+
+OvAnalytics::Profiling::ProfilerTraceWriter::ProfilerTraceWriter(const std::string& p_filePath) :
+	m_filePath(p_filePath),
+	m_file(p_filePath, std::ios::out | std::ios::trunc)
+{
+	if (m_file.is_open())
+	{
+		m_file << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+		m_thread = std::thread(&ProfilerTraceWriter::Run, this);
+	}
+}
+
+OvAnalytics::Profiling::ProfilerTraceWriter::~ProfilerTraceWriter()
+{
+	Close();
+
+	if (m_thread.joinable())
+		m_thread.join();
+}
+
+void OvAnalytics::Profiling::ProfilerTraceWriter::Write(const ProfilerFrame& p_frame)
+{
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+
+		if (m_closed || !m_file.is_open())
+			return;
+
+		m_pendingFrames.push_back(p_frame);
+	}
+
+	m_condition.notify_one();
+}
+
+void OvAnalytics::Profiling::ProfilerTraceWriter::Close()
+{
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_closed = true;
+	}
+
+	m_condition.notify_one();
+}
+
+bool OvAnalytics::Profiling::ProfilerTraceWriter::IsValid() const
+{
+	return m_file.is_open();
+}
+
+const std::string& OvAnalytics::Profiling::ProfilerTraceWriter::GetFilePath() const
+{
+	return m_filePath;
+}
+
+void OvAnalytics::Profiling::ProfilerTraceWriter::Run()
+{
+	std::vector<ProfilerFrame> frames;
+
+	while (true)
+	{
+		bool closed;
+
+		{
+			std::unique_lock<std::mutex> lock(m_mutex);
+			m_condition.wait(lock, [this] { return m_closed || !m_pendingFrames.empty(); });
+			frames.swap(m_pendingFrames);
+			closed = m_closed;
+		}
+
+		for (const auto& frame : frames)
+			WriteFrame(frame);
+
+		frames.clear();
+
+		if (closed)
+			break;
+	}
+
+	m_file << "]}";
+	m_file.close();
+}
+
+void OvAnalytics::Profiling::ProfilerTraceWriter::WriteFrame(const ProfilerFrame& p_frame)
+{
+	if (m_writtenFrames == 0)
+		m_origin = p_frame.start;
+
+	char timeBuffer[64];
+
+	const auto writeTime = [this, &timeBuffer](const char* p_key, double p_microseconds)
+	{
+		std::snprintf(timeBuffer, sizeof(timeBuffer), ",\"%s\":%.3f", p_key, p_microseconds);
+		m_file << timeBuffer;
+	};
+
+	/* Frame boundaries are written as a global instant event */
+	BeginEvent();
+	m_file << "\"name\":\"Frame " << m_writtenFrames << "\",\"ph\":\"i\",\"s\":\"g\",\"pid\":1,\"tid\":0";
+	writeTime("ts", ToMicroseconds(p_frame.start));
+	m_file << '}';
+
+	for (const auto& thread : p_frame.threads)
+	{
+		if (thread.scopes.empty())
+			continue;
+
+		const uint32_t threadIndex = GetThreadIndex(thread.id);
+
+		for (const auto& scope : thread.scopes)
+		{
+			BeginEvent();
+			m_file << "\"name\":";
+			WriteEventName(scope.name);
+			m_file << ",\"cat\":\"Overload\",\"ph\":\"X\",\"pid\":1,\"tid\":" << threadIndex;
+			writeTime("ts", ToMicroseconds(scope.start));
+			writeTime("dur", static_cast<double>(scope.end - scope.start) * 1e-3);
+			m_file << '}';
+		}
+	}
+
+	++m_writtenFrames;
+}
+
+void OvAnalytics::Profiling::ProfilerTraceWriter::BeginEvent()
+{
+	if (!m_firstEvent)
+		m_file << ',';
+
+	m_firstEvent = false;
+	m_file << "\n{";
+}
+
+void OvAnalytics::Profiling::ProfilerTraceWriter::WriteEventName(const char* p_name)
+{
+	m_file << '"';
+
+	for (const char* character = p_name; *character; ++character)
+	{
+		switch (*character)
+		{
+		case '"':	m_file << "\\\"";	break;
+		case '\\':	m_file << "\\\\";	break;
+		case '\n':	m_file << "\\n";	break;
+		case '\t':	m_file << "\\t";	break;
+		default:
+			if (static_cast<unsigned char>(*character) >= 0x20)
+				m_file << *character;
+			break;
+		}
+	}
+
+	m_file << '"';
+}
+
+uint32_t OvAnalytics::Profiling::ProfilerTraceWriter::GetThreadIndex(std::thread::id p_thread)
+{
+	auto found = std::find(m_threads.begin(), m_threads.end(), p_thread);
+
+	if (found != m_threads.end())
+		return static_cast<uint32_t>(std::distance(m_threads.begin(), found)) + 1;
+
+	m_threads.push_back(p_thread);
+	const uint32_t threadIndex = static_cast<uint32_t>(m_threads.size());
+
+	/* Name the thread the first time it appears, trace viewers display it instead of its index */
+	BeginEvent();
+	m_file << "\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << threadIndex << ",\"args\":{\"name\":\"Thread " << threadIndex << "\"}}";
+
+	return threadIndex;
+}
+
+double OvAnalytics::Profiling::ProfilerTraceWriter::ToMicroseconds(int64_t p_time) const
+{
+	return static_cast<double>(p_time - m_origin) * 1e-3;
+}
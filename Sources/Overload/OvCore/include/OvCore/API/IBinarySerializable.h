@@ -0,0 +1,38 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#pragma once
+
+#include "OvCore/Helpers/BinaryWriter.h"
+#include "OvCore/Helpers/BinaryReader.h"
+
+namespace OvCore::API
+{
+	/**
+	* IBinarySerializable is an interface for any class that can be serialized to the binary scene format.
+	* Values must be read in the order they are written. Values appended by a newer version are read as defaults from older files
+	*/
+	class IBinarySerializable
+	{
+	public:
+		/**
+		* Called when the binary serialization is asked
+		* @param p_writer
+		*/
+		virtual void OnBinarySerialize(Helpers::BinaryWriter& p_writer) = 0;
+
+		/**
+		* Called when the binary deserialization is asked
+		* @param p_reader
+		*/
+		virtual void OnBinaryDeserialize(Helpers::BinaryReader& p_reader) = 0;
+
+		/**
+		* Default polymorphic destructor
+		*/
+		virtual ~IBinarySerializable() = default;
+	};
+}
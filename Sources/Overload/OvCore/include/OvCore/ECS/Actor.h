@@ -6,8 +6,10 @@
 
 #pragma once
 
+#include <string_view>
 #include <unordered_map>
 #include <memory>
+#include <atomic>
 
 #include <OvTools/Eventing/Event.h>
 
@@ -15,6 +17,7 @@
 #include "OvCore/ECS/Components/CTransform.h"
 #include "OvCore/ECS/Components/Behaviour.h"
 #include "OvCore/API/ISerializable.h"
+#include "OvCore/API/IBinarySerializable.h"
 
 namespace OvCore::ECS
 {
@@ -22,7 +25,7 @@ namespace OvCore::ECS
 	* The Actor is the main class of the ECS, it corresponds to the entity and is
 	* composed of componenents and behaviours (scripts)
 	*/
-	class Actor : public API::ISerializable
+	class Actor : public API::ISerializable, public API::IBinarySerializable
 	{
 	public:
 		/**
@@ -74,7 +77,8 @@ namespace OvCore::ECS
 		bool IsSelfActive() const;
 
 		/**
-		* Returns true if the actor is and his recursive parents (if any) are active
+		* Returns true if the actor is and his recursive parents (if any) are active.
+		* The hierarchical state is cached, and refreshed when the actor or one of its parents gets enabled, disabled, attached or detached
 		*/
 		bool IsActive() const;
 
@@ -255,7 +259,9 @@ namespace OvCore::ECS
 		bool RemoveComponent(OvCore::ECS::Components::AComponent& p_component);
 
 		/**
-		* Try to get the given component (Returns nullptr on failure)
+		* Try to get the given component (Returns nullptr on failure). T can be a base class of the component (CLight for instance).
+		* The result is cached per component type until the components of the actor change, so repeated calls are constant-time.
+		* Calls can be concurrent, but not with calls adding or removing components
 		*/
 		template<typename T>
 		T* GetComponent();
@@ -304,6 +310,18 @@ namespace OvCore::ECS
 		*/
 		virtual void OnDeserialize(tinyxml2::XMLDocument& p_doc, tinyxml2::XMLNode* p_actorsRoot) override;
 
+		/**
+		* Serialize the actor settings, then each component and behaviour in its own block
+		* @param p_writer
+		*/
+		virtual void OnBinarySerialize(Helpers::BinaryWriter& p_writer) override;
+
+		/**
+		* Deserialize the actor settings, components and behaviours. Blocks of unknown component types are skipped
+		* @param p_reader
+		*/
+		virtual void OnBinaryDeserialize(Helpers::BinaryReader& p_reader) override;
+
 	private:
 		/**
 		 * @brief Deleted copy constructor
@@ -314,12 +332,32 @@ namespace OvCore::ECS
 		void RecursiveActiveUpdate();
 		void RecursiveWasActiveUpdate();
 
+		/**
+		* Refresh the cached hierarchical active state of the actor, and of its children if it changed
+		*/
+		void RecursiveHierarchyActiveUpdate();
+
+		/**
+		* Apply deserialized settings. Name, tag and ID go through their setters, so the scene indexes follow them
+		*/
+		void ApplySettings(const std::string& p_name, const std::string& p_tag, bool p_active, int64_t p_actorID, int64_t p_parentID);
+
+		/**
+		* Add a component of the given type (Serialized type name), or return the transform. Returns nullptr for unknown types
+		* @param p_type
+		*/
+		Components::AComponent* AddComponentByType(std::string_view p_type);
+
 	public:
 		/* Some events that are triggered when an action occur on the actor instance */
 		OvTools::Eventing::Event<Components::AComponent&>	ComponentAddedEvent;
 		OvTools::Eventing::Event<Components::AComponent&>	ComponentRemovedEvent;
 		OvTools::Eventing::Event<Components::Behaviour&>	BehaviourAddedEvent;
 		OvTools::Eventing::Event<Components::Behaviour&>	BehaviourRemovedEvent;
+		OvTools::Eventing::Event<Actor&>					ActiveStateChangedEvent; // Hierarchical active state (See IsActive)
+		OvTools::Eventing::Event<Actor&, const std::string&>	NameChangedEvent; // Gives the previous name
+		OvTools::Eventing::Event<Actor&, const std::string&>	TagChangedEvent; // Gives the previous tag
+		OvTools::Eventing::Event<Actor&, int64_t>			IDChangedEvent; // Gives the previous ID
 
 		/* Some events that are triggered when an action occur on any actor */
 		static OvTools::Eventing::Event<Actor&>				DestroyedEvent;
@@ -327,6 +365,21 @@ namespace OvCore::ECS
 		static OvTools::Eventing::Event<Actor&, Actor&>		AttachEvent;
 		static OvTools::Eventing::Event<Actor&>				DettachEvent;
 
+	private:
+		/**
+		* Returns the ID of the given component type (IDs are given in order of first use)
+		*/
+		template<typename T>
+		static uint32_t GetComponentTypeID();
+
+		/**
+		* Scans the components for the given type, without using the lookup
+		*/
+		template<typename T>
+		T* FindComponent() const;
+
+		void InvalidateComponentLookup();
+
 	private:
 		/* Settings */
 		std::string		m_name;
@@ -341,6 +394,7 @@ namespace OvCore::ECS
 		bool	m_awaked = false;
 		bool	m_started = false;
 		bool	m_wasActive = false;
+		bool	m_hierarchyActive = true;
 
 		/* Parenting system stuff */
 		int64_t					m_parentID = 0;
@@ -351,6 +405,15 @@ namespace OvCore::ECS
 		std::vector<std::shared_ptr<Components::AComponent>> m_components;
 		std::unordered_map<std::string, Components::Behaviour> m_behaviours;
 
+		/*
+		* Results of GetComponent, indexed by component type ID and pointing to the queried type (Not to AComponent).
+		* Sized and reset when components are added or removed, so queries only fill unresolved slots and can run concurrently
+		*/
+		std::unique_ptr<std::atomic<void*>[]> m_componentLookup;
+		uint32_t m_componentLookupSize = 0;
+		static std::atomic<uint32_t> __COMPONENT_TYPE_COUNT;
+		static char __UNRESOLVED_COMPONENT; // Its address marks the slots not resolved yet
+
 	public:
 		Components::CTransform& transform;
 	};
@@ -7,6 +7,8 @@
 #pragma once
 
 #include "OvCore/ECS/Actor.h"
+#include "OvCore/ECS/ComponentPool.h"
+#include "OvCore/ECS/UpdateSystem.h"
 
 namespace OvCore::ECS
 {
@@ -17,8 +19,17 @@ namespace OvCore::ECS
 
 		if (auto found = GetComponent<T>(); !found)
 		{
-			m_components.insert(m_components.begin(), std::make_shared<T>(*this, p_args...));
-			T& instance = *dynamic_cast<T*>(m_components.front().get());
+			std::shared_ptr<T> component;
+
+			if constexpr (UsesPooledStorage<T>::value)
+				component = std::allocate_shared<T>(ComponentAllocator<T>(), *this, p_args...);
+			else
+				component = std::make_shared<T>(*this, p_args...);
+
+			T& instance = *component;
+			UpdateSystem::DescribeComponent<T>(instance);
+			m_components.insert(m_components.begin(), std::move(component));
+			InvalidateComponentLookup();
 			ComponentAddedEvent.Invoke(instance);
 			if (m_playing && IsActive())
 			{
@@ -40,18 +51,8 @@ namespace OvCore::ECS
 		static_assert(std::is_base_of<Components::AComponent, T>::value, "T should derive from AComponent");
 		static_assert(!std::is_same<Components::CTransform, T>::value, "You can't remove a CTransform from an actor");
 
-		std::shared_ptr<T> result(nullptr);
-
-		for (auto it = m_components.begin(); it != m_components.end(); ++it)
-		{
-			result = std::dynamic_pointer_cast<T>(*it);
-			if (result)
-			{
-				ComponentRemovedEvent.Invoke(*result.get());
-				m_components.erase(it);
-				return true;
-			}
-		}
+		if (auto found = GetComponent<T>())
+			return RemoveComponent(*found);
 
 		return false;
 	}
@@ -61,15 +62,40 @@ namespace OvCore::ECS
 	{
 		static_assert(std::is_base_of<Components::AComponent, T>::value, "T should derive from AComponent");
 
-		std::shared_ptr<T> result(nullptr);
+		const uint32_t typeID = GetComponentTypeID<T>();
+
+		/* Types first queried after the components last changed have no slot yet */
+		if (typeID >= m_componentLookupSize)
+			return FindComponent<T>();
+
+		std::atomic<void*>& lookup = m_componentLookup[typeID];
+		void* component = lookup.load(std::memory_order_acquire);
 
-		for (auto it = m_components.begin(); it != m_components.end(); ++it)
+		/* Queries resolving the same slot concurrently all store the same result */
+		if (component == &__UNRESOLVED_COMPONENT)
 		{
-			result = std::dynamic_pointer_cast<T>(*it);
-			if (result)
-			{
-				return result.get();
-			}
+			component = FindComponent<T>();
+			lookup.store(component, std::memory_order_release);
+		}
+
+		return static_cast<T*>(component);
+	}
+
+	template<typename T>
+	inline uint32_t Actor::GetComponentTypeID()
+	{
+		static const uint32_t typeID = __COMPONENT_TYPE_COUNT++;
+		return typeID;
+	}
+
+	template<typename T>
+	inline T* Actor::FindComponent() const
+	{
+		/* A single scan, which also resolves queries by base class */
+		for (auto& component : m_components)
+		{
+			if (T* result = dynamic_cast<T*>(component.get()))
+				return result;
 		}
 
 		return nullptr;
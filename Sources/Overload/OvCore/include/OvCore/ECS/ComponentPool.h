@@ -0,0 +1,89 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+namespace OvCore::ECS
+{
+	/**
+	* Chunked storage of fixed-size slots for objects of type T. Slots are stored contiguously by chunks, never move
+	* (Pointers to pooled objects stay valid), and freed slots are reused before new chunks get allocated.
+	* Chunks are only released on exit. Not thread-safe: components are created and destroyed on the main thread
+	*/
+	template<typename T>
+	class ComponentPool
+	{
+	public:
+		/**
+		* Disabled constructor
+		*/
+		ComponentPool() = delete;
+
+		/**
+		* Returns uninitialized memory for one T
+		*/
+		static T* Allocate();
+
+		/**
+		* Give back memory returned by Allocate (The object must be destroyed already)
+		* @param p_object
+		*/
+		static void Deallocate(T* p_object);
+
+	private:
+		union Slot
+		{
+			Slot* next;
+			alignas(T) unsigned char storage[sizeof(T)];
+		};
+
+		static constexpr size_t kChunkSize = 256;
+
+		static std::vector<std::unique_ptr<Slot[]>>	__CHUNKS;
+		static Slot*								__FREE_SLOTS;
+	};
+
+	/**
+	* Standard allocator drawing from a ComponentPool. Given to std::allocate_shared, the control block and the component
+	* end up in the same pooled slot, so components of a same type are packed together in memory
+	*/
+	template<typename T>
+	class ComponentAllocator
+	{
+	public:
+		using value_type = T;
+
+		ComponentAllocator() = default;
+
+		template<typename U>
+		ComponentAllocator(const ComponentAllocator<U>&) {}
+
+		T* allocate(size_t p_count);
+		void deallocate(T* p_pointer, size_t p_count);
+
+		template<typename U>
+		bool operator==(const ComponentAllocator<U>&) const { return true; }
+
+		template<typename U>
+		bool operator!=(const ComponentAllocator<U>&) const { return false; }
+	};
+
+	/**
+	* Tells if the component type T opted in for pooled storage, by declaring "static constexpr bool kPooledStorage = true"
+	*/
+	template<typename T, typename = void>
+	struct UsesPooledStorage : std::false_type {};
+
+	template<typename T>
+	struct UsesPooledStorage<T, std::void_t<decltype(T::kPooledStorage)>> : std::bool_constant<T::kPooledStorage> {};
+}
+
+#include "OvCore/ECS/ComponentPool.inl"
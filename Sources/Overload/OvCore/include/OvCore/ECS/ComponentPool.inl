@@ -0,0 +1,65 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#pragma once
+
+#include "OvCore/ECS/ComponentPool.h"
+
+namespace OvCore::ECS
+{
+	template<typename T>
+	std::vector<std::unique_ptr<typename ComponentPool<T>::Slot[]>> ComponentPool<T>::__CHUNKS;
+
+	template<typename T>
+	typename ComponentPool<T>::Slot* ComponentPool<T>::__FREE_SLOTS = nullptr;
+
+	template<typename T>
+	inline T* ComponentPool<T>::Allocate()
+	{
+		if (!__FREE_SLOTS)
+		{
+			__CHUNKS.push_back(std::make_unique<Slot[]>(kChunkSize));
+			Slot* chunk = __CHUNKS.back().get();
+
+			/* Slots are linked in address order, so consecutive allocations are contiguous */
+			for (size_t i = 0; i < kChunkSize - 1; ++i)
+				chunk[i].next = &chunk[i + 1];
+
+			chunk[kChunkSize - 1].next = nullptr;
+			__FREE_SLOTS = chunk;
+		}
+
+		Slot* slot = __FREE_SLOTS;
+		__FREE_SLOTS = slot->next;
+		return reinterpret_cast<T*>(slot->storage);
+	}
+
+	template<typename T>
+	inline void ComponentPool<T>::Deallocate(T* p_object)
+	{
+		Slot* slot = reinterpret_cast<Slot*>(p_object);
+		slot->next = __FREE_SLOTS;
+		__FREE_SLOTS = slot;
+	}
+
+	template<typename T>
+	inline T* ComponentAllocator<T>::allocate(size_t p_count)
+	{
+		if (p_count == 1)
+			return ComponentPool<T>::Allocate();
+
+		return std::allocator<T>().allocate(p_count);
+	}
+
+	template<typename T>
+	inline void ComponentAllocator<T>::deallocate(T* p_pointer, size_t p_count)
+	{
+		if (p_count == 1)
+			ComponentPool<T>::Deallocate(p_pointer);
+		else
+			std::allocator<T>().deallocate(p_pointer, p_count);
+	}
+}
@@ -6,9 +6,12 @@
 
 #pragma once
 
+#include <cstdint>
+
 #include "OvCore/API/IInspectorItem.h"
+#include "OvCore/API/IBinarySerializable.h"
 
-namespace OvCore::ECS { class Actor; }
+namespace OvCore::ECS { class Actor; class UpdateSystem; }
 
 namespace OvCore::ECS::Components
 {
@@ -18,7 +21,7 @@ namespace OvCore::ECS::Components
 	* AComponent is the base class for any component.
 	* A component is a set of data and behaviours (Entity-Component without systems) that is interpreted by the engine (Or the user)
 	*/
-	class AComponent : public API::IInspectorItem
+	class AComponent : public API::IInspectorItem, public API::IBinarySerializable
 	{
 	public:
 		/**
@@ -120,5 +123,12 @@ namespace OvCore::ECS::Components
 
 	public:
 		ECS::Actor& owner;
+
+	private:
+		friend class ECS::UpdateSystem;
+
+		/* Update phases implemented by the component (Every phase unless described), and its slots in the update lists */
+		uint8_t		m_updateFlags = 0b111;
+		uint32_t	m_updateSlots[3] = {};
 	};
 }
\ No newline at end of file
@@ -54,6 +54,18 @@ namespace OvCore::ECS::Components
 		*/
 		virtual void OnDeserialize(tinyxml2::XMLDocument& p_doc, tinyxml2::XMLNode* p_node) override;
 
+		/**
+		* Serialize the component to the binary scene format
+		* @param p_writer
+		*/
+		virtual void OnBinarySerialize(OvCore::Helpers::BinaryWriter& p_writer) override;
+
+		/**
+		* Deserialize the component from the binary scene format
+		* @param p_reader
+		*/
+		virtual void OnBinaryDeserialize(OvCore::Helpers::BinaryReader& p_reader) override;
+
 		/**
 		* Defines how the component should be drawn in the inspector
 		* @param p_root
@@ -3,6 +3,7 @@
 #include "AComponent.h"
 #include "OvRendering/Resources/Mesh.h"
 #include <OvRendering/Resources/ModelHierarchy.h>
+#include <OvRendering/Resources/Model.h>
 
 namespace OvRendering::Resources 
 {
@@ -21,6 +22,23 @@ namespace OvCore::ECS::Components
 		//const OvRendering::Resources::Animation* m_pAnim;
 		float m_samplePos = 0;
 		OvRendering::Resources::MeshBones m_meshBones;
+
+		/* Hierarchy the play controllers were created for (They are recreated if the model changes) */
+		const OvRendering::Resources::ModelHierarchy* m_playCtrlsHierarchy = nullptr;
+
+		/* Skinning matrices of every skinned mesh of the model, evaluated by UpdatePose() */
+		struct RigPalette
+		{
+			const OvRendering::Resources::MeshRigInfo* rig;
+			size_t offset;
+		};
+
+		std::vector<RigPalette> m_rigPalettes;
+		std::vector<OvMaths::FMatrix4> m_bonePalettes;
+
+		void ClearPlayCtrls();
+		void AllocateBonePalettes(const OvRendering::Resources::Model& p_model);
+		void EvaluateBonePalettes();
 	public:
 		OvRendering::Resources::ModelHierarchy* GetModelHierarchy();
 		std::vector<OvRendering::Resources::AnimationPlayCtrl> playCtrls;
@@ -33,14 +51,46 @@ namespace OvCore::ECS::Components
 		/**
 		* Destructor
 		*/
-		~CAnimation() = default;
+		~CAnimation();
 		bool isPlaying = false;
 		bool isPaused = false;
 
+		/**
+		* Returns the play controllers of the actor model, creating them for its first animation if needed.
+		* Returns nullptr if the model has no animation. Only touches this component, so it can be called from gathering jobs
+		*/
+		std::vector<OvRendering::Resources::AnimationPlayCtrl>* GetPlayCtrls();
+
+		/**
+		* Advance the animation time, evaluate the pose of the whole hierarchy and write the bone palettes of every
+		* skinned mesh of the actor. Called once per frame by the scene animation stage, which may run it on a worker thread
+		* @param p_deltaTime
+		*/
+		void UpdatePose(float p_deltaTime);
+
+		/**
+		* Write the skinning matrices of the given mesh rig for the current pose (Copied from the palettes evaluated by UpdatePose())
+		* @param p_rig
+		* @param p_transforms (Must hold p_rig.m_boneInfos.size() matrices)
+		*/
+		void GetBonePalette(const OvRendering::Resources::MeshRigInfo& p_rig, OvMaths::FMatrix4* p_transforms) const;
+
 		const OvRendering::Resources::MeshBones* GetBones();
 		virtual std::string GetName() override;
 		virtual void OnSerialize(tinyxml2::XMLDocument& p_doc, tinyxml2::XMLNode* p_node) override;
 		virtual void OnDeserialize(tinyxml2::XMLDocument& p_doc, tinyxml2::XMLNode* p_node) override;
+
+		/**
+		* Serialize the component to the binary scene format
+		* @param p_writer
+		*/
+		virtual void OnBinarySerialize(OvCore::Helpers::BinaryWriter& p_writer) override;
+
+		/**
+		* Deserialize the component from the binary scene format
+		* @param p_reader
+		*/
+		virtual void OnBinaryDeserialize(OvCore::Helpers::BinaryReader& p_reader) override;
 		virtual void OnInspector(OvUI::Internal::WidgetContainer& p_root) override;
 	};
 }
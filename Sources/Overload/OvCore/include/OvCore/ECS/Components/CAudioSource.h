@@ -10,6 +10,7 @@
 #include <OvTools/Eventing/Event.h>
 
 #include "OvCore/ECS/Components/AComponent.h"
+#include "OvCore/ResourceManagement/ResourceHandle.h"
 
 namespace OvCore::ECS { class Actor; }
 
@@ -158,6 +159,18 @@ namespace OvCore::ECS::Components
 		*/
 		virtual void OnDeserialize(tinyxml2::XMLDocument& p_doc, tinyxml2::XMLNode* p_node) override;
 
+		/**
+		* Serialize the component to the binary scene format
+		* @param p_writer
+		*/
+		virtual void OnBinarySerialize(OvCore::Helpers::BinaryWriter& p_writer) override;
+
+		/**
+		* Deserialize the component from the binary scene format
+		* @param p_reader
+		*/
+		virtual void OnBinaryDeserialize(OvCore::Helpers::BinaryReader& p_reader) override;
+
 		/**
 		* Defines how the component should be drawn in the inspector
 		* @param p_root
@@ -170,6 +183,7 @@ namespace OvCore::ECS::Components
 
 	private:
 		OvAudio::Resources::Sound* m_sound = nullptr;
+		ResourceManagement::ResourceHandle<OvAudio::Resources::Sound> m_soundHandle;
 		OvAudio::Entities::AudioSource m_audioSource;
 		bool m_autoPlay = false;
 	};
@@ -14,6 +14,7 @@
 
 #include "OvCore/Resources/Material.h"
 #include "OvCore/ECS/Components/AComponent.h"
+#include "OvCore/ResourceManagement/ResourceHandle.h"
 
 #define MAX_MATERIAL_COUNT 255
 
@@ -27,6 +28,9 @@ namespace OvCore::ECS::Components
 	class CMaterialRenderer : public AComponent
 	{
 	public:
+		/* Read along with the model renderer of every drawn actor (See ComponentPool) */
+		static constexpr bool kPooledStorage = true;
+
 		using MaterialList = std::array<OvCore::Resources::Material*, MAX_MATERIAL_COUNT>;
 		using MaterialField = std::array<std::array<OvUI::Widgets::AWidget*, 3>, MAX_MATERIAL_COUNT>;
 
@@ -121,14 +125,33 @@ namespace OvCore::ECS::Components
 		*/
 		virtual void OnDeserialize(tinyxml2::XMLDocument& p_doc, tinyxml2::XMLNode* p_node) override;
 
+		/**
+		* Serialize the component to the binary scene format
+		* @param p_writer
+		*/
+		virtual void OnBinarySerialize(OvCore::Helpers::BinaryWriter& p_writer) override;
+
+		/**
+		* Deserialize the component from the binary scene format
+		* @param p_reader
+		*/
+		virtual void OnBinaryDeserialize(OvCore::Helpers::BinaryReader& p_reader) override;
+
 		/**
 		* Defines how the component should be drawn in the inspector
 		* @param p_root
 		*/
 		virtual void OnInspector(OvUI::Internal::WidgetContainer& p_root) override;
 
+	private:
+		/**
+		* Make the material handles reference the current materials
+		*/
+		void UpdateMaterialHandles();
+
 	private:
 		MaterialList m_materials;
+		std::array<ResourceManagement::ResourceHandle<OvCore::Resources::Material>, MAX_MATERIAL_COUNT> m_materialHandles;
 		MaterialField m_materialFields;
 		std::array<std::string, MAX_MATERIAL_COUNT> m_materialNames;
 		OvMaths::FMatrix4 m_userMatrix;
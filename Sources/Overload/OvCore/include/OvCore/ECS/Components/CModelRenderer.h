@@ -6,10 +6,13 @@
 
 #pragma once
 
+#include <memory>
+
 #include <OvRendering/Geometry/Vertex.h>
 #include <OvRendering/Resources/Model.h>
 
 #include "OvCore/ECS/Components/AComponent.h"
+#include "OvCore/ResourceManagement/ResourceHandle.h"
 
 namespace OvCore::ECS { class Actor; }
 
@@ -21,6 +24,9 @@ namespace OvCore::ECS::Components
 	class CModelRenderer : public AComponent
 	{
 	public:
+		/* Visited every frame by the drawables gathering, so model renderers are packed together (See ComponentPool) */
+		static constexpr bool kPooledStorage = true;
+
 		/**
 		* Defines how the model renderer bounding sphere should be interpreted
 		*/
@@ -84,22 +90,47 @@ namespace OvCore::ECS::Components
 		virtual void OnSerialize(tinyxml2::XMLDocument& p_doc, tinyxml2::XMLNode* p_node) override;
 
 		/**
-		* Deserialize the component
+		* Deserialize the component. The model is streamed (See AResourceManager::LoadResourceAsync),
+		* so it may only be set a few frames later
 		* @param p_doc
 		* @param p_node
 		*/
 		virtual void OnDeserialize(tinyxml2::XMLDocument& p_doc, tinyxml2::XMLNode* p_node) override;
 
+		/**
+		* Serialize the component to the binary scene format
+		* @param p_writer
+		*/
+		virtual void OnBinarySerialize(OvCore::Helpers::BinaryWriter& p_writer) override;
+
+		/**
+		* Deserialize the component from the binary scene format
+		* @param p_reader
+		*/
+		virtual void OnBinaryDeserialize(OvCore::Helpers::BinaryReader& p_reader) override;
+
 		/**
 		* Defines how the component should be drawn in the inspector
 		* @param p_root
 		*/
 		virtual void OnInspector(OvUI::Internal::WidgetContainer& p_root) override;
 
+	private:
+		/**
+		* Clear the current model and stream the given one (Set once loaded, unless another model is given in the meantime)
+		* @param p_path
+		*/
+		void LoadModelAsync(const std::string& p_path);
+
 	private:
 		OvRendering::Resources::Model* m_model = nullptr;
+		ResourceManagement::ResourceHandle<OvRendering::Resources::Model> m_modelHandle; // Keeps m_model from being evicted
 		OvTools::Eventing::Event<> m_modelChangedEvent;
 		OvRendering::Geometry::BoundingSphere m_customBoundingSphere = { {}, 1.0f };
 		EFrustumBehaviour m_frustumBehaviour = EFrustumBehaviour::CULL_MODEL;
+
+		/* Path of the model being streamed, and token telling pending loads whether the component still exists */
+		std::string m_pendingModelPath;
+		std::shared_ptr<bool> m_lifetime = std::make_shared<bool>(true);
 	};
 }
\ No newline at end of file
@@ -0,0 +1,125 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#pragma once
+
+#include <vector>
+#include <functional>
+
+#include <OvMaths/FVector3.h>
+#include <OvRendering/Data/Frustum.h>
+#include <OvRendering/Resources/Mesh.h>
+
+#include "OvCore/ECS/RenderQueue.h"
+#include "OvCore/SceneSystem/Scene.h"
+
+namespace OvTools::Utils
+{
+	class ThreadPool;
+}
+
+namespace OvCore::ECS
+{
+	/**
+	* Collects the drawables of the scene model renderers into render queues. Model renderers are split into
+	* chunks gathered in parallel when a thread pool is available, the result being identical to a serial gathering.
+	* It doesn't issue any graphics call, so it can be used without a rendering context
+	*/
+	class DrawableGatherer
+	{
+	public:
+		/**
+		* Constructor of the DrawableGatherer
+		* @param p_threadPool (Optional, used to gather drawables in parallel)
+		*/
+		DrawableGatherer(OvTools::Utils::ThreadPool* p_threadPool = nullptr);
+
+		/**
+		* Fill the given queues with the sorted drawables of the scene, culled against the given frustum (If any)
+		* @param p_opaques
+		* @param p_transparents
+		* @param p_scene
+		* @param p_cameraPosition
+		* @param p_frustum
+		* @param p_defaultMaterial
+		*/
+		void Gather
+		(
+			RenderQueue& p_opaques,
+			RenderQueue& p_transparents,
+			const OvCore::SceneSystem::Scene& p_scene,
+			const OvMaths::FVector3& p_cameraPosition,
+			const OvRendering::Data::Frustum* p_frustum,
+			OvCore::Resources::Material* p_defaultMaterial
+		);
+
+	private:
+		/**
+		* Gathering state of a range of model renderers, kept between frames to avoid per-frame allocations
+		*/
+		struct GatheringChunk
+		{
+			RenderQueue opaques;
+			RenderQueue transparents;
+			std::vector<std::reference_wrapper<OvRendering::Resources::Mesh>> meshesInFrustum;
+
+			/* World space model spheres (Structure of arrays) and their frustum visibility bitmask */
+			std::vector<float> centersX;
+			std::vector<float> centersY;
+			std::vector<float> centersZ;
+			std::vector<float> radii;
+			std::vector<uint32_t> visibility;
+		};
+
+		/**
+		* Fill the queues of the given chunk with the drawables of the model renderers in [p_first, p_last).
+		* Model spheres are culled all at once with Frustum::SpheresInFrustum
+		* @param p_chunk
+		* @param p_modelRenderers
+		* @param p_first
+		* @param p_last
+		* @param p_cameraPosition
+		* @param p_frustum
+		* @param p_defaultMaterial
+		*/
+		static void GatherChunkDrawables
+		(
+			GatheringChunk& p_chunk,
+			const std::vector<OvCore::ECS::Components::CModelRenderer*>& p_modelRenderers,
+			size_t p_first,
+			size_t p_last,
+			const OvMaths::FVector3& p_cameraPosition,
+			const OvRendering::Data::Frustum* p_frustum,
+			OvCore::Resources::Material* p_defaultMaterial
+		);
+
+		/**
+		* Push the meshes of the given model renderer to the given (Unsorted) queues. The model itself is
+		* expected to be in frustum already, only its meshes are culled (If the model culls its meshes)
+		* @param p_modelRenderer
+		* @param p_opaques
+		* @param p_transparents
+		* @param p_meshes (Scratch storage)
+		* @param p_cameraPosition
+		* @param p_frustum
+		* @param p_defaultMaterial
+		*/
+		static void GatherModelDrawables
+		(
+			OvCore::ECS::Components::CModelRenderer& p_modelRenderer,
+			RenderQueue& p_opaques,
+			RenderQueue& p_transparents,
+			std::vector<std::reference_wrapper<OvRendering::Resources::Mesh>>& p_meshes,
+			const OvMaths::FVector3& p_cameraPosition,
+			const OvRendering::Data::Frustum* p_frustum,
+			OvCore::Resources::Material* p_defaultMaterial
+		);
+
+	private:
+		OvTools::Utils::ThreadPool* m_threadPool = nullptr;
+		std::vector<GatheringChunk> m_chunks;
+	};
+}
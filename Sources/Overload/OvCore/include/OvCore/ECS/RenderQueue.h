@@ -0,0 +1,180 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#pragma once
+
+#include <vector>
+#include <cstdint>
+#include <functional>
+
+#include <OvMaths/FMatrix4.h>
+#include <OvRendering/Resources/Mesh.h>
+
+#include "OvCore/Resources/Material.h"
+
+namespace OvCore::ECS::Components
+{
+	class CAnimation;
+}
+
+namespace OvCore::ECS
+{
+	/**
+	* Compact description of a mesh to draw. Matrices are referenced (Not copied), so the
+	* referenced transforms and material renderers must outlive the render queue content
+	*/
+	struct Drawable
+	{
+		const OvMaths::FMatrix4* matrix;
+		OvRendering::Resources::Mesh* mesh;
+		OvCore::Resources::Material* material;
+		const OvMaths::FMatrix4* userMatrix;
+		const Components::CAnimation* animation; // Set if the mesh is skinned by an animation of its actor
+	};
+
+	/**
+	* Frame-persistent list of drawables sorted by a 64 bits key.
+	* The storage is kept between frames (Clear() doesn't release memory), so once the queue
+	* reached its peak size, filling and sorting it doesn't allocate anymore
+	*/
+	class RenderQueue
+	{
+	public:
+		/**
+		* Range of consecutive drawables (In sorted order) that can be drawn with a single draw call
+		*/
+		struct Batch
+		{
+			size_t first;
+			uint32_t count;
+		};
+
+		/**
+		* Iterates over the drawables in sorted order
+		*/
+		class ConstIterator
+		{
+		public:
+			ConstIterator(const RenderQueue& p_queue, size_t p_position) : m_queue(p_queue), m_position(p_position) {}
+			const Drawable& operator*() const { return m_queue[m_position]; }
+			const Drawable* operator->() const { return &m_queue[m_position]; }
+			ConstIterator& operator++() { ++m_position; return *this; }
+			bool operator==(const ConstIterator& p_other) const { return m_position == p_other.m_position; }
+			bool operator!=(const ConstIterator& p_other) const { return m_position != p_other.m_position; }
+
+		private:
+			const RenderQueue& m_queue;
+			size_t m_position;
+		};
+
+		/**
+		* Remove every drawables from the queue (The memory is kept for the next frame)
+		*/
+		void Clear();
+
+		/**
+		* Reserve memory for the given number of drawables
+		* @param p_count
+		*/
+		void Reserve(size_t p_count);
+
+		/**
+		* Add a drawable to the queue. Drawables are not sorted until Sort() is called
+		* @param p_drawable
+		* @param p_sortKey
+		*/
+		void Push(const Drawable& p_drawable, uint64_t p_sortKey);
+
+		/**
+		* Add the drawables of another queue (With their keys) after the drawables of this queue.
+		* Drawables are not sorted until Sort() is called
+		* @param p_other
+		*/
+		void Append(const RenderQueue& p_other);
+
+		/**
+		* Sort the drawables by ascending key (LSD radix sort, stable)
+		*/
+		void Sort();
+
+		/**
+		* Returns the number of drawables in the queue
+		*/
+		size_t Size() const;
+
+		/**
+		* Returns true if the queue contains no drawable
+		*/
+		bool Empty() const;
+
+		/**
+		* Returns the drawable at the given position (In sorted order once Sort() has been called)
+		* @param p_position
+		*/
+		const Drawable& operator[](size_t p_position) const;
+
+		/**
+		* Returns the sort key of the drawable at the given position
+		* @param p_position
+		*/
+		uint64_t GetSortKey(size_t p_position) const;
+
+		/**
+		* Split the sorted drawables into batches of consecutive drawables sharing the same mesh, material and user matrix.
+		* Drawables rejected by the given predicate always get their own batch.
+		* Only CPU data is read, so batching doesn't require any rendering context
+		* @param p_batches (Cleared before being filled)
+		* @param p_canBeInstanced (bool(const Drawable&))
+		*/
+		template<typename Predicate>
+		void BuildBatches(std::vector<Batch>& p_batches, Predicate p_canBeInstanced) const;
+
+		/**
+		* Append the bone palettes of the skinned drawables accepted by the given predicate to p_palettes (Read from the pose
+		* cached by their CAnimation). The offset of every drawable palette in p_palettes (-1 if not skinned) is written at
+		* the drawable position in p_boneOffsets. Only CPU data is read, so palettes don't require any rendering context
+		* @param p_palettes
+		* @param p_boneOffsets (Resized to the number of drawables)
+		* @param p_isSkinned
+		*/
+		void CollectBonePalettes(std::vector<OvMaths::FMatrix4>& p_palettes, std::vector<int32_t>& p_boneOffsets, const std::function<bool(const Drawable&)>& p_isSkinned) const;
+
+		ConstIterator begin() const;
+		ConstIterator end() const;
+
+		/**
+		* Generate a key that groups opaque drawables by shader, material and mesh, then sorts them front to back
+		* @param p_drawable
+		* @param p_distance
+		*/
+		static uint64_t GenerateOpaqueSortKey(const Drawable& p_drawable, float p_distance);
+
+		/**
+		* Generate a key that sorts transparent drawables back to front
+		* @param p_distance
+		*/
+		static uint64_t GenerateTransparentSortKey(float p_distance);
+
+	private:
+		/**
+		* Returns true if the given drawables have equal user matrices (Instanced draws send a single user matrix per batch)
+		*/
+		static bool HaveSameUserMatrix(const Drawable& p_first, const Drawable& p_second);
+
+	private:
+		struct SortEntry
+		{
+			uint64_t key;
+			uint32_t index;
+		};
+
+		std::vector<Drawable> m_drawables;
+		std::vector<SortEntry> m_entries;
+		std::vector<SortEntry> m_sortBuffer;
+	};
+}
+
+#include "OvCore/ECS/RenderQueue.inl"
@@ -0,0 +1,43 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#pragma once
+
+#include "OvCore/ECS/RenderQueue.h"
+
+namespace OvCore::ECS
+{
+	template<typename Predicate>
+	inline void RenderQueue::BuildBatches(std::vector<Batch>& p_batches, Predicate p_canBeInstanced) const
+	{
+		p_batches.clear();
+
+		const size_t count = Size();
+		size_t position = 0;
+
+		while (position < count)
+		{
+			const Drawable& first = (*this)[position];
+			uint32_t batchSize = 1;
+
+			if (p_canBeInstanced(first))
+			{
+				while (position + batchSize < count)
+				{
+					const Drawable& next = (*this)[position + batchSize];
+
+					if (next.mesh != first.mesh || next.material != first.material || !HaveSameUserMatrix(next, first) || !p_canBeInstanced(next))
+						break;
+
+					++batchSize;
+				}
+			}
+
+			p_batches.push_back({ position, batchSize });
+			position += batchSize;
+		}
+	}
+}
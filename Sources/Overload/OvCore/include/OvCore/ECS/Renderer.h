@@ -6,33 +6,21 @@
 
 #pragma once
 
-#include <map>
-
 #include <OvRendering/Core/Renderer.h>
 #include <OvRendering/Resources/Mesh.h>
 #include <OvRendering/Data/Frustum.h>
+#include <OvRendering/Buffers/ShaderStorageBuffer.h>
 
 
 #include "OvCore/Resources/Material.h"
 #include "OvCore/ECS/Actor.h"
+#include "OvCore/ECS/RenderQueue.h"
+#include "OvCore/ECS/DrawableGatherer.h"
 #include "OvCore/ECS/Components/CCamera.h"
 #include "OvCore/SceneSystem/Scene.h"
 
-namespace OvRendering::Buffers
-{
-	class UniformBuffer;
-}
-
 namespace OvCore::ECS
 {
-	struct Drawable
-	{
-		OvMaths::FMatrix4 matrix;
-		OvRendering::Resources::Mesh* mesh;
-		OvCore::Resources::Material* material;
-		OvMaths::FMatrix4 userMatrix;
-		std::vector<OvRendering::Resources::AnimationPlayCtrl>* animctrl;
-	};
 	/**
 	* A Renderer capable of rendering stuffs linked with the ECS. It is a convenient class that should be used instead of OvRendering::Core::Renderer
 	* when you plan to use the OvCore ECS architecture.
@@ -40,15 +28,12 @@ namespace OvCore::ECS
 	class Renderer : public OvRendering::Core::Renderer
 	{
 	public:
-		//using Drawable				= std::tuple<OvMaths::FMatrix4, OvRendering::Resources::Mesh*, OvCore::Resources::Material*, OvMaths::FMatrix4, std::vector<OvRendering::Resources::AnimationPlayCtrl>*>;
-		using OpaqueDrawables		= std::multimap<float, Drawable, std::less<float>>;
-		using TransparentDrawables	= std::multimap<float, Drawable, std::greater<float>>;
-
 		/**
 		* Constructor of the Renderer
 		* @param p_driver
+		* @param p_threadPool (Optional, used to gather drawables in parallel)
 		*/
-		Renderer(OvRendering::Context::Driver& p_driver);
+		Renderer(OvRendering::Context::Driver& p_driver, OvTools::Utils::ThreadPool* p_threadPool = nullptr);
 
 		/**
 		* Destructor of the Renderer
@@ -89,19 +74,22 @@ namespace OvCore::ECS
 			const OvMaths::FVector3& p_cameraPosition,
 			const OvRendering::LowRenderer::Camera& p_camera,
 			const OvRendering::Data::Frustum* p_customFrustum,
-			OvCore::Resources::Material* p_defaultMaterial,
-			OvRendering::Buffers::UniformBuffer* p_ubo 
+			OvCore::Resources::Material* p_defaultMaterial
 		);
 
 		/**
-		* Returns opaque and transparents drawables from the scene with frustum culling
+		* Fill the given queues with the sorted opaque and transparents drawables from the scene with frustum culling
+		* @param p_opaques
+		* @param p_transparents
 		* @param p_scene
 		* @param p_cameraPosition
 		* @param p_frustum
 		* @param p_defaultMaterial
 		*/
-		std::pair<OpaqueDrawables, TransparentDrawables> FindAndSortFrustumCulledDrawables
+		void FindAndSortFrustumCulledDrawables
 		(
+			RenderQueue& p_opaques,
+			RenderQueue& p_transparents,
 			const OvCore::SceneSystem::Scene& p_scene,
 			const OvMaths::FVector3& p_cameraPosition,
 			const OvRendering::Data::Frustum& p_frustum,
@@ -109,13 +97,17 @@ namespace OvCore::ECS
 		);
 
 		/**
-		* Returns opaque and transparents drawables from the scene
+		* Fill the given queues with the sorted opaque and transparents drawables from the scene
+		* @param p_opaques
+		* @param p_transparents
 		* @param p_scene
 		* @param p_cameraPosition
 		* @param p_defaultMaterial
 		*/
-		std::pair<OpaqueDrawables, TransparentDrawables> FindAndSortDrawables
+		void FindAndSortDrawables
 		(
+			RenderQueue& p_opaques,
+			RenderQueue& p_transparents,
 			const OvCore::SceneSystem::Scene& p_scene,
 			const OvMaths::FVector3& p_cameraPosition,
 			OvCore::Resources::Material* p_defaultMaterial
@@ -124,8 +116,18 @@ namespace OvCore::ECS
 		/**
 		* Draw a Drawable instance
 		* @param p_toDraw
+		* @param p_boneOffset (Index of the drawable bone palette in the bone palette SSBO, -1 if not skinned)
+		*/
+		void DrawDrawable(const Drawable& p_toDraw, int32_t p_boneOffset = -1);
+
+		/**
+		* Draw a batch of drawables sharing the same mesh and material with a single instanced draw call.
+		* The instance matrices must already be uploaded to the instance SSBO, starting at the given offset
+		* @param p_toDraw (First drawable of the batch)
+		* @param p_instances
+		* @param p_instanceOffset
 		*/
-		void DrawDrawable(const Drawable& p_toDraw);
+		void DrawInstancedBatch(const Drawable& p_toDraw, uint32_t p_instances, size_t p_instanceOffset);
 
 		/**
 		* Draw the model using the given material (The material will be applied to every submeshes of the the model)
@@ -149,8 +151,9 @@ namespace OvCore::ECS
 		* @param p_mesh
 		* @param p_material
 		* @param p_modelMatrix (If set to nullptr, no data will be sent to the GPU)
+		* @param p_boneOffset (Index of the mesh bone palette in the bone palette SSBO, -1 if not skinned)
 		*/
-		void DrawMesh(OvRendering::Resources::Mesh& p_mesh, OvCore::Resources::Material& p_material, OvMaths::FMatrix4 const* p_modelMatrix);
+		void DrawMesh(OvRendering::Resources::Mesh& p_mesh, OvCore::Resources::Material& p_material, OvMaths::FMatrix4 const* p_modelMatrix, int32_t p_boneOffset = -1);
 
 		/**
 		* Register the given function as the model matrix sender.
@@ -170,9 +173,40 @@ namespace OvCore::ECS
 		*/
 		void RegisterUserMatrixSender(std::function<void(OvMaths::FMatrix4)> p_userMatrixSender);
 
+	private:
+		/**
+		* Upload the model matrices of every instanced batch (Batches of more than one drawable) to the instance SSBO.
+		* Returns true if at least one batch is instanced
+		* @param p_queue
+		* @param p_batches
+		*/
+		bool UploadInstanceData(const RenderQueue& p_queue, const std::vector<RenderQueue::Batch>& p_batches);
+
+		/**
+		* Upload the bone palettes of every skinned drawable of the opaque and transparent queues to the bone palette SSBO.
+		* Returns true if at least one palette has been uploaded
+		*/
+		bool UploadBonePalettes();
+
 	private:
 		std::function<void(OvMaths::FMatrix4)> m_modelMatrixSender;
 		std::function<void(OvMaths::FMatrix4)> m_userMatrixSender;
 		OvRendering::Resources::Texture* m_emptyTexture = nullptr;
+
+		/* Kept between frames to avoid per-frame allocations */
+		DrawableGatherer m_drawableGatherer;
+		RenderQueue m_opaqueQueue;
+		RenderQueue m_transparentQueue;
+		std::vector<RenderQueue::Batch> m_opaqueBatches;
+
+		/* Per frame instance data (Model matrix of every instanced drawable) */
+		OvRendering::Buffers::ShaderStorageBuffer m_instanceSSBO;
+		std::vector<OvMaths::FMatrix4> m_instanceData;
+
+		/* Per frame bone palettes (Skinning matrices of every skinned drawable) */
+		OvRendering::Buffers::ShaderStorageBuffer m_bonePaletteSSBO;
+		std::vector<OvMaths::FMatrix4> m_bonePalettes;
+		std::vector<int32_t> m_opaqueBoneOffsets;
+		std::vector<int32_t> m_transparentBoneOffsets;
 	};
 }
\ No newline at end of file
@@ -0,0 +1,102 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+#include "OvCore/ECS/Components/AComponent.h"
+
+namespace OvTools::Utils { class ThreadPool; }
+
+namespace OvCore::ECS
+{
+	/**
+	* Calls the update callbacks of the registered components. Components are kept in one list per update phase, in
+	* registration order, and are only listed in the phases they implement (A component that doesn't override
+	* OnUpdate is never visited on update).
+	* Components declaring "static constexpr bool kThreadSafeUpdate = true" get their OnUpdate called in parallel when a
+	* thread pool is given. Such an OnUpdate must only touch its own actor data, and must not create or destroy actors
+	* or components
+	*/
+	class UpdateSystem
+	{
+	public:
+		/**
+		* Update phases, in order of execution within a frame
+		*/
+		enum class EPhase : uint8_t
+		{
+			UPDATE,
+			FIXED_UPDATE,
+			LATE_UPDATE
+		};
+
+		/**
+		* Record the update callbacks implemented by the given component, deduced from its type T.
+		* Components that aren't described (Behaviours for instance) are listed in every phase
+		* @param p_component
+		*/
+		template<typename T>
+		static void DescribeComponent(Components::AComponent& p_component);
+
+		/**
+		* Add the given component to the lists of the phases it implements
+		* @param p_component
+		*/
+		void Register(Components::AComponent& p_component);
+
+		/**
+		* Remove the given component from the update lists. Can be called while the lists are being run
+		* @param p_component
+		*/
+		void Unregister(Components::AComponent& p_component);
+
+		/**
+		* Call the callback of the given phase on every registered component with an active owner.
+		* Components registered while running are called from the next run
+		* @param p_phase
+		* @param p_deltaTime
+		* @param p_threadPool
+		*/
+		void Run(EPhase p_phase, float p_deltaTime, OvTools::Utils::ThreadPool* p_threadPool = nullptr);
+
+	private:
+		struct ComponentList
+		{
+			std::vector<Components::AComponent*> components;
+			size_t removedCount = 0;
+		};
+
+		static constexpr uint8_t kPhaseCount = 3;
+		static constexpr uint8_t kParallelUpdateFlag = 1 << kPhaseCount;
+		static constexpr uint8_t kRegisteredFlag = 1 << (kPhaseCount + 1);
+
+		static void Call(Components::AComponent& p_component, EPhase p_phase, float p_deltaTime);
+
+		ComponentList& GetList(const Components::AComponent& p_component, uint8_t p_phase);
+		void RunSerial(ComponentList& p_list, EPhase p_phase, float p_deltaTime);
+		void RunParallel(ComponentList& p_list, float p_deltaTime, OvTools::Utils::ThreadPool& p_threadPool);
+		void Compact(ComponentList& p_list, uint8_t p_phase);
+
+	private:
+		ComponentList m_lists[kPhaseCount];
+		ComponentList m_parallelUpdates;
+	};
+
+	/**
+	* Tells if the component type T declared "static constexpr bool kThreadSafeUpdate = true"
+	*/
+	template<typename T, typename = void>
+	struct HasThreadSafeUpdate : std::false_type {};
+
+	template<typename T>
+	struct HasThreadSafeUpdate<T, std::void_t<decltype(T::kThreadSafeUpdate)>> : std::bool_constant<T::kThreadSafeUpdate> {};
+}
+
+#include "OvCore/ECS/UpdateSystem.inl"
@@ -0,0 +1,37 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#pragma once
+
+#include "OvCore/ECS/UpdateSystem.h"
+
+namespace OvCore::ECS
+{
+	template<typename T>
+	inline void UpdateSystem::DescribeComponent(Components::AComponent& p_component)
+	{
+		static_assert(std::is_base_of<Components::AComponent, T>::value, "T should derive from AComponent");
+
+		/* &T::OnUpdate points to a member of AComponent, unless T (Or one of its bases) overrides it */
+		using DefaultCallback = void(Components::AComponent::*)(float);
+
+		uint8_t flags = 0;
+
+		if constexpr (!std::is_same<decltype(&T::OnUpdate), DefaultCallback>::value)
+			flags |= 1 << static_cast<uint8_t>(EPhase::UPDATE);
+
+		if constexpr (!std::is_same<decltype(&T::OnFixedUpdate), DefaultCallback>::value)
+			flags |= 1 << static_cast<uint8_t>(EPhase::FIXED_UPDATE);
+
+		if constexpr (!std::is_same<decltype(&T::OnLateUpdate), DefaultCallback>::value)
+			flags |= 1 << static_cast<uint8_t>(EPhase::LATE_UPDATE);
+
+		if constexpr (HasThreadSafeUpdate<T>::value)
+			flags |= kParallelUpdateFlag;
+
+		p_component.m_updateFlags = flags;
+	}
+}
@@ -0,0 +1,100 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <OvMaths/FVector2.h>
+#include <OvMaths/FVector3.h>
+#include <OvMaths/FVector4.h>
+#include <OvMaths/FQuaternion.h>
+
+namespace OvAudio::Resources { class Sound; }
+namespace OvCore::Resources { class Material; }
+
+namespace OvCore::Helpers
+{
+	/**
+	* Reads the values written by a BinaryWriter, without copying the underlying data.
+	* A value missing at the end of the data (Written by a previous version of the format) is read as the given default value.
+	* A truncated or corrupted value invalidates the reader, which then only returns default values
+	*/
+	class BinaryReader
+	{
+	public:
+		/**
+		* Create a reader over the given data. Strings are read from the given string table, which must outlive the reader
+		* @param p_data
+		* @param p_size
+		* @param p_strings
+		*/
+		BinaryReader(const uint8_t* p_data, size_t p_size, const std::vector<std::string_view>& p_strings);
+
+		bool ReadBoolean(bool p_default = false);
+		int32_t ReadInt(int32_t p_default = 0);
+		uint32_t ReadUint(uint32_t p_default = 0);
+		int64_t ReadInt64(int64_t p_default = 0);
+		float ReadFloat(float p_default = 0.0f);
+		OvMaths::FVector2 ReadVec2(const OvMaths::FVector2& p_default = OvMaths::FVector2::Zero);
+		OvMaths::FVector3 ReadVec3(const OvMaths::FVector3& p_default = OvMaths::FVector3::Zero);
+		OvMaths::FVector4 ReadVec4(const OvMaths::FVector4& p_default = OvMaths::FVector4::Zero);
+		OvMaths::FQuaternion ReadQuat(const OvMaths::FQuaternion& p_default = OvMaths::FQuaternion::Identity);
+		std::string_view ReadString(std::string_view p_default = {});
+
+		/**
+		* Read a material path and return the material from the MaterialManager (nullptr if the path is empty or "?")
+		* @param p_default
+		*/
+		OvCore::Resources::Material* ReadMaterial(OvCore::Resources::Material* p_default = nullptr);
+
+		/**
+		* Read a sound path and return the sound from the SoundManager (nullptr if the path is empty or "?")
+		* @param p_default
+		*/
+		OvAudio::Resources::Sound* ReadSound(OvAudio::Resources::Sound* p_default = nullptr);
+
+		/**
+		* Read a block written by BinaryWriter::WriteBlock. The returned reader is limited to the block, and this reader
+		* continues after it, whatever is read from the block
+		*/
+		BinaryReader ReadBlock();
+
+		/**
+		* Read raw bytes. Returns nullptr (And invalidates the reader) if there isn't enough data left
+		* @param p_size
+		*/
+		const uint8_t* ReadBytes(size_t p_size);
+
+		/**
+		* Returns true if there is no more data to read
+		*/
+		bool IsAtEnd() const;
+
+		/**
+		* Returns the number of bytes left to read
+		*/
+		size_t GetRemaining() const;
+
+		/**
+		* Returns false if a truncated or corrupted value has been read
+		*/
+		bool IsValid() const;
+
+	private:
+		bool ReadVarUint(uint64_t& p_out);
+
+	private:
+		const uint8_t* m_data;
+		size_t m_size;
+		size_t m_offset = 0;
+		bool m_valid = true;
+		const std::vector<std::string_view>* m_strings;
+	};
+}
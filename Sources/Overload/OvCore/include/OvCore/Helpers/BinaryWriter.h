@@ -0,0 +1,90 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <OvMaths/FVector2.h>
+#include <OvMaths/FVector3.h>
+#include <OvMaths/FVector4.h>
+#include <OvMaths/FQuaternion.h>
+
+namespace OvAudio::Resources { class Sound; }
+namespace OvCore::Resources { class Material; }
+
+namespace OvCore::Helpers
+{
+	/**
+	* Writes typed values in a compact little-endian binary form (See BinaryReader).
+	* Integers are variable-length encoded, floats are stored as their bits, and strings are stored once
+	* in a string table shared by every writer of a file
+	*/
+	class BinaryWriter
+	{
+	public:
+		/**
+		* Strings written to a file, in order of first use
+		*/
+		struct StringTable
+		{
+			std::vector<std::string> strings;
+			std::unordered_map<std::string, uint32_t> indices;
+		};
+
+		/**
+		* Create a writer storing its strings in the given table
+		* @param p_strings
+		*/
+		BinaryWriter(StringTable& p_strings);
+
+		void WriteBoolean(bool p_value);
+		void WriteInt(int32_t p_value);
+		void WriteUint(uint32_t p_value);
+		void WriteInt64(int64_t p_value);
+		void WriteFloat(float p_value);
+		void WriteVec2(const OvMaths::FVector2& p_value);
+		void WriteVec3(const OvMaths::FVector3& p_value);
+		void WriteVec4(const OvMaths::FVector4& p_value);
+		void WriteQuat(const OvMaths::FQuaternion& p_value);
+		void WriteString(const std::string& p_value);
+		void WriteMaterial(OvCore::Resources::Material* p_value);
+		void WriteSound(OvAudio::Resources::Sound* p_value);
+
+		/**
+		* Write the content of the given writer, prefixed by its size, so it can be read (Or skipped) as a block (See BinaryReader::ReadBlock)
+		* @param p_block
+		*/
+		void WriteBlock(const BinaryWriter& p_block);
+
+		/**
+		* Write raw bytes
+		* @param p_data
+		* @param p_size
+		*/
+		void WriteBytes(const void* p_data, size_t p_size);
+
+		/**
+		* Returns the string table used by this writer
+		*/
+		StringTable& GetStrings();
+
+		/**
+		* Returns the written bytes
+		*/
+		const std::vector<uint8_t>& GetData() const;
+
+	private:
+		void WriteVarUint(uint64_t p_value);
+
+	private:
+		StringTable& m_strings;
+		std::vector<uint8_t> m_data;
+	};
+}
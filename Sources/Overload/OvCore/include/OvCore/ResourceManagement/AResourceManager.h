@@ -8,13 +8,31 @@
 
 #include <unordered_map>
 #include <any>
+#include <functional>
+#include <future>
+#include <memory>
+#include <vector>
 
+#include "OvCore/ResourceManagement/AsyncLoader.h"
 
 
 namespace OvCore::ResourceManagement
 {
+	template<typename T> class ResourceHandle;
+
 	/**
-	* Handle the management of various resources of variable type
+	* Estimated memory used by resources
+	*/
+	struct ResourceMemory
+	{
+		uint64_t cpuBytes = 0;
+		uint64_t gpuBytes = 0;
+	};
+
+	/**
+	* Handle the management of various resources of variable type.
+	* Resources can be referenced through handles (See ResourceHandle), and once the memory used by
+	* the resources exceeds the memory budget, the least recently used unreferenced ones can be evicted
 	*/
 	template<typename T>
 	class AResourceManager
@@ -26,6 +44,23 @@ namespace OvCore::ResourceManagement
 		*/
 		T* LoadResource(const std::string& p_path);
 
+		/**
+		* Load a resource in the background (See AsyncLoader) and register it once it is uploaded.
+		* The returned future becomes ready on the main thread, once the resource is registered (nullptr if the loading failed or was discarded by the destruction of the loader),
+		* so the main thread must not wait for it without processing the uploads (See AsyncLoader::Flush).
+		* The given callback is invoked on the main thread with the loaded resource.
+		* If no asynchronous loader has been provided, the resource is loaded synchronously
+		* @param p_path
+		* @param p_callback
+		*/
+		std::shared_future<T*> LoadResourceAsync(const std::string& p_path, std::function<void(T*)> p_callback = nullptr);
+
+		/**
+		* Return true if the resource is being loaded in the background
+		* @param p_path
+		*/
+		bool IsResourcePending(const std::string& p_path) const;
+
 		/**
 		* Handle the destruction of a resource and unregister it
 		* @param p_path
@@ -80,6 +115,48 @@ namespace OvCore::ResourceManagement
 		*/
 		T* GetResource(const std::string& p_path, bool p_tryToLoadIfNotFound = true);
 
+		/**
+		* Return a handle to the resource linked to the given path, loading it if it isn't registered
+		* (An evicted resource is transparently loaded again). The handle is empty if the loading failed
+		* @param p_path
+		*/
+		ResourceHandle<T> GetHandle(const std::string& p_path);
+
+		/**
+		* Return a handle to the given resource. The handle isn't counted if the resource isn't registered in this manager
+		* @param p_resource
+		*/
+		ResourceHandle<T> GetHandle(T* p_resource);
+
+		/**
+		* Set the memory budget (CPU and GPU) of the resources of this manager (0 for no budget, which disables eviction)
+		* @param p_bytes
+		*/
+		void SetMemoryBudget(uint64_t p_bytes);
+
+		/**
+		* Returns the memory budget of the resources of this manager
+		*/
+		uint64_t GetMemoryBudget() const;
+
+		/**
+		* Returns the estimated memory used by the registered resources
+		*/
+		const ResourceMemory& GetMemoryUsage() const;
+
+		/**
+		* Returns the number of resources evicted since the creation of the manager
+		*/
+		uint32_t GetEvictionCount() const;
+
+		/**
+		* Destroy the least recently used resources that aren't referenced by any handle, until the memory used
+		* fits in the budget. Raw pointers to these resources become invalid, so this method should be called
+		* when only handles are kept (Between frames). Returns the number of evicted resources.
+		* Handles to a resource unloaded explicitly stop being counted, and never count for another resource created at the same address
+		*/
+		uint32_t EvictUnusedResources();
+
 		/**
 		* Operator overload to get an instance linked to the given path.
 		* @note See GetResource for more informations
@@ -95,6 +172,13 @@ namespace OvCore::ResourceManagement
 		*/
 		static void ProvideAssetPaths(const std::string& p_projectAssetsPath, const std::string& p_engineAssetsPath);
 
+		/**
+		* Provide the loader used by LoadResourceAsync (nullptr to load synchronously)
+		* @note The loader must be destroyed before the resource managers
+		* @param p_loader
+		*/
+		static void ProvideAsyncLoader(AsyncLoader* p_loader);
+
 		/**
 		* Returns the resource map
 		*/
@@ -104,13 +188,61 @@ namespace OvCore::ResourceManagement
 		virtual T* CreateResource(const std::string& p_path) = 0;
 		virtual void DestroyResource(T* p_resource) = 0;
 		virtual void ReloadResource(T* p_resource, const std::string& p_path) = 0;
+
+		/**
+		* Called on a worker thread to prepare the given resource. The returned function is called on the
+		* main thread to create the resource. Resources that can't be prepared without a rendering context
+		* keep the default implementation, which creates the whole resource on the main thread
+		* @param p_path
+		*/
+		virtual std::function<T*()> DecodeResource(const std::string& p_path);
+
+		/**
+		* Returns the estimated memory used by the given resource. Resources without estimation are never evicted
+		* @param p_resource
+		*/
+		virtual ResourceMemory GetResourceMemory(T& p_resource);
+
 		std::string GetRealPath(const std::string& p_path) const;
 
+	private:
+		struct PendingResource
+		{
+			std::shared_ptr<std::promise<T*>> promise;
+			std::shared_future<T*> future;
+			std::vector<std::function<void(T*)>> callbacks;
+		};
+
+		struct ResourceRecord
+		{
+			uint64_t id = 0; // Unique to this registration of the resource, even if another resource reuses its address later
+			uint32_t references = 0;
+			uint64_t lastUse = 0;
+			ResourceMemory memory;
+		};
+
+		friend class ResourceHandle<T>;
+
+		void CompleteResource(const std::string& p_path, T* p_resource);
+		uint64_t AcquireResource(T* p_resource, uint64_t p_recordID = 0);
+		void ReleaseResource(T* p_resource, uint64_t p_recordID);
+		void TrackResource(T* p_resource);
+		void ForgetResource(T* p_resource);
+
 	private:
 		inline static std::string __PROJECT_ASSETS_PATH = "";
 		inline static std::string __ENGINE_ASSETS_PATH = "";
+		inline static AsyncLoader* __ASYNC_LOADER = nullptr;
 
 		std::unordered_map<std::string, T*> m_resources;
+		std::unordered_map<std::string, PendingResource> m_pendingResources;
+
+		std::unordered_map<const T*, ResourceRecord> m_records;
+		ResourceMemory m_memoryUsage;
+		uint64_t m_memoryBudget = 0;
+		uint64_t m_useClock = 0;
+		uint64_t m_recordClock = 0;
+		uint32_t m_evictionCount = 0;
 	};
 }
 
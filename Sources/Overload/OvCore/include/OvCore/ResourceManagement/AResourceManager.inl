@@ -27,6 +27,104 @@ namespace OvCore::ResourceManagement
 		}
 	}
 
+	template<typename T>
+	inline std::shared_future<T*> AResourceManager<T>::LoadResourceAsync(const std::string& p_path, std::function<void(T*)> p_callback)
+	{
+		if (auto pending = m_pendingResources.find(p_path); pending != m_pendingResources.end())
+		{
+			if (p_callback)
+				pending->second.callbacks.push_back(std::move(p_callback));
+
+			return pending->second.future;
+		}
+
+		if (!__ASYNC_LOADER || IsResourceRegistered(p_path))
+		{
+			T* resource = LoadResource(p_path);
+
+			if (p_callback)
+				p_callback(resource);
+
+			std::promise<T*> promise;
+			promise.set_value(resource);
+			return promise.get_future().share();
+		}
+
+		PendingResource& pending = m_pendingResources[p_path];
+		pending.promise = std::make_shared<std::promise<T*>>();
+		pending.future = pending.promise->get_future().share();
+
+		if (p_callback)
+			pending.callbacks.push_back(std::move(p_callback));
+
+		/* The request may be discarded (Thus completed and erased) during the submission */
+		auto future = pending.future;
+
+		__ASYNC_LOADER->Submit([this, p_path]() -> AsyncLoader::UploadTask
+		{
+			auto create = DecodeResource(p_path);
+
+			return [this, p_path, create]
+			{
+				CompleteResource(p_path, create());
+			};
+		},
+		[this, p_path]
+		{
+			CompleteResource(p_path, nullptr);
+		});
+
+		return future;
+	}
+
+	template<typename T>
+	inline bool AResourceManager<T>::IsResourcePending(const std::string& p_path) const
+	{
+		return m_pendingResources.find(p_path) != m_pendingResources.end();
+	}
+
+	template<typename T>
+	inline void AResourceManager<T>::CompleteResource(const std::string& p_path, T* p_resource)
+	{
+		auto pending = m_pendingResources.find(p_path);
+
+		if (pending == m_pendingResources.end())
+			return;
+
+		/* The resource may have been loaded synchronously in the meantime, keep the registered instance */
+		if (auto registered = GetResource(p_path, false); registered)
+		{
+			if (p_resource)
+				DestroyResource(p_resource);
+
+			p_resource = registered;
+		}
+		else if (p_resource)
+		{
+			RegisterResource(p_path, p_resource);
+		}
+
+		PendingResource completed = std::move(pending->second);
+		m_pendingResources.erase(pending);
+
+		completed.promise->set_value(p_resource);
+
+		for (auto& callback : completed.callbacks)
+			callback(p_resource);
+	}
+
+	template<typename T>
+	inline std::function<T*()> AResourceManager<T>::DecodeResource(const std::string& p_path)
+	{
+		return [this, p_path] { return CreateResource(p_path); };
+	}
+
+	template<typename T>
+	inline ResourceMemory AResourceManager<T>::GetResourceMemory(T& p_resource)
+	{
+		return {};
+	}
+
 	template<typename T>
 	inline void AResourceManager<T>::UnloadResource(const std::string & p_path)
 	{
@@ -42,9 +140,10 @@ namespace OvCore::ResourceManagement
 	{
 		if (IsResourceRegistered(p_previousPath) && !IsResourceRegistered(p_newPath))
 		{
+			/* The record of the resource (References and memory) is kept as is */
 			T* toMove = m_resources.at(p_previousPath);
-			UnregisterResource(p_previousPath);
-			RegisterResource(p_newPath, toMove);
+			m_resources.erase(p_previousPath);
+			m_resources[p_newPath] = toMove;
 			return true;
 		}
 
@@ -57,6 +156,16 @@ namespace OvCore::ResourceManagement
 		if (auto resource = GetResource(p_path, false); resource)
 		{
 			ReloadResource(resource, p_path);
+
+			/* The reloaded resource may use another amount of memory, its record (And handles) stay valid */
+			if (auto record = m_records.find(resource); record != m_records.end())
+			{
+				m_memoryUsage.cpuBytes -= record->second.memory.cpuBytes;
+				m_memoryUsage.gpuBytes -= record->second.memory.gpuBytes;
+				record->second.memory = GetResourceMemory(*resource);
+				m_memoryUsage.cpuBytes += record->second.memory.cpuBytes;
+				m_memoryUsage.gpuBytes += record->second.memory.gpuBytes;
+			}
 		}
 	}
 
@@ -73,15 +182,21 @@ namespace OvCore::ResourceManagement
 			DestroyResource(value);
 
 		m_resources.clear();
+		m_records.clear();
+		m_memoryUsage = {};
 	}
 
 	template<typename T>
 	inline T* AResourceManager<T>::RegisterResource(const std::string& p_path, T* p_instance)
 	{
 		if (auto resource = GetResource(p_path, false); resource)
+		{
+			ForgetResource(resource);
 			DestroyResource(resource);
+		}
 
 		m_resources[p_path] = p_instance;
+		TrackResource(p_instance);
 
 		return p_instance;
 	}
@@ -89,7 +204,11 @@ namespace OvCore::ResourceManagement
 	template<typename T>
 	inline void AResourceManager<T>::UnregisterResource(const std::string & p_path)
 	{
-		m_resources.erase(p_path);
+		if (auto resource = m_resources.find(p_path); resource != m_resources.end())
+		{
+			ForgetResource(resource->second);
+			m_resources.erase(resource);
+		}
 	}
 
 	template<typename T>
@@ -97,6 +216,9 @@ namespace OvCore::ResourceManagement
 	{
 		if (auto resource = m_resources.find(p_path); resource != m_resources.end())
 		{
+			if (auto record = m_records.find(resource->second); record != m_records.end())
+				record->second.lastUse = ++m_useClock;
+
 			return resource->second;
 		}
 		else if (p_tryToLoadIfNotFound)
@@ -107,6 +229,127 @@ namespace OvCore::ResourceManagement
 		return nullptr;
 	}
 
+	template<typename T>
+	inline ResourceHandle<T> AResourceManager<T>::GetHandle(const std::string& p_path)
+	{
+		return ResourceHandle<T>(*this, GetResource(p_path));
+	}
+
+	template<typename T>
+	inline ResourceHandle<T> AResourceManager<T>::GetHandle(T* p_resource)
+	{
+		return ResourceHandle<T>(*this, p_resource);
+	}
+
+	template<typename T>
+	inline void AResourceManager<T>::SetMemoryBudget(uint64_t p_bytes)
+	{
+		m_memoryBudget = p_bytes;
+	}
+
+	template<typename T>
+	inline uint64_t AResourceManager<T>::GetMemoryBudget() const
+	{
+		return m_memoryBudget;
+	}
+
+	template<typename T>
+	inline const ResourceMemory& AResourceManager<T>::GetMemoryUsage() const
+	{
+		return m_memoryUsage;
+	}
+
+	template<typename T>
+	inline uint32_t AResourceManager<T>::GetEvictionCount() const
+	{
+		return m_evictionCount;
+	}
+
+	template<typename T>
+	inline uint32_t AResourceManager<T>::EvictUnusedResources()
+	{
+		const auto overBudget = [this]
+		{
+			return m_memoryBudget > 0 && m_memoryUsage.cpuBytes + m_memoryUsage.gpuBytes > m_memoryBudget;
+		};
+
+		if (!overBudget())
+			return 0;
+
+		std::vector<std::pair<uint64_t, std::string>> candidates;
+
+		for (const auto& [path, resource] : m_resources)
+		{
+			if (auto record = m_records.find(resource); record != m_records.end() && record->second.references == 0)
+			{
+				const ResourceMemory& memory = record->second.memory;
+
+				if (memory.cpuBytes + memory.gpuBytes > 0)
+					candidates.emplace_back(record->second.lastUse, path);
+			}
+		}
+
+		std::sort(candidates.begin(), candidates.end());
+
+		uint32_t evicted = 0;
+
+		for (auto it = candidates.begin(); it != candidates.end() && overBudget(); ++it, ++evicted)
+			UnloadResource(it->second);
+
+		m_evictionCount += evicted;
+
+		return evicted;
+	}
+
+	template<typename T>
+	inline uint64_t AResourceManager<T>::AcquireResource(T* p_resource, uint64_t p_recordID)
+	{
+		/* A handle copied from a handle to an unloaded resource must not count for a new resource at the same address */
+		if (auto record = m_records.find(p_resource); record != m_records.end() && (p_recordID == 0 || record->second.id == p_recordID))
+		{
+			++record->second.references;
+			record->second.lastUse = ++m_useClock;
+			return record->second.id;
+		}
+
+		return 0;
+	}
+
+	template<typename T>
+	inline void AResourceManager<T>::ReleaseResource(T* p_resource, uint64_t p_recordID)
+	{
+		/* The resource may have been unloaded explicitly while referenced, and its address reused by another resource */
+		if (auto record = m_records.find(p_resource); record != m_records.end() && record->second.id == p_recordID && record->second.references > 0)
+		{
+			--record->second.references;
+			record->second.lastUse = ++m_useClock;
+		}
+	}
+
+	template<typename T>
+	inline void AResourceManager<T>::TrackResource(T* p_resource)
+	{
+		ResourceRecord& record = m_records[p_resource];
+		record.id = ++m_recordClock;
+		record.references = 0;
+		record.lastUse = ++m_useClock;
+		record.memory = GetResourceMemory(*p_resource);
+
+		m_memoryUsage.cpuBytes += record.memory.cpuBytes;
+		m_memoryUsage.gpuBytes += record.memory.gpuBytes;
+	}
+
+	template<typename T>
+	inline void AResourceManager<T>::ForgetResource(T* p_resource)
+	{
+		if (auto record = m_records.find(p_resource); record != m_records.end())
+		{
+			m_memoryUsage.cpuBytes -= record->second.memory.cpuBytes;
+			m_memoryUsage.gpuBytes -= record->second.memory.gpuBytes;
+			m_records.erase(record);
+		}
+	}
+
 	template<typename T>
 	inline T* AResourceManager<T>::operator[](const std::string & p_path)
 	{
@@ -120,6 +363,12 @@ namespace OvCore::ResourceManagement
 		__ENGINE_ASSETS_PATH	= p_engineAssetsPath;
 	}
 
+	template<typename T>
+	inline void AResourceManager<T>::ProvideAsyncLoader(AsyncLoader* p_loader)
+	{
+		__ASYNC_LOADER = p_loader;
+	}
+
 	template<typename T>
 	inline std::unordered_map<std::string, T*>& AResourceManager<T>::GetResources()
 	{
@@ -142,4 +391,6 @@ namespace OvCore::ResourceManagement
 
 		return result;
 	}
-}
\ No newline at end of file
+}
+
+#include "OvCore/ResourceManagement/ResourceHandle.h"
@@ -0,0 +1,96 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace OvCore::ResourceManagement
+{
+	/**
+	* Loads resources in two steps: a load task (File I/O, decoding) runs on a worker thread and returns
+	* an upload task (GPU resource creation) that is queued to the main thread, where ProcessUploads runs it
+	* within a per-frame time budget
+	*/
+	class AsyncLoader
+	{
+	public:
+		using UploadTask = std::function<void()>;
+		using LoadTask = std::function<UploadTask()>;
+
+		/**
+		* Create the loader and start its worker threads
+		* @param p_workerCount (Number of worker threads, uses the hardware concurrency minus the main thread if set to 0)
+		*/
+		AsyncLoader(uint32_t p_workerCount = 0);
+
+		/**
+		* Discard the load tasks that didn't start (Running their discard tasks), wait for the running ones and run their upload tasks
+		*/
+		~AsyncLoader();
+
+		AsyncLoader(const AsyncLoader&) = delete;
+		AsyncLoader& operator=(const AsyncLoader&) = delete;
+
+		/**
+		* Queue a load task. The upload task it returns (If any) will be run on the main thread by ProcessUploads.
+		* If the load task is discarded instead (The loader is destroyed before it starts), the given discard task is run on the main thread
+		* @param p_task
+		* @param p_discardTask
+		*/
+		void Submit(LoadTask p_task, UploadTask p_discardTask = nullptr);
+
+		/**
+		* Run the queued upload tasks until the given budget is exceeded (At least one task is run if any is queued).
+		* Must be called from the main thread. Returns the number of upload tasks run
+		* @param p_budget (In milliseconds)
+		*/
+		uint32_t ProcessUploads(float p_budget);
+
+		/**
+		* Wait for every submitted task to be loaded and uploaded. Must be called from the main thread
+		*/
+		void Flush();
+
+		/**
+		* Returns the number of submitted tasks that are not uploaded yet
+		*/
+		uint32_t GetPendingCount() const;
+
+		/**
+		* Returns the number of worker threads
+		*/
+		uint32_t GetWorkerCount() const;
+
+	private:
+		struct QueuedTask
+		{
+			LoadTask task;
+			UploadTask discardTask;
+		};
+
+		void WorkerLoop();
+		bool RunNextUpload();
+
+	private:
+		std::vector<std::thread> m_workers;
+
+		mutable std::mutex m_mutex;
+		std::condition_variable m_loadCondition;
+		std::condition_variable m_uploadCondition;
+
+		std::deque<QueuedTask> m_loadTasks;
+		std::deque<UploadTask> m_uploadTasks;
+		uint32_t m_pendingTasks = 0;
+		bool m_stopping = false;
+	};
+}
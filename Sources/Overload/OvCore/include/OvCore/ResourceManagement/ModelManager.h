@@ -36,5 +36,18 @@ namespace OvCore::ResourceManagement
 		* @param p_path
 		*/
 		virtual void ReloadResource(OvRendering::Resources::Model* p_resource, const std::string& p_path) override;
+
+	protected:
+		/**
+		* Decode the resource identified by the given path on a worker thread, then upload it on the main thread
+		* @param p_path
+		*/
+		virtual std::function<OvRendering::Resources::Model*()> DecodeResource(const std::string& p_path) override;
+
+		/**
+		* Returns the memory used by the vertex and index buffers of the given model, and by its animations
+		* @param p_resource
+		*/
+		virtual ResourceMemory GetResourceMemory(OvRendering::Resources::Model& p_resource) override;
 	};
 }
\ No newline at end of file
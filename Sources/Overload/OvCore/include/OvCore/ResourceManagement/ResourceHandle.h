@@ -0,0 +1,66 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#pragma once
+
+#include "OvCore/ResourceManagement/AResourceManager.h"
+
+namespace OvCore::ResourceManagement
+{
+	/**
+	* Counted reference to a resource of a resource manager.
+	* A resource referenced by at least one handle is never evicted by its manager (See AResourceManager::EvictUnusedResources).
+	* Handles to resources the manager doesn't own still give access to the resource, but aren't counted.
+	* A handle doesn't keep its resource from being unloaded explicitly (See AResourceManager::UnloadResource), the resource
+	* must not be accessed through it afterwards
+	*/
+	template<typename T>
+	class ResourceHandle
+	{
+	public:
+		/**
+		* Create an empty handle
+		*/
+		ResourceHandle() = default;
+
+		/**
+		* Create a handle to the given resource
+		* @param p_manager
+		* @param p_resource
+		*/
+		ResourceHandle(AResourceManager<T>& p_manager, T* p_resource);
+
+		ResourceHandle(const ResourceHandle& p_other);
+		ResourceHandle(ResourceHandle&& p_other) noexcept;
+		ResourceHandle& operator=(ResourceHandle p_other) noexcept;
+
+		/**
+		* Release the reference
+		*/
+		~ResourceHandle();
+
+		/**
+		* Release the reference and empty the handle
+		*/
+		void Reset();
+
+		/**
+		* Returns the referenced resource (nullptr if the handle is empty)
+		*/
+		T* Get() const;
+
+		T* operator->() const;
+
+		explicit operator bool() const;
+
+	private:
+		T* m_resource = nullptr;
+		uint64_t m_recordID = 0; // Record of the resource in the manager when the handle was created
+		AResourceManager<T>* m_manager = nullptr; // nullptr if the reference isn't counted
+	};
+}
+
+#include "OvCore/ResourceManagement/ResourceHandle.inl"
@@ -0,0 +1,82 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#pragma once
+
+#include <utility>
+
+#include "OvCore/ResourceManagement/ResourceHandle.h"
+
+namespace OvCore::ResourceManagement
+{
+	template<typename T>
+	inline ResourceHandle<T>::ResourceHandle(AResourceManager<T>& p_manager, T* p_resource) :
+		m_resource(p_resource),
+		m_recordID(p_resource ? p_manager.AcquireResource(p_resource) : 0),
+		m_manager(m_recordID ? &p_manager : nullptr)
+	{
+	}
+
+	template<typename T>
+	inline ResourceHandle<T>::ResourceHandle(const ResourceHandle& p_other) :
+		m_resource(p_other.m_resource),
+		m_recordID(p_other.m_manager ? p_other.m_manager->AcquireResource(p_other.m_resource, p_other.m_recordID) : 0),
+		m_manager(m_recordID ? p_other.m_manager : nullptr)
+	{
+	}
+
+	template<typename T>
+	inline ResourceHandle<T>::ResourceHandle(ResourceHandle&& p_other) noexcept :
+		m_resource(std::exchange(p_other.m_resource, nullptr)),
+		m_recordID(std::exchange(p_other.m_recordID, 0)),
+		m_manager(std::exchange(p_other.m_manager, nullptr))
+	{
+	}
+
+	template<typename T>
+	inline ResourceHandle<T>& ResourceHandle<T>::operator=(ResourceHandle p_other) noexcept
+	{
+		std::swap(m_resource, p_other.m_resource);
+		std::swap(m_recordID, p_other.m_recordID);
+		std::swap(m_manager, p_other.m_manager);
+		return *this;
+	}
+
+	template<typename T>
+	inline ResourceHandle<T>::~ResourceHandle()
+	{
+		Reset();
+	}
+
+	template<typename T>
+	inline void ResourceHandle<T>::Reset()
+	{
+		if (m_manager)
+			m_manager->ReleaseResource(m_resource, m_recordID);
+
+		m_resource = nullptr;
+		m_recordID = 0;
+		m_manager = nullptr;
+	}
+
+	template<typename T>
+	inline T* ResourceHandle<T>::Get() const
+	{
+		return m_resource;
+	}
+
+	template<typename T>
+	inline T* ResourceHandle<T>::operator->() const
+	{
+		return m_resource;
+	}
+
+	template<typename T>
+	inline ResourceHandle<T>::operator bool() const
+	{
+		return m_resource != nullptr;
+	}
+}
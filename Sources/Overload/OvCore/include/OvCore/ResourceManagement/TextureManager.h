@@ -36,5 +36,18 @@ namespace OvCore::ResourceManagement
 		* @param p_path
 		*/
 		virtual void ReloadResource(OvRendering::Resources::Texture* p_resource, const std::string& p_path) override;
+
+	protected:
+		/**
+		* Decode the resource identified by the given path on a worker thread, then upload it on the main thread
+		* @param p_path
+		*/
+		virtual std::function<OvRendering::Resources::Texture*()> DecodeResource(const std::string& p_path) override;
+
+		/**
+		* Returns the memory used by the given texture and its mips
+		* @param p_resource
+		*/
+		virtual ResourceMemory GetResourceMemory(OvRendering::Resources::Texture& p_resource) override;
 	};
 }
\ No newline at end of file
@@ -8,10 +8,15 @@
 
 #include <any>
 #include <map>
+#include <memory>
+#include <vector>
 
+#include <OvRendering/Core/GLStateCache.h>
 #include <OvRendering/Resources/Shader.h>
 
 #include "OvCore/API/ISerializable.h"
+#include "OvCore/Resources/MaterialParameterBlock.h"
+#include "OvCore/ResourceManagement/ResourceHandle.h"
 
 
 namespace OvCore::Resources
@@ -22,6 +27,16 @@ namespace OvCore::Resources
 	class Material : public API::ISerializable
 	{
 	public:
+		/**
+		* Constructor (Defined where the parameter buffer type is complete)
+		*/
+		Material();
+
+		/**
+		* Destructor
+		*/
+		virtual ~Material();
+
 		/**
 		* Defines the shader to attach to this material instance
 		* @param p_shader
@@ -36,13 +51,15 @@ namespace OvCore::Resources
 		/**
 		* Bind the material and send its uniform data to the GPU
 		* @parma p_emptyTexture (The texture to use if a texture uniform is nullptr)
+		* @param p_stateCache
 		*/
-		void Bind(OvRendering::Resources::Texture* p_emptyTexture);
+		void Bind(OvRendering::Resources::Texture* p_emptyTexture, OvRendering::Core::GLStateCache& p_stateCache);
 
 		/**
 		* Unbind the material
+		* @param p_stateCache
 		*/
-		void UnBind();
+		void UnBind(OvRendering::Core::GLStateCache& p_stateCache);
 
 		/**
 		* Set a shader uniform value
@@ -150,10 +167,22 @@ namespace OvCore::Resources
 		uint8_t GenerateStateMask() const;
 
 		/**
-		* Returns the uniforms data of the material
+		* Returns the uniforms data of the material. The parameter block is re-baked on the next bind, as the
+		* returned data can be modified
 		*/
 		std::map<std::string, std::any>& GetUniformsData();
 
+		/**
+		* Request the parameter block to be re-baked on the next bind. Must be called after modifying the
+		* uniforms data through a reference kept from a previous GetUniformsData() call
+		*/
+		void MarkParametersDirty();
+
+		/**
+		* Returns the parameter block of the material, as baked on the last bind
+		*/
+		const MaterialParameterBlock& GetParameterBlock() const;
+
 		/**
 		* Serialize the material
 		* @param p_doc
@@ -162,7 +191,8 @@ namespace OvCore::Resources
 		virtual void OnSerialize(tinyxml2::XMLDocument& p_doc, tinyxml2::XMLNode* p_node) override;
 
 		/**
-		* Deserialize the material
+		* Deserialize the material. Textures are streamed (See AResourceManager::LoadResourceAsync),
+		* so samplers may only be set a few frames later
 		* @param p_doc
 		* @param p_node
 		*/
@@ -170,10 +200,30 @@ namespace OvCore::Resources
 
 		const std::string path;
 
+	private:
+		void BakeParameters();
+
+		/**
+		* Make the texture handles reference the textures currently set in the uniforms data
+		*/
+		void UpdateTextureHandles();
+
 	private:
 		OvRendering::Resources::Shader* m_shader = nullptr;
 		std::map<std::string, std::any> m_uniformsData;
 
+		/* Keep the shader and the sampled textures from being evicted while the material uses them */
+		ResourceManagement::ResourceHandle<OvRendering::Resources::Shader> m_shaderHandle;
+		std::vector<ResourceManagement::ResourceHandle<OvRendering::Resources::Texture>> m_textureHandles;
+
+		MaterialParameterBlock m_parameterBlock;
+		std::unique_ptr<OvRendering::Buffers::UniformBuffer> m_parameterBuffer;
+		uint32_t m_bakedUniformsRevision = 0;
+		bool m_parametersDirty = true;
+
+		/* Token telling pending texture loads whether the material still exists */
+		std::shared_ptr<bool> m_lifetime = std::make_shared<bool>(true);
+
 		bool m_blendable		= false;
 		bool m_backfaceCulling	= true;
 		bool m_frontfaceCulling = false;
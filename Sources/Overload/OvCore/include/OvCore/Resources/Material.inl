@@ -6,6 +6,8 @@
 
 #pragma once
 
+#include <type_traits>
+
 #include <OvDebug/Logger.h>
 
 #include "OvCore/Resources/Material.h"
@@ -17,8 +19,14 @@ namespace OvCore::Resources
 	{
 		if (HasShader())
 		{
-			if (m_uniformsData.find(p_key) != m_uniformsData.end())
-				m_uniformsData[p_key] = std::any(p_value);
+			if (auto found = m_uniformsData.find(p_key); found != m_uniformsData.end())
+			{
+				found->second = std::any(p_value);
+				m_parametersDirty = true;
+
+				if constexpr (std::is_same_v<T, OvRendering::Resources::Texture*>)
+					UpdateTextureHandles();
+			}
 		}
 		else
 		{
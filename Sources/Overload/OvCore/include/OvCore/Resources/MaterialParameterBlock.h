@@ -0,0 +1,103 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#pragma once
+
+#include <any>
+#include <map>
+#include <string>
+#include <vector>
+#include <cstdint>
+
+#include <OvRendering/Core/GLStateCache.h>
+#include <OvRendering/Resources/UniformInfo.h>
+
+namespace OvRendering::Resources
+{
+	class Shader;
+	class Texture;
+}
+
+namespace OvRendering::Buffers { class UniformBuffer; }
+
+namespace OvCore::Resources
+{
+	/**
+	* Flat, typed representation of the parameters of a material, compiled against the uniforms of a shader.
+	* Baking resolves every parameter once (Uniform location, texture slot, packed value), so binding the material
+	* doesn't have to look anything up by name. Parameters declared in the MaterialUBO block are packed into a std140
+	* buffer image instead. Baking only reads the given uniform descriptions, so it doesn't require any rendering context
+	*/
+	class MaterialParameterBlock
+	{
+	public:
+		/**
+		* A parameter sent with glUniform*. Its value is stored in the packed values at the given offset
+		*/
+		struct Parameter
+		{
+			OvRendering::Resources::UniformType type;
+			uint32_t location;
+			uint32_t offset;
+		};
+
+		/**
+		* A texture bound to a texture unit (slot) for a sampler uniform
+		*/
+		struct Sampler
+		{
+			uint32_t location;
+			uint32_t slot;
+			OvRendering::Resources::Texture* texture;
+		};
+
+		/**
+		* Compile the given values against the given uniforms. Values that are missing or that don't match
+		* the type of their uniform are ignored
+		* @param p_uniforms
+		* @param p_values
+		* @param p_bufferSize (Size of the MaterialUBO block, 0 if the shader doesn't declare it)
+		*/
+		void Bake(const std::vector<OvRendering::Resources::UniformInfo>& p_uniforms, const std::map<std::string, std::any>& p_values, uint32_t p_bufferSize);
+
+		/**
+		* Send the baked parameters to the given (Bound) shader and bind the textures.
+		* The buffer image is only uploaded to the given uniform buffer if it changed since the last upload
+		* @param p_shader
+		* @param p_emptyTexture (The texture to use if a sampler has no texture)
+		* @param p_buffer (Can be nullptr if the block has no buffer image)
+		* @param p_stateCache
+		*/
+		void Upload(OvRendering::Resources::Shader& p_shader, OvRendering::Resources::Texture* p_emptyTexture, OvRendering::Buffers::UniformBuffer* p_buffer, OvRendering::Core::GLStateCache& p_stateCache);
+
+		/**
+		* Returns the parameters sent with glUniform*
+		*/
+		const std::vector<Parameter>& GetParameters() const;
+
+		/**
+		* Returns the samplers
+		*/
+		const std::vector<Sampler>& GetSamplers() const;
+
+		/**
+		* Returns the packed values of the parameters
+		*/
+		const std::vector<uint8_t>& GetValues() const;
+
+		/**
+		* Returns the std140 image of the MaterialUBO block (Empty if the shader doesn't declare it)
+		*/
+		const std::vector<uint8_t>& GetBufferData() const;
+
+	private:
+		std::vector<Parameter> m_parameters;
+		std::vector<Sampler> m_samplers;
+		std::vector<uint8_t> m_values;
+		std::vector<uint8_t> m_bufferData;
+		bool m_bufferUploaded = false;
+	};
+}
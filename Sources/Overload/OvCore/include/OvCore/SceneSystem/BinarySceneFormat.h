@@ -0,0 +1,92 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace OvCore::SceneSystem { class Scene; }
+
+namespace OvCore::SceneSystem
+{
+	/**
+	* Binary scene files, loaded without going through an XML document.
+	* The file is made of a versioned header followed by chunks (Unknown chunks are skipped):
+	* - A string table, holding every name, tag, component type and resource path once
+	* - The scene, where each actor and each of its components is a size-prefixed block of typed little-endian values
+	* written by IBinarySerializable (Blocks of unknown component types are skipped, missing trailing values are read as defaults)
+	*/
+	class BinarySceneFormat
+	{
+	public:
+		/**
+		* Disabled constructor
+		*/
+		BinarySceneFormat() = delete;
+
+		/**
+		* Returns true if the given data starts with a binary scene header
+		* @param p_data
+		* @param p_size
+		*/
+		static bool IsBinary(const uint8_t* p_data, size_t p_size);
+
+		/**
+		* Returns true if the given data is a binary scene that can be decoded (Supported version, string table and actor blocks within bounds)
+		* @param p_data
+		* @param p_size
+		*/
+		static bool Validate(const uint8_t* p_data, size_t p_size);
+
+		/**
+		* Encode the given scene
+		* @param p_scene
+		*/
+		static std::vector<uint8_t> Encode(Scene& p_scene);
+
+		/**
+		* Add the actors of a binary scene to the given scene. Returns false, without modifying the scene,
+		* if the data is corrupted or has an unsupported version
+		* @param p_data
+		* @param p_size
+		* @param p_scene
+		*/
+		static bool Decode(const uint8_t* p_data, size_t p_size, Scene& p_scene);
+
+		/**
+		* Encode the given scene to a binary scene file. Returns true on success
+		* @param p_scene
+		* @param p_filePath
+		*/
+		static bool Save(Scene& p_scene, const std::string& p_filePath);
+
+		/**
+		* Add the actors of a scene file (Binary or XML) to the given scene. The file is read through a single mapping.
+		* Returns false, without modifying the scene, if the file can't be read or parsed
+		* @param p_filePath
+		* @param p_scene
+		*/
+		static bool Load(const std::string& p_filePath, Scene& p_scene);
+
+		/**
+		* Convert a scene file (Binary or XML) to a binary scene file. Source and destination can be the same file.
+		* The scene is loaded to be converted, so the resource managers used by its components must be provided
+		* @param p_sourcePath
+		* @param p_destinationPath
+		*/
+		static bool ConvertToBinary(const std::string& p_sourcePath, const std::string& p_destinationPath);
+
+		/**
+		* Convert a scene file (Binary or XML) to an XML scene file. Source and destination can be the same file.
+		* The scene is loaded to be converted, so the resource managers used by its components must be provided
+		* @param p_sourcePath
+		* @param p_destinationPath
+		*/
+		static bool ConvertToXML(const std::string& p_sourcePath, const std::string& p_destinationPath);
+	};
+}
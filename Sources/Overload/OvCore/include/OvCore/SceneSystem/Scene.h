@@ -6,20 +6,30 @@
 
 #pragma once
 
+#include <functional>
+#include <unordered_map>
 
 #include "OvCore/ECS/Actor.h"
+#include "OvCore/ECS/UpdateSystem.h"
 #include "OvCore/API/ISerializable.h"
+#include "OvCore/API/IBinarySerializable.h"
 
 #include "OvCore/ECS/Components/CModelRenderer.h"
 #include "OvCore/ECS/Components/CCamera.h"
 #include "OvCore/ECS/Components/CLight.h"
+#include "OvCore/ECS/Components/CAnimation.h"
+
+namespace OvTools::Utils
+{
+	class ThreadPool;
+}
 
 namespace OvCore::SceneSystem
 {
 	/**
 	* The scene is a set of actors
 	*/
-	class Scene : public API::ISerializable
+	class Scene : public API::ISerializable, public API::IBinarySerializable
 	{
 	public:
 		/**
@@ -31,6 +41,7 @@ namespace OvCore::SceneSystem
 			std::vector<ECS::Components::CModelRenderer*>	modelRenderers;
 			std::vector<ECS::Components::CCamera*>			cameras;
 			std::vector<ECS::Components::CLight*>			lights;
+			std::vector<ECS::Components::CAnimation*>		animations;
 		};
 
 		/**
@@ -54,19 +65,21 @@ namespace OvCore::SceneSystem
 		bool IsPlaying() const;
 
 		/**
-		* Update every actors
+		* Update the components of active actors implementing OnUpdate (Thread-safe ones spread over the given thread pool, if any),
+		* then evaluate the animation poses of the active actors
 		* @param p_deltaTime
+		* @param p_threadPool
 		*/
-		void Update(float p_deltaTime);
+		void Update(float p_deltaTime, OvTools::Utils::ThreadPool* p_threadPool = nullptr);
 
 		/**
-		* Update every actors 60 frames per seconds
+		* Update the components of active actors implementing OnFixedUpdate, once per physics step
 		* @param p_deltaTime
 		*/
 		void FixedUpdate(float p_deltaTime);
 
 		/**
-		* Update every actors lately
+		* Update the components of active actors implementing OnLateUpdate
 		* @param p_deltaTime
 		*/
 		void LateUpdate(float p_deltaTime);
@@ -95,31 +108,31 @@ namespace OvCore::SceneSystem
 		void CollectGarbages();
 
 		/**
-		* Return the first actor identified by the given name, or nullptr on fail
+		* Return the first actor identified by the given name, or nullptr on fail. Goes through the name index, in linear time over the actors sharing that name
 		* @param p_name
 		*/
 		ECS::Actor* FindActorByName(const std::string& p_name);
 
 		/**
-		* Return the first actor identified by the given tag, or nullptr on fail
+		* Return the first actor identified by the given tag, or nullptr on fail. Goes through the tag index, in linear time over the actors sharing that tag
 		* @param p_tag
 		*/
 		ECS::Actor* FindActorByTag(const std::string& p_tag);
 
 		/**
-		* Return the actor identified by the given ID (Returns 0 on fail)
+		* Return the actor identified by the given ID (Returns 0 on fail). Goes through the ID index, in constant time unless IDs are shared
 		* @param p_id
 		*/
 		ECS::Actor* FindActorByID(int64_t p_id);
 
 		/**
-		* Return every actors identified by the given name
+		* Return every actors identified by the given name, in scene order (Sorted from the name index, in O(k log k) for k actors)
 		* @param p_name
 		*/
 		std::vector<std::reference_wrapper<ECS::Actor>> FindActorsByName(const std::string& p_name);
 
 		/**
-		* Return every actors identified by the given tag
+		* Return every actors identified by the given tag, in scene order (Sorted from the tag index, in O(k log k) for k actors)
 		* @param p_tag
 		*/
 		std::vector<std::reference_wrapper<ECS::Actor>> FindActorsByTag(const std::string& p_tag);
@@ -146,6 +159,12 @@ namespace OvCore::SceneSystem
 		*/
 		const FastAccessComponents& GetFastAccessComponents() const;
 
+		/**
+		* Return the fast access components owned by active actors. These lists are updated when actors get enabled or disabled
+		* (Instead of being filtered every frame), and keep the order of the fast access components
+		*/
+		const FastAccessComponents& GetActiveComponents() const;
+
 		/**
 		* Serialize the scene
 		* @param p_doc
@@ -154,17 +173,121 @@ namespace OvCore::SceneSystem
 		virtual void OnSerialize(tinyxml2::XMLDocument& p_doc, tinyxml2::XMLNode* p_root) override;
 
 		/**
-		* Deserialize the scene
+		* Deserialize the scene. Actors are loaded in bulk: their storage is reserved up front, parents are resolved
+		* through an ID index, and their components are registered to the scene in a single pass once every actor is loaded.
+		* If the scene is playing, loaded actors are awaken after the whole hierarchy is rebuilt
 		* @param p_doc
 		* @param p_root
 		*/
 		virtual void OnDeserialize(tinyxml2::XMLDocument& p_doc, tinyxml2::XMLNode* p_root) override;
 
+		/**
+		* Serialize the scene to the binary scene format (Each actor in its own block)
+		* @param p_writer
+		*/
+		virtual void OnBinarySerialize(Helpers::BinaryWriter& p_writer) override;
+
+		/**
+		* Deserialize the scene from the binary scene format. Actors are loaded in bulk, like OnDeserialize
+		* @param p_reader
+		*/
+		virtual void OnBinaryDeserialize(Helpers::BinaryReader& p_reader) override;
+
+	private:
+		/**
+		* Load the given number of actors in bulk, each actor being deserialized by the given function (Called in order).
+		* Parents are resolved and components registered once every actor is loaded
+		* @param p_actorCount
+		* @param p_deserialize
+		*/
+		void LoadActors(size_t p_actorCount, const std::function<void(ECS::Actor&)>& p_deserialize);
+
+		/**
+		* Allocate an actor and add it to the scene, without listening to its components nor waking it up
+		* @param p_actorID
+		* @param p_name
+		* @param p_tag
+		*/
+		ECS::Actor& InstantiateActor(int64_t p_actorID, const std::string& p_name, const std::string& p_tag);
+
+		/**
+		* Index the given actor by ID, name and tag, and keep the indexes, the fast access components and the update system up to date
+		* with the changes of the actor (Components and behaviours added or removed, active state, ID, name and tag)
+		* @param p_actor
+		*/
+		void ListenToActor(ECS::Actor& p_actor);
+
+		/**
+		* Remove the given actor from the ID, name and tag indexes (Before its destruction)
+		* @param p_actor
+		*/
+		void UnindexActor(ECS::Actor& p_actor);
+
+		/**
+		* Add the components of the given actor to the active components, or remove them, depending on the actor active state
+		* @param p_actor
+		*/
+		void OnActorActiveStateChanged(ECS::Actor& p_actor);
+
+		/**
+		* Add the given component to the active components (If it is a fast access component), or remove it
+		* @param p_component
+		* @param p_active
+		*/
+		void SetComponentActive(ECS::Components::AComponent& p_component, bool p_active);
+
+		/**
+		* Advance and evaluate the pose of every active animation. Animations only touch their own actor data,
+		* so they are evaluated in parallel when a thread pool is given
+		* @param p_deltaTime
+		* @param p_threadPool
+		*/
+		void UpdateAnimations(float p_deltaTime, OvTools::Utils::ThreadPool* p_threadPool);
+
 	private:
 		int64_t m_availableID = 1;
 		bool m_isPlaying = false;
 		std::vector<ECS::Actor*> m_actors;
 
 		FastAccessComponents m_fastAccessComponents;
+		FastAccessComponents m_activeComponents;
+		ECS::UpdateSystem m_updateSystem;
+
+		/* An actor of an index bucket, with its scene order (Buckets are unordered so removals are constant time, queries look for or sort by scene order) */
+		struct IndexedActor
+		{
+			ECS::Actor* actor;
+			uint64_t order;
+		};
+
+		/* Scene order of an actor, and its position in its bucket of each index (So it is removed by moving the last actor of the bucket in its place) */
+		struct ActorRecord
+		{
+			uint64_t order;
+			size_t idPosition = 0;
+			size_t namePosition = 0;
+			size_t tagPosition = 0;
+		};
+
+		/* Registration orders of the active components, stored along them so they are kept sorted without looking the orders up */
+		struct ActiveComponentOrders
+		{
+			std::vector<uint64_t> modelRenderers;
+			std::vector<uint64_t> cameras;
+			std::vector<uint64_t> lights;
+			std::vector<uint64_t> animations;
+		};
+
+		/* Actors by ID, name and tag. Queries return the same actor as a linear search of the actor list */
+		std::unordered_map<int64_t, std::vector<IndexedActor>> m_actorsByID;
+		std::unordered_map<std::string, std::vector<IndexedActor>> m_actorsByName;
+		std::unordered_map<std::string, std::vector<IndexedActor>> m_actorsByTag;
+		std::unordered_map<const ECS::Actor*, ActorRecord> m_actorRecords;
+		uint64_t m_actorOrderCount = 0;
+
+		/* Registration order of the components, used to keep the active components in the order of the fast access components */
+		std::unordered_map<const ECS::Components::AComponent*, uint64_t> m_componentOrders;
+		ActiveComponentOrders m_activeComponentOrders;
+		uint64_t m_componentOrderCount = 0;
 	};
 }
\ No newline at end of file
@@ -53,7 +53,7 @@ namespace OvCore::SceneSystem
 		void LoadEmptyLightedScene();
 
 		/**
-		* Load specific scene in memory
+		* Load specific scene in memory. The scene file can either be an XML or a binary scene (See BinarySceneFormat)
 		* @param p_scenePath
 		* @param p_absolute (If this setting is set to true, the scene loader will ignore the "SceneRootFolder" given on SceneManager construction)
 		*/
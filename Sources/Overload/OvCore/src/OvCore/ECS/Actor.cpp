@@ -5,6 +5,7 @@
 */
 
 #include <algorithm>
+#include <utility>
 
 #include "OvCore/ECS/Actor.h"
 
@@ -27,6 +28,9 @@ OvTools::Eventing::Event<OvCore::ECS::Actor&> OvCore::ECS::Actor::CreatedEvent;
 OvTools::Eventing::Event<OvCore::ECS::Actor&, OvCore::ECS::Actor&> OvCore::ECS::Actor::AttachEvent;
 OvTools::Eventing::Event<OvCore::ECS::Actor&> OvCore::ECS::Actor::DettachEvent;
 
+std::atomic<uint32_t> OvCore::ECS::Actor::__COMPONENT_TYPE_COUNT = 0;
+char OvCore::ECS::Actor::__UNRESOLVED_COMPONENT = 0;
+
 OvCore::ECS::Actor::Actor(int64_t p_actorID, const std::string & p_name, const std::string & p_tag, bool& p_playing) :
 	m_actorID(p_actorID),
 	m_name(p_name),
@@ -76,12 +80,20 @@ const std::string & OvCore::ECS::Actor::GetTag() const
 
 void OvCore::ECS::Actor::SetName(const std::string & p_name)
 {
-	m_name = p_name;
+	if (p_name != m_name)
+	{
+		const std::string previousName = std::exchange(m_name, p_name);
+		NameChangedEvent.Invoke(*this, previousName);
+	}
 }
 
 void OvCore::ECS::Actor::SetTag(const std::string & p_tag)
 {
-	m_tag = p_tag;
+	if (p_tag != m_tag)
+	{
+		const std::string previousTag = std::exchange(m_tag, p_tag);
+		TagChangedEvent.Invoke(*this, previousTag);
+	}
 }
 
 void OvCore::ECS::Actor::SetActive(bool p_active)
@@ -90,6 +102,7 @@ void OvCore::ECS::Actor::SetActive(bool p_active)
 	{
 		RecursiveWasActiveUpdate();
 		m_active = p_active;
+		RecursiveHierarchyActiveUpdate();
 		RecursiveActiveUpdate();
 	}
 }
@@ -101,12 +114,16 @@ bool OvCore::ECS::Actor::IsSelfActive() const
 
 bool OvCore::ECS::Actor::IsActive() const
 {
-	return m_active && (m_parent ? m_parent->IsActive() : true);
+	return m_hierarchyActive;
 }
 
 void OvCore::ECS::Actor::SetID(int64_t p_id)
 {
-	m_actorID = p_id;
+	if (p_id != m_actorID)
+	{
+		const int64_t previousID = std::exchange(m_actorID, p_id);
+		IDChangedEvent.Invoke(*this, previousID);
+	}
 }
 
 int64_t OvCore::ECS::Actor::GetID() const
@@ -126,6 +143,8 @@ void OvCore::ECS::Actor::SetParent(Actor& p_parent)
 	/* Store the actor in the parent children list */
 	p_parent.m_children.push_back(this);
 
+	RecursiveHierarchyActiveUpdate();
+
 	AttachEvent.Invoke(*this, p_parent);
 }
 
@@ -146,6 +165,8 @@ void OvCore::ECS::Actor::DetachFromParent()
 	m_parentID = 0;
 
 	transform.RemoveParent();
+
+	RecursiveHierarchyActiveUpdate();
 }
 
 bool OvCore::ECS::Actor::HasParent() const
@@ -289,6 +310,7 @@ bool OvCore::ECS::Actor::RemoveComponent(OvCore::ECS::Components::AComponent& p_
 		{
 			ComponentRemovedEvent.Invoke(p_component);
 			m_components.erase(it);
+			InvalidateComponentLookup();
 			return true;
 		}
 	}
@@ -296,6 +318,21 @@ bool OvCore::ECS::Actor::RemoveComponent(OvCore::ECS::Components::AComponent& p_
 	return false;
 }
 
+void OvCore::ECS::Actor::InvalidateComponentLookup()
+{
+	const uint32_t typeCount = __COMPONENT_TYPE_COUNT;
+
+	/* Grown with some room, so types registered later still get a slot */
+	if (typeCount > m_componentLookupSize)
+	{
+		m_componentLookupSize = (typeCount + 7) / 8 * 8;
+		m_componentLookup = std::make_unique<std::atomic<void*>[]>(m_componentLookupSize);
+	}
+
+	for (uint32_t i = 0; i < m_componentLookupSize; ++i)
+		m_componentLookup[i].store(&__UNRESOLVED_COMPONENT, std::memory_order_relaxed);
+}
+
 std::vector<std::shared_ptr<OvCore::ECS::Components::AComponent>>& OvCore::ECS::Actor::GetComponents()
 {
 	return m_components;
@@ -415,11 +452,19 @@ void OvCore::ECS::Actor::OnSerialize(tinyxml2::XMLDocument & p_doc, tinyxml2::XM
 
 void OvCore::ECS::Actor::OnDeserialize(tinyxml2::XMLDocument & p_doc, tinyxml2::XMLNode * p_actorsRoot)
 {
-	OvCore::Helpers::Serializer::DeserializeString(p_doc, p_actorsRoot, "name", m_name);
-	OvCore::Helpers::Serializer::DeserializeString(p_doc, p_actorsRoot, "tag", m_tag);
-	OvCore::Helpers::Serializer::DeserializeBoolean(p_doc, p_actorsRoot, "active", m_active);
-	OvCore::Helpers::Serializer::DeserializeInt64(p_doc, p_actorsRoot, "id", m_actorID);
-	OvCore::Helpers::Serializer::DeserializeInt64(p_doc, p_actorsRoot, "parent", m_parentID);
+	std::string name = m_name;
+	std::string tag = m_tag;
+	bool active = m_active;
+	int64_t actorID = m_actorID;
+	int64_t parentID = m_parentID;
+
+	OvCore::Helpers::Serializer::DeserializeString(p_doc, p_actorsRoot, "name", name);
+	OvCore::Helpers::Serializer::DeserializeString(p_doc, p_actorsRoot, "tag", tag);
+	OvCore::Helpers::Serializer::DeserializeBoolean(p_doc, p_actorsRoot, "active", active);
+	OvCore::Helpers::Serializer::DeserializeInt64(p_doc, p_actorsRoot, "id", actorID);
+	OvCore::Helpers::Serializer::DeserializeInt64(p_doc, p_actorsRoot, "parent", parentID);
+
+	ApplySettings(name, tag, active, actorID, parentID);
 
 	{
 		tinyxml2::XMLNode* componentsRoot = p_actorsRoot->FirstChildElement("components");
@@ -429,26 +474,7 @@ void OvCore::ECS::Actor::OnDeserialize(tinyxml2::XMLDocument & p_doc, tinyxml2::
 
 			while (currentComponent)
 			{
-				std::string componentType = currentComponent->FirstChildElement("type")->GetText();
-				OvCore::ECS::Components::AComponent* component = nullptr;
-
-				// TODO: Use component name instead of typeid (unsafe)
-				if (componentType == typeid(Components::CTransform).name())			component = &transform;
-				else if (componentType == typeid(Components::CPhysicalBox).name())			component = &AddComponent<OvCore::ECS::Components::CPhysicalBox>();
-				else if (componentType == typeid(Components::CPhysicalSphere).name())		component = &AddComponent<OvCore::ECS::Components::CPhysicalSphere>();
-				else if (componentType == typeid(Components::CPhysicalCapsule).name())		component = &AddComponent<OvCore::ECS::Components::CPhysicalCapsule>();
-				else if (componentType == typeid(Components::CModelRenderer).name())			component = &AddComponent<OvCore::ECS::Components::CModelRenderer>();
-				else if (componentType == typeid(Components::CCamera).name())				component = &AddComponent<OvCore::ECS::Components::CCamera>();
-				else if (componentType == typeid(Components::CMaterialRenderer).name())		component = &AddComponent<OvCore::ECS::Components::CMaterialRenderer>();
-				else if (componentType == typeid(Components::CAudioSource).name())			component = &AddComponent<OvCore::ECS::Components::CAudioSource>();
-				else if (componentType == typeid(Components::CAudioListener).name())		component = &AddComponent<OvCore::ECS::Components::CAudioListener>();
-				else if (componentType == typeid(Components::CPointLight).name())			component = &AddComponent<OvCore::ECS::Components::CPointLight>();
-				else if (componentType == typeid(Components::CDirectionalLight).name())		component = &AddComponent<OvCore::ECS::Components::CDirectionalLight>();
-				else if (componentType == typeid(Components::CSpotLight).name())			component = &AddComponent<OvCore::ECS::Components::CSpotLight>();
-				else if (componentType == typeid(Components::CAmbientBoxLight).name())		component = &AddComponent<OvCore::ECS::Components::CAmbientBoxLight>();
-				else if (componentType == typeid(Components::CAmbientSphereLight).name())	component = &AddComponent<OvCore::ECS::Components::CAmbientSphereLight>();
-
-				if (component)
+				if (auto component = AddComponentByType(currentComponent->FirstChildElement("type")->GetText()))
 					component->OnDeserialize(p_doc, currentComponent->FirstChildElement("data"));
 
 				currentComponent = currentComponent->NextSiblingElement("component");
@@ -476,6 +502,103 @@ void OvCore::ECS::Actor::OnDeserialize(tinyxml2::XMLDocument & p_doc, tinyxml2::
 	}
 }
 
+void OvCore::ECS::Actor::OnBinarySerialize(Helpers::BinaryWriter& p_writer)
+{
+	p_writer.WriteString(m_name);
+	p_writer.WriteString(m_tag);
+	p_writer.WriteBoolean(m_active);
+	p_writer.WriteInt64(m_actorID);
+	p_writer.WriteInt64(m_parentID);
+
+	p_writer.WriteUint(static_cast<uint32_t>(m_components.size()));
+
+	for (auto& component : m_components)
+	{
+		Helpers::BinaryWriter block(p_writer.GetStrings());
+		component->OnBinarySerialize(block);
+
+		p_writer.WriteString(typeid(*component).name());
+		p_writer.WriteBlock(block);
+	}
+
+	p_writer.WriteUint(static_cast<uint32_t>(m_behaviours.size()));
+
+	for (auto& [name, behaviour] : m_behaviours)
+	{
+		Helpers::BinaryWriter block(p_writer.GetStrings());
+		behaviour.OnBinarySerialize(block);
+
+		p_writer.WriteString(name);
+		p_writer.WriteBlock(block);
+	}
+}
+
+void OvCore::ECS::Actor::OnBinaryDeserialize(Helpers::BinaryReader& p_reader)
+{
+	const std::string name(p_reader.ReadString(m_name));
+	const std::string tag(p_reader.ReadString(m_tag));
+	const bool active = p_reader.ReadBoolean(m_active);
+	const int64_t actorID = p_reader.ReadInt64(m_actorID);
+	const int64_t parentID = p_reader.ReadInt64(m_parentID);
+
+	ApplySettings(name, tag, active, actorID, parentID);
+
+	const uint32_t componentCount = p_reader.ReadUint();
+
+	for (uint32_t i = 0; i < componentCount && p_reader.IsValid(); ++i)
+	{
+		const std::string_view type = p_reader.ReadString();
+		Helpers::BinaryReader block = p_reader.ReadBlock();
+
+		if (auto component = p_reader.IsValid() ? AddComponentByType(type) : nullptr)
+			component->OnBinaryDeserialize(block);
+	}
+
+	const uint32_t behaviourCount = p_reader.ReadUint();
+
+	for (uint32_t i = 0; i < behaviourCount && p_reader.IsValid(); ++i)
+	{
+		const std::string behaviourType(p_reader.ReadString());
+		Helpers::BinaryReader block = p_reader.ReadBlock();
+
+		if (p_reader.IsValid())
+			AddBehaviour(behaviourType).OnBinaryDeserialize(block);
+	}
+}
+
+void OvCore::ECS::Actor::ApplySettings(const std::string& p_name, const std::string& p_tag, bool p_active, int64_t p_actorID, int64_t p_parentID)
+{
+	m_active = p_active;
+	m_parentID = p_parentID;
+
+	SetName(p_name);
+	SetTag(p_tag);
+	SetID(p_actorID);
+
+	RecursiveHierarchyActiveUpdate();
+}
+
+OvCore::ECS::Components::AComponent* OvCore::ECS::Actor::AddComponentByType(std::string_view p_type)
+{
+	// TODO: Use component name instead of typeid (unsafe)
+	if (p_type == typeid(Components::CTransform).name())			return &transform;
+	else if (p_type == typeid(Components::CPhysicalBox).name())			return &AddComponent<OvCore::ECS::Components::CPhysicalBox>();
+	else if (p_type == typeid(Components::CPhysicalSphere).name())		return &AddComponent<OvCore::ECS::Components::CPhysicalSphere>();
+	else if (p_type == typeid(Components::CPhysicalCapsule).name())		return &AddComponent<OvCore::ECS::Components::CPhysicalCapsule>();
+	else if (p_type == typeid(Components::CModelRenderer).name())			return &AddComponent<OvCore::ECS::Components::CModelRenderer>();
+	else if (p_type == typeid(Components::CCamera).name())				return &AddComponent<OvCore::ECS::Components::CCamera>();
+	else if (p_type == typeid(Components::CMaterialRenderer).name())		return &AddComponent<OvCore::ECS::Components::CMaterialRenderer>();
+	else if (p_type == typeid(Components::CAudioSource).name())			return &AddComponent<OvCore::ECS::Components::CAudioSource>();
+	else if (p_type == typeid(Components::CAudioListener).name())		return &AddComponent<OvCore::ECS::Components::CAudioListener>();
+	else if (p_type == typeid(Components::CPointLight).name())			return &AddComponent<OvCore::ECS::Components::CPointLight>();
+	else if (p_type == typeid(Components::CDirectionalLight).name())		return &AddComponent<OvCore::ECS::Components::CDirectionalLight>();
+	else if (p_type == typeid(Components::CSpotLight).name())			return &AddComponent<OvCore::ECS::Components::CSpotLight>();
+	else if (p_type == typeid(Components::CAmbientBoxLight).name())		return &AddComponent<OvCore::ECS::Components::CAmbientBoxLight>();
+	else if (p_type == typeid(Components::CAmbientSphereLight).name())	return &AddComponent<OvCore::ECS::Components::CAmbientSphereLight>();
+
+	return nullptr;
+}
+
 void OvCore::ECS::Actor::RecursiveActiveUpdate()
 {
 	bool isActive = IsActive();
@@ -507,3 +630,18 @@ void OvCore::ECS::Actor::RecursiveWasActiveUpdate()
 	for (auto child : m_children)
 		child->RecursiveWasActiveUpdate();
 }
+
+void OvCore::ECS::Actor::RecursiveHierarchyActiveUpdate()
+{
+	const bool hierarchyActive = m_active && (m_parent ? m_parent->m_hierarchyActive : true);
+
+	/* Children states only depend on their parent state, so they are left untouched if it didn't change */
+	if (hierarchyActive != m_hierarchyActive)
+	{
+		m_hierarchyActive = hierarchyActive;
+		ActiveStateChangedEvent.Invoke(*this);
+
+		for (auto child : m_children)
+			child->RecursiveHierarchyActiveUpdate();
+	}
+}
@@ -151,6 +151,14 @@ void OvCore::ECS::Components::Behaviour::OnDeserialize(tinyxml2::XMLDocument & p
 {
 }
 
+void OvCore::ECS::Components::Behaviour::OnBinarySerialize(OvCore::Helpers::BinaryWriter& p_writer)
+{
+}
+
+void OvCore::ECS::Components::Behaviour::OnBinaryDeserialize(OvCore::Helpers::BinaryReader& p_reader)
+{
+}
+
 void OvCore::ECS::Components::Behaviour::OnInspector(OvUI::Internal::WidgetContainer & p_root)
 {
 	using namespace OvMaths;
@@ -62,6 +62,23 @@ void OvCore::ECS::Components::CAmbientBoxLight::OnDeserialize(tinyxml2::XMLDocum
 	m_data.quadratic = size.z;
 }
 
+void OvCore::ECS::Components::CAmbientBoxLight::OnBinarySerialize(OvCore::Helpers::BinaryWriter& p_writer)
+{
+	CLight::OnBinarySerialize(p_writer);
+
+	p_writer.WriteVec3({ m_data.constant, m_data.linear, m_data.quadratic });
+}
+
+void OvCore::ECS::Components::CAmbientBoxLight::OnBinaryDeserialize(OvCore::Helpers::BinaryReader& p_reader)
+{
+	CLight::OnBinaryDeserialize(p_reader);
+
+	const OvMaths::FVector3 size = p_reader.ReadVec3({ m_data.constant, m_data.linear, m_data.quadratic });
+	m_data.constant = size.x;
+	m_data.linear = size.y;
+	m_data.quadratic = size.z;
+}
+
 void OvCore::ECS::Components::CAmbientBoxLight::OnInspector(OvUI::Internal::WidgetContainer& p_root)
 {
 	using namespace OvCore::Helpers;
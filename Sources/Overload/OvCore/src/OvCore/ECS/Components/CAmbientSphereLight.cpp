@@ -55,6 +55,20 @@ void OvCore::ECS::Components::CAmbientSphereLight::OnDeserialize(tinyxml2::XMLDo
 	Serializer::DeserializeFloat(p_doc, p_node, "radius", m_data.constant);
 }
 
+void OvCore::ECS::Components::CAmbientSphereLight::OnBinarySerialize(OvCore::Helpers::BinaryWriter& p_writer)
+{
+	CLight::OnBinarySerialize(p_writer);
+
+	p_writer.WriteFloat(m_data.constant);
+}
+
+void OvCore::ECS::Components::CAmbientSphereLight::OnBinaryDeserialize(OvCore::Helpers::BinaryReader& p_reader)
+{
+	CLight::OnBinaryDeserialize(p_reader);
+
+	m_data.constant = p_reader.ReadFloat(m_data.constant);
+}
+
 void OvCore::ECS::Components::CAmbientSphereLight::OnInspector(OvUI::Internal::WidgetContainer& p_root)
 {
 	using namespace OvCore::Helpers;
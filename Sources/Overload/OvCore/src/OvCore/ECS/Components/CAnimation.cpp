@@ -1,3 +1,5 @@
+#include <algorithm>
+
 #include <OvUI/Widgets/Drags/DragFloat.h>
 #include <OvUI/Widgets/Selection/ComboBox.h>
 #include <OvUI/Plugins/DataDispatcher.h>
@@ -9,6 +11,8 @@
 OvRendering::Resources::ModelHierarchy* OvCore::ECS::Components::CAnimation::GetModelHierarchy()
 {
 	auto pModelRenderer = owner.GetComponent<CModelRenderer>();
+	if (!pModelRenderer || !pModelRenderer->GetModel())
+		return nullptr;
 	return pModelRenderer->GetModel()->GetHierarchy();
 }
 
@@ -17,6 +21,103 @@ OvCore::ECS::Components::CAnimation::CAnimation(ECS::Actor& p_owner) : AComponen
 
 }
 
+OvCore::ECS::Components::CAnimation::~CAnimation()
+{
+	ClearPlayCtrls();
+}
+
+void OvCore::ECS::Components::CAnimation::ClearPlayCtrls()
+{
+	for (auto& ctrl : playCtrls)
+		delete ctrl.m_calculator;
+
+	playCtrls.clear();
+	m_playCtrlsHierarchy = nullptr;
+	m_rigPalettes.clear();
+	m_bonePalettes.clear();
+}
+
+void OvCore::ECS::Components::CAnimation::AllocateBonePalettes(const OvRendering::Resources::Model& p_model)
+{
+	size_t boneCount = 0;
+
+	for (auto mesh : p_model.GetMeshes())
+	{
+		const auto& rig = mesh->m_rigInfo;
+
+		if (!rig.m_boneInfos.empty())
+		{
+			m_rigPalettes.push_back({ &rig, boneCount });
+			boneCount += rig.m_boneInfos.size();
+		}
+	}
+
+	m_bonePalettes.resize(boneCount);
+}
+
+void OvCore::ECS::Components::CAnimation::EvaluateBonePalettes()
+{
+	const auto calculator = playCtrls.front().m_calculator;
+
+	for (const auto& rigPalette : m_rigPalettes)
+		calculator->GetRigBoneTransforms(*rigPalette.rig, m_bonePalettes.data() + rigPalette.offset);
+}
+
+std::vector<OvRendering::Resources::AnimationPlayCtrl>* OvCore::ECS::Components::CAnimation::GetPlayCtrls()
+{
+	auto hierarchy = GetModelHierarchy();
+
+	if (hierarchy != m_playCtrlsHierarchy)
+	{
+		ClearPlayCtrls();
+
+		if (hierarchy && hierarchy->animations.size())
+		{
+			OvRendering::Resources::AnimationPlayCtrl ctrl;
+			ctrl.m_animation = &hierarchy->animations[0];
+			ctrl.m_calculator = new OvRendering::Resources::ModelNodeTransformCalculator(*hierarchy, *ctrl.m_animation);
+			ctrl.time = 0.0;
+			playCtrls.emplace_back(ctrl);
+
+			AllocateBonePalettes(*owner.GetComponent<CModelRenderer>()->GetModel());
+			EvaluateBonePalettes();
+		}
+
+		m_playCtrlsHierarchy = hierarchy;
+	}
+
+	return playCtrls.empty() ? nullptr : &playCtrls;
+}
+
+void OvCore::ECS::Components::CAnimation::UpdatePose(float p_deltaTime)
+{
+	if (auto ctrls = GetPlayCtrls())
+	{
+		auto& ctrl = ctrls->front();
+
+		if (!isPaused)
+			ctrl.time += p_deltaTime;
+
+		ctrl.m_calculator->SampleAnimation(ctrl.time);
+		EvaluateBonePalettes();
+	}
+}
+
+void OvCore::ECS::Components::CAnimation::GetBonePalette(const OvRendering::Resources::MeshRigInfo& p_rig, OvMaths::FMatrix4* p_transforms) const
+{
+	for (const auto& rigPalette : m_rigPalettes)
+	{
+		if (rigPalette.rig == &p_rig)
+		{
+			std::copy_n(m_bonePalettes.data() + rigPalette.offset, p_rig.m_boneInfos.size(), p_transforms);
+			return;
+		}
+	}
+
+	/* The rig doesn't belong to the model the palettes were allocated for, evaluate it from the cached pose */
+	playCtrls.front().m_calculator->GetRigBoneTransforms(p_rig, p_transforms);
+}
+
 
 const OvRendering::Resources::MeshBones* OvCore::ECS::Components::CAnimation::GetBones()
 {
@@ -36,6 +137,14 @@ void OvCore::ECS::Components::CAnimation::OnDeserialize(tinyxml2::XMLDocument& p
 {
 }
 
+void OvCore::ECS::Components::CAnimation::OnBinarySerialize(OvCore::Helpers::BinaryWriter& p_writer)
+{
+}
+
+void OvCore::ECS::Components::CAnimation::OnBinaryDeserialize(OvCore::Helpers::BinaryReader& p_reader)
+{
+}
+
 void OvCore::ECS::Components::CAnimation::OnInspector(OvUI::Internal::WidgetContainer& p_root)
 {
 }
@@ -27,6 +27,14 @@ void OvCore::ECS::Components::CAudioListener::OnDeserialize(tinyxml2::XMLDocumen
 {
 }
 
+void OvCore::ECS::Components::CAudioListener::OnBinarySerialize(OvCore::Helpers::BinaryWriter& p_writer)
+{
+}
+
+void OvCore::ECS::Components::CAudioListener::OnBinaryDeserialize(OvCore::Helpers::BinaryReader& p_reader)
+{
+}
+
 void OvCore::ECS::Components::CAudioListener::OnInspector(OvUI::Internal::WidgetContainer& p_root)
 {
 
@@ -12,6 +12,7 @@
 #include "OvCore/ECS/Actor.h"
 #include "OvCore/Global/ServiceLocator.h"
 #include "OvCore/SceneSystem/SceneManager.h"
+#include "OvCore/ResourceManagement/SoundManager.h"
 
 OvCore::ECS::Components::CAudioSource::CAudioSource(ECS::Actor& p_owner) :
 	AComponent(p_owner),
@@ -27,6 +28,7 @@ std::string OvCore::ECS::Components::CAudioSource::GetName()
 void OvCore::ECS::Components::CAudioSource::SetSound(OvAudio::Resources::Sound* p_sound)
 {
 	m_sound = p_sound;
+	m_soundHandle = OVSERVICE(OvCore::ResourceManagement::SoundManager).GetHandle(m_sound);
 }
 
 void OvCore::ECS::Components::CAudioSource::SetAutoplay(bool p_autoplay)
@@ -159,6 +161,32 @@ void OvCore::ECS::Components::CAudioSource::OnDeserialize(tinyxml2::XMLDocument&
 	SetPitch(Serializer::DeserializeFloat(p_doc, p_node, "pitch"));
 	SetAttenuationThreshold(Serializer::DeserializeFloat(p_doc, p_node, "attenuation_threshold"));
 	Serializer::DeserializeSound(p_doc, p_node, "audio_clip", m_sound);
+	m_soundHandle = OVSERVICE(OvCore::ResourceManagement::SoundManager).GetHandle(m_sound);
+}
+
+void OvCore::ECS::Components::CAudioSource::OnBinarySerialize(OvCore::Helpers::BinaryWriter& p_writer)
+{
+	p_writer.WriteBoolean(m_autoPlay);
+	p_writer.WriteBoolean(IsSpatial());
+	p_writer.WriteFloat(GetVolume());
+	p_writer.WriteFloat(GetPan());
+	p_writer.WriteBoolean(IsLooped());
+	p_writer.WriteFloat(GetPitch());
+	p_writer.WriteFloat(GetAttenuationThreshold());
+	p_writer.WriteSound(m_sound);
+}
+
+void OvCore::ECS::Components::CAudioSource::OnBinaryDeserialize(OvCore::Helpers::BinaryReader& p_reader)
+{
+	m_autoPlay = p_reader.ReadBoolean(m_autoPlay);
+	SetSpatial(p_reader.ReadBoolean(IsSpatial()));
+	SetVolume(p_reader.ReadFloat(GetVolume()));
+	SetPan(p_reader.ReadFloat(GetPan()));
+	SetLooped(p_reader.ReadBoolean(IsLooped()));
+	SetPitch(p_reader.ReadFloat(GetPitch()));
+	SetAttenuationThreshold(p_reader.ReadFloat(GetAttenuationThreshold()));
+	m_sound = p_reader.ReadSound(m_sound);
+	m_soundHandle = OVSERVICE(OvCore::ResourceManagement::SoundManager).GetHandle(m_sound);
 }
 
 void OvCore::ECS::Components::CAudioSource::OnInspector(OvUI::Internal::WidgetContainer& p_root)
@@ -138,6 +138,30 @@ void OvCore::ECS::Components::CCamera::OnDeserialize(tinyxml2::XMLDocument & p_d
     }
 }
 
+void OvCore::ECS::Components::CCamera::OnBinarySerialize(OvCore::Helpers::BinaryWriter& p_writer)
+{
+	p_writer.WriteFloat(m_camera.GetFov());
+	p_writer.WriteFloat(m_camera.GetSize());
+	p_writer.WriteFloat(m_camera.GetNear());
+	p_writer.WriteFloat(m_camera.GetFar());
+	p_writer.WriteVec3(m_camera.GetClearColor());
+	p_writer.WriteBoolean(m_camera.HasFrustumGeometryCulling());
+	p_writer.WriteBoolean(m_camera.HasFrustumLightCulling());
+	p_writer.WriteInt(static_cast<int>(m_camera.GetProjectionMode()));
+}
+
+void OvCore::ECS::Components::CCamera::OnBinaryDeserialize(OvCore::Helpers::BinaryReader& p_reader)
+{
+	m_camera.SetFov(p_reader.ReadFloat(m_camera.GetFov()));
+	m_camera.SetSize(p_reader.ReadFloat(m_camera.GetSize()));
+	m_camera.SetNear(p_reader.ReadFloat(m_camera.GetNear()));
+	m_camera.SetFar(p_reader.ReadFloat(m_camera.GetFar()));
+	m_camera.SetClearColor(p_reader.ReadVec3(m_camera.GetClearColor()));
+	m_camera.SetFrustumGeometryCulling(p_reader.ReadBoolean(m_camera.HasFrustumGeometryCulling()));
+	m_camera.SetFrustumLightCulling(p_reader.ReadBoolean(m_camera.HasFrustumLightCulling()));
+	m_camera.SetProjectionMode(static_cast<OvRendering::Settings::EProjectionMode>(p_reader.ReadInt(static_cast<int>(m_camera.GetProjectionMode()))));
+}
+
 void OvCore::ECS::Components::CCamera::OnInspector(OvUI::Internal::WidgetContainer& p_root)
 {
     auto currentProjectionMode = GetProjectionMode();
@@ -33,6 +33,16 @@ void OvCore::ECS::Components::CDirectionalLight::OnDeserialize(tinyxml2::XMLDocu
 	CLight::OnDeserialize(p_doc, p_node);
 }
 
+void OvCore::ECS::Components::CDirectionalLight::OnBinarySerialize(OvCore::Helpers::BinaryWriter& p_writer)
+{
+	CLight::OnBinarySerialize(p_writer);
+}
+
+void OvCore::ECS::Components::CDirectionalLight::OnBinaryDeserialize(OvCore::Helpers::BinaryReader& p_reader)
+{
+	CLight::OnBinaryDeserialize(p_reader);
+}
+
 void OvCore::ECS::Components::CDirectionalLight::OnInspector(OvUI::Internal::WidgetContainer& p_root)
 {
 	CLight::OnInspector(p_root);
@@ -61,6 +61,18 @@ void OvCore::ECS::Components::CLight::OnDeserialize(tinyxml2::XMLDocument & p_do
 	Serializer::DeserializeFloat(p_doc, p_node, "intensity", m_data.intensity);
 }
 
+void OvCore::ECS::Components::CLight::OnBinarySerialize(OvCore::Helpers::BinaryWriter& p_writer)
+{
+	p_writer.WriteVec3(m_data.color);
+	p_writer.WriteFloat(m_data.intensity);
+}
+
+void OvCore::ECS::Components::CLight::OnBinaryDeserialize(OvCore::Helpers::BinaryReader& p_reader)
+{
+	m_data.color = p_reader.ReadVec3(m_data.color);
+	m_data.intensity = p_reader.ReadFloat(m_data.intensity);
+}
+
 void OvCore::ECS::Components::CLight::OnInspector(OvUI::Internal::WidgetContainer& p_root)
 {
 	using namespace OvCore::Helpers;
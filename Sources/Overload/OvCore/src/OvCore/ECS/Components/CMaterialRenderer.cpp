@@ -38,11 +38,14 @@ void OvCore::ECS::Components::CMaterialRenderer::FillWithMaterial(OvCore::Resour
 {
 	for (uint8_t i = 0; i < m_materials.size(); ++i)
 		m_materials[i] = &p_material;
+
+	UpdateMaterialHandles();
 }
 
 void OvCore::ECS::Components::CMaterialRenderer::SetMaterialAtIndex(uint8_t p_index, OvCore::Resources::Material& p_material)
 {
 	m_materials[p_index] = &p_material;
+	UpdateMaterialHandles();
 }
 
 OvCore::Resources::Material* OvCore::ECS::Components::CMaterialRenderer::GetMaterialAtIndex(uint8_t p_index)
@@ -55,6 +58,7 @@ void OvCore::ECS::Components::CMaterialRenderer::RemoveMaterialAtIndex(uint8_t p
 	if (p_index < m_materials.size())
 	{
 		m_materials[p_index] = nullptr;;
+		UpdateMaterialHandles();
 	}
 }
 
@@ -63,12 +67,16 @@ void OvCore::ECS::Components::CMaterialRenderer::RemoveMaterialByInstance(OvCore
 	for (uint8_t i = 0; i < m_materials.size(); ++i)
 		if (m_materials[i] == &p_instance)
 			m_materials[i] = nullptr;
+
+	UpdateMaterialHandles();
 }
 
 void OvCore::ECS::Components::CMaterialRenderer::RemoveAllMaterials()
 {
 	for (uint8_t i = 0; i < m_materials.size(); ++i)
 		m_materials[i] = nullptr;
+
+	UpdateMaterialHandles();
 }
 
 const OvMaths::FMatrix4 & OvCore::ECS::Components::CMaterialRenderer::GetUserMatrix() const
@@ -117,6 +125,34 @@ void OvCore::ECS::Components::CMaterialRenderer::OnDeserialize(tinyxml2::XMLDocu
 	UpdateMaterialList();
 }
 
+void OvCore::ECS::Components::CMaterialRenderer::OnBinarySerialize(OvCore::Helpers::BinaryWriter& p_writer)
+{
+	/* Materials are written up to the last one set, as the model may not be loaded yet (See CModelRenderer::OnDeserialize) */
+	uint32_t materialCount = MAX_MATERIAL_COUNT;
+	while (materialCount > 0 && !m_materials[materialCount - 1])
+		--materialCount;
+
+	p_writer.WriteUint(materialCount);
+
+	for (uint32_t i = 0; i < materialCount; ++i)
+		p_writer.WriteMaterial(m_materials[i]);
+}
+
+void OvCore::ECS::Components::CMaterialRenderer::OnBinaryDeserialize(OvCore::Helpers::BinaryReader& p_reader)
+{
+	const uint32_t materialCount = p_reader.ReadUint();
+
+	for (uint32_t i = 0; i < materialCount && p_reader.IsValid(); ++i)
+	{
+		auto material = p_reader.ReadMaterial();
+
+		if (material && i < MAX_MATERIAL_COUNT)
+			m_materials[i] = material;
+	}
+
+	UpdateMaterialList();
+}
+
 std::array<OvUI::Widgets::AWidget*, 3> CustomMaterialDrawer(OvUI::Internal::WidgetContainer& p_root, const std::string& p_name, OvCore::Resources::Material*& p_data)
 {
 	using namespace OvCore::Helpers;
@@ -171,6 +207,8 @@ void OvCore::ECS::Components::CMaterialRenderer::OnInspector(OvUI::Internal::Wid
 
 void OvCore::ECS::Components::CMaterialRenderer::UpdateMaterialList()
 {
+	UpdateMaterialHandles();
+
 	if (auto modelRenderer = owner.GetComponent<CModelRenderer>(); modelRenderer && modelRenderer->GetModel())
 	{
 		uint8_t materialIndex = 0;
@@ -197,6 +235,15 @@ void OvCore::ECS::Components::CMaterialRenderer::UpdateMaterialList()
 	}
 }
 
+void OvCore::ECS::Components::CMaterialRenderer::UpdateMaterialHandles()
+{
+	auto& materialManager = OVSERVICE(OvCore::ResourceManagement::MaterialManager);
+
+	for (uint8_t i = 0; i < m_materials.size(); ++i)
+		if (m_materialHandles[i].Get() != m_materials[i])
+			m_materialHandles[i] = materialManager.GetHandle(m_materials[i]);
+}
+
 void OvCore::ECS::Components::CMaterialRenderer::SetUserMatrixElement(uint32_t p_row, uint32_t p_column, float p_value)
 {
 	if (p_row < 4 && p_column < 4)
@@ -24,6 +24,9 @@ OvCore::ECS::Components::CModelRenderer::CModelRenderer(ECS::Actor& p_owner) : A
 {
 	m_modelChangedEvent += [this]
 	{
+		if (m_modelHandle.Get() != m_model)
+			m_modelHandle = OVSERVICE(OvCore::ResourceManagement::ModelManager).GetHandle(m_model);
+
 		if (auto materialRenderer = owner.GetComponent<CMaterialRenderer>())
 			materialRenderer->UpdateMaterialList();
 	};
@@ -37,6 +40,7 @@ std::string OvCore::ECS::Components::CModelRenderer::GetName()
 void OvCore::ECS::Components::CModelRenderer::SetModel(OvRendering::Resources::Model* p_model)
 {
 	m_model = p_model;
+	m_pendingModelPath.clear();
 	m_modelChangedEvent.Invoke();
 }
 
@@ -67,7 +71,11 @@ void OvCore::ECS::Components::CModelRenderer::SetCustomBoundingSphere(const OvRe
 
 void OvCore::ECS::Components::CModelRenderer::OnSerialize(tinyxml2::XMLDocument & p_doc, tinyxml2::XMLNode * p_node)
 {
-	OvCore::Helpers::Serializer::SerializeModel(p_doc, p_node, "model", m_model);
+	if (!m_model && !m_pendingModelPath.empty())
+		OvCore::Helpers::Serializer::SerializeString(p_doc, p_node, "model", m_pendingModelPath);
+	else
+		OvCore::Helpers::Serializer::SerializeModel(p_doc, p_node, "model", m_model);
+
 	OvCore::Helpers::Serializer::SerializeInt(p_doc, p_node, "frustum_behaviour", reinterpret_cast<int&>(m_frustumBehaviour));
 	OvCore::Helpers::Serializer::SerializeVec3(p_doc, p_node, "custom_bounding_sphere_position", m_customBoundingSphere.position);
 	OvCore::Helpers::Serializer::SerializeFloat(p_doc, p_node, "custom_bounding_sphere_radius", m_customBoundingSphere.radius);
@@ -75,12 +83,34 @@ void OvCore::ECS::Components::CModelRenderer::OnSerialize(tinyxml2::XMLDocument
 
 void OvCore::ECS::Components::CModelRenderer::OnDeserialize(tinyxml2::XMLDocument & p_doc, tinyxml2::XMLNode* p_node)
 {
-	OvCore::Helpers::Serializer::DeserializeModel(p_doc, p_node, "model", m_model);
+	LoadModelAsync(OvCore::Helpers::Serializer::DeserializeString(p_doc, p_node, "model"));
+
 	OvCore::Helpers::Serializer::DeserializeInt(p_doc, p_node, "frustum_behaviour", reinterpret_cast<int&>(m_frustumBehaviour));
 	OvCore::Helpers::Serializer::DeserializeVec3(p_doc, p_node, "custom_bounding_sphere_position", m_customBoundingSphere.position);
 	OvCore::Helpers::Serializer::DeserializeFloat(p_doc, p_node, "custom_bounding_sphere_radius", m_customBoundingSphere.radius);
 }
 
+void OvCore::ECS::Components::CModelRenderer::OnBinarySerialize(OvCore::Helpers::BinaryWriter& p_writer)
+{
+	if (!m_model && !m_pendingModelPath.empty())
+		p_writer.WriteString(m_pendingModelPath);
+	else
+		p_writer.WriteString(m_model ? m_model->path : "?");
+
+	p_writer.WriteInt(static_cast<int>(m_frustumBehaviour));
+	p_writer.WriteVec3(m_customBoundingSphere.position);
+	p_writer.WriteFloat(m_customBoundingSphere.radius);
+}
+
+void OvCore::ECS::Components::CModelRenderer::OnBinaryDeserialize(OvCore::Helpers::BinaryReader& p_reader)
+{
+	LoadModelAsync(std::string(p_reader.ReadString()));
+
+	m_frustumBehaviour = static_cast<EFrustumBehaviour>(p_reader.ReadInt(static_cast<int>(m_frustumBehaviour)));
+	m_customBoundingSphere.position = p_reader.ReadVec3(m_customBoundingSphere.position);
+	m_customBoundingSphere.radius = p_reader.ReadFloat(m_customBoundingSphere.radius);
+}
+
 void OvCore::ECS::Components::CModelRenderer::OnInspector(OvUI::Internal::WidgetContainer& p_root)
 {
 	using namespace OvCore::Helpers;
@@ -113,3 +143,22 @@ void OvCore::ECS::Components::CModelRenderer::OnInspector(OvUI::Internal::Widget
 
 	centerLabel.enabled = centerWidget.enabled = radiusLabel.enabled = radiusWidget.enabled = m_frustumBehaviour == EFrustumBehaviour::CULL_CUSTOM;
 }
+
+void OvCore::ECS::Components::CModelRenderer::LoadModelAsync(const std::string& p_path)
+{
+	m_model = nullptr;
+	m_modelHandle.Reset();
+	m_pendingModelPath.clear();
+
+	if (p_path != "?" && p_path != "")
+	{
+		m_pendingModelPath = p_path;
+
+		OVSERVICE(OvCore::ResourceManagement::ModelManager).LoadResourceAsync(p_path, [this, lifetime = std::weak_ptr<bool>(m_lifetime), p_path](OvRendering::Resources::Model* p_model)
+		{
+			/* Ignore the model if the component has been destroyed or given another model in the meantime */
+			if (!lifetime.expired() && m_pendingModelPath == p_path)
+				SetModel(p_model);
+		});
+	}
+}
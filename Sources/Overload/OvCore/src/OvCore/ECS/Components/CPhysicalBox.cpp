@@ -51,6 +51,20 @@ void OvCore::ECS::Components::CPhysicalBox::OnDeserialize(tinyxml2::XMLDocument
 	SetSize(Helpers::Serializer::DeserializeVec3(p_doc, p_node, "size"));
 }
 
+void OvCore::ECS::Components::CPhysicalBox::OnBinarySerialize(OvCore::Helpers::BinaryWriter& p_writer)
+{
+	CPhysicalObject::OnBinarySerialize(p_writer);
+
+	p_writer.WriteVec3(GetSize());
+}
+
+void OvCore::ECS::Components::CPhysicalBox::OnBinaryDeserialize(OvCore::Helpers::BinaryReader& p_reader)
+{
+	CPhysicalObject::OnBinaryDeserialize(p_reader);
+
+	SetSize(p_reader.ReadVec3(GetSize()));
+}
+
 void OvCore::ECS::Components::CPhysicalBox::OnInspector(OvUI::Internal::WidgetContainer & p_root)
 {
 	CPhysicalObject::OnInspector(p_root);
@@ -64,6 +64,22 @@ void OvCore::ECS::Components::CPhysicalCapsule::OnDeserialize(tinyxml2::XMLDocum
 	SetHeight(Helpers::Serializer::DeserializeFloat(p_doc, p_node, "height"));
 }
 
+void OvCore::ECS::Components::CPhysicalCapsule::OnBinarySerialize(OvCore::Helpers::BinaryWriter& p_writer)
+{
+	CPhysicalObject::OnBinarySerialize(p_writer);
+
+	p_writer.WriteFloat(GetRadius());
+	p_writer.WriteFloat(GetHeight());
+}
+
+void OvCore::ECS::Components::CPhysicalCapsule::OnBinaryDeserialize(OvCore::Helpers::BinaryReader& p_reader)
+{
+	CPhysicalObject::OnBinaryDeserialize(p_reader);
+
+	SetRadius(p_reader.ReadFloat(GetRadius()));
+	SetHeight(p_reader.ReadFloat(GetHeight()));
+}
+
 void OvCore::ECS::Components::CPhysicalCapsule::OnInspector(OvUI::Internal::WidgetContainer & p_root)
 {
 	CPhysicalObject::OnInspector(p_root);
@@ -168,6 +168,30 @@ void OvCore::ECS::Components::CPhysicalObject::OnDeserialize(tinyxml2::XMLDocume
 	SetCollisionDetectionMode(static_cast<OvPhysics::Entities::PhysicalObject::ECollisionDetectionMode>(Helpers::Serializer::DeserializeInt(p_doc, p_node, "collision_mode")));
 }
 
+void OvCore::ECS::Components::CPhysicalObject::OnBinarySerialize(OvCore::Helpers::BinaryWriter& p_writer)
+{
+	p_writer.WriteBoolean(IsTrigger());
+	p_writer.WriteBoolean(IsKinematic());
+	p_writer.WriteFloat(GetBounciness());
+	p_writer.WriteFloat(GetMass());
+	p_writer.WriteFloat(GetFriction());
+	p_writer.WriteVec3(GetLinearFactor());
+	p_writer.WriteVec3(GetAngularFactor());
+	p_writer.WriteInt(static_cast<int>(GetCollisionDetectionMode()));
+}
+
+void OvCore::ECS::Components::CPhysicalObject::OnBinaryDeserialize(OvCore::Helpers::BinaryReader& p_reader)
+{
+	SetTrigger(p_reader.ReadBoolean(IsTrigger()));
+	SetKinematic(p_reader.ReadBoolean(IsKinematic()));
+	SetBounciness(p_reader.ReadFloat(GetBounciness()));
+	SetMass(p_reader.ReadFloat(GetMass()));
+	SetFriction(p_reader.ReadFloat(GetFriction()));
+	SetLinearFactor(p_reader.ReadVec3(GetLinearFactor()));
+	SetAngularFactor(p_reader.ReadVec3(GetAngularFactor()));
+	SetCollisionDetectionMode(static_cast<OvPhysics::Entities::PhysicalObject::ECollisionDetectionMode>(p_reader.ReadInt(static_cast<int>(GetCollisionDetectionMode()))));
+}
+
 void OvCore::ECS::Components::CPhysicalObject::OnInspector(OvUI::Internal::WidgetContainer & p_root)
 {
 	Helpers::GUIDrawer::DrawBoolean(p_root, "Trigger", std::bind(&CPhysicalObject::IsTrigger, this), std::bind(&CPhysicalObject::SetTrigger, this, std::placeholders::_1));
@@ -52,6 +52,20 @@ void OvCore::ECS::Components::CPhysicalSphere::OnDeserialize(tinyxml2::XMLDocume
 	SetRadius(Helpers::Serializer::DeserializeFloat(p_doc, p_node, "radius"));
 }
 
+void OvCore::ECS::Components::CPhysicalSphere::OnBinarySerialize(OvCore::Helpers::BinaryWriter& p_writer)
+{
+	CPhysicalObject::OnBinarySerialize(p_writer);
+
+	p_writer.WriteFloat(GetRadius());
+}
+
+void OvCore::ECS::Components::CPhysicalSphere::OnBinaryDeserialize(OvCore::Helpers::BinaryReader& p_reader)
+{
+	CPhysicalObject::OnBinaryDeserialize(p_reader);
+
+	SetRadius(p_reader.ReadFloat(GetRadius()));
+}
+
 void OvCore::ECS::Components::CPhysicalSphere::OnInspector(OvUI::Internal::WidgetContainer & p_root)
 {
 	CPhysicalObject::OnInspector(p_root);
@@ -77,6 +77,24 @@ void OvCore::ECS::Components::CPointLight::OnDeserialize(tinyxml2::XMLDocument &
 	Serializer::DeserializeFloat(p_doc, p_node, "quadratic", m_data.quadratic);
 }
 
+void OvCore::ECS::Components::CPointLight::OnBinarySerialize(OvCore::Helpers::BinaryWriter& p_writer)
+{
+	CLight::OnBinarySerialize(p_writer);
+
+	p_writer.WriteFloat(m_data.constant);
+	p_writer.WriteFloat(m_data.linear);
+	p_writer.WriteFloat(m_data.quadratic);
+}
+
+void OvCore::ECS::Components::CPointLight::OnBinaryDeserialize(OvCore::Helpers::BinaryReader& p_reader)
+{
+	CLight::OnBinaryDeserialize(p_reader);
+
+	m_data.constant = p_reader.ReadFloat(m_data.constant);
+	m_data.linear = p_reader.ReadFloat(m_data.linear);
+	m_data.quadratic = p_reader.ReadFloat(m_data.quadratic);
+}
+
 void OvCore::ECS::Components::CPointLight::OnInspector(OvUI::Internal::WidgetContainer& p_root)
 {
 	using namespace OvCore::Helpers;
@@ -101,6 +101,28 @@ void OvCore::ECS::Components::CSpotLight::OnDeserialize(tinyxml2::XMLDocument &
 	Serializer::DeserializeFloat(p_doc, p_node, "outercutoff", m_data.outerCutoff);
 }
 
+void OvCore::ECS::Components::CSpotLight::OnBinarySerialize(OvCore::Helpers::BinaryWriter& p_writer)
+{
+	CLight::OnBinarySerialize(p_writer);
+
+	p_writer.WriteFloat(m_data.constant);
+	p_writer.WriteFloat(m_data.linear);
+	p_writer.WriteFloat(m_data.quadratic);
+	p_writer.WriteFloat(m_data.cutoff);
+	p_writer.WriteFloat(m_data.outerCutoff);
+}
+
+void OvCore::ECS::Components::CSpotLight::OnBinaryDeserialize(OvCore::Helpers::BinaryReader& p_reader)
+{
+	CLight::OnBinaryDeserialize(p_reader);
+
+	m_data.constant = p_reader.ReadFloat(m_data.constant);
+	m_data.linear = p_reader.ReadFloat(m_data.linear);
+	m_data.quadratic = p_reader.ReadFloat(m_data.quadratic);
+	m_data.cutoff = p_reader.ReadFloat(m_data.cutoff);
+	m_data.outerCutoff = p_reader.ReadFloat(m_data.outerCutoff);
+}
+
 void OvCore::ECS::Components::CSpotLight::OnInspector(OvUI::Internal::WidgetContainer& p_root)
 {
 	using namespace OvCore::Helpers;
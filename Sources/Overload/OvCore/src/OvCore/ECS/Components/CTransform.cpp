@@ -172,6 +172,22 @@ void OvCore::ECS::Components::CTransform::OnDeserialize(tinyxml2::XMLDocument &
 	);
 }
 
+void OvCore::ECS::Components::CTransform::OnBinarySerialize(OvCore::Helpers::BinaryWriter& p_writer)
+{
+	p_writer.WriteVec3(GetLocalPosition());
+	p_writer.WriteQuat(GetLocalRotation());
+	p_writer.WriteVec3(GetLocalScale());
+}
+
+void OvCore::ECS::Components::CTransform::OnBinaryDeserialize(OvCore::Helpers::BinaryReader& p_reader)
+{
+	const OvMaths::FVector3 position = p_reader.ReadVec3(GetLocalPosition());
+	const OvMaths::FQuaternion rotation = p_reader.ReadQuat(GetLocalRotation());
+	const OvMaths::FVector3 scale = p_reader.ReadVec3(GetLocalScale());
+
+	m_transform.GenerateMatrices(position, rotation, scale);
+}
+
 void OvCore::ECS::Components::CTransform::OnInspector(OvUI::Internal::WidgetContainer& p_root)
 {
 	auto getRotation = [this]
@@ -0,0 +1,211 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#include <limits>
+
+#include <OvAnalytics/Profiling/ProfilerSpy.h>
+
+#include <OvTools/Utils/ThreadPool.h>
+
+#include <OvRendering/Core/Renderer.h>
+
+#include "OvCore/ECS/DrawableGatherer.h"
+#include "OvCore/ECS/Components/CModelRenderer.h"
+#include "OvCore/ECS/Components/CMaterialRenderer.h"
+#include "OvCore/ECS/Components/CAnimation.h"
+
+/* Number of model renderers processed by a single gathering job */
+constexpr size_t kGatheringChunkSize = 256;
+
+OvCore::ECS::DrawableGatherer::DrawableGatherer(OvTools::Utils::ThreadPool* p_threadPool) :
+	m_threadPool(p_threadPool)
+{
+}
+
+void OvCore::ECS::DrawableGatherer::Gather
+(
+	RenderQueue& p_opaques,
+	RenderQueue& p_transparents,
+	const OvCore::SceneSystem::Scene& p_scene,
+	const OvMaths::FVector3& p_cameraPosition,
+	const OvRendering::Data::Frustum* p_frustum,
+	OvCore::Resources::Material* p_defaultMaterial
+)
+{
+	PROFILER_SPY("Drawables Gathering");
+
+	p_opaques.Clear();
+	p_transparents.Clear();
+
+	const auto& modelRenderers = p_scene.GetActiveComponents().modelRenderers;
+	const uint32_t chunkCount = static_cast<uint32_t>((modelRenderers.size() + kGatheringChunkSize - 1) / kGatheringChunkSize);
+
+	if (m_chunks.size() < chunkCount)
+		m_chunks.resize(chunkCount);
+
+	/* Every chunk owns its queues, so workers never write to shared memory */
+	const auto gatherChunk = [&](uint32_t p_chunkIndex)
+	{
+		const size_t first = static_cast<size_t>(p_chunkIndex) * kGatheringChunkSize;
+		const size_t last = std::min(first + kGatheringChunkSize, modelRenderers.size());
+		GatherChunkDrawables(m_chunks[p_chunkIndex], modelRenderers, first, last, p_cameraPosition, p_frustum, p_defaultMaterial);
+	};
+
+	if (m_threadPool)
+	{
+		/* World transforms are computed on demand, so outdated ones are computed here, before the workers read them */
+		for (const auto modelRenderer : modelRenderers)
+			modelRenderer->owner.transform.GetFTransform().UpdateWorldMatrix();
+
+		m_threadPool->Dispatch(chunkCount, gatherChunk);
+	}
+	else
+	{
+		for (uint32_t i = 0; i < chunkCount; ++i)
+			gatherChunk(i);
+	}
+
+	/* Chunks are appended in order, so the queues receive the drawables in the same order as a serial gathering */
+	for (uint32_t i = 0; i < chunkCount; ++i)
+	{
+		p_opaques.Append(m_chunks[i].opaques);
+		p_transparents.Append(m_chunks[i].transparents);
+	}
+
+	p_opaques.Sort();
+	p_transparents.Sort();
+}
+
+void OvCore::ECS::DrawableGatherer::GatherChunkDrawables
+(
+	GatheringChunk& p_chunk,
+	const std::vector<OvCore::ECS::Components::CModelRenderer*>& p_modelRenderers,
+	size_t p_first,
+	size_t p_last,
+	const OvMaths::FVector3& p_cameraPosition,
+	const OvRendering::Data::Frustum* p_frustum,
+	OvCore::Resources::Material* p_defaultMaterial
+)
+{
+	using namespace OvCore::ECS::Components;
+
+	p_chunk.opaques.Clear();
+	p_chunk.transparents.Clear();
+
+	const size_t count = p_last - p_first;
+
+	if (p_frustum)
+	{
+		/* Model level culling of the whole chunk with a single batch test (Models that are not culled get an infinite sphere) */
+		p_chunk.centersX.resize(count);
+		p_chunk.centersY.resize(count);
+		p_chunk.centersZ.resize(count);
+		p_chunk.radii.resize(count);
+		p_chunk.visibility.resize((count + 31) / 32);
+
+		for (size_t i = 0; i < count; ++i)
+		{
+			const CModelRenderer& modelRenderer = *p_modelRenderers[p_first + i];
+			const auto model = modelRenderer.GetModel();
+			const auto frustumBehaviour = modelRenderer.GetFrustumBehaviour();
+
+			OvRendering::Geometry::BoundingSphere worldSphere = { OvMaths::FVector3::Zero, std::numeric_limits<float>::infinity() };
+
+			if (model && frustumBehaviour != CModelRenderer::EFrustumBehaviour::DISABLED)
+			{
+				const auto& modelBoundingSphere = frustumBehaviour == CModelRenderer::EFrustumBehaviour::CULL_CUSTOM ? modelRenderer.GetCustomBoundingSphere() : model->GetBoundingSphere();
+				worldSphere = OvRendering::Data::Frustum::TransformBoundingSphere(modelBoundingSphere, modelRenderer.owner.transform.GetFTransform());
+			}
+
+			p_chunk.centersX[i] = worldSphere.position.x;
+			p_chunk.centersY[i] = worldSphere.position.y;
+			p_chunk.centersZ[i] = worldSphere.position.z;
+			p_chunk.radii[i] = worldSphere.radius;
+		}
+
+		p_frustum->SpheresInFrustum(p_chunk.centersX.data(), p_chunk.centersY.data(), p_chunk.centersZ.data(), p_chunk.radii.data(), count, p_chunk.visibility.data());
+	}
+
+	for (size_t i = 0; i < count; ++i)
+	{
+		if (!p_frustum || (p_chunk.visibility[i / 32] >> (i % 32)) & 1u)
+			GatherModelDrawables(*p_modelRenderers[p_first + i], p_chunk.opaques, p_chunk.transparents, p_chunk.meshesInFrustum, p_cameraPosition, p_frustum, p_defaultMaterial);
+	}
+}
+
+void OvCore::ECS::DrawableGatherer::GatherModelDrawables
+(
+	OvCore::ECS::Components::CModelRenderer& p_modelRenderer,
+	RenderQueue& p_opaques,
+	RenderQueue& p_transparents,
+	std::vector<std::reference_wrapper<OvRendering::Resources::Mesh>>& p_meshes,
+	const OvMaths::FVector3& p_cameraPosition,
+	const OvRendering::Data::Frustum* p_frustum,
+	OvCore::Resources::Material* p_defaultMaterial
+)
+{
+	using namespace OvCore::ECS::Components;
+
+	auto& owner = p_modelRenderer.owner;
+
+	if (!owner.IsActive())
+		return;
+
+	auto model = p_modelRenderer.GetModel();
+	if (!model)
+		return;
+
+	auto materialRenderer = owner.GetComponent<CMaterialRenderer>();
+	if (!materialRenderer)
+		return;
+
+	auto& transform = owner.transform.GetFTransform();
+
+	if (p_frustum && p_modelRenderer.GetFrustumBehaviour() == CModelRenderer::EFrustumBehaviour::CULL_MESHES)
+	{
+		/* The model sphere has already been tested by GatherChunkDrawables, only meshes are left to cull */
+		OvRendering::Core::Renderer::GetMeshesInFrustum(p_meshes, *model, model->GetBoundingSphere(), transform, *p_frustum, OvRendering::Settings::ECullingOptions::FRUSTUM_PER_MESH);
+	}
+	else
+	{
+		p_meshes.clear();
+
+		for (auto mesh : model->GetMeshes())
+			p_meshes.emplace_back(*mesh);
+	}
+
+	if (p_meshes.empty())
+		return;
+
+	float distanceToActor = OvMaths::FVector3::Distance(transform.GetWorldPosition(), p_cameraPosition);
+	const CMaterialRenderer::MaterialList& materials = materialRenderer->GetMaterials();
+	auto animation = owner.GetComponent<CAnimation>();
+
+	if (animation && !animation->GetPlayCtrls())
+		animation = nullptr;
+
+	for (const auto& mesh : p_meshes)
+	{
+		OvCore::Resources::Material* material = nullptr;
+
+		if (mesh.get().GetMaterialIndex() < MAX_MATERIAL_COUNT)
+		{
+			material = materials.at(mesh.get().GetMaterialIndex());
+			if (!material || !material->GetShader())
+				material = p_defaultMaterial;
+		}
+
+		if (material)
+		{
+			OvCore::ECS::Drawable element = { &transform.GetWorldMatrix(), &mesh.get(), material, &materialRenderer->GetUserMatrix(), animation };
+
+			if (material->IsBlendable())
+				p_transparents.Push(element, RenderQueue::GenerateTransparentSortKey(distanceToActor));
+			else
+				p_opaques.Push(element, RenderQueue::GenerateOpaqueSortKey(element, distanceToActor));
+		}
+	}
+}
@@ -0,0 +1,188 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#include <cstring>
+
+#include "OvCore/ECS/RenderQueue.h"
+#include "OvCore/ECS/Components/CAnimation.h"
+
+namespace
+{
+	/* Fold a pointer into a small identifier. Collisions only affect the grouping of drawables, not their correctness */
+	template<uint8_t Bits>
+	uint64_t HashPointer(const void* p_pointer)
+	{
+		uint64_t value = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(p_pointer));
+		value ^= value >> 33;
+		value *= 0xFF51AFD7ED558CCDULL;
+		value ^= value >> 33;
+		return value >> (64 - Bits);
+	}
+
+	/* The bit pattern of a positive IEEE 754 float grows with its value, so it can be used directly as an integer key */
+	uint32_t DistanceToBits(float p_distance)
+	{
+		if (!(p_distance > 0.0f))
+			return 0;
+
+		uint32_t bits;
+		std::memcpy(&bits, &p_distance, sizeof(bits));
+		return bits;
+	}
+}
+
+void OvCore::ECS::RenderQueue::Clear()
+{
+	m_drawables.clear();
+	m_entries.clear();
+}
+
+void OvCore::ECS::RenderQueue::Reserve(size_t p_count)
+{
+	m_drawables.reserve(p_count);
+	m_entries.reserve(p_count);
+	m_sortBuffer.reserve(p_count);
+}
+
+void OvCore::ECS::RenderQueue::Push(const Drawable& p_drawable, uint64_t p_sortKey)
+{
+	m_entries.push_back({ p_sortKey, static_cast<uint32_t>(m_drawables.size()) });
+	m_drawables.push_back(p_drawable);
+}
+
+void OvCore::ECS::RenderQueue::Append(const RenderQueue& p_other)
+{
+	const uint32_t offset = static_cast<uint32_t>(m_drawables.size());
+
+	for (const auto& entry : p_other.m_entries)
+		m_entries.push_back({ entry.key, entry.index + offset });
+
+	m_drawables.insert(m_drawables.end(), p_other.m_drawables.begin(), p_other.m_drawables.end());
+}
+
+void OvCore::ECS::RenderQueue::Sort()
+{
+	const size_t count = m_entries.size();
+
+	if (count < 2)
+		return;
+
+	m_sortBuffer.resize(count);
+
+	/* Build the histograms of the 8 key bytes in a single pass */
+	uint32_t histograms[8][256] = {};
+
+	for (const auto& entry : m_entries)
+	{
+		for (uint8_t pass = 0; pass < 8; ++pass)
+			++histograms[pass][(entry.key >> (pass * 8)) & 0xFF];
+	}
+
+	SortEntry* source = m_entries.data();
+	SortEntry* destination = m_sortBuffer.data();
+
+	for (uint8_t pass = 0; pass < 8; ++pass)
+	{
+		const uint8_t shift = pass * 8;
+		const uint32_t* histogram = histograms[pass];
+
+		/* Every key shares the same byte for this pass, nothing to reorder */
+		if (histogram[(source[0].key >> shift) & 0xFF] == count)
+			continue;
+
+		uint32_t offsets[256];
+		uint32_t offset = 0;
+
+		for (uint32_t bucket = 0; bucket < 256; ++bucket)
+		{
+			offsets[bucket] = offset;
+			offset += histogram[bucket];
+		}
+
+		for (size_t i = 0; i < count; ++i)
+			destination[offsets[(source[i].key >> shift) & 0xFF]++] = source[i];
+
+		std::swap(source, destination);
+	}
+
+	if (source != m_entries.data())
+		m_entries.swap(m_sortBuffer);
+}
+
+size_t OvCore::ECS::RenderQueue::Size() const
+{
+	return m_entries.size();
+}
+
+bool OvCore::ECS::RenderQueue::Empty() const
+{
+	return m_entries.empty();
+}
+
+const OvCore::ECS::Drawable& OvCore::ECS::RenderQueue::operator[](size_t p_position) const
+{
+	return m_drawables[m_entries[p_position].index];
+}
+
+uint64_t OvCore::ECS::RenderQueue::GetSortKey(size_t p_position) const
+{
+	return m_entries[p_position].key;
+}
+
+void OvCore::ECS::RenderQueue::CollectBonePalettes(std::vector<OvMaths::FMatrix4>& p_palettes, std::vector<int32_t>& p_boneOffsets, const std::function<bool(const Drawable&)>& p_isSkinned) const
+{
+	p_boneOffsets.assign(Size(), -1);
+
+	for (size_t i = 0; i < Size(); ++i)
+	{
+		const Drawable& drawable = (*this)[i];
+
+		if (drawable.animation && p_isSkinned(drawable))
+		{
+			const auto& rig = drawable.mesh->m_rigInfo;
+			const size_t offset = p_palettes.size();
+
+			p_palettes.resize(offset + rig.m_boneInfos.size());
+			drawable.animation->GetBonePalette(rig, p_palettes.data() + offset);
+			p_boneOffsets[i] = static_cast<int32_t>(offset);
+		}
+	}
+}
+
+OvCore::ECS::RenderQueue::ConstIterator OvCore::ECS::RenderQueue::begin() const
+{
+	return ConstIterator(*this, 0);
+}
+
+OvCore::ECS::RenderQueue::ConstIterator OvCore::ECS::RenderQueue::end() const
+{
+	return ConstIterator(*this, m_entries.size());
+}
+
+uint64_t OvCore::ECS::RenderQueue::GenerateOpaqueSortKey(const Drawable& p_drawable, float p_distance)
+{
+	/* Key layout: [63..52] shader | [51..38] material | [37..24] mesh | [23..0] distance (Front to back) */
+	const auto shader = p_drawable.material->GetShader();
+	const uint64_t shaderID = shader ? (shader->id & 0xFFF) : 0;
+	const uint64_t materialID = HashPointer<14>(p_drawable.material);
+	const uint64_t meshID = HashPointer<14>(p_drawable.mesh);
+	const uint64_t depth = DistanceToBits(p_distance) >> 7; // The sign bit is always 0, keep the 24 most significant remaining bits
+
+	return (shaderID << 52) | (materialID << 38) | (meshID << 24) | depth;
+}
+
+uint64_t OvCore::ECS::RenderQueue::GenerateTransparentSortKey(float p_distance)
+{
+	/* Key layout: [63..32] inverted distance (Back to front) | [31..0] unused, so drawables at the same distance keep their submission order */
+	const uint64_t depth = ~DistanceToBits(p_distance);
+
+	return depth << 32;
+}
+
+bool OvCore::ECS::RenderQueue::HaveSameUserMatrix(const Drawable& p_first, const Drawable& p_second)
+{
+	return p_first.userMatrix == p_second.userMatrix || std::memcmp(p_first.userMatrix->data, p_second.userMatrix->data, sizeof(p_first.userMatrix->data)) == 0;
+}
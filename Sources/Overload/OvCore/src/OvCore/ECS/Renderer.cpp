@@ -13,11 +13,10 @@
 #include "OvCore/ECS/Components/CModelRenderer.h"
 #include "OvCore/ECS/Components/CMaterialRenderer.h"
 #include "OvCore/ECS/Components/CAnimation.h"
-#include "OvRendering/Buffers/UniformBuffer.h"
 #include "OvRendering/Resources/Mesh.h"
 #include "OvCore/ECS/Components/AComponent.h"
 
-OvCore::ECS::Renderer::Renderer(OvRendering::Context::Driver& p_driver) :
+OvCore::ECS::Renderer::Renderer(OvRendering::Context::Driver& p_driver, OvTools::Utils::ThreadPool* p_threadPool) :
 	OvRendering::Core::Renderer(p_driver),
 	m_emptyTexture(OvRendering::Resources::Loaders::TextureLoader::CreateColor
 	(
@@ -25,15 +24,18 @@ OvCore::ECS::Renderer::Renderer(OvRendering::Context::Driver& p_driver) :
 		OvRendering::Settings::ETextureFilteringMode::NEAREST,
 		OvRendering::Settings::ETextureFilteringMode::NEAREST,
 		false
-	))
+	)),
+	m_drawableGatherer(p_threadPool),
+	m_instanceSSBO(OvRendering::Buffers::EAccessSpecifier::STREAM_DRAW),
+	m_bonePaletteSSBO(OvRendering::Buffers::EAccessSpecifier::STREAM_DRAW)
 {
 }
 
-struct UboBoneData
-{
-	int count;
-	OvMaths::FMatrix4 mat[64];
-} g_uboBoneData;
+/* Binding point of the InstanceSSBO block declared by instancing-capable shaders (0 is used by lights) */
+constexpr uint32_t kInstanceSSBOBindingPoint = 1;
+
+/* Binding point of the BonePaletteSSBO block declared by skinning shaders */
+constexpr uint32_t kBonePaletteSSBOBindingPoint = 2;
 
 OvCore::ECS::Renderer::~Renderer()
 {
@@ -42,25 +44,19 @@ OvCore::ECS::Renderer::~Renderer()
 
 OvCore::ECS::Components::CCamera* OvCore::ECS::Renderer::FindMainCamera(const OvCore::SceneSystem::Scene& p_scene)
 {
-	for (OvCore::ECS::Components::CCamera* camera : p_scene.GetFastAccessComponents().cameras)
-		if (camera->owner.IsActive())
-			return camera;
-
-	return nullptr;
+	const auto& cameras = p_scene.GetActiveComponents().cameras;
+	return cameras.empty() ? nullptr : cameras.front();
 }
 
 std::vector<OvMaths::FMatrix4> OvCore::ECS::Renderer::FindLightMatrices(const OvCore::SceneSystem::Scene& p_scene)
 {
 	std::vector<OvMaths::FMatrix4> result;
 
-	const auto& facs = p_scene.GetFastAccessComponents();
+	const auto& facs = p_scene.GetActiveComponents();
 
 	for (auto light : facs.lights)
 	{
-		if (light->owner.IsActive())
-		{
-			result.push_back(light->GetData().GenerateMatrix());
-		}
+		result.push_back(light->GetData().GenerateMatrix());
 	}
 
 	return result;
@@ -72,21 +68,18 @@ std::vector<OvMaths::FMatrix4> OvCore::ECS::Renderer::FindLightMatricesInFrustum
 {
 	std::vector<OvMaths::FMatrix4> result;
 
-	const auto& facs = p_scene.GetFastAccessComponents();
+	const auto& facs = p_scene.GetActiveComponents();
 
 	for (auto light : facs.lights)
 	{
-		if (light->owner.IsActive())
-		{
-			const auto& lightData = light->GetData();
-			const auto& position = lightData.GetTransform().GetWorldPosition();
-			auto effectRange = lightData.GetEffectRange();
+		const auto& lightData = light->GetData();
+		const auto& position = lightData.GetTransform().GetWorldPosition();
+		auto effectRange = lightData.GetEffectRange();
 
-			// We always consider lights that have an +inf range (Not necessary to test if they are in frustum)
-			if (std::isinf(effectRange) || p_frustum.SphereInFrustum(position.x, position.y, position.z, lightData.GetEffectRange()))
-			{
-				result.push_back(lightData.GenerateMatrix());
-			}
+		// We always consider lights that have an +inf range (Not necessary to test if they are in frustum)
+		if (std::isinf(effectRange) || p_frustum.SphereInFrustum(position.x, position.y, position.z, lightData.GetEffectRange()))
+		{
+			result.push_back(lightData.GenerateMatrix());
 		}
 	}
 
@@ -99,283 +92,146 @@ void OvCore::ECS::Renderer::RenderScene
 	const OvMaths::FVector3& p_cameraPosition,
 	const OvRendering::LowRenderer::Camera& p_camera,
 	const OvRendering::Data::Frustum* p_customFrustum,
-	OvCore::Resources::Material* p_defaultMaterial,
-	OvRendering::Buffers::UniformBuffer* p_ubo
+	OvCore::Resources::Material* p_defaultMaterial
 )
 {
-	OpaqueDrawables	opaqueMeshes;
-	TransparentDrawables transparentMeshes;
-
 	if (p_camera.HasFrustumGeometryCulling())
 	{
 		const auto& frustum = p_customFrustum ? *p_customFrustum : p_camera.GetFrustum();
-		std::tie(opaqueMeshes, transparentMeshes) = FindAndSortFrustumCulledDrawables(p_scene, p_cameraPosition, frustum, p_defaultMaterial);
+		FindAndSortFrustumCulledDrawables(m_opaqueQueue, m_transparentQueue, p_scene, p_cameraPosition, frustum, p_defaultMaterial);
 	}
 	else
 	{
-		std::tie(opaqueMeshes, transparentMeshes) = FindAndSortDrawables(p_scene, p_cameraPosition, p_defaultMaterial);
+		FindAndSortDrawables(m_opaqueQueue, m_transparentQueue, p_scene, p_cameraPosition, p_defaultMaterial);
 	}
 
-	g_uboBoneData.count = 0;
-	for (int i = 0; i < 64; i++)
-	{
-		g_uboBoneData.mat[i] = OvMaths::FMatrix4::Identity;
-	}
-	auto uboOffset = sizeof(OvMaths::FMatrix4) * 3 + sizeof(OvMaths::FVector3);
-	for (const auto& [distance, drawable] : opaqueMeshes)
+	/* Consecutive opaque drawables sharing the same mesh and material are drawn with a single instanced draw call */
+	m_opaqueQueue.BuildBatches(m_opaqueBatches, [](const Drawable& p_drawable)
 	{
-		std::vector<OvRendering::Resources::AnimationPlayCtrl>* playCtrl = drawable.animctrl;
-		auto mat = drawable.material;
-		if (drawable.animctrl)
-		{
-			g_uboBoneData.count = drawable.mesh->m_rigInfo.m_boneInfos.size();
-			drawable.animctrl->front().m_calculator->GetRigBoneTransforms(drawable.mesh->m_rigInfo, g_uboBoneData.mat);
-		}
-		else
-		{
-			g_uboBoneData.count = 0;
-		}
-		p_ubo->SetSubData(g_uboBoneData, uboOffset);
+		const auto shader = p_drawable.material->GetShader();
+		return !p_drawable.animation && p_drawable.material->GetGPUInstances() == 1 && shader && shader->SupportsInstancing();
+	});
 
-		DrawDrawable(drawable);
-	}
+	const bool hasInstancedBatches = UploadInstanceData(m_opaqueQueue, m_opaqueBatches);
+
+	/* Bone palettes of every skinned drawable are uploaded at once, each draw then selects its own palette with ubo_BoneOffset */
+	const bool hasBonePalettes = UploadBonePalettes();
+
+	if (hasInstancedBatches)
+		GetStateCache().BindBufferBase(OvRendering::Buffers::EBufferTarget::SHADER_STORAGE_BUFFER, kInstanceSSBOBindingPoint, m_instanceSSBO.GetID());
 
-	for (const auto& [distance, drawable] : transparentMeshes)
+	if (hasBonePalettes)
+		GetStateCache().BindBufferBase(OvRendering::Buffers::EBufferTarget::SHADER_STORAGE_BUFFER, kBonePaletteSSBOBindingPoint, m_bonePaletteSSBO.GetID());
+
+	size_t instanceOffset = 0;
+
+	for (const auto& batch : m_opaqueBatches)
 	{
-		std::vector<OvRendering::Resources::AnimationPlayCtrl>* playCtrl = drawable.animctrl;
-		auto mat = drawable.material;
-		if (drawable.animctrl)
+		const auto& drawable = m_opaqueQueue[batch.first];
+
+		if (batch.count > 1)
 		{
-			g_uboBoneData.count = drawable.mesh->m_rigInfo.m_boneInfos.size();
-			drawable.animctrl->front().m_calculator->GetRigBoneTransforms(drawable.mesh->m_rigInfo, g_uboBoneData.mat);
+			DrawInstancedBatch(drawable, batch.count, instanceOffset);
+			instanceOffset += batch.count;
 		}
 		else
 		{
-			g_uboBoneData.count = 0;
+			DrawDrawable(drawable, m_opaqueBoneOffsets[batch.first]);
 		}
-		p_ubo->SetSubData(g_uboBoneData, uboOffset);
-		DrawDrawable(drawable);
 	}
-}
 
-std::vector<OvRendering::Resources::AnimationPlayCtrl>* GetAnimationPlayCtrlFromActor(OvCore::ECS::Actor& actor)
-{
-	auto anim = actor.GetComponent<OvCore::ECS::Components::CAnimation>();
-	if (nullptr == anim)
-		return nullptr;
-	if (anim->playCtrls.size() == 0)
-	{
-		if (auto hr = anim->GetModelHierarchy())
-		{
-			if (hr->animations.size())
-			{
-				OvRendering::Resources::AnimationPlayCtrl ctrl;
-				ctrl.m_animation = &hr->animations[0];
-				ctrl.m_calculator = new OvRendering::Resources::ModelNodeTransformCalculator(*hr, *ctrl.m_animation);
-				ctrl.time = 0.0;
-				anim->playCtrls.emplace_back(ctrl);
-			}
-		}
-	}
-	if (anim->playCtrls.size() == 0)
-		return nullptr;
-	return &(anim->playCtrls);
+	/* Bindings are left in place, the next pass rebinds them only if they changed */
+	for (size_t i = 0; i < m_transparentQueue.Size(); ++i)
+		DrawDrawable(m_transparentQueue[i], m_transparentBoneOffsets[i]);
 }
 
-void FindAndSortDrawables
+void OvCore::ECS::Renderer::FindAndSortFrustumCulledDrawables
 (
-	OvCore::ECS::Renderer::OpaqueDrawables& p_opaques,
-	OvCore::ECS::Renderer::TransparentDrawables& p_transparents,
+	RenderQueue& p_opaques,
+	RenderQueue& p_transparents,
 	const OvCore::SceneSystem::Scene& p_scene,
 	const OvMaths::FVector3& p_cameraPosition,
+	const OvRendering::Data::Frustum& p_frustum,
 	OvCore::Resources::Material* p_defaultMaterial
 )
 {
-	for (OvCore::ECS::Components::CModelRenderer* modelRenderer : p_scene.GetFastAccessComponents().modelRenderers)
-	{
-		if (modelRenderer->owner.IsActive())
-		{
-			if (auto model = modelRenderer->GetModel())
-			{
-				float distanceToActor = OvMaths::FVector3::Distance(modelRenderer->owner.transform.GetWorldPosition(), p_cameraPosition);
-
-				if (auto materialRenderer = modelRenderer->owner.GetComponent<OvCore::ECS::Components::CMaterialRenderer>())
-				{
-					const auto& transform = modelRenderer->owner.transform.GetFTransform();
-
-					const OvCore::ECS::Components::CMaterialRenderer::MaterialList& materials = materialRenderer->GetMaterials();
-
-					for (auto mesh : model->GetMeshes())
-					{
-						OvCore::Resources::Material* material = nullptr;
-
-						if (mesh->GetMaterialIndex() < MAX_MATERIAL_COUNT)
-						{
-							material = materials.at(mesh->GetMaterialIndex());
-							if (!material || !material->GetShader())
-								material = p_defaultMaterial;
-						}
-
-						if (material)
-						{
-							OvCore::ECS::Drawable element{ transform.GetWorldMatrix(), mesh, material, materialRenderer->GetUserMatrix(), GetAnimationPlayCtrlFromActor(modelRenderer->owner)};
-
-							if (material->IsBlendable())
-								p_transparents.emplace(distanceToActor, element);
-							else
-								p_opaques.emplace(distanceToActor, element);
-						}
-					}
-				}
-			}
-		}
-	}
+	m_drawableGatherer.Gather(p_opaques, p_transparents, p_scene, p_cameraPosition, &p_frustum, p_defaultMaterial);
 }
 
-std::pair<OvCore::ECS::Renderer::OpaqueDrawables, OvCore::ECS::Renderer::TransparentDrawables> OvCore::ECS::Renderer::FindAndSortFrustumCulledDrawables
+void OvCore::ECS::Renderer::FindAndSortDrawables
 (
+	RenderQueue& p_opaques,
+	RenderQueue& p_transparents,
 	const OvCore::SceneSystem::Scene& p_scene,
 	const OvMaths::FVector3& p_cameraPosition,
-	const OvRendering::Data::Frustum& p_frustum,
 	OvCore::Resources::Material* p_defaultMaterial
 )
 {
-	using namespace OvCore::ECS::Components;
+	m_drawableGatherer.Gather(p_opaques, p_transparents, p_scene, p_cameraPosition, nullptr, p_defaultMaterial);
+}
 
-	OvCore::ECS::Renderer::OpaqueDrawables opaqueDrawables;
-	OvCore::ECS::Renderer::TransparentDrawables transparentDrawables;
+void OvCore::ECS::Renderer::DrawDrawable(const Drawable& p_toDraw, int32_t p_boneOffset)
+{
+	m_userMatrixSender(*p_toDraw.userMatrix);
+	DrawMesh(*p_toDraw.mesh, *p_toDraw.material, p_toDraw.matrix, p_boneOffset);
+}
 
-	for (CModelRenderer* modelRenderer : p_scene.GetFastAccessComponents().modelRenderers)
-	{
-		auto& owner = modelRenderer->owner;
+void OvCore::ECS::Renderer::DrawInstancedBatch(const Drawable& p_toDraw, uint32_t p_instances, size_t p_instanceOffset)
+{
+	auto& material = *p_toDraw.material;
+	auto shader = material.GetShader();
 
-		if (owner.IsActive())
-		{
-			if (auto model = modelRenderer->GetModel())
-			{
-				if (auto materialRenderer = modelRenderer->owner.GetComponent<CMaterialRenderer>())
-				{
-					auto& transform = owner.transform.GetFTransform();
-					auto anim = owner.GetComponent<CAnimation>();
-					auto bones = anim ? anim->GetBones() : nullptr;
-					OvRendering::Settings::ECullingOptions cullingOptions = OvRendering::Settings::ECullingOptions::NONE;
-
-					if (modelRenderer->GetFrustumBehaviour() != CModelRenderer::EFrustumBehaviour::DISABLED)
-					{
-						cullingOptions |= OvRendering::Settings::ECullingOptions::FRUSTUM_PER_MODEL;
-					}
-
-					if (modelRenderer->GetFrustumBehaviour() == CModelRenderer::EFrustumBehaviour::CULL_MESHES)
-					{
-						cullingOptions |= OvRendering::Settings::ECullingOptions::FRUSTUM_PER_MESH;
-					}
-
-					const auto& modelBoundingSphere = modelRenderer->GetFrustumBehaviour() == CModelRenderer::EFrustumBehaviour::CULL_CUSTOM ? modelRenderer->GetCustomBoundingSphere() : model->GetBoundingSphere();
-
-					std::vector<std::reference_wrapper<OvRendering::Resources::Mesh>> meshes;
-
-					{
-						PROFILER_SPY("Frustum Culling");
-						meshes = GetMeshesInFrustum(*model, modelBoundingSphere, transform, p_frustum, cullingOptions);
-					}
-
-					if (!meshes.empty())
-					{
-						float distanceToActor = OvMaths::FVector3::Distance(transform.GetWorldPosition(), p_cameraPosition);
-						const OvCore::ECS::Components::CMaterialRenderer::MaterialList& materials = materialRenderer->GetMaterials();
-
-						for (const auto& mesh : meshes)
-						{
-							OvCore::Resources::Material* material = nullptr;
-
-							if (mesh.get().GetMaterialIndex() < MAX_MATERIAL_COUNT)
-							{
-								material = materials.at(mesh.get().GetMaterialIndex());
-								if (!material || !material->GetShader())
-									material = p_defaultMaterial;
-							}
-
-							if (material)
-							{
-								OvCore::ECS::Drawable element = { transform.GetWorldMatrix(), &mesh.get(), material, materialRenderer->GetUserMatrix(), GetAnimationPlayCtrlFromActor(modelRenderer->owner) };
-
-								if (material->IsBlendable())
-									transparentDrawables.emplace(distanceToActor, element);
-								else
-									opaqueDrawables.emplace(distanceToActor, element);
-							}
-						}
-					}
-				}
-			}
-		}
-	}
+	ApplyStateMask(material.GenerateStateMask());
 
-	return { opaqueDrawables, transparentDrawables };
-}
+	/* Drawables of a batch share the same user matrix (See RenderQueue::BuildBatches) */
+	m_userMatrixSender(*p_toDraw.userMatrix);
 
-static float pos = 0.0f;
+	material.Bind(m_emptyTexture, GetStateCache());
+	shader->SetUniformInt(shader->GetInstanceOffsetLocation(), static_cast<int>(p_instanceOffset));
+	Draw(*p_toDraw.mesh, OvRendering::Settings::EPrimitiveMode::TRIANGLES, p_instances);
+	shader->SetUniformInt(shader->GetInstanceOffsetLocation(), -1);
+}
 
-std::pair<OvCore::ECS::Renderer::OpaqueDrawables, OvCore::ECS::Renderer::TransparentDrawables> OvCore::ECS::Renderer::FindAndSortDrawables
-(
-	const OvCore::SceneSystem::Scene& p_scene,
-	const OvMaths::FVector3& p_cameraPosition,
-	OvCore::Resources::Material* p_defaultMaterial
-)
+bool OvCore::ECS::Renderer::UploadInstanceData(const RenderQueue& p_queue, const std::vector<RenderQueue::Batch>& p_batches)
 {
-	OvCore::ECS::Renderer::OpaqueDrawables opaqueDrawables;
-	OvCore::ECS::Renderer::TransparentDrawables transparentDrawables;
-	pos += 0.1;
-	if (pos > 100)
-		pos = 0.0f;
+	m_instanceData.clear();
 
-	for (OvCore::ECS::Components::CModelRenderer* modelRenderer : p_scene.GetFastAccessComponents().modelRenderers)
+	for (const auto& batch : p_batches)
 	{
-		if (modelRenderer->owner.IsActive())
+		if (batch.count > 1)
 		{
-			if (auto model = modelRenderer->GetModel())
+			for (size_t i = batch.first; i < batch.first + batch.count; ++i)
 			{
-				float distanceToActor = OvMaths::FVector3::Distance(modelRenderer->owner.transform.GetWorldPosition(), p_cameraPosition);
-
-				if (auto materialRenderer = modelRenderer->owner.GetComponent<OvCore::ECS::Components::CMaterialRenderer>())
-				{
-					const auto& transform = modelRenderer->owner.transform.GetFTransform();
-
-					const OvCore::ECS::Components::CMaterialRenderer::MaterialList& materials = materialRenderer->GetMaterials();
-					auto anim = modelRenderer->owner.GetComponent<OvCore::ECS::Components::CAnimation>();
-					for (auto mesh : model->GetMeshes())
-					{
-						OvCore::Resources::Material* material = nullptr;
-
-						if (mesh->GetMaterialIndex() < MAX_MATERIAL_COUNT)
-						{
-							material = materials.at(mesh->GetMaterialIndex());
-							if (!material || !material->GetShader())
-								material = p_defaultMaterial;
-						}
-
-						if (material)
-						{
-							OvCore::ECS::Drawable element = { transform.GetWorldMatrix(), mesh, material, materialRenderer->GetUserMatrix(), GetAnimationPlayCtrlFromActor(modelRenderer->owner) };
-
-							if (material->IsBlendable())
-								transparentDrawables.emplace(distanceToActor, element);
-							else
-								opaqueDrawables.emplace(distanceToActor, element);
-						}
-					}
-				}
+				/* Same convention as the engine UBO model matrix sender: the model matrix is transposed */
+				m_instanceData.push_back(OvMaths::FMatrix4::Transpose(*p_queue[i].matrix));
 			}
 		}
 	}
 
-	return { opaqueDrawables, transparentDrawables };
+	if (m_instanceData.empty())
+		return false;
+
+	m_instanceSSBO.SendBlocks<OvMaths::FMatrix4>(m_instanceData.data(), m_instanceData.size() * sizeof(OvMaths::FMatrix4));
+	return true;
 }
 
-void OvCore::ECS::Renderer::DrawDrawable(const Drawable& p_toDraw)
+bool OvCore::ECS::Renderer::UploadBonePalettes()
 {
-	m_userMatrixSender(p_toDraw.userMatrix);
-	DrawMesh(*p_toDraw.mesh, *p_toDraw.material, &p_toDraw.matrix);
+	const auto supportsSkinning = [](const Drawable& p_drawable)
+	{
+		const auto shader = p_drawable.material->GetShader();
+		return shader && shader->SupportsSkinning();
+	};
+
+	m_bonePalettes.clear();
+	m_opaqueQueue.CollectBonePalettes(m_bonePalettes, m_opaqueBoneOffsets, supportsSkinning);
+	m_transparentQueue.CollectBonePalettes(m_bonePalettes, m_transparentBoneOffsets, supportsSkinning);
+
+	if (m_bonePalettes.empty())
+		return false;
+
+	m_bonePaletteSSBO.SendBlocks<OvMaths::FMatrix4>(m_bonePalettes.data(), m_bonePalettes.size() * sizeof(OvMaths::FMatrix4));
+	return true;
 }
 
 void OvCore::ECS::Renderer::DrawModelWithSingleMaterial(OvRendering::Resources::Model& p_model, OvCore::Resources::Material& p_material, OvMaths::FMatrix4 const* p_modelMatrix, OvCore::Resources::Material* p_defaultMaterial)
@@ -405,7 +261,7 @@ void OvCore::ECS::Renderer::DrawModelWithMaterials(OvRendering::Resources::Model
 	}
 }
 
-void OvCore::ECS::Renderer::DrawMesh(OvRendering::Resources::Mesh& p_mesh, OvCore::Resources::Material& p_material, OvMaths::FMatrix4 const* p_modelMatrix)
+void OvCore::ECS::Renderer::DrawMesh(OvRendering::Resources::Mesh& p_mesh, OvCore::Resources::Material& p_material, OvMaths::FMatrix4 const* p_modelMatrix, int32_t p_boneOffset)
 {
 	using namespace OvRendering::Settings;
 
@@ -418,9 +274,15 @@ void OvCore::ECS::Renderer::DrawMesh(OvRendering::Resources::Mesh& p_mesh, OvCor
 		ApplyStateMask(stateMask);
 		
 		/* Draw the mesh */
-		p_material.Bind(m_emptyTexture);
+		p_material.Bind(m_emptyTexture, GetStateCache());
+
+		if (p_boneOffset >= 0)
+			p_material.GetShader()->SetUniformInt(p_material.GetShader()->GetBoneOffsetLocation(), p_boneOffset);
+
 		Draw(p_mesh, OvRendering::Settings::EPrimitiveMode::TRIANGLES, p_material.GetGPUInstances());
-		p_material.UnBind();
+
+		if (p_boneOffset >= 0)
+			p_material.GetShader()->SetUniformInt(p_material.GetShader()->GetBoneOffsetLocation(), -1);
 	}
 }
 
@@ -0,0 +1,140 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#include <algorithm>
+
+#include <OvTools/Utils/ThreadPool.h>
+
+#include "OvCore/ECS/UpdateSystem.h"
+#include "OvCore/ECS/Actor.h"
+
+namespace
+{
+	constexpr uint32_t kParallelChunkSize = 64;
+}
+
+void OvCore::ECS::UpdateSystem::Register(Components::AComponent& p_component)
+{
+	if (p_component.m_updateFlags & kRegisteredFlag)
+		return;
+
+	p_component.m_updateFlags |= kRegisteredFlag;
+
+	for (uint8_t phase = 0; phase < kPhaseCount; ++phase)
+	{
+		if (p_component.m_updateFlags & (1 << phase))
+		{
+			ComponentList& list = GetList(p_component, phase);
+			p_component.m_updateSlots[phase] = static_cast<uint32_t>(list.components.size());
+			list.components.push_back(&p_component);
+		}
+	}
+}
+
+void OvCore::ECS::UpdateSystem::Unregister(Components::AComponent& p_component)
+{
+	if (!(p_component.m_updateFlags & kRegisteredFlag))
+		return;
+
+	p_component.m_updateFlags &= ~kRegisteredFlag;
+
+	/* The slot is only emptied (Lists can be running), lists are compacted after their next run */
+	for (uint8_t phase = 0; phase < kPhaseCount; ++phase)
+	{
+		if (p_component.m_updateFlags & (1 << phase))
+		{
+			ComponentList& list = GetList(p_component, phase);
+			list.components[p_component.m_updateSlots[phase]] = nullptr;
+			++list.removedCount;
+		}
+	}
+}
+
+void OvCore::ECS::UpdateSystem::Run(EPhase p_phase, float p_deltaTime, OvTools::Utils::ThreadPool* p_threadPool)
+{
+	RunSerial(m_lists[static_cast<uint8_t>(p_phase)], p_phase, p_deltaTime);
+	Compact(m_lists[static_cast<uint8_t>(p_phase)], static_cast<uint8_t>(p_phase));
+
+	if (p_phase == EPhase::UPDATE)
+	{
+		if (p_threadPool)
+			RunParallel(m_parallelUpdates, p_deltaTime, *p_threadPool);
+		else
+			RunSerial(m_parallelUpdates, p_phase, p_deltaTime);
+
+		Compact(m_parallelUpdates, static_cast<uint8_t>(p_phase));
+	}
+}
+
+void OvCore::ECS::UpdateSystem::Call(Components::AComponent& p_component, EPhase p_phase, float p_deltaTime)
+{
+	switch (p_phase)
+	{
+	case EPhase::UPDATE:		p_component.OnUpdate(p_deltaTime);		break;
+	case EPhase::FIXED_UPDATE:	p_component.OnFixedUpdate(p_deltaTime);	break;
+	case EPhase::LATE_UPDATE:	p_component.OnLateUpdate(p_deltaTime);	break;
+	}
+}
+
+OvCore::ECS::UpdateSystem::ComponentList& OvCore::ECS::UpdateSystem::GetList(const Components::AComponent& p_component, uint8_t p_phase)
+{
+	if (p_phase == static_cast<uint8_t>(EPhase::UPDATE) && (p_component.m_updateFlags & kParallelUpdateFlag))
+		return m_parallelUpdates;
+
+	return m_lists[p_phase];
+}
+
+void OvCore::ECS::UpdateSystem::RunSerial(ComponentList& p_list, EPhase p_phase, float p_deltaTime)
+{
+	/* Indexed loop: callbacks can register (Appended, not run until the next run) or unregister components */
+	const size_t count = p_list.components.size();
+
+	for (size_t i = 0; i < count; ++i)
+	{
+		if (Components::AComponent* component = p_list.components[i]; component && component->owner.IsActive())
+			Call(*component, p_phase, p_deltaTime);
+	}
+}
+
+void OvCore::ECS::UpdateSystem::RunParallel(ComponentList& p_list, float p_deltaTime, OvTools::Utils::ThreadPool& p_threadPool)
+{
+	const auto& components = p_list.components;
+	const uint32_t chunkCount = static_cast<uint32_t>((components.size() + kParallelChunkSize - 1) / kParallelChunkSize);
+
+	p_threadPool.Dispatch(chunkCount, [&components, p_deltaTime](uint32_t p_chunkIndex)
+	{
+		const size_t first = static_cast<size_t>(p_chunkIndex) * kParallelChunkSize;
+		const size_t last = std::min(first + kParallelChunkSize, components.size());
+
+		for (size_t i = first; i < last; ++i)
+		{
+			if (Components::AComponent* component = components[i]; component && component->owner.IsActive())
+				component->OnUpdate(p_deltaTime);
+		}
+	});
+}
+
+void OvCore::ECS::UpdateSystem::Compact(ComponentList& p_list, uint8_t p_phase)
+{
+	if (p_list.removedCount == 0)
+		return;
+
+	/* Stable compaction, so components keep being called in registration order */
+	auto& components = p_list.components;
+	size_t kept = 0;
+
+	for (size_t i = 0; i < components.size(); ++i)
+	{
+		if (Components::AComponent* component = components[i])
+		{
+			component->m_updateSlots[p_phase] = static_cast<uint32_t>(kept);
+			components[kept++] = component;
+		}
+	}
+
+	components.resize(kept);
+	p_list.removedCount = 0;
+}
@@ -0,0 +1,218 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#include <cstring>
+
+#include "OvCore/ResourceManagement/MaterialManager.h"
+#include "OvCore/ResourceManagement/SoundManager.h"
+#include "OvCore/Global/ServiceLocator.h"
+#include "OvCore/Helpers/BinaryReader.h"
+
+OvCore::Helpers::BinaryReader::BinaryReader(const uint8_t* p_data, size_t p_size, const std::vector<std::string_view>& p_strings) :
+	m_data(p_data),
+	m_size(p_size),
+	m_strings(&p_strings)
+{
+}
+
+bool OvCore::Helpers::BinaryReader::ReadBoolean(bool p_default)
+{
+	if (IsAtEnd())
+		return p_default;
+
+	const uint8_t* bytes = ReadBytes(1);
+	return bytes ? *bytes != 0 : p_default;
+}
+
+int32_t OvCore::Helpers::BinaryReader::ReadInt(int32_t p_default)
+{
+	return static_cast<int32_t>(ReadInt64(p_default));
+}
+
+uint32_t OvCore::Helpers::BinaryReader::ReadUint(uint32_t p_default)
+{
+	uint64_t value;
+	return !IsAtEnd() && ReadVarUint(value) ? static_cast<uint32_t>(value) : p_default;
+}
+
+int64_t OvCore::Helpers::BinaryReader::ReadInt64(int64_t p_default)
+{
+	uint64_t value;
+
+	if (IsAtEnd() || !ReadVarUint(value))
+		return p_default;
+
+	return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+}
+
+float OvCore::Helpers::BinaryReader::ReadFloat(float p_default)
+{
+	if (IsAtEnd())
+		return p_default;
+
+	const uint8_t* bytes = ReadBytes(4);
+
+	if (!bytes)
+		return p_default;
+
+	uint32_t bits = 0;
+	for (uint32_t i = 0; i < 4; ++i)
+		bits |= static_cast<uint32_t>(bytes[i]) << (8 * i);
+
+	float value;
+	std::memcpy(&value, &bits, sizeof(value));
+	return value;
+}
+
+OvMaths::FVector2 OvCore::Helpers::BinaryReader::ReadVec2(const OvMaths::FVector2& p_default)
+{
+	if (IsAtEnd())
+		return p_default;
+
+	const float x = ReadFloat();
+	const float y = ReadFloat();
+	return m_valid ? OvMaths::FVector2(x, y) : p_default;
+}
+
+OvMaths::FVector3 OvCore::Helpers::BinaryReader::ReadVec3(const OvMaths::FVector3& p_default)
+{
+	if (IsAtEnd())
+		return p_default;
+
+	const float x = ReadFloat();
+	const float y = ReadFloat();
+	const float z = ReadFloat();
+	return m_valid ? OvMaths::FVector3(x, y, z) : p_default;
+}
+
+OvMaths::FVector4 OvCore::Helpers::BinaryReader::ReadVec4(const OvMaths::FVector4& p_default)
+{
+	if (IsAtEnd())
+		return p_default;
+
+	const float x = ReadFloat();
+	const float y = ReadFloat();
+	const float z = ReadFloat();
+	const float w = ReadFloat();
+	return m_valid ? OvMaths::FVector4(x, y, z, w) : p_default;
+}
+
+OvMaths::FQuaternion OvCore::Helpers::BinaryReader::ReadQuat(const OvMaths::FQuaternion& p_default)
+{
+	if (IsAtEnd())
+		return p_default;
+
+	const float x = ReadFloat();
+	const float y = ReadFloat();
+	const float z = ReadFloat();
+	const float w = ReadFloat();
+	return m_valid ? OvMaths::FQuaternion(x, y, z, w) : p_default;
+}
+
+std::string_view OvCore::Helpers::BinaryReader::ReadString(std::string_view p_default)
+{
+	uint64_t index;
+
+	if (IsAtEnd() || !ReadVarUint(index))
+		return p_default;
+
+	if (index >= m_strings->size())
+	{
+		m_valid = false;
+		return p_default;
+	}
+
+	return (*m_strings)[static_cast<size_t>(index)];
+}
+
+OvCore::Resources::Material* OvCore::Helpers::BinaryReader::ReadMaterial(OvCore::Resources::Material* p_default)
+{
+	if (IsAtEnd())
+		return p_default;
+
+	if (const std::string_view path = ReadString(); m_valid && path != "?" && path != "")
+		return OvCore::Global::ServiceLocator::Get<OvCore::ResourceManagement::MaterialManager>().GetResource(std::string(path));
+
+	return m_valid ? nullptr : p_default;
+}
+
+OvAudio::Resources::Sound* OvCore::Helpers::BinaryReader::ReadSound(OvAudio::Resources::Sound* p_default)
+{
+	if (IsAtEnd())
+		return p_default;
+
+	if (const std::string_view path = ReadString(); m_valid && path != "?" && path != "")
+		return OvCore::Global::ServiceLocator::Get<OvCore::ResourceManagement::SoundManager>().GetResource(std::string(path));
+
+	return m_valid ? nullptr : p_default;
+}
+
+OvCore::Helpers::BinaryReader OvCore::Helpers::BinaryReader::ReadBlock()
+{
+	uint64_t size = 0;
+	const uint8_t* bytes = nullptr;
+
+	if (!IsAtEnd() && ReadVarUint(size))
+	{
+		if (size <= GetRemaining())
+			bytes = ReadBytes(static_cast<size_t>(size));
+		else
+			m_valid = false;
+	}
+
+	BinaryReader block(bytes, bytes ? static_cast<size_t>(size) : 0, *m_strings);
+	block.m_valid = m_valid;
+	return block;
+}
+
+bool OvCore::Helpers::BinaryReader::IsAtEnd() const
+{
+	return !m_valid || m_offset == m_size;
+}
+
+size_t OvCore::Helpers::BinaryReader::GetRemaining() const
+{
+	return m_size - m_offset;
+}
+
+bool OvCore::Helpers::BinaryReader::IsValid() const
+{
+	return m_valid;
+}
+
+const uint8_t* OvCore::Helpers::BinaryReader::ReadBytes(size_t p_size)
+{
+	if (!m_valid || p_size > m_size - m_offset)
+	{
+		m_valid = false;
+		return nullptr;
+	}
+
+	const uint8_t* bytes = m_data + m_offset;
+	m_offset += p_size;
+	return bytes;
+}
+
+bool OvCore::Helpers::BinaryReader::ReadVarUint(uint64_t& p_out)
+{
+	p_out = 0;
+
+	for (uint32_t shift = 0; shift < 64; shift += 7)
+	{
+		const uint8_t* byte = ReadBytes(1);
+
+		if (!byte)
+			return false;
+
+		p_out |= static_cast<uint64_t>(*byte & 0x7F) << shift;
+
+		if (!(*byte & 0x80))
+			return true;
+	}
+
+	m_valid = false;
+	return false;
+}
@@ -0,0 +1,128 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#include <cstring>
+
+#include "OvCore/ResourceManagement/MaterialManager.h"
+#include "OvCore/ResourceManagement/SoundManager.h"
+#include "OvCore/Helpers/BinaryWriter.h"
+
+OvCore::Helpers::BinaryWriter::BinaryWriter(StringTable& p_strings) :
+	m_strings(p_strings)
+{
+}
+
+void OvCore::Helpers::BinaryWriter::WriteBoolean(bool p_value)
+{
+	m_data.push_back(p_value ? 1 : 0);
+}
+
+void OvCore::Helpers::BinaryWriter::WriteInt(int32_t p_value)
+{
+	WriteInt64(p_value);
+}
+
+void OvCore::Helpers::BinaryWriter::WriteUint(uint32_t p_value)
+{
+	WriteVarUint(p_value);
+}
+
+void OvCore::Helpers::BinaryWriter::WriteInt64(int64_t p_value)
+{
+	/* Zigzag encoding, so small negative values stay small */
+	WriteVarUint((static_cast<uint64_t>(p_value) << 1) ^ static_cast<uint64_t>(p_value >> 63));
+}
+
+void OvCore::Helpers::BinaryWriter::WriteFloat(float p_value)
+{
+	uint32_t bits;
+	std::memcpy(&bits, &p_value, sizeof(bits));
+
+	for (uint32_t i = 0; i < 4; ++i)
+		m_data.push_back(static_cast<uint8_t>(bits >> (8 * i)));
+}
+
+void OvCore::Helpers::BinaryWriter::WriteVec2(const OvMaths::FVector2& p_value)
+{
+	WriteFloat(p_value.x);
+	WriteFloat(p_value.y);
+}
+
+void OvCore::Helpers::BinaryWriter::WriteVec3(const OvMaths::FVector3& p_value)
+{
+	WriteFloat(p_value.x);
+	WriteFloat(p_value.y);
+	WriteFloat(p_value.z);
+}
+
+void OvCore::Helpers::BinaryWriter::WriteVec4(const OvMaths::FVector4& p_value)
+{
+	WriteFloat(p_value.x);
+	WriteFloat(p_value.y);
+	WriteFloat(p_value.z);
+	WriteFloat(p_value.w);
+}
+
+void OvCore::Helpers::BinaryWriter::WriteQuat(const OvMaths::FQuaternion& p_value)
+{
+	WriteFloat(p_value.x);
+	WriteFloat(p_value.y);
+	WriteFloat(p_value.z);
+	WriteFloat(p_value.w);
+}
+
+void OvCore::Helpers::BinaryWriter::WriteString(const std::string& p_value)
+{
+	auto [it, inserted] = m_strings.indices.try_emplace(p_value, static_cast<uint32_t>(m_strings.strings.size()));
+
+	if (inserted)
+		m_strings.strings.push_back(p_value);
+
+	WriteVarUint(it->second);
+}
+
+void OvCore::Helpers::BinaryWriter::WriteMaterial(OvCore::Resources::Material* p_value)
+{
+	WriteString(p_value ? p_value->path : "?");
+}
+
+void OvCore::Helpers::BinaryWriter::WriteSound(OvAudio::Resources::Sound* p_value)
+{
+	WriteString(p_value ? p_value->path : "?");
+}
+
+void OvCore::Helpers::BinaryWriter::WriteBlock(const BinaryWriter& p_block)
+{
+	WriteVarUint(p_block.m_data.size());
+	WriteBytes(p_block.m_data.data(), p_block.m_data.size());
+}
+
+void OvCore::Helpers::BinaryWriter::WriteBytes(const void* p_data, size_t p_size)
+{
+	const auto bytes = static_cast<const uint8_t*>(p_data);
+	m_data.insert(m_data.end(), bytes, bytes + p_size);
+}
+
+OvCore::Helpers::BinaryWriter::StringTable& OvCore::Helpers::BinaryWriter::GetStrings()
+{
+	return m_strings;
+}
+
+const std::vector<uint8_t>& OvCore::Helpers::BinaryWriter::GetData() const
+{
+	return m_data;
+}
+
+void OvCore::Helpers::BinaryWriter::WriteVarUint(uint64_t p_value)
+{
+	while (p_value >= 0x80)
+	{
+		m_data.push_back(static_cast<uint8_t>(p_value | 0x80));
+		p_value >>= 7;
+	}
+
+	m_data.push_back(static_cast<uint8_t>(p_value));
+}
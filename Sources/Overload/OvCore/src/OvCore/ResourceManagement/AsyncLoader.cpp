@@ -0,0 +1,175 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#include <chrono>
+
+#include "OvCore/ResourceManagement/AsyncLoader.h"
+
+OvCore::ResourceManagement::AsyncLoader::AsyncLoader(uint32_t p_workerCount)
+{
+	if (p_workerCount == 0)
+	{
+		const uint32_t hardwareThreads = std::thread::hardware_concurrency();
+		p_workerCount = hardwareThreads > 1 ? hardwareThreads - 1 : 1;
+	}
+
+	m_workers.reserve(p_workerCount);
+
+	for (uint32_t i = 0; i < p_workerCount; ++i)
+		m_workers.emplace_back(&AsyncLoader::WorkerLoop, this);
+}
+
+OvCore::ResourceManagement::AsyncLoader::~AsyncLoader()
+{
+	std::deque<QueuedTask> discardedTasks;
+
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_stopping = true;
+		m_pendingTasks -= static_cast<uint32_t>(m_loadTasks.size());
+		discardedTasks.swap(m_loadTasks);
+	}
+
+	m_loadCondition.notify_all();
+
+	for (auto& worker : m_workers)
+		worker.join();
+
+	/* Loaded resources still own their decoded data, uploading them lets their owners release them as usual */
+	while (RunNextUpload());
+
+	/* Discarded requests are failed explicitly, so nothing keeps waiting for them */
+	for (auto& discarded : discardedTasks)
+	{
+		if (discarded.discardTask)
+			discarded.discardTask();
+	}
+}
+
+void OvCore::ResourceManagement::AsyncLoader::Submit(LoadTask p_task, UploadTask p_discardTask)
+{
+	{
+		std::unique_lock<std::mutex> lock(m_mutex);
+
+		if (m_stopping)
+		{
+			lock.unlock();
+
+			if (p_discardTask)
+				p_discardTask();
+
+			return;
+		}
+
+		m_loadTasks.push_back({ std::move(p_task), std::move(p_discardTask) });
+		++m_pendingTasks;
+	}
+
+	m_loadCondition.notify_one();
+}
+
+uint32_t OvCore::ResourceManagement::AsyncLoader::ProcessUploads(float p_budget)
+{
+	const auto start = std::chrono::steady_clock::now();
+	const auto budget = std::chrono::duration<float, std::milli>(p_budget);
+
+	uint32_t uploads = 0;
+
+	while (RunNextUpload())
+	{
+		++uploads;
+
+		if (std::chrono::steady_clock::now() - start >= budget)
+			break;
+	}
+
+	return uploads;
+}
+
+void OvCore::ResourceManagement::AsyncLoader::Flush()
+{
+	while (true)
+	{
+		while (RunNextUpload());
+
+		std::unique_lock<std::mutex> lock(m_mutex);
+
+		if (m_pendingTasks == 0)
+			return;
+
+		m_uploadCondition.wait(lock, [this] { return !m_uploadTasks.empty() || m_pendingTasks == 0; });
+	}
+}
+
+uint32_t OvCore::ResourceManagement::AsyncLoader::GetPendingCount() const
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	return m_pendingTasks;
+}
+
+uint32_t OvCore::ResourceManagement::AsyncLoader::GetWorkerCount() const
+{
+	return static_cast<uint32_t>(m_workers.size());
+}
+
+void OvCore::ResourceManagement::AsyncLoader::WorkerLoop()
+{
+	while (true)
+	{
+		LoadTask task;
+
+		{
+			std::unique_lock<std::mutex> lock(m_mutex);
+			m_loadCondition.wait(lock, [this] { return m_stopping || !m_loadTasks.empty(); });
+
+			if (m_loadTasks.empty())
+				return;
+
+			task = std::move(m_loadTasks.front().task);
+			m_loadTasks.pop_front();
+		}
+
+		UploadTask upload = task();
+
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+
+			if (upload)
+				m_uploadTasks.push_back(std::move(upload));
+			else
+				--m_pendingTasks;
+		}
+
+		m_uploadCondition.notify_all();
+	}
+}
+
+bool OvCore::ResourceManagement::AsyncLoader::RunNextUpload()
+{
+	UploadTask upload;
+
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+
+		if (m_uploadTasks.empty())
+			return false;
+
+		upload = std::move(m_uploadTasks.front());
+		m_uploadTasks.pop_front();
+	}
+
+	/* The task runs unlocked, so it can submit new tasks */
+	upload();
+
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		--m_pendingTasks;
+	}
+
+	m_uploadCondition.notify_all();
+
+	return true;
+}
@@ -69,3 +69,43 @@ void OvCore::ResourceManagement::ModelManager::ReloadResource(OvRendering::Resou
 	std::string realPath = GetRealPath(p_path);
 	OvRendering::Resources::Loaders::ModelLoader::Reload(*p_resource, realPath, GetAssetMetadata(realPath));
 }
+
+std::function<OvRendering::Resources::Model*()> OvCore::ResourceManagement::ModelManager::DecodeResource(const std::string& p_path)
+{
+	std::string realPath = GetRealPath(p_path);
+	auto model = OvRendering::Resources::Loaders::ModelLoader::Parse(realPath, GetAssetMetadata(realPath));
+	if (model)
+		*reinterpret_cast<std::string*>(reinterpret_cast<char*>(model) + offsetof(OvRendering::Resources::Model, path)) = p_path; // Force the resource path to fit the given path
+
+	return [model]
+	{
+		if (model)
+			OvRendering::Resources::Loaders::ModelLoader::Upload(*model);
+
+		return model;
+	};
+}
+
+OvCore::ResourceManagement::ResourceMemory OvCore::ResourceManagement::ModelManager::GetResourceMemory(OvRendering::Resources::Model& p_resource)
+{
+	ResourceMemory memory;
+
+	for (auto mesh : p_resource.GetMeshes())
+	{
+		const uint64_t indexSize = mesh->GetIndexType() == OvRendering::Buffers::EType::UNSIGNED_SHORT ? sizeof(uint16_t) : sizeof(uint32_t);
+		memory.gpuBytes += static_cast<uint64_t>(mesh->GetVertexCount()) * OvRendering::Resources::Mesh::GetVertexSize(mesh->HasBones());
+		memory.gpuBytes += static_cast<uint64_t>(mesh->GetIndexCount()) * indexSize;
+	}
+
+	for (const auto& animation : p_resource.GetHierarchy()->animations)
+	{
+		for (const auto& channel : animation.m_modelNodeAnimations)
+		{
+			memory.cpuBytes += channel.positions.size() * sizeof(channel.positions[0]);
+			memory.cpuBytes += channel.rotations.size() * sizeof(channel.rotations[0]);
+			memory.cpuBytes += channel.scales.size() * sizeof(channel.scales[0]);
+		}
+	}
+
+	return memory;
+}
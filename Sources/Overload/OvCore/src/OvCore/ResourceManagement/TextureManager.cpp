@@ -6,27 +6,29 @@
 
 #include "OvCore/ResourceManagement/TextureManager.h"
 #include "OvRendering/Settings/DriverSettings.h"
+#include "OvRendering/Resources/Loaders/TextureCooker.h"
 
 #include <OvTools/Filesystem/IniFile.h>
 
-std::tuple<OvRendering::Settings::ETextureFilteringMode, OvRendering::Settings::ETextureFilteringMode, bool> GetAssetMetadata(const std::string& p_path)
+std::tuple<OvRendering::Settings::ETextureFilteringMode, OvRendering::Settings::ETextureFilteringMode, bool, OvRendering::Settings::ETextureCompression> GetAssetMetadata(const std::string& p_path)
 {
 	auto metaFile = OvTools::Filesystem::IniFile(p_path + ".meta");
 
 	auto min = metaFile.GetOrDefault("MIN_FILTER", static_cast<int>(OvRendering::Settings::ETextureFilteringMode::LINEAR_MIPMAP_LINEAR));
 	auto mag = metaFile.GetOrDefault("MAG_FILTER", static_cast<int>(OvRendering::Settings::ETextureFilteringMode::LINEAR));
 	auto mipmap = metaFile.GetOrDefault("ENABLE_MIPMAPPING", true);
+	auto compression = metaFile.GetOrDefault("COMPRESSION", static_cast<int>(OvRendering::Settings::ETextureCompression::NONE));
 
-	return { static_cast<OvRendering::Settings::ETextureFilteringMode>(min), static_cast<OvRendering::Settings::ETextureFilteringMode>(mag), mipmap };
+	return { static_cast<OvRendering::Settings::ETextureFilteringMode>(min), static_cast<OvRendering::Settings::ETextureFilteringMode>(mag), mipmap, static_cast<OvRendering::Settings::ETextureCompression>(compression) };
 }
 
 OvRendering::Resources::Texture* OvCore::ResourceManagement::TextureManager::CreateResource(const std::string & p_path)
 {
 	std::string realPath = GetRealPath(p_path);
 
-	auto [min, mag, mipmap] = GetAssetMetadata(realPath);
+	auto [min, mag, mipmap, compression] = GetAssetMetadata(realPath);
 
-	OvRendering::Resources::Texture* texture = OvRendering::Resources::Loaders::TextureLoader::Create(realPath, min, mag, mipmap);
+	OvRendering::Resources::Texture* texture = OvRendering::Resources::Loaders::TextureLoader::Create(realPath, min, mag, mipmap, compression);
 	if (texture)
 		*reinterpret_cast<std::string*>(reinterpret_cast<char*>(texture) + offsetof(OvRendering::Resources::Texture, path)) = p_path; // Force the resource path to fit the given path
 
@@ -42,7 +44,46 @@ void OvCore::ResourceManagement::TextureManager::ReloadResource(OvRendering::Res
 {
 	std::string realPath = GetRealPath(p_path);
 
-	auto [min, mag, mipmap] = GetAssetMetadata(realPath);
+	auto [min, mag, mipmap, compression] = GetAssetMetadata(realPath);
 
-	OvRendering::Resources::Loaders::TextureLoader::Reload(*p_resource, realPath, min, mag, mipmap);
+	OvRendering::Resources::Loaders::TextureLoader::Reload(*p_resource, realPath, min, mag, mipmap, compression);
+}
+
+std::function<OvRendering::Resources::Texture*()> OvCore::ResourceManagement::TextureManager::DecodeResource(const std::string& p_path)
+{
+	std::string realPath = GetRealPath(p_path);
+
+	auto [min, mag, mipmap, compression] = GetAssetMetadata(realPath);
+
+	auto data = std::make_shared<OvRendering::Resources::Loaders::TextureData>();
+
+	if (!OvRendering::Resources::Loaders::TextureLoader::Decode(realPath, *data, min, mag, mipmap, compression))
+		return [] { return nullptr; };
+
+	return [p_path, data, min = min, mag = mag, mipmap = mipmap]
+	{
+		/* The path given to the loader is directly the resource path, no need to force it afterward */
+		return OvRendering::Resources::Loaders::TextureLoader::Upload(p_path, *data, min, mag, mipmap);
+	};
+}
+
+OvCore::ResourceManagement::ResourceMemory OvCore::ResourceManagement::TextureManager::GetResourceMemory(OvRendering::Resources::Texture& p_resource)
+{
+	ResourceMemory memory;
+
+	uint32_t width = p_resource.width;
+	uint32_t height = p_resource.height;
+
+	while (true)
+	{
+		memory.gpuBytes += OvRendering::Resources::Loaders::TextureCooker::GetLevelSize(width, height, p_resource.compression);
+
+		if (!p_resource.isMimapped || (width == 1 && height == 1))
+			break;
+
+		width = std::max(width / 2, 1u);
+		height = std::max(height / 2, 1u);
+	}
+
+	return memory;
 }
@@ -7,13 +7,26 @@
 #include "OvCore/Resources/Material.h"
 #include "OvCore/Global/ServiceLocator.h"
 #include "OvCore/ResourceManagement/TextureManager.h"
+#include "OvCore/ResourceManagement/ShaderManager.h"
 
 #include <OvRendering/Buffers/UniformBuffer.h>
 #include <OvRendering/Resources/Texture.h>
 
+namespace
+{
+	constexpr uint32_t kMaterialUBOBindingPoint = 1; // Binding point 0 is used by the EngineUBO
+}
+
+OvCore::Resources::Material::Material() = default;
+
+OvCore::Resources::Material::~Material() = default;
+
 void OvCore::Resources::Material::SetShader(OvRendering::Resources::Shader* p_shader)
 {
 	m_shader = p_shader;
+	m_shaderHandle = OVSERVICE(OvCore::ResourceManagement::ShaderManager).GetHandle(m_shader);
+	m_bakedUniformsRevision = 0; // Uniforms revisions start at 1, so the new shader is always seen as changed
+	m_parametersDirty = true;
 	if (m_shader)
 	{
 		OvRendering::Buffers::UniformBuffer::BindBlockToShader(*m_shader, "EngineUBO");
@@ -22,6 +35,7 @@ void OvCore::Resources::Material::SetShader(OvRendering::Resources::Shader* p_sh
 	else
 	{
 		m_uniformsData.clear();
+		m_textureHandles.clear();
 	}
 }
 
@@ -31,59 +45,78 @@ void OvCore::Resources::Material::FillUniform()
 
 	for (const OvRendering::Resources::UniformInfo& element : m_shader->uniforms)
 		m_uniformsData.emplace(element.name, element.defaultValue);
+
+	m_parametersDirty = true;
 }
 
-void OvCore::Resources::Material::Bind(OvRendering::Resources::Texture* p_emptyTexture)
+void OvCore::Resources::Material::Bind(OvRendering::Resources::Texture* p_emptyTexture, OvRendering::Core::GLStateCache& p_stateCache)
 {
 	if (HasShader())
 	{
-		using namespace OvMaths;
-		using namespace OvRendering::Resources;
+		p_stateCache.UseProgram(m_shader->id);
 
-		m_shader->Bind();
+		if (m_parametersDirty || m_bakedUniformsRevision != m_shader->GetUniformsRevision())
+			BakeParameters();
 
-		int textureSlot = 0;
+		if (m_parameterBuffer)
+			p_stateCache.BindBufferBase(OvRendering::Buffers::EBufferTarget::UNIFORM_BUFFER, kMaterialUBOBindingPoint, m_parameterBuffer->GetID());
 
-		for (auto&[name, value] : m_uniformsData)
+		m_parameterBlock.Upload(*m_shader, p_emptyTexture, m_parameterBuffer.get(), p_stateCache);
+	}
+}
+
+void OvCore::Resources::Material::BakeParameters()
+{
+	const uint32_t bufferSize = m_shader->GetMaterialBlockSize();
+
+	/* The program changed (New shader or recompilation), its blocks bindings and layout must be set up again */
+	if (m_bakedUniformsRevision != m_shader->GetUniformsRevision())
+	{
+		OvRendering::Buffers::UniformBuffer::BindBlockToShader(*m_shader, "EngineUBO");
+
+		if (bufferSize > 0)
+		{
+			OvRendering::Buffers::UniformBuffer::BindBlockToShader(*m_shader, "MaterialUBO", kMaterialUBOBindingPoint);
+			m_parameterBuffer = std::make_unique<OvRendering::Buffers::UniformBuffer>(bufferSize, kMaterialUBOBindingPoint);
+		}
+		else
 		{
-			auto uniformData = m_shader->GetUniformInfo(name);
+			m_parameterBuffer.reset();
+		}
 
-			if (uniformData)
-			{
-				switch (uniformData->type)
-				{
-				case OvRendering::Resources::UniformType::UNIFORM_BOOL:			if (value.type() == typeid(bool))		m_shader->SetUniformInt(name, std::any_cast<bool>(value));			break;
-				case OvRendering::Resources::UniformType::UNIFORM_INT:			if (value.type() == typeid(int))		m_shader->SetUniformInt(name, std::any_cast<int>(value));			break;
-				case OvRendering::Resources::UniformType::UNIFORM_FLOAT:		if (value.type() == typeid(float))		m_shader->SetUniformFloat(name, std::any_cast<float>(value));		break;
-				case OvRendering::Resources::UniformType::UNIFORM_FLOAT_VEC2:	if (value.type() == typeid(FVector2))	m_shader->SetUniformVec2(name, std::any_cast<FVector2>(value));		break;
-				case OvRendering::Resources::UniformType::UNIFORM_FLOAT_VEC3:	if (value.type() == typeid(FVector3))	m_shader->SetUniformVec3(name, std::any_cast<FVector3>(value));		break;
-				case OvRendering::Resources::UniformType::UNIFORM_FLOAT_VEC4:	if (value.type() == typeid(FVector4))	m_shader->SetUniformVec4(name, std::any_cast<FVector4>(value));		break;
-				case OvRendering::Resources::UniformType::UNIFORM_SAMPLER_2D:
-					{
-						if (value.type() == typeid(Texture*))
-						{
-							if (auto tex = std::any_cast<Texture*>(value); tex)
-							{
-								tex->Bind(textureSlot);
-								m_shader->SetUniformInt(uniformData->name, textureSlot++);
-							}
-							else if (p_emptyTexture)
-							{
-								p_emptyTexture->Bind(textureSlot);
-								m_shader->SetUniformInt(uniformData->name, textureSlot++);
-							}
-						}
-					}
-				}
-			}
+		m_bakedUniformsRevision = m_shader->GetUniformsRevision();
+	}
+
+	m_parameterBlock.Bake(m_shader->uniforms, m_uniformsData, bufferSize);
+	m_parametersDirty = false;
+
+	UpdateTextureHandles();
+}
+
+void OvCore::Resources::Material::UpdateTextureHandles()
+{
+	auto& textureManager = OVSERVICE(OvCore::ResourceManagement::TextureManager);
+
+	std::vector<ResourceManagement::ResourceHandle<OvRendering::Resources::Texture>> handles;
+	handles.reserve(m_textureHandles.size());
+
+	for (const auto& [name, value] : m_uniformsData)
+	{
+		if (value.type() == typeid(OvRendering::Resources::Texture*))
+		{
+			if (auto texture = std::any_cast<OvRendering::Resources::Texture*>(value))
+				handles.push_back(textureManager.GetHandle(texture));
 		}
 	}
+
+	/* The new handles are acquired before the previous ones are released, so kept textures never reach zero references */
+	m_textureHandles = std::move(handles);
 }
 
-void OvCore::Resources::Material::UnBind()
+void OvCore::Resources::Material::UnBind(OvRendering::Core::GLStateCache& p_stateCache)
 {
 	if (HasShader())
-		m_shader->Unbind();
+		p_stateCache.UseProgram(0);
 }
 
 OvRendering::Resources::Shader*& OvCore::Resources::Material::GetShader()
@@ -183,9 +216,20 @@ uint8_t OvCore::Resources::Material::GenerateStateMask() const
 
 std::map<std::string, std::any>& OvCore::Resources::Material::GetUniformsData()
 {
+	m_parametersDirty = true;
 	return m_uniformsData;
 }
 
+void OvCore::Resources::Material::MarkParametersDirty()
+{
+	m_parametersDirty = true;
+}
+
+const OvCore::Resources::MaterialParameterBlock& OvCore::Resources::Material::GetParameterBlock() const
+{
+	return m_parameterBlock;
+}
+
 void OvCore::Resources::Material::OnSerialize(tinyxml2::XMLDocument & p_doc, tinyxml2::XMLNode * p_node)
 {
 	using namespace OvCore::Helpers;
@@ -326,7 +370,24 @@ void OvCore::Resources::Material::OnDeserialize(tinyxml2::XMLDocument & p_doc, t
 							break;
 
 						case OvRendering::Resources::UniformType::UNIFORM_SAMPLER_2D:
-							m_uniformsData[uniformInfo->name] = OvCore::Helpers::Serializer::DeserializeTexture(p_doc, uniform, "value");
+							m_uniformsData[uniformInfo->name] = static_cast<OvRendering::Resources::Texture*>(nullptr);
+
+							if (std::string texturePath = OvCore::Helpers::Serializer::DeserializeString(p_doc, uniform, "value"); texturePath != "?" && texturePath != "")
+							{
+								OVSERVICE(OvCore::ResourceManagement::TextureManager).LoadResourceAsync(texturePath, [this, lifetime = std::weak_ptr<bool>(m_lifetime), name = uniformInfo->name](OvRendering::Resources::Texture* p_texture)
+								{
+									if (lifetime.expired())
+										return;
+
+									/* Only fill the sampler if it hasn't been given another texture in the meantime */
+									if (auto value = m_uniformsData.find(name); value != m_uniformsData.end() && value->second.type() == typeid(OvRendering::Resources::Texture*) && !std::any_cast<OvRendering::Resources::Texture*>(value->second))
+									{
+										value->second = p_texture;
+										m_parametersDirty = true;
+										UpdateTextureHandles();
+									}
+								});
+							}
 							break;
 						}
 					}
@@ -0,0 +1,182 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#include <cstring>
+
+#include <OvMaths/FVector2.h>
+#include <OvMaths/FVector3.h>
+#include <OvMaths/FVector4.h>
+#include <OvRendering/Buffers/UniformBuffer.h>
+#include <OvRendering/Resources/Shader.h>
+#include <OvRendering/Resources/Texture.h>
+
+#include "OvCore/Resources/MaterialParameterBlock.h"
+
+namespace
+{
+	/* Write the value held by p_value (If it holds a T) as raw bytes. Booleans are written as 32 bits integers (GLSL bool) */
+	template<typename T>
+	bool WriteValue(const std::any& p_value, uint8_t* p_destination)
+	{
+		if (p_value.type() != typeid(T))
+			return false;
+
+		if constexpr (std::is_same_v<T, bool>)
+		{
+			const int32_t value = std::any_cast<bool>(p_value) ? 1 : 0;
+			std::memcpy(p_destination, &value, sizeof(value));
+		}
+		else
+		{
+			const T& value = *std::any_cast<T>(&p_value);
+			std::memcpy(p_destination, &value, sizeof(T));
+		}
+
+		return true;
+	}
+
+	uint32_t GetValueSize(OvRendering::Resources::UniformType p_type)
+	{
+		using namespace OvRendering::Resources;
+
+		switch (p_type)
+		{
+		case UniformType::UNIFORM_BOOL:			return sizeof(int32_t);
+		case UniformType::UNIFORM_INT:			return sizeof(int);
+		case UniformType::UNIFORM_FLOAT:		return sizeof(float);
+		case UniformType::UNIFORM_FLOAT_VEC2:	return sizeof(OvMaths::FVector2);
+		case UniformType::UNIFORM_FLOAT_VEC3:	return sizeof(OvMaths::FVector3);
+		case UniformType::UNIFORM_FLOAT_VEC4:	return sizeof(OvMaths::FVector4);
+		default:								return 0;
+		}
+	}
+
+	bool WriteValue(OvRendering::Resources::UniformType p_type, const std::any& p_value, uint8_t* p_destination)
+	{
+		using namespace OvRendering::Resources;
+
+		switch (p_type)
+		{
+		case UniformType::UNIFORM_BOOL:			return WriteValue<bool>(p_value, p_destination);
+		case UniformType::UNIFORM_INT:			return WriteValue<int>(p_value, p_destination);
+		case UniformType::UNIFORM_FLOAT:		return WriteValue<float>(p_value, p_destination);
+		case UniformType::UNIFORM_FLOAT_VEC2:	return WriteValue<OvMaths::FVector2>(p_value, p_destination);
+		case UniformType::UNIFORM_FLOAT_VEC3:	return WriteValue<OvMaths::FVector3>(p_value, p_destination);
+		case UniformType::UNIFORM_FLOAT_VEC4:	return WriteValue<OvMaths::FVector4>(p_value, p_destination);
+		default:								return false;
+		}
+	}
+
+	template<typename T>
+	T ReadValue(const std::vector<uint8_t>& p_values, uint32_t p_offset)
+	{
+		T value;
+		std::memcpy(&value, p_values.data() + p_offset, sizeof(T));
+		return value;
+	}
+}
+
+void OvCore::Resources::MaterialParameterBlock::Bake(const std::vector<OvRendering::Resources::UniformInfo>& p_uniforms, const std::map<std::string, std::any>& p_values, uint32_t p_bufferSize)
+{
+	using namespace OvRendering::Resources;
+
+	m_parameters.clear();
+	m_samplers.clear();
+	m_values.clear();
+	m_bufferData.assign(p_bufferSize, 0);
+	m_bufferUploaded = false;
+
+	uint32_t textureSlot = 0;
+
+	for (const auto& uniform : p_uniforms)
+	{
+		const auto found = p_values.find(uniform.name);
+
+		if (found == p_values.end())
+			continue;
+
+		const std::any& value = found->second;
+
+		if (uniform.type == UniformType::UNIFORM_SAMPLER_2D)
+		{
+			if (value.type() == typeid(Texture*))
+				m_samplers.push_back({ uniform.location, textureSlot++, std::any_cast<Texture*>(value) });
+		}
+		else if (const uint32_t size = GetValueSize(uniform.type); size > 0)
+		{
+			if (uniform.blockOffset >= 0)
+			{
+				if (static_cast<uint32_t>(uniform.blockOffset) + size <= m_bufferData.size())
+					WriteValue(uniform.type, value, m_bufferData.data() + uniform.blockOffset);
+			}
+			else
+			{
+				const uint32_t offset = static_cast<uint32_t>(m_values.size());
+				m_values.resize(offset + size);
+
+				if (WriteValue(uniform.type, value, m_values.data() + offset))
+					m_parameters.push_back({ uniform.type, uniform.location, offset });
+				else
+					m_values.resize(offset);
+			}
+		}
+	}
+}
+
+void OvCore::Resources::MaterialParameterBlock::Upload(OvRendering::Resources::Shader& p_shader, OvRendering::Resources::Texture* p_emptyTexture, OvRendering::Buffers::UniformBuffer* p_buffer, OvRendering::Core::GLStateCache& p_stateCache)
+{
+	using namespace OvMaths;
+	using namespace OvRendering::Resources;
+
+	for (const auto& parameter : m_parameters)
+	{
+		switch (parameter.type)
+		{
+		case UniformType::UNIFORM_BOOL:
+		case UniformType::UNIFORM_INT:			p_shader.SetUniformInt(parameter.location, ReadValue<int32_t>(m_values, parameter.offset));		break;
+		case UniformType::UNIFORM_FLOAT:		p_shader.SetUniformFloat(parameter.location, ReadValue<float>(m_values, parameter.offset));		break;
+		case UniformType::UNIFORM_FLOAT_VEC2:	p_shader.SetUniformVec2(parameter.location, ReadValue<FVector2>(m_values, parameter.offset));	break;
+		case UniformType::UNIFORM_FLOAT_VEC3:	p_shader.SetUniformVec3(parameter.location, ReadValue<FVector3>(m_values, parameter.offset));	break;
+		case UniformType::UNIFORM_FLOAT_VEC4:	p_shader.SetUniformVec4(parameter.location, ReadValue<FVector4>(m_values, parameter.offset));	break;
+		default: break;
+		}
+	}
+
+	for (const auto& sampler : m_samplers)
+	{
+		if (auto texture = sampler.texture ? sampler.texture : p_emptyTexture; texture)
+		{
+			p_stateCache.BindTexture(sampler.slot, texture->id);
+			p_shader.SetUniformInt(sampler.location, static_cast<int>(sampler.slot));
+		}
+	}
+
+	if (p_buffer && !m_bufferData.empty() && !m_bufferUploaded)
+	{
+		p_buffer->SetSubData(m_bufferData.data(), m_bufferData.size(), 0);
+		m_bufferUploaded = true;
+	}
+}
+
+const std::vector<OvCore::Resources::MaterialParameterBlock::Parameter>& OvCore::Resources::MaterialParameterBlock::GetParameters() const
+{
+	return m_parameters;
+}
+
+const std::vector<OvCore::Resources::MaterialParameterBlock::Sampler>& OvCore::Resources::MaterialParameterBlock::GetSamplers() const
+{
+	return m_samplers;
+}
+
+const std::vector<uint8_t>& OvCore::Resources::MaterialParameterBlock::GetValues() const
+{
+	return m_values;
+}
+
+const std::vector<uint8_t>& OvCore::Resources::MaterialParameterBlock::GetBufferData() const
+{
+	return m_bufferData;
+}
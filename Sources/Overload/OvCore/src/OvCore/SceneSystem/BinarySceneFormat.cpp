@@ -0,0 +1,285 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <optional>
+#include <string_view>
+
+#include <OvTools/Filesystem/MappedFile.h>
+#include <OvTools/Filesystem/tinyxml2.h>
+
+#include "OvCore/Helpers/BinaryReader.h"
+#include "OvCore/Helpers/BinaryWriter.h"
+#include "OvCore/SceneSystem/BinarySceneFormat.h"
+#include "OvCore/SceneSystem/Scene.h"
+
+namespace
+{
+	constexpr char kMagic[4] = { 'O', 'V', 'S', 'B' };
+	constexpr uint32_t kVersion = 2;
+
+	constexpr uint32_t MakeChunkID(char p_a, char p_b, char p_c, char p_d)
+	{
+		return static_cast<uint32_t>(static_cast<uint8_t>(p_a)) |
+			(static_cast<uint32_t>(static_cast<uint8_t>(p_b)) << 8) |
+			(static_cast<uint32_t>(static_cast<uint8_t>(p_c)) << 16) |
+			(static_cast<uint32_t>(static_cast<uint8_t>(p_d)) << 24);
+	}
+
+	constexpr uint32_t kStringsChunk = MakeChunkID('S', 'T', 'R', 'S');
+	constexpr uint32_t kSceneChunk = MakeChunkID('S', 'C', 'N', 'E');
+
+	/* The strings point into the given data, and the scene reader reads its strings from them */
+	std::optional<OvCore::Helpers::BinaryReader> ReadFile(const uint8_t* p_data, size_t p_size, std::vector<std::string_view>& p_outStrings)
+	{
+		using OvCore::Helpers::BinaryReader;
+
+		if (!OvCore::SceneSystem::BinarySceneFormat::IsBinary(p_data, p_size))
+			return std::nullopt;
+
+		BinaryReader file(p_data + sizeof(kMagic), p_size - sizeof(kMagic), p_outStrings);
+
+		if (file.ReadUint() != kVersion)
+			return std::nullopt;
+
+		const uint32_t chunkCount = file.ReadUint();
+
+		std::optional<BinaryReader> scene;
+		bool hasStrings = false;
+
+		for (uint32_t i = 0; i < chunkCount && file.IsValid(); ++i)
+		{
+			/* Unlike values, chunks can't be missing (Which would only come from a truncated file) */
+			if (file.IsAtEnd())
+				return std::nullopt;
+
+			const uint32_t chunkID = file.ReadUint();
+
+			if (file.IsAtEnd())
+				return std::nullopt;
+
+			BinaryReader chunk = file.ReadBlock();
+
+			if (!file.IsValid())
+				return std::nullopt;
+
+			if (chunkID == kStringsChunk)
+			{
+				const uint32_t count = chunk.ReadUint();
+
+				/* Every string takes at least one byte (Its size), so a larger count can only come from a corrupted file */
+				if (count > chunk.GetRemaining())
+					return std::nullopt;
+
+				p_outStrings.clear();
+				p_outStrings.reserve(count);
+
+				for (uint32_t j = 0; j < count && chunk.IsValid(); ++j)
+				{
+					const uint32_t size = chunk.ReadUint();
+					const uint8_t* bytes = chunk.ReadBytes(size);
+
+					if (bytes)
+						p_outStrings.emplace_back(reinterpret_cast<const char*>(bytes), size);
+				}
+
+				if (!chunk.IsValid())
+					return std::nullopt;
+
+				hasStrings = true;
+			}
+			else if (chunkID == kSceneChunk)
+			{
+				scene = chunk;
+			}
+		}
+
+		if (!file.IsValid() || !hasStrings)
+			return std::nullopt;
+
+		return scene;
+	}
+
+	/* Walks through the actor blocks, so a corrupted file is rejected before any actor is created */
+	bool ValidateScene(OvCore::Helpers::BinaryReader p_scene)
+	{
+		const uint32_t actorCount = p_scene.ReadUint();
+
+		if (actorCount > p_scene.GetRemaining())
+			return false;
+
+		for (uint32_t i = 0; i < actorCount && p_scene.IsValid(); ++i)
+		{
+			OvCore::Helpers::BinaryReader actor = p_scene.ReadBlock();
+
+			actor.ReadString(); // Name
+			actor.ReadString(); // Tag
+			actor.ReadBoolean(); // Active
+			actor.ReadInt64(); // ID
+			actor.ReadInt64(); // Parent
+
+			/* Components, then behaviours: a type name and a block each */
+			for (uint32_t list = 0; list < 2 && actor.IsValid(); ++list)
+			{
+				const uint32_t count = actor.ReadUint();
+
+				if (count > actor.GetRemaining())
+					return false;
+
+				for (uint32_t j = 0; j < count && actor.IsValid(); ++j)
+				{
+					actor.ReadString();
+					actor.ReadBlock();
+				}
+			}
+
+			if (!actor.IsValid())
+				return false;
+		}
+
+		return p_scene.IsValid();
+	}
+
+	bool WriteFile(const std::vector<uint8_t>& p_bytes, const std::string& p_filePath)
+	{
+		/* Write to a temporary file first, so the scene is never left half written (The source may be the same file) */
+		const std::string temporaryPath = p_filePath + ".tmp";
+
+		{
+			std::ofstream output(temporaryPath, std::ios::binary | std::ios::trunc);
+
+			if (!output)
+				return false;
+
+			output.write(reinterpret_cast<const char*>(p_bytes.data()), p_bytes.size());
+
+			if (!output)
+			{
+				output.close();
+				std::error_code error;
+				std::filesystem::remove(temporaryPath, error);
+				return false;
+			}
+		}
+
+		std::error_code error;
+		std::filesystem::rename(temporaryPath, p_filePath, error);
+
+		if (error)
+			std::filesystem::remove(temporaryPath, error);
+
+		return !error;
+	}
+}
+
+bool OvCore::SceneSystem::BinarySceneFormat::IsBinary(const uint8_t* p_data, size_t p_size)
+{
+	return p_data && p_size >= sizeof(kMagic) && std::memcmp(p_data, kMagic, sizeof(kMagic)) == 0;
+}
+
+bool OvCore::SceneSystem::BinarySceneFormat::Validate(const uint8_t* p_data, size_t p_size)
+{
+	std::vector<std::string_view> strings;
+	const auto scene = ReadFile(p_data, p_size, strings);
+	return scene && ValidateScene(*scene);
+}
+
+std::vector<uint8_t> OvCore::SceneSystem::BinarySceneFormat::Encode(Scene& p_scene)
+{
+	Helpers::BinaryWriter::StringTable strings;
+
+	Helpers::BinaryWriter scene(strings);
+	p_scene.OnBinarySerialize(scene);
+
+	Helpers::BinaryWriter stringsChunk(strings);
+	stringsChunk.WriteUint(static_cast<uint32_t>(strings.strings.size()));
+
+	for (const std::string& value : strings.strings)
+	{
+		stringsChunk.WriteUint(static_cast<uint32_t>(value.size()));
+		stringsChunk.WriteBytes(value.data(), value.size());
+	}
+
+	Helpers::BinaryWriter file(strings);
+	file.WriteBytes(kMagic, sizeof(kMagic));
+	file.WriteUint(kVersion);
+	file.WriteUint(2); // Chunk count
+	file.WriteUint(kStringsChunk);
+	file.WriteBlock(stringsChunk);
+	file.WriteUint(kSceneChunk);
+	file.WriteBlock(scene);
+
+	return file.GetData();
+}
+
+bool OvCore::SceneSystem::BinarySceneFormat::Decode(const uint8_t* p_data, size_t p_size, Scene& p_scene)
+{
+	std::vector<std::string_view> strings;
+	auto scene = ReadFile(p_data, p_size, strings);
+
+	if (!scene || !ValidateScene(*scene))
+		return false;
+
+	p_scene.OnBinaryDeserialize(*scene);
+	return true;
+}
+
+bool OvCore::SceneSystem::BinarySceneFormat::Save(Scene& p_scene, const std::string& p_filePath)
+{
+	return WriteFile(Encode(p_scene), p_filePath);
+}
+
+bool OvCore::SceneSystem::BinarySceneFormat::Load(const std::string& p_filePath, Scene& p_scene)
+{
+	OvTools::Filesystem::MappedFile file(p_filePath);
+
+	if (!file.IsOpen())
+		return false;
+
+	if (IsBinary(file.GetData(), file.GetSize()))
+		return Decode(file.GetData(), file.GetSize(), p_scene);
+
+	tinyxml2::XMLDocument doc;
+
+	if (doc.Parse(reinterpret_cast<const char*>(file.GetData()), file.GetSize()) != tinyxml2::XML_SUCCESS || !doc.FirstChild())
+		return false;
+
+	tinyxml2::XMLNode* sceneNode = doc.FirstChild()->FirstChildElement("scene");
+
+	if (!sceneNode)
+		return false;
+
+	p_scene.OnDeserialize(doc, sceneNode);
+	return true;
+}
+
+bool OvCore::SceneSystem::BinarySceneFormat::ConvertToBinary(const std::string& p_sourcePath, const std::string& p_destinationPath)
+{
+	Scene scene;
+	return Load(p_sourcePath, scene) && Save(scene, p_destinationPath);
+}
+
+bool OvCore::SceneSystem::BinarySceneFormat::ConvertToXML(const std::string& p_sourcePath, const std::string& p_destinationPath)
+{
+	Scene scene;
+
+	if (!Load(p_sourcePath, scene))
+		return false;
+
+	tinyxml2::XMLDocument doc;
+	tinyxml2::XMLNode* root = doc.NewElement("root");
+	doc.InsertFirstChild(root);
+	scene.OnSerialize(doc, root);
+
+	/* Written through a temporary file as well, as the source may be the same file */
+	tinyxml2::XMLPrinter printer;
+	doc.Print(&printer);
+
+	const auto text = reinterpret_cast<const uint8_t*>(printer.CStr());
+	return WriteFile(std::vector<uint8_t>(text, text + printer.CStrSize() - 1), p_destinationPath);
+}
@@ -6,9 +6,103 @@
 
 #include <algorithm>
 #include <string>
+#include <unordered_map>
+#include <utility>
+
+#include <OvTools/Utils/ThreadPool.h>
 
 #include "OvCore/SceneSystem/Scene.h"
 
+namespace
+{
+	/**
+	* Insert the given element in the given list sorted by registration order, or remove it. Does nothing if the element
+	* is already in (Or out of) the list. The orders of the listed elements are kept in a parallel list
+	*/
+	template<typename T>
+	void SetListed(std::vector<T*>& p_list, std::vector<uint64_t>& p_orders, T* p_element, uint64_t p_order, bool p_listed)
+	{
+		const auto position = std::lower_bound(p_orders.begin(), p_orders.end(), p_order);
+		const auto index = position - p_orders.begin();
+
+		/* Orders are unique, so an element with the same order is the given element */
+		const bool listed = position != p_orders.end() && *position == p_order;
+
+		if (p_listed && !listed)
+		{
+			p_orders.insert(position, p_order);
+			p_list.insert(p_list.begin() + index, p_element);
+		}
+		else if (!p_listed && listed)
+		{
+			p_orders.erase(position);
+			p_list.erase(p_list.begin() + index);
+		}
+	}
+
+	/**
+	* Add the given actor to the bucket of the given key, or remove it (Empty buckets are removed). The position of the actor
+	* in the bucket is stored in its record, so removing it moves the last actor of the bucket in its place
+	*/
+	template<typename Index, typename Key, typename Records, typename Position>
+	void SetIndexed(Index& p_index, const Key& p_key, OvCore::ECS::Actor& p_actor, bool p_indexed, Records& p_records, Position p_position)
+	{
+		auto& record = p_records.at(&p_actor);
+
+		if (p_indexed)
+		{
+			auto& bucket = p_index[p_key];
+
+			if (record.*p_position < bucket.size() && bucket[record.*p_position].actor == &p_actor)
+				return;
+
+			record.*p_position = bucket.size();
+			bucket.push_back({ &p_actor, record.order });
+		}
+		else if (auto found = p_index.find(p_key); found != p_index.end())
+		{
+			auto& bucket = found->second;
+			const size_t position = record.*p_position;
+
+			if (position < bucket.size() && bucket[position].actor == &p_actor)
+			{
+				bucket[position] = bucket.back();
+				p_records.at(bucket[position].actor).*p_position = position;
+				bucket.pop_back();
+
+				if (bucket.empty())
+					p_index.erase(found);
+			}
+		}
+	}
+
+	/**
+	* Returns the first actor of the given bucket in scene order
+	*/
+	template<typename Bucket>
+	OvCore::ECS::Actor* GetFirstActor(const Bucket& p_bucket)
+	{
+		return std::min_element(p_bucket.begin(), p_bucket.end(), [](const auto& p_a, const auto& p_b) { return p_a.order < p_b.order; })->actor;
+	}
+
+	/**
+	* Returns the actors of the given bucket in scene order
+	*/
+	template<typename Bucket>
+	std::vector<std::reference_wrapper<OvCore::ECS::Actor>> GetActorsInOrder(Bucket p_bucket)
+	{
+		std::sort(p_bucket.begin(), p_bucket.end(), [](const auto& p_a, const auto& p_b) { return p_a.order < p_b.order; });
+
+		std::vector<std::reference_wrapper<OvCore::ECS::Actor>> actors;
+		actors.reserve(p_bucket.size());
+
+		for (const auto& indexed : p_bucket)
+			actors.push_back(std::ref(*indexed.actor));
+
+		return actors;
+	}
+}
+
 OvCore::SceneSystem::Scene::Scene()
 {
 
@@ -16,6 +110,12 @@ OvCore::SceneSystem::Scene::Scene()
 
 OvCore::SceneSystem::Scene::~Scene()
 {
+	/* Emptied first, so the actors removing their components don't look them up in lists destroyed anyway */
+	m_fastAccessComponents = FastAccessComponents();
+	m_activeComponents = FastAccessComponents();
+	m_activeComponentOrders = ActiveComponentOrders();
+	m_componentOrders.clear();
+
 	std::for_each(m_actors.begin(), m_actors.end(), [](OvCore::ECS::Actor* element)
 	{ 
 		delete element;
@@ -41,22 +141,41 @@ bool OvCore::SceneSystem::Scene::IsPlaying() const
 	return m_isPlaying;
 }
 
-void OvCore::SceneSystem::Scene::Update(float p_deltaTime)
+void OvCore::SceneSystem::Scene::Update(float p_deltaTime, OvTools::Utils::ThreadPool* p_threadPool)
 {
-	auto actors = m_actors;
-	std::for_each(actors.begin(), actors.end(), std::bind(std::mem_fn(&ECS::Actor::OnUpdate), std::placeholders::_1, p_deltaTime));
+	m_updateSystem.Run(ECS::UpdateSystem::EPhase::UPDATE, p_deltaTime, p_threadPool);
+
+	UpdateAnimations(p_deltaTime, p_threadPool);
+}
+
+void OvCore::SceneSystem::Scene::UpdateAnimations(float p_deltaTime, OvTools::Utils::ThreadPool* p_threadPool)
+{
+	const auto& animations = m_activeComponents.animations;
+
+	const auto updateAnimation = [&animations, p_deltaTime](uint32_t p_index)
+	{
+		animations[p_index]->UpdatePose(p_deltaTime);
+	};
+
+	if (p_threadPool)
+	{
+		p_threadPool->Dispatch(static_cast<uint32_t>(animations.size()), updateAnimation);
+	}
+	else
+	{
+		for (uint32_t i = 0; i < animations.size(); ++i)
+			updateAnimation(i);
+	}
 }
 
 void OvCore::SceneSystem::Scene::FixedUpdate(float p_deltaTime)
 {
-	auto actors = m_actors;
-	std::for_each(actors.begin(), actors.end(), std::bind(std::mem_fn(&ECS::Actor::OnFixedUpdate), std::placeholders::_1, p_deltaTime));
+	m_updateSystem.Run(ECS::UpdateSystem::EPhase::FIXED_UPDATE, p_deltaTime);
 }
 
 void OvCore::SceneSystem::Scene::LateUpdate(float p_deltaTime)
 {
-	auto actors = m_actors;
-	std::for_each(actors.begin(), actors.end(), std::bind(std::mem_fn(&ECS::Actor::OnLateUpdate), std::placeholders::_1, p_deltaTime));
+	m_updateSystem.Run(ECS::UpdateSystem::EPhase::LATE_UPDATE, p_deltaTime);
 }
 
 OvCore::ECS::Actor& OvCore::SceneSystem::Scene::CreateActor()
@@ -66,10 +185,8 @@ OvCore::ECS::Actor& OvCore::SceneSystem::Scene::CreateActor()
 
 OvCore::ECS::Actor& OvCore::SceneSystem::Scene::CreateActor(const std::string& p_name, const std::string& p_tag)
 {
-	m_actors.push_back(new OvCore::ECS::Actor(m_availableID++, p_name, p_tag, m_isPlaying));
-	ECS::Actor& instance = *m_actors.back();
-	instance.ComponentAddedEvent	+= std::bind(&Scene::OnComponentAdded, this, std::placeholders::_1);
-	instance.ComponentRemovedEvent	+= std::bind(&Scene::OnComponentRemoved, this, std::placeholders::_1);
+	ECS::Actor& instance = InstantiateActor(m_availableID++, p_name, p_tag);
+	ListenToActor(instance);
 	if (m_isPlaying)
 	{
 		instance.SetSleeping(false);
@@ -83,6 +200,84 @@ OvCore::ECS::Actor& OvCore::SceneSystem::Scene::CreateActor(const std::string& p
 	return instance;
 }
 
+OvCore::ECS::Actor& OvCore::SceneSystem::Scene::InstantiateActor(int64_t p_actorID, const std::string& p_name, const std::string& p_tag)
+{
+	m_actors.push_back(new OvCore::ECS::Actor(p_actorID, p_name, p_tag, m_isPlaying));
+	m_actorRecords.emplace(m_actors.back(), ActorRecord{ m_actorOrderCount++ });
+	return *m_actors.back();
+}
+
+void OvCore::SceneSystem::Scene::ListenToActor(ECS::Actor& p_actor)
+{
+	SetIndexed(m_actorsByID, p_actor.GetID(), p_actor, true, m_actorRecords, &ActorRecord::idPosition);
+	SetIndexed(m_actorsByName, p_actor.GetName(), p_actor, true, m_actorRecords, &ActorRecord::namePosition);
+	SetIndexed(m_actorsByTag, p_actor.GetTag(), p_actor, true, m_actorRecords, &ActorRecord::tagPosition);
+
+	/* Lambdas only capturing "this" are stored inline by std::function, unlike the equivalent std::bind */
+	p_actor.ComponentAddedEvent		+= [this](ECS::Components::AComponent& p_component) { OnComponentAdded(p_component); };
+	p_actor.ComponentRemovedEvent	+= [this](ECS::Components::AComponent& p_component) { OnComponentRemoved(p_component); };
+	p_actor.BehaviourAddedEvent		+= [this](ECS::Components::Behaviour& p_behaviour) { m_updateSystem.Register(p_behaviour); };
+	p_actor.BehaviourRemovedEvent	+= [this](ECS::Components::Behaviour& p_behaviour) { m_updateSystem.Unregister(p_behaviour); };
+	p_actor.ActiveStateChangedEvent	+= [this](ECS::Actor& p_changedActor) { OnActorActiveStateChanged(p_changedActor); };
+
+	p_actor.IDChangedEvent += [this](ECS::Actor& p_changedActor, int64_t p_previousID)
+	{
+		SetIndexed(m_actorsByID, p_previousID, p_changedActor, false, m_actorRecords, &ActorRecord::idPosition);
+		SetIndexed(m_actorsByID, p_changedActor.GetID(), p_changedActor, true, m_actorRecords, &ActorRecord::idPosition);
+	};
+
+	p_actor.NameChangedEvent += [this](ECS::Actor& p_changedActor, const std::string& p_previousName)
+	{
+		SetIndexed(m_actorsByName, p_previousName, p_changedActor, false, m_actorRecords, &ActorRecord::namePosition);
+		SetIndexed(m_actorsByName, p_changedActor.GetName(), p_changedActor, true, m_actorRecords, &ActorRecord::namePosition);
+	};
+
+	p_actor.TagChangedEvent += [this](ECS::Actor& p_changedActor, const std::string& p_previousTag)
+	{
+		SetIndexed(m_actorsByTag, p_previousTag, p_changedActor, false, m_actorRecords, &ActorRecord::tagPosition);
+		SetIndexed(m_actorsByTag, p_changedActor.GetTag(), p_changedActor, true, m_actorRecords, &ActorRecord::tagPosition);
+	};
+}
+
+void OvCore::SceneSystem::Scene::UnindexActor(ECS::Actor& p_actor)
+{
+	SetIndexed(m_actorsByID, p_actor.GetID(), p_actor, false, m_actorRecords, &ActorRecord::idPosition);
+	SetIndexed(m_actorsByName, p_actor.GetName(), p_actor, false, m_actorRecords, &ActorRecord::namePosition);
+	SetIndexed(m_actorsByTag, p_actor.GetTag(), p_actor, false, m_actorRecords, &ActorRecord::tagPosition);
+	m_actorRecords.erase(&p_actor);
+}
+
+void OvCore::SceneSystem::Scene::OnActorActiveStateChanged(ECS::Actor& p_actor)
+{
+	const bool isActive = p_actor.IsActive();
+
+	for (auto& component : p_actor.GetComponents())
+		SetComponentActive(*component, isActive);
+}
+
+void OvCore::SceneSystem::Scene::SetComponentActive(ECS::Components::AComponent& p_component, bool p_active)
+{
+	/* Components that aren't registered to the scene yet are listed when they get registered */
+	const auto found = m_componentOrders.find(&p_component);
+
+	if (found == m_componentOrders.end())
+		return;
+
+	const uint64_t order = found->second;
+
+	if (auto result = dynamic_cast<ECS::Components::CModelRenderer*>(&p_component))
+		SetListed(m_activeComponents.modelRenderers, m_activeComponentOrders.modelRenderers, result, order, p_active);
+
+	if (auto result = dynamic_cast<ECS::Components::CCamera*>(&p_component))
+		SetListed(m_activeComponents.cameras, m_activeComponentOrders.cameras, result, order, p_active);
+
+	if (auto result = dynamic_cast<ECS::Components::CLight*>(&p_component))
+		SetListed(m_activeComponents.lights, m_activeComponentOrders.lights, result, order, p_active);
+
+	if (auto result = dynamic_cast<ECS::Components::CAnimation*>(&p_component))
+		SetListed(m_activeComponents.animations, m_activeComponentOrders.animations, result, order, p_active);
+}
+
 bool OvCore::SceneSystem::Scene::DestroyActor(ECS::Actor& p_target)
 {
 	auto found = std::find_if(m_actors.begin(), m_actors.end(), [&p_target](OvCore::ECS::Actor* element)
@@ -92,6 +287,7 @@ bool OvCore::SceneSystem::Scene::DestroyActor(ECS::Actor& p_target)
 
 	if (found != m_actors.end())
 	{
+		UnindexActor(**found);
 		delete *found;
 		m_actors.erase(found);
 		return true;
@@ -109,6 +305,7 @@ void OvCore::SceneSystem::Scene::CollectGarbages()
 		bool isGarbage = !element->IsAlive();
 		if (isGarbage)
 		{
+			UnindexActor(*element);
 			delete element;
 		}
 		return isGarbage;
@@ -117,67 +314,42 @@ void OvCore::SceneSystem::Scene::CollectGarbages()
 
 OvCore::ECS::Actor* OvCore::SceneSystem::Scene::FindActorByName(const std::string& p_name)
 {
-	auto result = std::find_if(m_actors.begin(), m_actors.end(), [p_name](OvCore::ECS::Actor* element)
-	{ 
-		return element->GetName() == p_name;
-	});
-
-	if (result != m_actors.end())
-		return *result;
+	if (auto found = m_actorsByName.find(p_name); found != m_actorsByName.end())
+		return GetFirstActor(found->second);
 	else
 		return nullptr;
 }
 
 OvCore::ECS::Actor* OvCore::SceneSystem::Scene::FindActorByTag(const std::string & p_tag)
 {
-	auto result = std::find_if(m_actors.begin(), m_actors.end(), [p_tag](OvCore::ECS::Actor* element)
-	{
-		return element->GetTag() == p_tag;
-	});
-
-	if (result != m_actors.end())
-		return *result;
+	if (auto found = m_actorsByTag.find(p_tag); found != m_actorsByTag.end())
+		return GetFirstActor(found->second);
 	else
 		return nullptr;
 }
 
 OvCore::ECS::Actor* OvCore::SceneSystem::Scene::FindActorByID(int64_t p_id)
 {
-	auto result = std::find_if(m_actors.begin(), m_actors.end(), [p_id](OvCore::ECS::Actor* element)
-	{
-		return element->GetID() == p_id;
-	});
-
-	if (result != m_actors.end())
-		return *result;
+	if (auto found = m_actorsByID.find(p_id); found != m_actorsByID.end())
+		return GetFirstActor(found->second);
 	else
 		return nullptr;
 }
 
 std::vector<std::reference_wrapper<OvCore::ECS::Actor>> OvCore::SceneSystem::Scene::FindActorsByName(const std::string & p_name)
 {
-	std::vector<std::reference_wrapper<OvCore::ECS::Actor>> actors;
-
-	for (auto actor : m_actors)
-	{
-		if (actor->GetName() == p_name)
-			actors.push_back(std::ref(*actor));
-	}
-
-	return actors;
+	if (auto found = m_actorsByName.find(p_name); found != m_actorsByName.end())
+		return GetActorsInOrder(found->second);
+	else
+		return {};
 }
 
 std::vector<std::reference_wrapper<OvCore::ECS::Actor>> OvCore::SceneSystem::Scene::FindActorsByTag(const std::string & p_tag)
 {
-	std::vector<std::reference_wrapper<OvCore::ECS::Actor>> actors;
-
-	for (auto actor : m_actors)
-	{
-		if (actor->GetTag() == p_tag)
-			actors.push_back(std::ref(*actor));
-	}
-
-	return actors;
+	if (auto found = m_actorsByTag.find(p_tag); found != m_actorsByTag.end())
+		return GetActorsInOrder(found->second);
+	else
+		return {};
 }
 
 void OvCore::SceneSystem::Scene::OnComponentAdded(ECS::Components::AComponent& p_compononent)
@@ -190,6 +362,16 @@ void OvCore::SceneSystem::Scene::OnComponentAdded(ECS::Components::AComponent& p
 
 	if (auto result = dynamic_cast<ECS::Components::CLight*>(&p_compononent))
 		m_fastAccessComponents.lights.push_back(result);
+
+	if (auto result = dynamic_cast<ECS::Components::CAnimation*>(&p_compononent))
+		m_fastAccessComponents.animations.push_back(result);
+
+	m_componentOrders.emplace(&p_compononent, m_componentOrderCount++);
+
+	if (p_compononent.owner.IsActive())
+		SetComponentActive(p_compononent, true);
+
+	m_updateSystem.Register(p_compononent);
 }
 
 void OvCore::SceneSystem::Scene::OnComponentRemoved(ECS::Components::AComponent& p_compononent)
@@ -202,6 +384,14 @@ void OvCore::SceneSystem::Scene::OnComponentRemoved(ECS::Components::AComponent&
 
 	if (auto result = dynamic_cast<ECS::Components::CLight*>(&p_compononent))
 		m_fastAccessComponents.lights.erase(std::remove(m_fastAccessComponents.lights.begin(), m_fastAccessComponents.lights.end(), result), m_fastAccessComponents.lights.end());
+
+	if (auto result = dynamic_cast<ECS::Components::CAnimation*>(&p_compononent))
+		m_fastAccessComponents.animations.erase(std::remove(m_fastAccessComponents.animations.begin(), m_fastAccessComponents.animations.end(), result), m_fastAccessComponents.animations.end());
+
+	SetComponentActive(p_compononent, false);
+	m_componentOrders.erase(&p_compononent);
+
+	m_updateSystem.Unregister(p_compononent);
 }
 
 std::vector<OvCore::ECS::Actor*>& OvCore::SceneSystem::Scene::GetActors()
@@ -214,6 +404,11 @@ const OvCore::SceneSystem::Scene::FastAccessComponents& OvCore::SceneSystem::Sce
 	return m_fastAccessComponents;
 }
 
+const OvCore::SceneSystem::Scene::FastAccessComponents& OvCore::SceneSystem::Scene::GetActiveComponents() const
+{
+	return m_activeComponents;
+}
+
 void OvCore::SceneSystem::Scene::OnSerialize(tinyxml2::XMLDocument & p_doc, tinyxml2::XMLNode * p_root)
 {
 	tinyxml2::XMLNode* sceneNode = p_doc.NewElement("scene");
@@ -234,28 +429,102 @@ void OvCore::SceneSystem::Scene::OnDeserialize(tinyxml2::XMLDocument & p_doc, ti
 
 	if (actorsRoot)
 	{
-		tinyxml2::XMLElement* currentActor = actorsRoot->FirstChildElement("actor");
+		size_t actorCount = 0;
+		for (auto currentActor = actorsRoot->FirstChildElement("actor"); currentActor; currentActor = currentActor->NextSiblingElement("actor"))
+			++actorCount;
 
-		int64_t maxID = 1;
+		tinyxml2::XMLElement* currentActor = actorsRoot->FirstChildElement("actor");
 
-		while (currentActor)
+		LoadActors(actorCount, [&p_doc, &currentActor](ECS::Actor& p_actor)
 		{
-			auto& actor = CreateActor();
-			actor.OnDeserialize(p_doc, currentActor);
-			maxID = std::max(actor.GetID() + 1, maxID);
+			p_actor.OnDeserialize(p_doc, currentActor);
 			currentActor = currentActor->NextSiblingElement("actor");
-		}
+		});
+	}
+}
 
-		m_availableID = maxID;
+void OvCore::SceneSystem::Scene::OnBinarySerialize(Helpers::BinaryWriter& p_writer)
+{
+	p_writer.WriteUint(static_cast<uint32_t>(m_actors.size()));
+
+	for (auto& actor : m_actors)
+	{
+		Helpers::BinaryWriter block(p_writer.GetStrings());
+		actor->OnBinarySerialize(block);
+		p_writer.WriteBlock(block);
+	}
+}
+
+void OvCore::SceneSystem::Scene::OnBinaryDeserialize(Helpers::BinaryReader& p_reader)
+{
+	/* Every actor block takes at least one byte, so a larger count can only come from a corrupted file */
+	const size_t actorCount = std::min<size_t>(p_reader.ReadUint(), p_reader.GetRemaining());
+
+	LoadActors(actorCount, [&p_reader](ECS::Actor& p_actor)
+	{
+		Helpers::BinaryReader block = p_reader.ReadBlock();
+		p_actor.OnBinaryDeserialize(block);
+	});
+}
+
+void OvCore::SceneSystem::Scene::LoadActors(size_t p_actorCount, const std::function<void(ECS::Actor&)>& p_deserialize)
+{
+	const size_t firstLoadedActor = m_actors.size();
+	m_actors.reserve(firstLoadedActor + p_actorCount);
+
+	std::unordered_map<int64_t, ECS::Actor*> loadedActors;
+	loadedActors.reserve(p_actorCount);
+
+	/* Loaded actors must not wake up (Nor their components and behaviours) before the whole hierarchy is loaded */
+	const bool wasPlaying = std::exchange(m_isPlaying, false);
+
+	int64_t maxID = 1;
+
+	for (size_t i = 0; i < p_actorCount; ++i)
+	{
+		auto& actor = InstantiateActor(m_availableID++, "New Actor", "");
+		p_deserialize(actor);
+		loadedActors.emplace(actor.GetID(), &actor);
+		maxID = std::max(actor.GetID() + 1, maxID);
+	}
+
+	m_availableID = maxID;
+
+	/* We recreate the hierarchy of the scene by attaching children to their parents */
+	for (size_t i = firstLoadedActor; i < m_actors.size(); ++i)
+	{
+		ECS::Actor* actor = m_actors[i];
 
-		/* We recreate the hierarchy of the scene by attaching children to their parents */
-		for (auto actor : m_actors)
+		if (actor->GetParentID() > 0)
 		{
-			if (actor->GetParentID() > 0)
-			{
-				if (auto found = FindActorByID(actor->GetParentID()); found)
-					actor->SetParent(*found);
-			}
+			if (auto found = loadedActors.find(actor->GetParentID()); found != loadedActors.end())
+				actor->SetParent(*found->second);
+			else if (auto parent = FindActorByID(actor->GetParentID()); parent)
+				actor->SetParent(*parent);
 		}
 	}
+
+	/* The components added while loading are registered in one pass, instead of one event per component */
+	for (size_t i = firstLoadedActor; i < m_actors.size(); ++i)
+	{
+		ListenToActor(*m_actors[i]);
+
+		for (auto& component : m_actors[i]->GetComponents())
+			OnComponentAdded(*component);
+
+		for (auto& [name, behaviour] : m_actors[i]->GetBehaviours())
+			m_updateSystem.Register(behaviour);
+	}
+
+	m_isPlaying = wasPlaying;
+
+	if (m_isPlaying)
+	{
+		const auto loadedBegin = m_actors.begin() + firstLoadedActor;
+
+		std::for_each(loadedBegin, m_actors.end(), [](ECS::Actor* p_element) { p_element->SetSleeping(false); });
+		std::for_each(loadedBegin, m_actors.end(), [](ECS::Actor* p_element) { if (p_element->IsActive()) p_element->OnAwake(); });
+		std::for_each(loadedBegin, m_actors.end(), [](ECS::Actor* p_element) { if (p_element->IsActive()) p_element->OnEnable(); });
+		std::for_each(loadedBegin, m_actors.end(), [](ECS::Actor* p_element) { if (p_element->IsActive()) p_element->OnStart(); });
+	}
 }
@@ -4,10 +4,12 @@
 * @licence: MIT
 */
 
+#include <OvTools/Filesystem/MappedFile.h>
 #include <OvTools/Filesystem/tinyxml2.h>
 #include <OvWindowing/Dialogs/MessageBox.h>
 
 #include "OvCore/SceneSystem/SceneManager.h"
+#include "OvCore/SceneSystem/BinarySceneFormat.h"
 #include "OvCore/ECS/Components/CDirectionalLight.h"
 #include "OvCore/ECS/Components/CAmbientSphereLight.h"
 #include "OvCore/ECS/Components/CCamera.h"
@@ -77,16 +79,37 @@ bool OvCore::SceneSystem::SceneManager::LoadScene(const std::string& p_path, boo
 {
 	std::string completePath = (p_absolute ? "" : m_sceneRootFolder) + p_path;
 
-	tinyxml2::XMLDocument doc;
-	doc.LoadFile(completePath.c_str());
+	OvTools::Filesystem::MappedFile file(completePath);
+	bool loaded = false;
 
-	if (LoadSceneFromMemory(doc))
+	/* Binary and XML scenes are both supported, the format is detected from the file header */
+	if (BinarySceneFormat::IsBinary(file.GetData(), file.GetSize()))
 	{
-		StoreCurrentSceneSourcePath(completePath);
-		return true;
+		/* Binary scenes are loaded straight from the mapped file, once validated (So a corrupted file doesn't unload the current scene) */
+		if (BinarySceneFormat::Validate(file.GetData(), file.GetSize()))
+		{
+			LoadEmptyScene();
+			loaded = BinarySceneFormat::Decode(file.GetData(), file.GetSize(), *m_currentScene);
+		}
+		else
+		{
+			OvWindowing::Dialogs::MessageBox message("Scene loading failed", "The scene you are trying to load was not found or corrupted", OvWindowing::Dialogs::MessageBox::EMessageType::ERROR, OvWindowing::Dialogs::MessageBox::EButtonLayout::OK, true);
+		}
+	}
+	else
+	{
+		tinyxml2::XMLDocument doc;
+
+		if (file.IsOpen())
+			doc.Parse(reinterpret_cast<const char*>(file.GetData()), file.GetSize());
+
+		loaded = LoadSceneFromMemory(doc);
 	}
 
-	return false;
+	if (loaded)
+		StoreCurrentSceneSourcePath(completePath);
+
+	return loaded;
 }
 
 bool OvCore::SceneSystem::SceneManager::LoadSceneFromMemory(tinyxml2::XMLDocument& p_doc)
@@ -42,7 +42,7 @@ void OvCore::Scripting::LuaGlobalsBinder::BindGlobals(sol::state & p_luaState)
 		/* Methods */
 		"FindActorByName", &Scene::FindActorByName,
 		"FindActorByTag", &Scene::FindActorByTag,
-		"FindActorsByName", &Scene::FindActorsByTag,
+		"FindActorsByName", &Scene::FindActorsByName,
 		"FindActorsByTag", &Scene::FindActorsByTag,
 		"CreateActor", CreateActorOverload
 		);
@@ -24,6 +24,11 @@ namespace OvDebug
 		* Log the the file
 		*/
 		void Log(const LogData& p_logData);
+
+		/**
+		* Write the buffered logs to the file
+		*/
+		static void Flush();
 	
 		/**
 		* Returns the log file path
@@ -7,7 +7,8 @@
 #pragma once
 
 #include <string>
-#include <queue>
+#include <deque>
+#include <mutex>
 
 #include "ILogHandler.h"
 
@@ -26,12 +27,20 @@ namespace OvDebug
 		void Log(const LogData& p_logData);
 
 		/**
-		* Return log queue
+		* Return a copy of the log queue (Oldest log first)
 		*/
-		static std::queue<LogData>& GetLogQueue();
+		static std::deque<LogData> GetLogQueue();
+
+		/**
+		* Set the maximum number of logs kept in the history (The oldest logs are discarded first)
+		* @param p_capacity
+		*/
+		static void SetCapacity(size_t p_capacity);
 
 	private:
 
-		static std::queue<LogData> LOG_QUEUE;
+		static std::deque<LogData> LOG_QUEUE;
+		static size_t LOG_QUEUE_CAPACITY;
+		static std::mutex LOG_QUEUE_MUTEX;
 	};
 }
\ No newline at end of file
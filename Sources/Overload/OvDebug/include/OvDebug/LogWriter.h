@@ -0,0 +1,85 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <ctime>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include <OvTools/Utils/MPSCQueue.h>
+
+#include "OvDebug/ILogHandler.h"
+
+namespace OvDebug
+{
+	/**
+	* Log waiting to be handled. The date is formatted by the writer thread
+	*/
+	struct LogRecord
+	{
+		std::string message;
+		ELogLevel logLevel;
+		ELogMode logMode;
+		std::string handlerId;
+		std::time_t time;
+	};
+
+	/**
+	* Background thread handling the logs. Logging threads push records into a lock-free queue, the writer
+	* thread sends them to the handlers in batches and flushes the handlers periodically
+	*/
+	class LogWriter final
+	{
+	public:
+		/**
+		* Start the writer thread
+		* @param p_capacity (Maximum number of records waiting to be handled)
+		*/
+		LogWriter(size_t p_capacity);
+
+		/**
+		* Handle the remaining records and stop the writer thread
+		*/
+		~LogWriter();
+
+		LogWriter(const LogWriter&) = delete;
+		LogWriter& operator=(const LogWriter&) = delete;
+
+		/**
+		* Queue a record (Any thread, never blocks). If the queue is full, the record is dropped and reported later
+		* @param p_record
+		*/
+		void Push(LogRecord&& p_record);
+
+		/**
+		* Wait until every record pushed before this call has been handled and the handlers have been flushed
+		*/
+		void Flush();
+
+	private:
+		void Run();
+
+	private:
+		OvTools::Utils::MPSCQueue<LogRecord> m_queue;
+
+		std::atomic<uint64_t> m_pushedRecords = 0;
+		std::atomic<uint64_t> m_droppedRecords = 0;
+		std::atomic<uint64_t> m_handledRecords = 0;
+		std::atomic<uint64_t> m_flushRequest = 0;
+		std::atomic<bool> m_stop = false;
+
+		std::mutex m_mutex;
+		std::condition_variable m_wakeCondition;
+		std::condition_variable m_flushCondition;
+		uint64_t m_flushedRecords = 0;
+
+		std::thread m_thread;
+	};
+}
@@ -8,6 +8,7 @@
 
 #include <string>
 #include <map>
+#include <mutex>
 
 #include <OvTools/Eventing/Event.h>
 
@@ -15,6 +16,7 @@
 #include "OvDebug/ConsoleHandler.h"
 #include "OvDebug/FileHandler.h"
 #include "OvDebug/HistoryHandler.h"
+#include "OvDebug/LogWriter.h"
 
 #define OVLOG(message)			OvDebug::Logger::Log(message, OvDebug::ELogLevel::LOG_DEFAULT,	OvDebug::ELogMode::CONSOLE)
 #define OVLOG_INFO(message)		OvDebug::Logger::Log(message, OvDebug::ELogLevel::LOG_INFO,		OvDebug::ELogMode::CONSOLE)
@@ -29,10 +31,13 @@
 namespace OvDebug
 {
 	/*
-	* Static class to display error messages on console or file
+	* Static class to display error messages on console or file.
+	* Logs are handled asynchronously by a writer thread, which also notifies the log listeners
 	*/
 	class Logger
 	{
+		friend class LogWriter;
+
 	public:
 
 		/**
@@ -41,7 +46,7 @@ namespace OvDebug
 		Logger() = delete;
 
 		/**
-		* Display error massage to target destination
+		* Queue the message for the target destination (Returns without waiting for the message to be handled)
 		* @param p_message
 		* @param p_logLevel
 		* @param p_logMode
@@ -85,17 +90,39 @@ namespace OvDebug
 		*/
 		static HistoryHandler& GetHistoryHandler(std::string p_id);
 
+		/**
+		* Wait until every queued log has been handled and written
+		*/
+		static void Flush();
+
+		/**
+		* Add a listener notified of every log. Listeners are called on the writer thread, so they must be thread-safe
+		* and must not add or remove log listeners
+		* @param p_callback
+		*/
+		static OvTools::Eventing::ListenerID AddLogListener(OvTools::Eventing::Event<const LogData&>::Callback p_callback);
+
+		/**
+		* Remove a log listener. Once this method returns, the listener isn't running and won't be called anymore
+		* @param p_listenerID
+		*/
+		static bool RemoveLogListener(OvTools::Eventing::ListenerID p_listenerID);
+
 	private:
 		template<typename T>
 		static void LogToHandlerMap(std::map<std::string, T>& p_map, const LogData& p_data, std::string p_id);
 
-	public:
-		static OvTools::Eventing::Event<const LogData&> LogEvent;
+		static LogWriter& GetWriter();
+		static const std::string& GetDate(std::time_t p_time);
+		static void Dispatch(LogRecord& p_record);
+		static void FlushHandlers();
 
 	private:
+		static OvTools::Eventing::Event<const LogData&> LogEvent;
 		static std::map<std::string, ConsoleHandler>	CONSOLE_HANDLER_MAP;
 		static std::map<std::string, FileHandler>		FILE_HANDLER_MAP;
 		static std::map<std::string, HistoryHandler>	HISTORY_HANDLER_MAP;
+		static std::mutex								HANDLERS_MUTEX;
 	};
 }
 
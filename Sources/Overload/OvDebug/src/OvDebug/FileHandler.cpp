@@ -31,11 +31,17 @@ void OvDebug::FileHandler::Log(const LogData& p_logData)
 	}
 
 	if (OUTPUT_FILE.is_open())
-		OUTPUT_FILE << GetLogHeader(p_logData.logLevel) << p_logData.date << " " << p_logData.message << std::endl;
+		OUTPUT_FILE << GetLogHeader(p_logData.logLevel) << p_logData.date << " " << p_logData.message << '\n';
 	else
 		std::cout << "Unable to create log file" << std::endl;
 }
 
+void OvDebug::FileHandler::Flush()
+{
+	if (OUTPUT_FILE.is_open())
+		OUTPUT_FILE.flush();
+}
+
 std::string& OvDebug::FileHandler::GetLogFilePath()
 {
 	return LOG_FILE_PATH;
@@ -6,14 +6,35 @@
 
 #include "OvDebug/HistoryHandler.h"
 
-std::queue<OvDebug::LogData> OvDebug::HistoryHandler::LOG_QUEUE;
+std::deque<OvDebug::LogData> OvDebug::HistoryHandler::LOG_QUEUE;
+size_t OvDebug::HistoryHandler::LOG_QUEUE_CAPACITY = 1024;
+std::mutex OvDebug::HistoryHandler::LOG_QUEUE_MUTEX;
 
 void OvDebug::HistoryHandler::Log(const LogData& p_logData)
 {
-	LOG_QUEUE.push(p_logData);
+	std::lock_guard<std::mutex> lock(LOG_QUEUE_MUTEX);
+
+	if (LOG_QUEUE_CAPACITY == 0)
+		return;
+
+	if (LOG_QUEUE.size() >= LOG_QUEUE_CAPACITY)
+		LOG_QUEUE.pop_front();
+
+	LOG_QUEUE.push_back(p_logData);
 }
 
-std::queue<OvDebug::LogData>& OvDebug::HistoryHandler::GetLogQueue()
+std::deque<OvDebug::LogData> OvDebug::HistoryHandler::GetLogQueue()
 {
+	std::lock_guard<std::mutex> lock(LOG_QUEUE_MUTEX);
 	return LOG_QUEUE;
-}
\ No newline at end of file
+}
+
+void OvDebug::HistoryHandler::SetCapacity(size_t p_capacity)
+{
+	std::lock_guard<std::mutex> lock(LOG_QUEUE_MUTEX);
+
+	LOG_QUEUE_CAPACITY = p_capacity;
+
+	while (LOG_QUEUE.size() > LOG_QUEUE_CAPACITY)
+		LOG_QUEUE.pop_front();
+}
@@ -0,0 +1,113 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#include <chrono>
+
+#include "OvDebug/LogWriter.h"
+#include "OvDebug/Logger.h"
+
+namespace
+{
+	/* Idle time of the writer thread between two batches */
+	constexpr auto kWriterIdleTime = std::chrono::milliseconds(10);
+
+	/* Maximum time a handled log can stay in the handlers buffers */
+	constexpr auto kFlushPeriod = std::chrono::milliseconds(250);
+}
+
+OvDebug::LogWriter::LogWriter(size_t p_capacity) :
+	m_queue(p_capacity)
+{
+	m_thread = std::thread(&LogWriter::Run, this);
+}
+
+OvDebug::LogWriter::~LogWriter()
+{
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_stop = true;
+	}
+
+	m_wakeCondition.notify_one();
+	m_thread.join();
+}
+
+void OvDebug::LogWriter::Push(LogRecord&& p_record)
+{
+	if (m_queue.TryPush(std::move(p_record)))
+		m_pushedRecords.fetch_add(1, std::memory_order_release);
+	else
+		m_droppedRecords.fetch_add(1, std::memory_order_relaxed);
+}
+
+void OvDebug::LogWriter::Flush()
+{
+	const uint64_t target = m_pushedRecords.load(std::memory_order_acquire);
+
+	std::unique_lock<std::mutex> lock(m_mutex);
+
+	if (target > m_flushRequest)
+		m_flushRequest = target;
+
+	m_wakeCondition.notify_one();
+	m_flushCondition.wait(lock, [this, target] { return m_flushedRecords >= target || m_stop; });
+}
+
+void OvDebug::LogWriter::Run()
+{
+	LogRecord record;
+	auto lastFlush = std::chrono::steady_clock::now();
+	bool pendingFlush = false;
+
+	while (true)
+	{
+		/* Read the stop flag first, so every record pushed before the stop request is handled */
+		const bool stop = m_stop.load();
+		uint64_t handledRecords = m_handledRecords.load(std::memory_order_relaxed);
+		const uint64_t firstHandledRecord = handledRecords;
+
+		while (m_queue.TryPop(record))
+		{
+			Logger::Dispatch(record);
+			++handledRecords;
+		}
+
+		if (const uint64_t droppedRecords = m_droppedRecords.exchange(0, std::memory_order_relaxed))
+		{
+			record = { std::to_string(droppedRecords) + " log(s) dropped (Log queue full)", ELogLevel::LOG_WARNING, ELogMode::DEFAULT, "default", std::time(nullptr) };
+			Logger::Dispatch(record);
+		}
+
+		m_handledRecords.store(handledRecords, std::memory_order_relaxed);
+		pendingFlush |= handledRecords != firstHandledRecord;
+
+		const auto now = std::chrono::steady_clock::now();
+		const bool flushRequested = m_flushRequest.load() > m_flushedRecords;
+
+		if (pendingFlush && (stop || flushRequested || now - lastFlush >= kFlushPeriod))
+		{
+			Logger::FlushHandlers();
+			lastFlush = now;
+			pendingFlush = false;
+		}
+
+		{
+			std::unique_lock<std::mutex> lock(m_mutex);
+
+			if (!pendingFlush)
+			{
+				m_flushedRecords = handledRecords;
+				m_flushCondition.notify_all();
+			}
+
+			if (stop)
+				break;
+
+			if (handledRecords == firstHandledRecord)
+				m_wakeCondition.wait_for(lock, kWriterIdleTime, [this] { return m_stop || m_flushRequest > m_flushedRecords; });
+		}
+	}
+}
@@ -12,56 +12,118 @@ OvTools::Eventing::Event<const OvDebug::LogData&> OvDebug::Logger::LogEvent;
 std::map<std::string, OvDebug::ConsoleHandler>	OvDebug::Logger::CONSOLE_HANDLER_MAP;
 std::map<std::string, OvDebug::FileHandler>		OvDebug::Logger::FILE_HANDLER_MAP;
 std::map<std::string, OvDebug::HistoryHandler>	OvDebug::Logger::HISTORY_HANDLER_MAP;
+std::mutex										OvDebug::Logger::HANDLERS_MUTEX;
 
 void OvDebug::Logger::Log(const std::string& p_message, ELogLevel p_logLevel, ELogMode p_logMode, std::string p_handlerId)
 {
-	LogData logData{ p_message, p_logLevel, OvTools::Time::Date::GetDateAsString() };
+	GetWriter().Push({ p_message, p_logLevel, p_logMode, std::move(p_handlerId), std::time(nullptr) });
+}
+
+void OvDebug::Logger::Flush()
+{
+	GetWriter().Flush();
+}
+
+OvTools::Eventing::ListenerID OvDebug::Logger::AddLogListener(OvTools::Eventing::Event<const LogData&>::Callback p_callback)
+{
+	std::lock_guard<std::mutex> lock(HANDLERS_MUTEX);
+	return LogEvent.AddListener(std::move(p_callback));
+}
+
+bool OvDebug::Logger::RemoveLogListener(OvTools::Eventing::ListenerID p_listenerID)
+{
+	std::lock_guard<std::mutex> lock(HANDLERS_MUTEX);
+	return LogEvent.RemoveListener(p_listenerID);
+}
+
+OvDebug::LogWriter& OvDebug::Logger::GetWriter()
+{
+	/* Created on the first log, so it is destroyed (And completes the pending logs) before the handlers static data */
+	static LogWriter writer(8192);
+	return writer;
+}
 
-	switch (p_logMode)
+const std::string& OvDebug::Logger::GetDate(std::time_t p_time)
+{
+	/* The date only changes every second, so the last formatted date is reused */
+	thread_local std::time_t cachedTime = -1;
+	thread_local std::string cachedDate;
+
+	if (p_time != cachedTime)
+	{
+		cachedTime = p_time;
+		cachedDate = OvTools::Time::Date::GetDateAsString(p_time);
+	}
+
+	return cachedDate;
+}
+
+void OvDebug::Logger::Dispatch(LogRecord& p_record)
+{
+	const LogData logData{ std::move(p_record.message), p_record.logLevel, GetDate(p_record.time) };
+	const std::string& handlerId = p_record.handlerId;
+
+	std::lock_guard<std::mutex> lock(HANDLERS_MUTEX);
+
+	/* Listeners are notified under the handlers lock, so a removed listener is never called afterward */
+	if (LogEvent.GetListenerCount() > 0)
+		LogEvent.Invoke(logData);
+
+	switch (p_record.logMode)
 	{
 	case ELogMode::DEFAULT:
-	case ELogMode::CONSOLE: LogToHandlerMap<ConsoleHandler>(CONSOLE_HANDLER_MAP, logData, p_handlerId); break;
-	case ELogMode::FILE:	LogToHandlerMap<FileHandler>(FILE_HANDLER_MAP, logData, p_handlerId);		break;
-	case ELogMode::HISTORY: LogToHandlerMap<HistoryHandler>(HISTORY_HANDLER_MAP, logData, p_handlerId);	break;
+	case ELogMode::CONSOLE: LogToHandlerMap<ConsoleHandler>(CONSOLE_HANDLER_MAP, logData, handlerId); break;
+	case ELogMode::FILE:	LogToHandlerMap<FileHandler>(FILE_HANDLER_MAP, logData, handlerId);		break;
+	case ELogMode::HISTORY: LogToHandlerMap<HistoryHandler>(HISTORY_HANDLER_MAP, logData, handlerId);	break;
 	case ELogMode::ALL:
-		LogToHandlerMap<ConsoleHandler>(CONSOLE_HANDLER_MAP, logData, p_handlerId);
-		LogToHandlerMap<FileHandler>(FILE_HANDLER_MAP, logData, p_handlerId);
-		LogToHandlerMap<HistoryHandler>(HISTORY_HANDLER_MAP, logData, p_handlerId);
+		LogToHandlerMap<ConsoleHandler>(CONSOLE_HANDLER_MAP, logData, handlerId);
+		LogToHandlerMap<FileHandler>(FILE_HANDLER_MAP, logData, handlerId);
+		LogToHandlerMap<HistoryHandler>(HISTORY_HANDLER_MAP, logData, handlerId);
 		break;
 	}
+}
 
-	LogEvent.Invoke(logData);
+void OvDebug::Logger::FlushHandlers()
+{
+	ConsoleHandler::Flush();
+	FileHandler::Flush();
 }
 
 OvDebug::ConsoleHandler& OvDebug::Logger::CreateConsoleHandler(std::string p_id)
 {
+	std::lock_guard<std::mutex> lock(HANDLERS_MUTEX);
 	CONSOLE_HANDLER_MAP.emplace(p_id, OvDebug::ConsoleHandler());
 	return CONSOLE_HANDLER_MAP[p_id];
 }
 
 OvDebug::FileHandler& OvDebug::Logger::CreateFileHandler(std::string p_id)
 {
+	std::lock_guard<std::mutex> lock(HANDLERS_MUTEX);
 	FILE_HANDLER_MAP.emplace(p_id, OvDebug::FileHandler());
 	return FILE_HANDLER_MAP[p_id];
 }
 
 OvDebug::HistoryHandler& OvDebug::Logger::CreateHistoryHandler(std::string p_id)
 {
+	std::lock_guard<std::mutex> lock(HANDLERS_MUTEX);
 	HISTORY_HANDLER_MAP.emplace(p_id, OvDebug::HistoryHandler());
 	return HISTORY_HANDLER_MAP[p_id];
 }
 
 OvDebug::ConsoleHandler& OvDebug::Logger::GetConsoleHandler(std::string p_id)
 {
+	std::lock_guard<std::mutex> lock(HANDLERS_MUTEX);
 	return CONSOLE_HANDLER_MAP[p_id];
 }
 
 OvDebug::FileHandler& OvDebug::Logger::GetFileHandler(std::string p_id)
 {
+	std::lock_guard<std::mutex> lock(HANDLERS_MUTEX);
 	return FILE_HANDLER_MAP[p_id];
 }
 
 OvDebug::HistoryHandler& OvDebug::Logger::GetHistoryHandler(std::string p_id)
 {
+	std::lock_guard<std::mutex> lock(HANDLERS_MUTEX);
 	return HISTORY_HANDLER_MAP[p_id];
 }
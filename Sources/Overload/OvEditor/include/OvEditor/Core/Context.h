@@ -7,6 +7,7 @@
 #pragma once
 
 #include <OvTools/Filesystem/IniFile.h>
+#include <OvTools/Utils/ThreadPool.h>
 
 #include <OvRendering/Buffers/UniformBuffer.h>
 #include <OvRendering/Buffers/ShaderStorageBuffer.h>
@@ -84,6 +85,7 @@ namespace OvEditor::Core
 		std::unique_ptr<OvWindowing::Window>					window;
 		std::unique_ptr<OvWindowing::Inputs::InputManager>		inputManager;
 		std::unique_ptr<OvRendering::Context::Driver>			driver;
+		std::unique_ptr<OvTools::Utils::ThreadPool>				threadPool;
 		std::unique_ptr<OvCore::ECS::Renderer>					renderer;
 		std::unique_ptr<OvRendering::Core::ShapeDrawer>			shapeDrawer;
 		std::unique_ptr<OvUI::Core::UIManager>					uiManager;
@@ -6,6 +6,9 @@
 
 #pragma once
 
+#include <mutex>
+#include <vector>
+
 #include <OvDebug/Logger.h>
 
 #include <OvUI/Panels/PanelWindow.h>
@@ -31,7 +34,12 @@ namespace OvEditor::Panels
 		);
 
 		/**
-		* Method called when a log event occured
+		* Destructor
+		*/
+		~Console();
+
+		/**
+		* Method called when a log event occured (On the log writer thread, the log is displayed on the next draw)
 		* @param p_logData
 		*/
 		void OnLogIntercepted(const OvDebug::LogData& p_logData);
@@ -57,7 +65,14 @@ namespace OvEditor::Panels
 		*/
 		bool IsAllowedByFilter(OvDebug::ELogLevel p_logLevel);
 
+	protected:
+		/**
+		* Create the widgets of the intercepted logs, then draw the panel
+		*/
+		void _Draw_Impl() override;
+
 	private:
+		void AddLogWidget(const OvDebug::LogData& p_logData);
 		void SetShowDefaultLogs(bool p_value);
 		void SetShowInfoLogs(bool p_value);
 		void SetShowWarningLogs(bool p_value);
@@ -67,6 +82,12 @@ namespace OvEditor::Panels
 		OvUI::Widgets::Layout::Group* m_logGroup;
 		std::unordered_map<OvUI::Widgets::Texts::TextColored*, OvDebug::ELogLevel> m_logTextWidgets;
 
+		/* Logs intercepted on the writer thread, waiting for the next draw to get their widgets */
+		std::mutex m_pendingLogsMutex;
+		std::vector<OvDebug::LogData> m_pendingLogs;
+		std::vector<OvDebug::LogData> m_drawnLogs;
+		OvTools::Eventing::ListenerID m_logListener;
+
 		bool m_clearOnPlay = true;
 		bool m_showDefaultLog = true;
 		bool m_showInfoLog = true;
@@ -9,6 +9,7 @@
 #include <OvUI/Panels/PanelWindow.h>
 #include <OvUI/Widgets/Plots/PlotLines.h>
 #include <OvUI/Widgets/Plots/PlotHistogram.h>
+#include <OvUI/Widgets/Texts/Text.h>
 
 namespace OvAnalytics::Hardware { class HardwareInfo; }
 
@@ -46,6 +47,9 @@ namespace OvEditor::Panels
 		*/
 		void Update(float p_deltaTime);
 
+	private:
+		void UpdateResourceMemory();
+
 	private:
 		float p_updateTimer = 0.f;
 		float m_logFrequency;
@@ -53,6 +57,8 @@ namespace OvEditor::Panels
 		OvUI::Widgets::Plots::APlot* m_cpuUsage;
 		OvUI::Widgets::Plots::APlot* m_gpuUsage;
 		OvUI::Widgets::Plots::APlot* m_ramUsage;
+		OvUI::Widgets::Texts::Text* m_modelMemory;
+		OvUI::Widgets::Texts::Text* m_textureMemory;
 		OvAnalytics::Hardware::HardwareInfo* m_hardwareInfo;
 	};
 }
\ No newline at end of file
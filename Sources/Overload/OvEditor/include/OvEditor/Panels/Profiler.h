@@ -48,6 +48,11 @@ namespace OvEditor::Panels
 		*/
 		void Enable(bool p_value, bool p_disableLog = false);
 
+		/**
+		* Stream the next frames to a Chrome Trace Event JSON file, in the project folder
+		*/
+		void SaveTrace();
+
 	private:
 		OvUI::Types::Color CalculateActionColor(double p_percentage) const;
 		std::string GenerateActionString(OvAnalytics::Profiling::ProfilerReport::Action& p_action);
@@ -63,6 +68,7 @@ namespace OvEditor::Panels
 		float m_timer = 0.f;
 		float m_fpsTimer = 0.f;
 		EProfilingMode m_profilingMode = EProfilingMode::DEFAULT;
+		uint32_t m_traceFrameCount = 300;
 
 		OvAnalytics::Profiling::Profiler m_profiler;
 
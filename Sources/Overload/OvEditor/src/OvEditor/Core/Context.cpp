@@ -4,6 +4,7 @@
 * @licence: MIT
 */
 
+#include <algorithm>
 #include <filesystem>
 
 #include <OvRendering/Entities/Light.h>
@@ -58,7 +59,10 @@ OvEditor::Core::Context::Context(const std::string& p_projectPath, const std::st
 
 	/* Graphics context creation */
 	driver = std::make_unique<OvRendering::Context::Driver>(OvRendering::Settings::DriverSettings{ true });
-	renderer = std::make_unique<OvCore::ECS::Renderer>(*driver);
+	threadPool = std::make_unique<OvTools::Utils::ThreadPool>();
+	renderer = std::make_unique<OvCore::ECS::Renderer>(*driver, threadPool.get());
+	/* The editor loads textures on the main thread, which is the only one dispatching on the pool */
+	OvRendering::Resources::Loaders::TextureLoader::ProvideThreadPool(threadPool.get());
 	renderer->SetCapability(OvRendering::Settings::ERenderingCapability::MULTISAMPLE, true);
 	shapeDrawer = std::make_unique<OvRendering::Core::ShapeDrawer>(*renderer);
 
@@ -85,7 +89,11 @@ OvEditor::Core::Context::Context(const std::string& p_projectPath, const std::st
 	editorResources = std::make_unique<OvEditor::Core::EditorResources>(editorAssetsPath);
 
 	/* Physics engine */
-	physicsEngine = std::make_unique<OvPhysics::Core::PhysicsEngine>(OvPhysics::Settings::PhysicsSettings{ {0.0f, -9.81f, 0.0f } });
+	OvPhysics::Settings::PhysicsSettings physicsSettings;
+	physicsSettings.fixedTimeStep = 1.0f / static_cast<float>(std::max(projectSettings.GetOrDefault<int>("physics_rate", 60), 1));
+	physicsSettings.maxSubSteps = static_cast<uint32_t>(std::max(projectSettings.GetOrDefault<int>("physics_max_substeps", 5), 1));
+	physicsSettings.interpolation = projectSettings.GetOrDefault<bool>("physics_interpolation", true);
+	physicsEngine = std::make_unique<OvPhysics::Core::PhysicsEngine>(physicsSettings);
 
 	/* Service Locator providing */
 	ServiceLocator::Provide<OvPhysics::Core::PhysicsEngine>(*physicsEngine);
@@ -111,9 +119,7 @@ OvEditor::Core::Context::Context(const std::string& p_projectPath, const std::st
 		sizeof(OvMaths::FMatrix4) +
 		sizeof(OvMaths::FVector3) +
 		sizeof(float) +
-		sizeof(OvMaths::FMatrix4) +
-		sizeof(int) +
-		sizeof(OvMaths::FMatrix4) * 64,
+		sizeof(OvMaths::FMatrix4),
 		0, 0,
 		OvRendering::Buffers::EAccessSpecifier::STREAM_DRAW
 	);
@@ -145,11 +151,16 @@ OvEditor::Core::Context::Context(const std::string& p_projectPath, const std::st
 
 OvEditor::Core::Context::~Context()
 {
+	/* Release the resource handles held by the scene while the resource managers still exist */
+	sceneManager.UnloadCurrentScene();
+
+	materialManager.UnloadResources(); // Materials release their shader and texture handles
 	modelManager.UnloadResources();
 	textureManager.UnloadResources();
 	shaderManager.UnloadResources();
-	materialManager.UnloadResources();
 	soundManager.UnloadResources();
+
+	OvRendering::Resources::Loaders::TextureLoader::ProvideThreadPool(nullptr);
 }
 
 void OvEditor::Core::Context::ResetProjectSettings()
@@ -116,22 +116,19 @@ void OvEditor::Core::Editor::UpdateCurrentEditorMode(float p_deltaTime)
 void OvEditor::Core::Editor::UpdatePlayMode(float p_deltaTime)
 {
 	auto currentScene = m_context.sceneManager.GetCurrentScene();
-	bool simulationApplied = false;
 
 	{
 		PROFILER_SPY("Physics Update");
-		simulationApplied = m_context.physicsEngine->Update(p_deltaTime);
-	}
-
-	if (simulationApplied)
-	{
-		PROFILER_SPY("FixedUpdate");
-		currentScene->FixedUpdate(p_deltaTime);
+		m_context.physicsEngine->Update(p_deltaTime, [currentScene](float p_fixedDeltaTime)
+		{
+			PROFILER_SPY("FixedUpdate");
+			currentScene->FixedUpdate(p_fixedDeltaTime);
+		});
 	}
 
 	{
 		PROFILER_SPY("Update");
-		currentScene->Update(p_deltaTime);
+		currentScene->Update(p_deltaTime, m_context.threadPool.get());
 	}
 
 	{
@@ -171,7 +168,8 @@ void OvEditor::Core::Editor::UpdateEditorPanels(float p_deltaTime)
 	if (m_elapsedFrames == 1) // Let the first frame happen and then make the scene view the first seen view
 		sceneView.Focus();
 
-	if (profiler.IsOpened())
+	/* A trace capture must reach its last frame (And write its file) even if the panel gets closed meanwhile */
+	if (profiler.IsOpened() || OvAnalytics::Profiling::Profiler::IsCapturing())
 	{
 		PROFILER_SPY("Profiler Update");
 		profiler.Update(p_deltaTime);
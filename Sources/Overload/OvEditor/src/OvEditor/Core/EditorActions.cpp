@@ -16,6 +16,7 @@
 #include <OvCore/ECS/Components/CModelRenderer.h>
 #include <OvCore/ECS/Components/CMaterialRenderer.h>
 #include <OvCore/ECS/Components/CAudioSource.h>
+#include <OvCore/SceneSystem/BinarySceneFormat.h>
 
 #include <OvWindowing/Dialogs/OpenFileDialog.h>
 #include <OvWindowing/Dialogs/SaveFileDialog.h>
@@ -219,6 +220,20 @@ void OvEditor::Core::EditorActions::BuildAtLocation(const std::string & p_config
 					{
 						OVLOG_INFO("Data\\User\\Assets\\ directory copied");
 
+						/* Built games load binary scenes, which are smaller and faster to load than the XML scenes the editor saves.
+						Project scenes are converted into the build output, over their copies (Kept if the conversion fails) */
+						for (auto& entry : std::filesystem::recursive_directory_iterator(m_context.projectAssetsPath))
+						{
+							if (entry.is_regular_file() && OvTools::Utils::PathParser::GetFileType(entry.path().string()) == OvTools::Utils::PathParser::EFileType::SCENE)
+							{
+								const std::string source = entry.path().string();
+								const std::string destination = buildPath + "Data\\User\\Assets\\" + std::filesystem::relative(entry.path(), m_context.projectAssetsPath).string();
+
+								if (!OvCore::SceneSystem::BinarySceneFormat::ConvertToBinary(source, destination))
+									OVLOG_WARNING("Failed to convert scene to binary, the XML scene is kept: " + destination);
+							}
+						}
+
 						std::filesystem::copy(m_context.projectScriptsPath, buildPath + "Data\\User\\Scripts\\", std::filesystem::copy_options::recursive, err);
 
 						if (!err)
@@ -161,7 +161,7 @@ void OvEditor::Core::EditorRenderer::RenderScene(const OvMaths::FVector3& p_came
 {
 	/* Render the actors */
 	m_context.lightSSBO->Bind(0);
-	m_context.renderer->RenderScene(*m_context.sceneManager.GetCurrentScene(), p_cameraPosition, p_camera, p_customFrustum, &m_emptyMaterial, m_context.engineUBO.get());
+	m_context.renderer->RenderScene(*m_context.sceneManager.GetCurrentScene(), p_cameraPosition, p_camera, p_customFrustum, &m_emptyMaterial);
 	m_context.lightSSBO->Unbind();
 }
 
@@ -170,42 +170,39 @@ void OvEditor::Core::EditorRenderer::RenderSceneForActorPicking()
 	auto& scene = *m_context.sceneManager.GetCurrentScene();
 
 	/* Render models */
-	for (auto modelRenderer : scene.GetFastAccessComponents().modelRenderers)
+	for (auto modelRenderer : scene.GetActiveComponents().modelRenderers)
 	{
 		auto& actor = modelRenderer->owner;
 
-		if (actor.IsActive())
+		if (auto model = modelRenderer->GetModel())
 		{
-			if (auto model = modelRenderer->GetModel())
+			if (auto materialRenderer = modelRenderer->owner.GetComponent<OvCore::ECS::Components::CMaterialRenderer>())
 			{
-				if (auto materialRenderer = modelRenderer->owner.GetComponent<OvCore::ECS::Components::CMaterialRenderer>())
+				const OvCore::ECS::Components::CMaterialRenderer::MaterialList& materials = materialRenderer->GetMaterials();
+				const auto& modelMatrix = actor.transform.GetWorldMatrix();
+
+				PreparePickingMaterial(actor, m_actorPickingMaterial);
+
+				for (auto mesh : model->GetMeshes())
 				{
-					const OvCore::ECS::Components::CMaterialRenderer::MaterialList& materials = materialRenderer->GetMaterials();
-					const auto& modelMatrix = actor.transform.GetWorldMatrix();
+					OvCore::Resources::Material* material = nullptr;
 
-					PreparePickingMaterial(actor, m_actorPickingMaterial);
+					if (mesh->GetMaterialIndex() < MAX_MATERIAL_COUNT)
+					{
+						material = materials.at(mesh->GetMaterialIndex());
+						if (!material || !material->GetShader())
+							material = &m_emptyMaterial;
+					}
 
-					for (auto mesh : model->GetMeshes())
+					if (material)
 					{
-						OvCore::Resources::Material* material = nullptr;
-
-						if (mesh->GetMaterialIndex() < MAX_MATERIAL_COUNT)
-						{
-							material = materials.at(mesh->GetMaterialIndex());
-							if (!material || !material->GetShader())
-								material = &m_emptyMaterial;
-						}
-
-						if (material)
-						{
-							m_actorPickingMaterial.SetBackfaceCulling(material->HasBackfaceCulling());
-							m_actorPickingMaterial.SetFrontfaceCulling(material->HasFrontfaceCulling());
-							m_actorPickingMaterial.SetColorWriting(material->HasColorWriting());
-							m_actorPickingMaterial.SetDepthTest(material->HasDepthTest());
-							m_actorPickingMaterial.SetDepthWriting(material->HasDepthWriting());
-
-							m_context.renderer->DrawMesh(*mesh, m_actorPickingMaterial, &modelMatrix);
-						}
+						m_actorPickingMaterial.SetBackfaceCulling(material->HasBackfaceCulling());
+						m_actorPickingMaterial.SetFrontfaceCulling(material->HasFrontfaceCulling());
+						m_actorPickingMaterial.SetColorWriting(material->HasColorWriting());
+						m_actorPickingMaterial.SetDepthTest(material->HasDepthTest());
+						m_actorPickingMaterial.SetDepthWriting(material->HasDepthWriting());
+
+						m_context.renderer->DrawMesh(*mesh, m_actorPickingMaterial, &modelMatrix);
 					}
 				}
 			}
@@ -213,18 +210,15 @@ void OvEditor::Core::EditorRenderer::RenderSceneForActorPicking()
 	}
 
 	/* Render cameras */
-	for (auto camera : m_context.sceneManager.GetCurrentScene()->GetFastAccessComponents().cameras)
+	for (auto camera : m_context.sceneManager.GetCurrentScene()->GetActiveComponents().cameras)
 	{
 		auto& actor = camera->owner;
 
-		if (actor.IsActive())
-		{
-			PreparePickingMaterial(actor, m_actorPickingMaterial);
-			auto& model = *m_context.editorResources->GetModel("Camera");
-			auto modelMatrix = CalculateCameraModelMatrix(actor);
+		PreparePickingMaterial(actor, m_actorPickingMaterial);
+		auto& model = *m_context.editorResources->GetModel("Camera");
+		auto modelMatrix = CalculateCameraModelMatrix(actor);
 
-			m_context.renderer->DrawModelWithSingleMaterial(model, m_actorPickingMaterial, &modelMatrix);
-		}
+		m_context.renderer->DrawModelWithSingleMaterial(model, m_actorPickingMaterial, &modelMatrix);
 	}
 
 	/* Render lights */
@@ -236,17 +230,14 @@ void OvEditor::Core::EditorRenderer::RenderSceneForActorPicking()
 		m_lightMaterial.Set<float>("u_Scale", Settings::EditorSettings::LightBillboardScale * 0.1f);
 		m_lightMaterial.Set<OvRendering::Resources::Texture*>("u_DiffuseMap", nullptr);
 
-		for (auto light : m_context.sceneManager.GetCurrentScene()->GetFastAccessComponents().lights)
+		for (auto light : m_context.sceneManager.GetCurrentScene()->GetActiveComponents().lights)
 		{
 			auto& actor = light->owner;
 
-			if (actor.IsActive())
-			{
-				PreparePickingMaterial(actor, m_lightMaterial);
-				auto& model = *m_context.editorResources->GetModel("Vertical_Plane");
-				auto modelMatrix = FMatrix4::Translation(actor.transform.GetWorldPosition());
-				m_context.renderer->DrawModelWithSingleMaterial(model, m_lightMaterial, &modelMatrix);
-			}
+			PreparePickingMaterial(actor, m_lightMaterial);
+			auto& model = *m_context.editorResources->GetModel("Vertical_Plane");
+			auto modelMatrix = FMatrix4::Translation(actor.transform.GetWorldPosition());
+			m_context.renderer->DrawModelWithSingleMaterial(model, m_lightMaterial, &modelMatrix);
 		}
 	}
 }
@@ -260,17 +251,14 @@ void OvEditor::Core::EditorRenderer::RenderCameras()
 {
 	using namespace OvMaths;
 
-	for (auto camera : m_context.sceneManager.GetCurrentScene()->GetFastAccessComponents().cameras)
+	for (auto camera : m_context.sceneManager.GetCurrentScene()->GetActiveComponents().cameras)
 	{
 		auto& actor = camera->owner;
 
-		if (actor.IsActive())
-		{
-			auto& model = *m_context.editorResources->GetModel("Camera");
-			auto modelMatrix = CalculateCameraModelMatrix(actor);
-			
-			m_context.renderer->DrawModelWithSingleMaterial(model, m_cameraMaterial, &modelMatrix);
-		}
+		auto& model = *m_context.editorResources->GetModel("Camera");
+		auto modelMatrix = CalculateCameraModelMatrix(actor);
+		
+		m_context.renderer->DrawModelWithSingleMaterial(model, m_cameraMaterial, &modelMatrix);
 	}
 }
 
@@ -281,31 +269,28 @@ void OvEditor::Core::EditorRenderer::RenderLights()
 	m_lightMaterial.SetDepthTest(false);
 	m_lightMaterial.Set<float>("u_Scale", Settings::EditorSettings::LightBillboardScale * 0.1f);
 
-	for (auto light : m_context.sceneManager.GetCurrentScene()->GetFastAccessComponents().lights)
+	for (auto light : m_context.sceneManager.GetCurrentScene()->GetActiveComponents().lights)
 	{
 		auto& actor = light->owner;
 
-		if (actor.IsActive())
-		{
-			auto& model = *m_context.editorResources->GetModel("Vertical_Plane");
-			auto modelMatrix = FMatrix4::Translation(actor.transform.GetWorldPosition());
-
-			OvRendering::Resources::Texture* texture = nullptr;
+		auto& model = *m_context.editorResources->GetModel("Vertical_Plane");
+		auto modelMatrix = FMatrix4::Translation(actor.transform.GetWorldPosition());
 
-			switch (static_cast<OvRendering::Entities::Light::Type>(static_cast<int>(light->GetData().type)))
-			{
-			case OvRendering::Entities::Light::Type::POINT:				texture = m_context.editorResources->GetTexture("Bill_Point_Light");			break;
-			case OvRendering::Entities::Light::Type::SPOT:				texture = m_context.editorResources->GetTexture("Bill_Spot_Light");				break;
-			case OvRendering::Entities::Light::Type::DIRECTIONAL:		texture = m_context.editorResources->GetTexture("Bill_Directional_Light");		break;
-			case OvRendering::Entities::Light::Type::AMBIENT_BOX:		texture = m_context.editorResources->GetTexture("Bill_Ambient_Box_Light");		break;
-			case OvRendering::Entities::Light::Type::AMBIENT_SPHERE:	texture = m_context.editorResources->GetTexture("Bill_Ambient_Sphere_Light");	break;
-			}
+		OvRendering::Resources::Texture* texture = nullptr;
 
-			const auto& lightColor = light->GetColor();
-			m_lightMaterial.Set<OvRendering::Resources::Texture*>("u_DiffuseMap", texture);
-			m_lightMaterial.Set<OvMaths::FVector4>("u_Diffuse", OvMaths::FVector4(lightColor.x, lightColor.y, lightColor.z, 0.75f));
-			m_context.renderer->DrawModelWithSingleMaterial(model, m_lightMaterial, &modelMatrix);
+		switch (static_cast<OvRendering::Entities::Light::Type>(static_cast<int>(light->GetData().type)))
+		{
+		case OvRendering::Entities::Light::Type::POINT:				texture = m_context.editorResources->GetTexture("Bill_Point_Light");			break;
+		case OvRendering::Entities::Light::Type::SPOT:				texture = m_context.editorResources->GetTexture("Bill_Spot_Light");				break;
+		case OvRendering::Entities::Light::Type::DIRECTIONAL:		texture = m_context.editorResources->GetTexture("Bill_Directional_Light");		break;
+		case OvRendering::Entities::Light::Type::AMBIENT_BOX:		texture = m_context.editorResources->GetTexture("Bill_Ambient_Box_Light");		break;
+		case OvRendering::Entities::Light::Type::AMBIENT_SPHERE:	texture = m_context.editorResources->GetTexture("Bill_Ambient_Sphere_Light");	break;
 		}
+
+		const auto& lightColor = light->GetColor();
+		m_lightMaterial.Set<OvRendering::Resources::Texture*>("u_DiffuseMap", texture);
+		m_lightMaterial.Set<OvMaths::FVector4>("u_Diffuse", OvMaths::FVector4(lightColor.x, lightColor.y, lightColor.z, 0.75f));
+		m_context.renderer->DrawModelWithSingleMaterial(model, m_lightMaterial, &modelMatrix);
 	}
 }
 
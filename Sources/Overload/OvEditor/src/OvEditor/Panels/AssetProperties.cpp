@@ -280,6 +280,7 @@ void OvEditor::Panels::AssetProperties::CreateTextureSettings()
 	m_metadata->Add("MIN_FILTER", static_cast<int>(OvRendering::Settings::ETextureFilteringMode::LINEAR_MIPMAP_LINEAR));
 	m_metadata->Add("MAG_FILTER", static_cast<int>(OvRendering::Settings::ETextureFilteringMode::LINEAR));
 	m_metadata->Add("ENABLE_MIPMAPPING", true);
+	m_metadata->Add("COMPRESSION", static_cast<int>(OvRendering::Settings::ETextureCompression::NONE));
 
     std::map<int, std::string> filteringModes
     {
@@ -308,6 +309,22 @@ void OvEditor::Panels::AssetProperties::CreateTextureSettings()
 	};
 
 	OvCore::Helpers::GUIDrawer::DrawBoolean(*m_settingsColumns, "ENABLE_MIPMAPPING", [&]() { return m_metadata->Get<bool>("ENABLE_MIPMAPPING"); }, [&](bool value) { m_metadata->Set<bool>("ENABLE_MIPMAPPING", value); });
+
+	std::map<int, std::string> compressionFormats
+	{
+		{0x8058, "NONE"},
+		{0x83F0, "BC1 (RGB)"},
+		{0x83F3, "BC3 (RGBA)"},
+		{0x8DBD, "BC5 (RG, Normal maps)"}
+	};
+
+	OvCore::Helpers::GUIDrawer::CreateTitle(*m_settingsColumns, "COMPRESSION");
+	auto& compression = m_settingsColumns->CreateWidget<OvUI::Widgets::Selection::ComboBox>(m_metadata->Get<int>("COMPRESSION"));
+	compression.choices = compressionFormats;
+	compression.ValueChangedEvent += [this](int p_choice)
+	{
+		m_metadata->Set("COMPRESSION", p_choice);
+	};
 }
 
 void OvEditor::Panels::AssetProperties::Apply()
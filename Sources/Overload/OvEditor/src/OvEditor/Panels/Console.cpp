@@ -88,10 +88,36 @@ OvEditor::Panels::Console::Console
 
 	EDITOR_EVENT(PlayEvent) += std::bind(&Console::ClearOnPlay, this);
 
-	OvDebug::Logger::LogEvent += std::bind(&Console::OnLogIntercepted, this, std::placeholders::_1);
+	m_logListener = OvDebug::Logger::AddLogListener(std::bind(&Console::OnLogIntercepted, this, std::placeholders::_1));
+}
+
+OvEditor::Panels::Console::~Console()
+{
+	OvDebug::Logger::RemoveLogListener(m_logListener);
 }
 
 void OvEditor::Panels::Console::OnLogIntercepted(const OvDebug::LogData & p_logData)
+{
+	std::lock_guard<std::mutex> lock(m_pendingLogsMutex);
+	m_pendingLogs.push_back(p_logData);
+}
+
+void OvEditor::Panels::Console::_Draw_Impl()
+{
+	{
+		std::lock_guard<std::mutex> lock(m_pendingLogsMutex);
+		m_drawnLogs.swap(m_pendingLogs);
+	}
+
+	for (const auto& logData : m_drawnLogs)
+		AddLogWidget(logData);
+
+	m_drawnLogs.clear();
+
+	OvUI::Panels::PanelWindow::_Draw_Impl();
+}
+
+void OvEditor::Panels::Console::AddLogWidget(const OvDebug::LogData& p_logData)
 {
 	auto[logColor, logDate] = GetWidgetSettingsFromLogData(p_logData);
 
@@ -4,9 +4,35 @@
 * @licence: MIT
 */
 
+#include <cstdio>
+
 #include "OvEditor/Panels/HardwareInfo.h"
 
 #include <OvAnalytics/Hardware/HardwareInfo.h>
+#include <OvCore/Global/ServiceLocator.h>
+#include <OvCore/ResourceManagement/ModelManager.h>
+#include <OvCore/ResourceManagement/TextureManager.h>
+
+namespace
+{
+	template<typename T>
+	std::string DescribeResourceMemory(const std::string& p_name, const OvCore::ResourceManagement::AResourceManager<T>& p_manager)
+	{
+		constexpr double kMegabyte = 1024.0 * 1024.0;
+
+		const auto& usage = p_manager.GetMemoryUsage();
+
+		char buffer[256];
+		std::snprintf(buffer, sizeof(buffer), "%s: %.1f MB CPU, %.1f MB GPU (Budget: %.0f MB, evictions: %llu)",
+			p_name.c_str(),
+			usage.cpuBytes / kMegabyte,
+			usage.gpuBytes / kMegabyte,
+			p_manager.GetMemoryBudget() / kMegabyte,
+			static_cast<unsigned long long>(p_manager.GetEvictionCount()));
+
+		return buffer;
+	}
+}
 
 using namespace OvUI::Panels;
 using namespace OvUI::Widgets;
@@ -27,6 +53,8 @@ OvEditor::Panels::HardwareInfo::HardwareInfo
 	m_cpuUsage = &CreateWidget<Plots::PlotLines>();
 	m_gpuUsage = &CreateWidget<Plots::PlotLines>();
 	m_ramUsage = &CreateWidget<Plots::PlotLines>();
+	m_modelMemory = &CreateWidget<Texts::Text>();
+	m_textureMemory = &CreateWidget<Texts::Text>();
 	
 	m_cpuUsage->minScale = 0.0f;
 	m_cpuUsage->maxScale = 100.0f;
@@ -75,6 +103,14 @@ void OvEditor::Panels::HardwareInfo::Update(float p_deltaTime)
 		if (m_ramUsage->data.size() > m_maxElements)
 			m_ramUsage->data.erase(m_ramUsage->data.begin());
 
+		UpdateResourceMemory();
+
 		p_updateTimer -= m_logFrequency;
 	}
 }
+
+void OvEditor::Panels::HardwareInfo::UpdateResourceMemory()
+{
+	m_modelMemory->content = DescribeResourceMemory("Models", OVSERVICE(OvCore::ResourceManagement::ModelManager));
+	m_textureMemory->content = DescribeResourceMemory("Textures", OVSERVICE(OvCore::ResourceManagement::TextureManager));
+}
@@ -23,7 +23,7 @@ using namespace OvUI::Panels;
 using namespace OvUI::Widgets;
 using namespace OvCore::Helpers;
 
-void DrawHybridVec3(OvUI::Internal::WidgetContainer& p_root, const std::string& p_name, OvMaths::FVector3& p_data, float p_step, float p_min, float p_max)
+void DrawHybridVec3(OvUI::Internal::WidgetContainer& p_root, const std::string& p_name, OvMaths::FVector3& p_data, float p_step, float p_min, float p_max, OvTools::Eventing::Event<>& p_updateNotifier)
 {
 	OvCore::Helpers::GUIDrawer::CreateTitle(p_root, p_name);
 
@@ -40,6 +40,9 @@ void DrawHybridVec3(OvUI::Internal::WidgetContainer& p_root, const std::string&
 	rgbWidget.enabled = false;
 	rgbWidget.lineBreak = false;
 
+	xyzWidget.ValueChangedEvent += [&p_updateNotifier](std::array<float, 3>&) { p_updateNotifier.Invoke(); };
+	rgbWidget.ColorChangedEvent += [&p_updateNotifier](OvUI::Types::Color&) { p_updateNotifier.Invoke(); };
+
 	auto& xyzButton = rightSide.CreateWidget<OvUI::Widgets::Buttons::Button>("XYZ");
 	xyzButton.idleBackgroundColor = { 0.7f, 0.5f, 0.0f };
 	xyzButton.lineBreak = false;
@@ -60,7 +63,7 @@ void DrawHybridVec3(OvUI::Internal::WidgetContainer& p_root, const std::string&
 	};
 }
 
-void DrawHybridVec4(OvUI::Internal::WidgetContainer& p_root, const std::string& p_name, OvMaths::FVector4& p_data, float p_step, float p_min, float p_max)
+void DrawHybridVec4(OvUI::Internal::WidgetContainer& p_root, const std::string& p_name, OvMaths::FVector4& p_data, float p_step, float p_min, float p_max, OvTools::Eventing::Event<>& p_updateNotifier)
 {
 	OvCore::Helpers::GUIDrawer::CreateTitle(p_root, p_name);
 
@@ -77,6 +80,9 @@ void DrawHybridVec4(OvUI::Internal::WidgetContainer& p_root, const std::string&
 	rgbaWidget.enabled = false;
 	rgbaWidget.lineBreak = false;
 
+	xyzWidget.ValueChangedEvent += [&p_updateNotifier](std::array<float, 4>&) { p_updateNotifier.Invoke(); };
+	rgbaWidget.ColorChangedEvent += [&p_updateNotifier](OvUI::Types::Color&) { p_updateNotifier.Invoke(); };
+
 	auto& xyzwButton = rightSide.CreateWidget<OvUI::Widgets::Buttons::Button>("XYZW");
 	xyzwButton.idleBackgroundColor = { 0.7f, 0.5f, 0.0f };
 	xyzwButton.lineBreak = false;
@@ -97,6 +103,23 @@ void DrawHybridVec4(OvUI::Internal::WidgetContainer& p_root, const std::string&
 	};
 }
 
+template <typename T>
+std::function<T(void)> UniformGatherer(std::any& p_data)
+{
+	return [&p_data] { return reinterpret_cast<T&>(p_data); };
+}
+
+/* Write the edited value into the uniforms data and notify the change (The material parameters must be baked again) */
+template <typename T>
+std::function<void(T)> UniformProvider(std::any& p_data, OvTools::Eventing::Event<>& p_updateNotifier)
+{
+	return [&p_data, &p_updateNotifier](T p_value)
+	{
+		reinterpret_cast<T&>(p_data) = p_value;
+		p_updateNotifier.Invoke();
+	};
+}
+
 OvEditor::Panels::MaterialEditor::MaterialEditor
 (
 	const std::string& p_title,
@@ -118,6 +141,13 @@ OvEditor::Panels::MaterialEditor::MaterialEditor
 
 	m_materialDroppedEvent	+= std::bind(&MaterialEditor::OnMaterialDropped, this);
 	m_shaderDroppedEvent	+= std::bind(&MaterialEditor::OnShaderDropped, this);
+
+	/* Shader settings widgets write directly into the uniforms data of the target, so its parameters must be baked again */
+	m_parametersChangedEvent += [this]
+	{
+		if (m_target)
+			m_target->MarkParametersDirty();
+	};
 }
 
 void OvEditor::Panels::MaterialEditor::Refresh()
@@ -343,13 +373,13 @@ void OvEditor::Panels::MaterialEditor::GenerateShaderSettingsContent()
 		{
 			switch (uniformData->type)
 			{
-			case UniformType::UNIFORM_BOOL:			GUIDrawer::DrawBoolean(*m_shaderSettingsColumns, UniformFormat(info.first), reinterpret_cast<bool&>(*info.second));																	break;
-			case UniformType::UNIFORM_INT:			GUIDrawer::DrawScalar<int>(*m_shaderSettingsColumns, UniformFormat(info.first), reinterpret_cast<int&>(*info.second));																break;
-			case UniformType::UNIFORM_FLOAT:		GUIDrawer::DrawScalar<float>(*m_shaderSettingsColumns, UniformFormat(info.first), reinterpret_cast<float&>(*info.second), 0.01f, GUIDrawer::_MIN_FLOAT, GUIDrawer::_MAX_FLOAT);		break;
-			case UniformType::UNIFORM_FLOAT_VEC2:	GUIDrawer::DrawVec2(*m_shaderSettingsColumns, UniformFormat(info.first), reinterpret_cast<OvMaths::FVector2&>(*info.second), 0.01f, GUIDrawer::_MIN_FLOAT, GUIDrawer::_MAX_FLOAT);	break;
-			case UniformType::UNIFORM_FLOAT_VEC3:	DrawHybridVec3(*m_shaderSettingsColumns, UniformFormat(info.first), reinterpret_cast<OvMaths::FVector3&>(*info.second), 0.01f, GUIDrawer::_MIN_FLOAT, GUIDrawer::_MAX_FLOAT);			break;
-			case UniformType::UNIFORM_FLOAT_VEC4:	DrawHybridVec4(*m_shaderSettingsColumns, UniformFormat(info.first), reinterpret_cast<OvMaths::FVector4&>(*info.second), 0.01f, GUIDrawer::_MIN_FLOAT, GUIDrawer::_MAX_FLOAT);			break;
-			case UniformType::UNIFORM_SAMPLER_2D:	GUIDrawer::DrawTexture(*m_shaderSettingsColumns, UniformFormat(info.first), reinterpret_cast<Texture * &>(*info.second));																break;
+			case UniformType::UNIFORM_BOOL:			GUIDrawer::DrawBoolean(*m_shaderSettingsColumns, UniformFormat(info.first), UniformGatherer<bool>(*info.second), UniformProvider<bool>(*info.second, m_parametersChangedEvent));																		break;
+			case UniformType::UNIFORM_INT:			GUIDrawer::DrawScalar<int>(*m_shaderSettingsColumns, UniformFormat(info.first), UniformGatherer<int>(*info.second), UniformProvider<int>(*info.second, m_parametersChangedEvent));																	break;
+			case UniformType::UNIFORM_FLOAT:		GUIDrawer::DrawScalar<float>(*m_shaderSettingsColumns, UniformFormat(info.first), UniformGatherer<float>(*info.second), UniformProvider<float>(*info.second, m_parametersChangedEvent), 0.01f, GUIDrawer::_MIN_FLOAT, GUIDrawer::_MAX_FLOAT);		break;
+			case UniformType::UNIFORM_FLOAT_VEC2:	GUIDrawer::DrawVec2(*m_shaderSettingsColumns, UniformFormat(info.first), UniformGatherer<OvMaths::FVector2>(*info.second), UniformProvider<OvMaths::FVector2>(*info.second, m_parametersChangedEvent), 0.01f, GUIDrawer::_MIN_FLOAT, GUIDrawer::_MAX_FLOAT);	break;
+			case UniformType::UNIFORM_FLOAT_VEC3:	DrawHybridVec3(*m_shaderSettingsColumns, UniformFormat(info.first), reinterpret_cast<OvMaths::FVector3&>(*info.second), 0.01f, GUIDrawer::_MIN_FLOAT, GUIDrawer::_MAX_FLOAT, m_parametersChangedEvent);	break;
+			case UniformType::UNIFORM_FLOAT_VEC4:	DrawHybridVec4(*m_shaderSettingsColumns, UniformFormat(info.first), reinterpret_cast<OvMaths::FVector4&>(*info.second), 0.01f, GUIDrawer::_MIN_FLOAT, GUIDrawer::_MAX_FLOAT, m_parametersChangedEvent);	break;
+			case UniformType::UNIFORM_SAMPLER_2D:	GUIDrawer::DrawTexture(*m_shaderSettingsColumns, UniformFormat(info.first), reinterpret_cast<Texture * &>(*info.second), &m_parametersChangedEvent);												break;
 			}
 		}
 	}
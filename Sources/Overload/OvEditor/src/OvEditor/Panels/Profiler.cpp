@@ -6,8 +6,14 @@
 
 #include "OvEditor/Panels/Profiler.h"
 
+#include <algorithm>
+
 #include <OvDebug/Logger.h>
+#include <OvTools/Time/Date.h>
 #include <OvUI/Widgets/Visual/Separator.h>
+#include <OvUI/Widgets/InputFields/InputInt.h>
+
+#include "OvEditor/Core/EditorActions.h"
 
 using namespace OvUI::Panels;
 using namespace OvUI::Widgets;
@@ -36,6 +42,13 @@ OvEditor::Panels::Profiler::Profiler
 		m_profilingMode					= m_profilingMode == EProfilingMode::CAPTURE ? EProfilingMode::DEFAULT : EProfilingMode::CAPTURE;
 		m_captureResumeButton->label	= m_profilingMode == EProfilingMode::CAPTURE ? "Resume" : "Capture";
 	};
+
+	auto& traceButton = CreateWidget<Buttons::Button>("Save trace");
+	traceButton.lineBreak = false;
+	traceButton.ClickedEvent += std::bind(&Profiler::SaveTrace, this);
+	auto& traceFrameCount = CreateWidget<InputFields::InputInt>(static_cast<int>(m_traceFrameCount), 1, 10, "Frames");
+	traceFrameCount.ContentChangedEvent += [this](int p_value) { m_traceFrameCount = static_cast<uint32_t>(std::max(p_value, 1)); };
+
 	m_elapsedFramesText = &CreateWidget<Texts::TextColored>("", Color(1.f, 0.8f, 0.01f, 1));
 	m_elapsedTimeText = &CreateWidget<Texts::TextColored>("", Color(1.f, 0.8f, 0.01f, 1));
 	m_separator = &CreateWidget<OvUI::Widgets::Visual::Separator>();
@@ -56,9 +69,10 @@ void OvEditor::Panels::Profiler::Update(float p_deltaTime)
 		m_fpsTimer -= 0.07f;
 	}
 
-	if (m_profiler.IsEnabled())
+	/* A running capture counts its frames down in Update, even if profiling has been disabled meanwhile */
+	if (m_profiler.IsEnabled() || OvAnalytics::Profiling::Profiler::IsCapturing())
 	{
-		m_profiler.Update(p_deltaTime);
+		m_profiler.Update();
 
 		while (m_timer >= m_frequency)
 		{
@@ -116,6 +130,16 @@ void OvEditor::Panels::Profiler::Enable(bool p_value, bool p_disableLog)
 	m_separator->enabled = p_value;
 }
 
+void OvEditor::Panels::Profiler::SaveTrace()
+{
+	const std::string filePath = EDITOR_CONTEXT(projectPath) + "Capture_" + OvTools::Time::Date::GetDateAsString() + ".json";
+
+	if (OvAnalytics::Profiling::Profiler::StartCapture(filePath, m_traceFrameCount))
+		OVLOG_INFO("Capturing " + std::to_string(m_traceFrameCount) + " frames to: " + filePath);
+	else
+		OVLOG_ERROR("Unable to create the trace file: " + filePath);
+}
+
 OvUI::Types::Color OvEditor::Panels::Profiler::CalculateActionColor(double p_percentage) const
 {
 	if (p_percentage <= 25.0f)		return { 0.0f, 1.0f, 0.0f, 1.0f };
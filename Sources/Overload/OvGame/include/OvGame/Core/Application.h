@@ -32,6 +32,12 @@ namespace OvGame::Core
 		*/
 		void Run();
 
+		/**
+		* Stream the next frames to a Chrome Trace Event JSON file
+		* @param p_frameCount
+		*/
+		void CaptureTrace(uint32_t p_frameCount);
+
 		/**
 		* Returns true if the app is running
 		*/
@@ -18,6 +18,7 @@
 #include <OvUI/Core/UIManager.h>
 
 #include <OvCore/ECS/Renderer.h>
+#include <OvCore/ResourceManagement/AsyncLoader.h>
 #include <OvCore/ResourceManagement/ModelManager.h>
 #include <OvCore/ResourceManagement/TextureManager.h>
 #include <OvCore/ResourceManagement/ShaderManager.h>
@@ -30,6 +31,7 @@
 #include <OvAudio/Core/AudioPlayer.h>
 
 #include <OvTools/Filesystem/IniFile.h>
+#include <OvTools/Utils/ThreadPool.h>
 
 namespace OvGame::Core
 {
@@ -58,6 +60,7 @@ namespace OvGame::Core
 		std::unique_ptr<OvWindowing::Window>						window;
 		std::unique_ptr<OvWindowing::Inputs::InputManager>			inputManager;
 		std::unique_ptr<OvRendering::Context::Driver>				driver;
+		std::unique_ptr<OvTools::Utils::ThreadPool>					threadPool;
 		std::unique_ptr<OvCore::ECS::Renderer>						renderer;
 		std::unique_ptr<OvUI::Core::UIManager>						uiManager;
 		std::unique_ptr<OvPhysics::Core::PhysicsEngine>				physicsEngine;
@@ -66,6 +69,7 @@ namespace OvGame::Core
 		std::unique_ptr<OvCore::Scripting::ScriptInterpreter>		scriptInterpreter;
 		std::unique_ptr<OvRendering::Buffers::UniformBuffer>		engineUBO;
 		std::unique_ptr<OvRendering::Buffers::ShaderStorageBuffer>	lightSSBO;
+		std::unique_ptr<OvCore::ResourceManagement::AsyncLoader>	asyncLoader;
 
 		OvCore::SceneSystem::SceneManager sceneManager;
 
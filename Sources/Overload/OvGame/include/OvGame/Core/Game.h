@@ -7,6 +7,7 @@
 #pragma once
 
 #include <OvUI/Modules/Canvas.h>
+#include <OvAnalytics/Profiling/Profiler.h>
 #include <OvCore/ECS/Components/CCamera.h>
 
 #include "OvGame/Core/Context.h"
@@ -55,6 +56,18 @@ namespace OvGame::Core
 		*/
 		void PostUpdate();
 
+		/**
+		* Stream the next frames to a Chrome Trace Event JSON file, in the working directory
+		* @param p_frameCount
+		*/
+		void CaptureTrace(uint32_t p_frameCount);
+
+		/* Number of frames captured when pressing F11 */
+		static constexpr uint32_t kDefaultTraceFrameCount = 300;
+
+		/* Time (In milliseconds) spent each frame creating the GPU resources of streamed assets */
+		static constexpr float kResourceUploadBudget = 4.0f;
+
 	private:
 		float m_elapsed = 0.0f;
 
@@ -63,6 +76,9 @@ namespace OvGame::Core
 
 		OvGame::Core::GameRenderer m_gameRenderer;
 
+		/* Collects the profiler events every frame (Declared before the debug elements that read them) */
+		OvAnalytics::Profiling::Profiler m_profiler;
+
 		/* Debug elements */
 		OvGame::Utils::FPSCounter	m_fpsCounter;
 
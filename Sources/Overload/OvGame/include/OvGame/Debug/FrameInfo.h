@@ -39,7 +39,7 @@ namespace OvGame::Debug
 		OvRendering::Core::Renderer&	m_renderer;
 		OvWindowing::Window&			m_window;
 
-		OvUI::Widgets::Texts::TextColored* m_frameInfo[3];
+		OvUI::Widgets::Texts::TextColored* m_frameInfo[4];
 	};
 }
 
@@ -28,9 +28,10 @@ namespace OvGame::Debug
 		/**
 		* Constructor
 		* @param p_window
+		* @param p_profiler (Collected by the game every frame)
 		* @param p_frequency
 		*/
-		GameProfiler(OvWindowing::Window& p_window, float p_frequency);
+		GameProfiler(OvWindowing::Window& p_window, OvAnalytics::Profiling::Profiler& p_profiler, float p_frequency);
 
 		/**
 		* Update the data
@@ -48,7 +49,7 @@ namespace OvGame::Debug
 		float m_frequency;
 		float m_timer = 0.f;
 
-		OvAnalytics::Profiling::Profiler m_profiler;
+		OvAnalytics::Profiling::Profiler& m_profiler;
 
 		OvWindowing::Window& m_window;
 		OvUI::Widgets::AWidget* m_separator;
@@ -32,6 +32,11 @@ void OvGame::Core::Application::Run()
 	}
 }
 
+void OvGame::Core::Application::CaptureTrace(uint32_t p_frameCount)
+{
+	m_game.CaptureTrace(p_frameCount);
+}
+
 bool OvGame::Core::Application::IsRunning() const
 {
 	return !m_context.window->ShouldClose();
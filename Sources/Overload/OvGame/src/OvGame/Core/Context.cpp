@@ -4,6 +4,7 @@
 * @licence: MIT
 */
 
+#include <algorithm>
 #include <filesystem>
 
 #include "OvGame/Core/Context.h"
@@ -53,7 +54,20 @@ OvGame::Core::Context::Context() :
 
 	/* Graphics context creation */
 	driver = std::make_unique<OvRendering::Context::Driver>(OvRendering::Settings::DriverSettings{ false });
-	renderer = std::make_unique<OvCore::ECS::Renderer>(*driver);
+	threadPool = std::make_unique<OvTools::Utils::ThreadPool>();
+	renderer = std::make_unique<OvCore::ECS::Renderer>(*driver, threadPool.get());
+
+	/* Resources are streamed: decoded on the loader workers, then uploaded by the game loop */
+	asyncLoader = std::make_unique<AsyncLoader>(static_cast<uint32_t>(projectSettings.GetOrDefault<int>("loading_threads", 0)));
+	ModelManager::ProvideAsyncLoader(asyncLoader.get());
+	TextureManager::ProvideAsyncLoader(asyncLoader.get());
+	ShaderManager::ProvideAsyncLoader(asyncLoader.get());
+	MaterialManager::ProvideAsyncLoader(asyncLoader.get());
+	SoundManager::ProvideAsyncLoader(asyncLoader.get());
+
+	/* Unreferenced resources are evicted (Least recently used first) once their manager exceeds its budget (In MB, 0 for no budget) */
+	modelManager.SetMemoryBudget(static_cast<uint64_t>(std::max(projectSettings.GetOrDefault<int>("model_memory_budget", 0), 0)) << 20);
+	textureManager.SetMemoryBudget(static_cast<uint64_t>(std::max(projectSettings.GetOrDefault<int>("texture_memory_budget", 0), 0)) << 20);
 
 	renderer->SetCapability(OvRendering::Settings::ERenderingCapability::MULTISAMPLE, projectSettings.Get<bool>("multisampling"));
 
@@ -70,7 +84,12 @@ OvGame::Core::Context::Context() :
 	audioPlayer = std::make_unique<OvAudio::Core::AudioPlayer>(*audioEngine);
 
 	/* Physics engine */
-	physicsEngine = std::make_unique<OvPhysics::Core::PhysicsEngine>(OvPhysics::Settings::PhysicsSettings{ {0.0f, projectSettings.Get<float>("gravity"), 0.0f } });
+	OvPhysics::Settings::PhysicsSettings physicsSettings;
+	physicsSettings.gravity = { 0.0f, projectSettings.Get<float>("gravity"), 0.0f };
+	physicsSettings.fixedTimeStep = 1.0f / static_cast<float>(std::max(projectSettings.GetOrDefault<int>("physics_rate", 60), 1));
+	physicsSettings.maxSubSteps = static_cast<uint32_t>(std::max(projectSettings.GetOrDefault<int>("physics_max_substeps", 5), 1));
+	physicsSettings.interpolation = projectSettings.GetOrDefault<bool>("physics_interpolation", true);
+	physicsEngine = std::make_unique<OvPhysics::Core::PhysicsEngine>(physicsSettings);
 
 	/* Service Locator providing */
 	ServiceLocator::Provide<OvPhysics::Core::PhysicsEngine>(*physicsEngine);
@@ -96,9 +115,7 @@ OvGame::Core::Context::Context() :
 		sizeof(OvMaths::FMatrix4) +
 		sizeof(OvMaths::FVector3) +
 		sizeof(float) +
-		sizeof(OvMaths::FMatrix4) +
-		sizeof(int) +
-		sizeof(OvMaths::FMatrix4)*64,
+		sizeof(OvMaths::FMatrix4),
 		0, 0,
 		OvRendering::Buffers::EAccessSpecifier::STREAM_DRAW
 	);
@@ -109,9 +126,20 @@ OvGame::Core::Context::Context() :
 
 OvGame::Core::Context::~Context()
 {
+	/* Release the resource handles held by the scene while the resource managers still exist */
+	sceneManager.UnloadCurrentScene();
+
+	/* Finish the pending loads while the resource managers still exist */
+	asyncLoader.reset();
+	ModelManager::ProvideAsyncLoader(nullptr);
+	TextureManager::ProvideAsyncLoader(nullptr);
+	ShaderManager::ProvideAsyncLoader(nullptr);
+	MaterialManager::ProvideAsyncLoader(nullptr);
+	SoundManager::ProvideAsyncLoader(nullptr);
+
+	materialManager.UnloadResources(); // Materials release their shader and texture handles
 	modelManager.UnloadResources();
 	textureManager.UnloadResources();
 	shaderManager.UnloadResources();
-	materialManager.UnloadResources();
 	soundManager.UnloadResources();
 }
@@ -10,6 +10,7 @@
 #include <OvUI/Widgets/Texts/Text.h>
 
 #include <OvAnalytics/Profiling/ProfilerSpy.h>
+#include <OvTools/Time/Date.h>
 
 OvGame::Core::Game::Game(Context & p_context) :
 	m_context(p_context),
@@ -18,7 +19,7 @@ OvGame::Core::Game::Game(Context & p_context) :
 	#ifdef _DEBUG
 	,
 	m_driverInfo(*m_context.renderer, *m_context.window),
-	m_gameProfiler(*p_context.window, 0.25f),
+	m_gameProfiler(*p_context.window, m_profiler, 0.25f),
 	m_frameInfo(*m_context.renderer, *m_context.window)
 	#endif
 {
@@ -41,9 +42,7 @@ OvGame::Core::Game::~Game()
 
 void OvGame::Core::Game::PreUpdate()
 {
-	#ifdef _DEBUG
 	PROFILER_SPY("Pre-Update");
-	#endif
 	m_context.device->PollEvents();
 }
 
@@ -55,45 +54,57 @@ void OvGame::Core::Game::Update(float p_deltaTime)
 
 	m_context.renderer->ClearFrameInfo();
 
+	{
+		PROFILER_SPY("Resource Uploads");
+		m_context.asyncLoader->ProcessUploads(kResourceUploadBudget);
+	}
+
 	if (auto currentScene = m_context.sceneManager.GetCurrentScene())
 	{
 		{
-			#ifdef _DEBUG
 			PROFILER_SPY("Physics Update");
-			#endif
 
-			if (m_context.physicsEngine->Update(p_deltaTime))
-				currentScene->FixedUpdate(p_deltaTime);
+			m_context.physicsEngine->Update(p_deltaTime, [currentScene](float p_fixedDeltaTime)
+			{
+				currentScene->FixedUpdate(p_fixedDeltaTime);
+			});
 		}
 
 		{
-			#ifdef _DEBUG
 			PROFILER_SPY("Scene Update");
-			#endif
-			currentScene->Update(p_deltaTime);
+			currentScene->Update(p_deltaTime, m_context.threadPool.get());
 			currentScene->LateUpdate(p_deltaTime);
 		}
 
 		{
-			#ifdef _DEBUG
 			PROFILER_SPY("Audio Update");
-			#endif
 			m_context.audioEngine->Update();
 		}
 
 		{
-			#ifdef _DEBUG
 			PROFILER_SPY("Render Scene");
-			#endif
 			m_gameRenderer.RenderScene();
 		}
 	}
 
 	m_context.sceneManager.Update();
 
+	{
+		PROFILER_SPY("Resource Eviction");
+
+		m_context.modelManager.EvictUnusedResources();
+		m_context.textureManager.EvictUnusedResources();
+	}
+
 	if  (m_context.inputManager->IsKeyPressed(OvWindowing::Inputs::EKey::KEY_F12))
 		m_showDebugInformation = !m_showDebugInformation;
 
+	if (m_context.inputManager->IsKeyPressed(OvWindowing::Inputs::EKey::KEY_F11))
+		CaptureTrace(kDefaultTraceFrameCount);
+
+	if (OvAnalytics::Profiling::Profiler::IsEnabled())
+		m_profiler.Update();
+
 	#ifdef _DEBUG
 	if (m_context.inputManager->IsKeyPressed(OvWindowing::Inputs::EKey::KEY_R))
 		OvRendering::Resources::Loaders::ShaderLoader::Recompile(*m_context.shaderManager[":Shaders\\Standard.glsl"], "Data\\Engine\\Shaders\\Standard.glsl");
@@ -110,11 +121,19 @@ void OvGame::Core::Game::Update(float p_deltaTime)
 	}
 }
 
+void OvGame::Core::Game::CaptureTrace(uint32_t p_frameCount)
+{
+	const std::string filePath = "Capture_" + OvTools::Time::Date::GetDateAsString() + ".json";
+
+	if (OvAnalytics::Profiling::Profiler::StartCapture(filePath, p_frameCount))
+		OVLOG_INFO("Capturing " + std::to_string(p_frameCount) + " frames to: " + filePath);
+	else
+		OVLOG_ERROR("Unable to create the trace file: " + filePath);
+}
+
 void OvGame::Core::Game::PostUpdate()
 {
-	#ifdef _DEBUG
 	PROFILER_SPY("Post-Update");
-	#endif
 	m_context.window->SwapBuffers();
 	m_context.inputManager->ClearEvents();
 }
\ No newline at end of file
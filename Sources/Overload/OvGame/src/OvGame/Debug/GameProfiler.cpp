@@ -16,7 +16,7 @@ using namespace OvUI::Panels;
 using namespace OvUI::Widgets;
 using namespace OvUI::Types;
 
-OvGame::Debug::GameProfiler::GameProfiler(OvWindowing::Window& p_window, float p_frequency) : m_frequency(p_frequency), m_window(p_window)
+OvGame::Debug::GameProfiler::GameProfiler(OvWindowing::Window& p_window, OvAnalytics::Profiling::Profiler& p_profiler, float p_frequency) : m_frequency(p_frequency), m_profiler(p_profiler), m_window(p_window)
 {
 	m_defaultHorizontalAlignment = OvUI::Settings::EHorizontalAlignment::LEFT;
 	m_defaultPosition = { 10.0f, 10.0f };
@@ -47,8 +47,6 @@ void OvGame::Debug::GameProfiler::Update(float p_deltaTime)
 
 	if (m_profiler.IsEnabled())
 	{
-		m_profiler.Update(p_deltaTime);
-
 		while (m_timer >= m_frequency)
 		{
 			
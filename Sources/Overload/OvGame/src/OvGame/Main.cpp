@@ -4,21 +4,38 @@
 * @licence: MIT
 */
 
+#include <string>
+#include <cstdlib>
+#include <algorithm>
+
 #include <OvRendering/Utils/Defines.h>
 
 #include "OvGame/Core/Application.h"
 
 FORCE_DEDICATED_GPU
 
-#ifdef _DEBUG
-int main()
-#else
+int main(int argc, char** argv);
+
+#ifndef _DEBUG
 #undef APIENTRY
 #include "Windows.h"
 INT WinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, PSTR lpCmdLine, INT nCmdShow)
+{
+	return main(__argc, __argv);
+}
 #endif
+
+int main(int argc, char** argv)
 {
 	OvGame::Core::Application app;
+
+	/* "--capture-trace <frames>" streams the first frames of the game to a trace file */
+	for (int i = 1; i + 1 < argc; ++i)
+	{
+		if (std::string(argv[i]) == "--capture-trace")
+			app.CaptureTrace(static_cast<uint32_t>(std::max(std::atoi(argv[i + 1]), 1)));
+	}
+
 	app.Run();
 
 	return EXIT_SUCCESS;
@@ -14,7 +14,9 @@
 namespace OvMaths
 {
 	/**
-	* Mathematic representation of a 3D transformation with float precision
+	* Mathematic representation of a 3D transformation with float precision.
+	* World data is computed lazily: changing a transform only marks it (And its children) as outdated,
+	* and the world matrix and its decomposition are computed the next time they are read
 	*/
 	class FTransform
 	{
@@ -65,9 +67,11 @@ namespace OvMaths
 		void GenerateMatrices(FVector3 p_position, FQuaternion p_rotation, FVector3 p_scale);
 
 		/**
-		* Re-update world matrix to use parent transformations
+		* Compute the world matrix and its decomposition now if they are outdated (Computing them also updates outdated parents).
+		* World data getters do it on demand, but they must not be called concurrently on outdated transforms:
+		* call this method first on every transform that will be read from multiple threads
 		*/
-		void UpdateWorldMatrix();
+		void UpdateWorldMatrix() const;
 
 		/**
 		* Set the position of the transform in the local space
@@ -163,6 +167,12 @@ namespace OvMaths
 		*/
 		const FMatrix4& GetWorldMatrix() const;
 
+		/**
+		* Return a counter incremented each time the local position, rotation or scale is set.
+		* Comparing it with a previously read value tells if the transform has been modified since
+		*/
+		uint64_t GetLocalVersion() const;
+
 		/**
 		* Return the transform world forward
 		*/
@@ -198,20 +208,28 @@ namespace OvMaths
 		Internal::TransformNotifier::NotificationHandlerID m_notificationHandlerID;
 
 	private:
-		void PreDecomposeWorldMatrix();
+		void SetWorldMatrixOutdated();
+		void ResolveWorldMatrix() const;
+		void ResolveWorldDecomposition() const;
+		void PreDecomposeWorldMatrix() const;
 		void PreDecomposeLocalMatrix();
 
 		/* Pre-decomposed data to prevent multiple decomposition */
 		FVector3 m_localPosition;
 		FQuaternion m_localRotation;
 		FVector3 m_localScale;
-		FVector3 m_worldPosition;
-		FQuaternion m_worldRotation;
-		FVector3 m_worldScale;
+		mutable FVector3 m_worldPosition;
+		mutable FQuaternion m_worldRotation;
+		mutable FVector3 m_worldScale;
 
 		FMatrix4 m_localMatrix;
-		FMatrix4 m_worldMatrix;
+		mutable FMatrix4 m_worldMatrix;
+
+		/* An outdated transform always has outdated children, so marking a subtree stops at already outdated transforms */
+		mutable bool m_worldMatrixOutdated = true;
+		mutable bool m_worldDecompositionOutdated = true;
 
 		FTransform*	m_parent;
+		uint64_t	m_localVersion = 0;
 	};
 }
\ No newline at end of file
@@ -23,7 +23,7 @@ void OvMaths::FTransform::NotificationHandler(Internal::TransformNotifier::ENoti
 	switch (p_notification)
 	{
 	case Internal::TransformNotifier::ENotification::TRANSFORM_CHANGED:
-		UpdateWorldMatrix();
+		SetWorldMatrixOutdated();
 		break;
 
 	case Internal::TransformNotifier::ENotification::TRANSFORM_DESTROYED:
@@ -31,9 +31,9 @@ void OvMaths::FTransform::NotificationHandler(Internal::TransformNotifier::ENoti
 		* RemoveParent() is not called here because it is unsafe to remove a notification handler
 		* while the parent is iterating on his notification handlers (Segfault otherwise)
 		*/
-		GenerateMatrices(m_worldPosition, m_worldRotation, m_worldScale);
+		ResolveWorldDecomposition();
 		m_parent = nullptr;
-		UpdateWorldMatrix();
+		GenerateMatrices(m_worldPosition, m_worldRotation, m_worldScale);
 		break;
 	}
 }
@@ -44,7 +44,7 @@ void OvMaths::FTransform::SetParent(FTransform& p_parent)
 
 	m_notificationHandlerID = m_parent->Notifier.AddNotificationHandler(std::bind(&FTransform::NotificationHandler, this, std::placeholders::_1));
 
-	UpdateWorldMatrix();
+	SetWorldMatrixOutdated();
 }
 
 bool OvMaths::FTransform::RemoveParent()
@@ -53,7 +53,7 @@ bool OvMaths::FTransform::RemoveParent()
 	{
 		m_parent->Notifier.RemoveNotificationHandler(m_notificationHandlerID);
 		m_parent = nullptr;
-		UpdateWorldMatrix();
+		SetWorldMatrixOutdated();
 
 		return true;
 	}
@@ -72,16 +72,44 @@ void OvMaths::FTransform::GenerateMatrices(FVector3 p_position, FQuaternion p_ro
 	m_localPosition = p_position;
 	m_localRotation = p_rotation;
 	m_localScale = p_scale;
+	++m_localVersion;
 
-	UpdateWorldMatrix();
+	SetWorldMatrixOutdated();
 }
 
-void OvMaths::FTransform::UpdateWorldMatrix()
+void OvMaths::FTransform::UpdateWorldMatrix() const
 {
-	m_worldMatrix = HasParent() ? m_parent->m_worldMatrix * m_localMatrix : m_localMatrix;
-	PreDecomposeWorldMatrix();
+	ResolveWorldDecomposition();
+}
 
-	Notifier.NotifyChildren(Internal::TransformNotifier::ENotification::TRANSFORM_CHANGED);
+void OvMaths::FTransform::SetWorldMatrixOutdated()
+{
+	/* Children of an outdated transform are already outdated */
+	if (!m_worldMatrixOutdated)
+	{
+		m_worldMatrixOutdated = true;
+		m_worldDecompositionOutdated = true;
+		Notifier.NotifyChildren(Internal::TransformNotifier::ENotification::TRANSFORM_CHANGED);
+	}
+}
+
+void OvMaths::FTransform::ResolveWorldMatrix() const
+{
+	if (m_worldMatrixOutdated)
+	{
+		m_worldMatrix = HasParent() ? m_parent->GetWorldMatrix() * m_localMatrix : m_localMatrix;
+		m_worldMatrixOutdated = false;
+	}
+}
+
+void OvMaths::FTransform::ResolveWorldDecomposition() const
+{
+	if (m_worldDecompositionOutdated)
+	{
+		ResolveWorldMatrix();
+		PreDecomposeWorldMatrix();
+		m_worldDecompositionOutdated = false;
+	}
 }
 
 void OvMaths::FTransform::SetLocalPosition(FVector3 p_newPosition)
@@ -101,17 +129,17 @@ void OvMaths::FTransform::SetLocalScale(FVector3 p_newScale)
 
 void OvMaths::FTransform::SetWorldPosition(FVector3 p_newPosition)
 {
-	GenerateMatrices(p_newPosition, m_worldRotation, m_worldScale);
+	GenerateMatrices(p_newPosition, GetWorldRotation(), GetWorldScale());
 }
 
 void OvMaths::FTransform::SetWorldRotation(FQuaternion p_newRotation)
 {
-	GenerateMatrices(m_worldPosition, p_newRotation, m_worldScale);
+	GenerateMatrices(GetWorldPosition(), p_newRotation, GetWorldScale());
 }
 
 void OvMaths::FTransform::SetWorldScale(FVector3 p_newScale)
 {
-	GenerateMatrices(m_worldPosition, m_worldRotation, p_newScale);
+	GenerateMatrices(GetWorldPosition(), GetWorldRotation(), p_newScale);
 }
 
 void OvMaths::FTransform::TranslateLocal(const FVector3& p_translation)
@@ -151,16 +179,19 @@ const OvMaths::FVector3& OvMaths::FTransform::GetLocalScale() const
 
 const OvMaths::FVector3& OvMaths::FTransform::GetWorldPosition() const
 {
+	ResolveWorldDecomposition();
 	return m_worldPosition;
 }
 
 const OvMaths::FQuaternion& OvMaths::FTransform::GetWorldRotation() const
 {
+	ResolveWorldDecomposition();
 	return m_worldRotation;
 }
 
 const OvMaths::FVector3& OvMaths::FTransform::GetWorldScale() const
 {
+	ResolveWorldDecomposition();
 	return m_worldScale;
 }
 
@@ -171,22 +202,28 @@ const OvMaths::FMatrix4& OvMaths::FTransform::GetLocalMatrix() const
 
 const OvMaths::FMatrix4& OvMaths::FTransform::GetWorldMatrix() const
 {
+	ResolveWorldMatrix();
 	return m_worldMatrix;
 }
 
+uint64_t OvMaths::FTransform::GetLocalVersion() const
+{
+	return m_localVersion;
+}
+
 OvMaths::FVector3 OvMaths::FTransform::GetWorldForward() const
 {
-	return m_worldRotation * FVector3::Forward;
+	return GetWorldRotation() * FVector3::Forward;
 }
 
 OvMaths::FVector3 OvMaths::FTransform::GetWorldUp() const
 {
-	return m_worldRotation * FVector3::Up;
+	return GetWorldRotation() * FVector3::Up;
 }
 
 OvMaths::FVector3 OvMaths::FTransform::GetWorldRight() const
 {
-	return m_worldRotation * FVector3::Right;
+	return GetWorldRotation() * FVector3::Right;
 }
 
 OvMaths::FVector3 OvMaths::FTransform::GetLocalForward() const
@@ -204,7 +241,7 @@ OvMaths::FVector3 OvMaths::FTransform::GetLocalRight() const
 	return m_localRotation * FVector3::Right;
 }
 
-void OvMaths::FTransform::PreDecomposeWorldMatrix()
+void OvMaths::FTransform::PreDecomposeWorldMatrix() const
 {
 	m_worldPosition.x = m_worldMatrix(0, 3);
 	m_worldPosition.y = m_worldMatrix(1, 3);
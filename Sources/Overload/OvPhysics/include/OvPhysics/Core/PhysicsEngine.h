@@ -7,8 +7,10 @@
 #pragma once
 
 #include <vector>
-#include <map>
+#include <unordered_map>
+#include <unordered_set>
 #include <optional>
+#include <functional>
 
 #include "OvPhysics/Entities/PhysicalObject.h"
 #include "OvPhysics/Settings/PhysicsSettings.h"
@@ -30,13 +32,17 @@ namespace OvPhysics::Core
 		PhysicsEngine(const Settings::PhysicsSettings& p_settings);
 
 		/**
-		* Simulate the physics. This method call is decomposed in 3 things:
-		* - Pre-Update (Apply FTransforms to btTransforms, called every Update call)
-		* - Simulation (Simulate the physics, called 60 times per seconds)
-		* - Post-Update (Apply the simulation results, btTransforms, to FTransforms)
-		* This methods returns true if the call invoked a physics simulation
+		* Simulate the physics. The elapsed time is accumulated and consumed by fixed steps (Up to the max sub-steps setting),
+		* each step being decomposed in 3 things:
+		* - Pre-Update (Apply FTransforms to btTransforms)
+		* - Simulation (Simulate the physics for exactly one fixed time step)
+		* - Post-Update (Apply the simulation results, btTransforms, to FTransforms, then call the given fixed update callback with the fixed time step)
+		* If interpolation is enabled, FTransforms are then set between the last two simulated poses, using the time left in the accumulator.
+		* This methods returns the number of simulated steps
+		* @param p_deltaTime
+		* @param p_fixedUpdate
 		*/
-		bool Update(float p_deltaTime);
+		uint32_t Update(float p_deltaTime, const std::function<void(float)>& p_fixedUpdate = nullptr);
 
 		/* Casts a ray against all Physical Object in the Scene and returns information on what was hit
 		 * @param p_origin
@@ -55,6 +61,11 @@ namespace OvPhysics::Core
 		*/
 		OvMaths::FVector3 GetGravity() const;
 
+		/**
+		* Returns the duration of a simulation step, in seconds
+		*/
+		float GetFixedTimeStep() const;
+
 	private:
 		void PreUpdate();
 		void PostUpdate();
@@ -67,11 +78,32 @@ namespace OvPhysics::Core
 		void Consider(btRigidBody& p_toConsider);
 		void Unconsider(btRigidBody& p_toUnconsider);
 
-		void ResetCollisionEvents();
-		void CheckCollisionStopEvents();
+		void UpdateContacts();
+		void DispatchContactEvents();
+
+	private:
+		enum class EContactState
+		{
+			START,
+			STAY,
+			STOP
+		};
+
+		/* Two physical objects in contact, ordered by address so each pair has a single key */
+		using ContactPair = std::pair<Entities::PhysicalObject*, Entities::PhysicalObject*>;
+
+		struct ContactPairHash
+		{
+			size_t operator()(const ContactPair& p_pair) const;
+		};
+
+		struct ContactEvent
+		{
+			ContactPair pair;
+			EContactState state;
+		};
 
-		static bool CollisionCallback(btManifoldPoint& cp, const btCollisionObjectWrapper* obj1, int id1, int index1, const btCollisionObjectWrapper* obj2, int id2, int index2);
-		void		SetCollisionCallback();
+		static void InvokeContactEvent(Entities::PhysicalObject& p_object, Entities::PhysicalObject& p_other, EContactState p_state);
 
 	private:
 		/* Bullet world */
@@ -81,7 +113,18 @@ namespace OvPhysics::Core
 		std::unique_ptr<btBroadphaseInterface>		m_broadphase;
 		std::unique_ptr<btConstraintSolver>			m_solver;
 
-		static std::map< std::pair<Entities::PhysicalObject*, Entities::PhysicalObject*>, bool> m_collisionEvents;
-		std::vector<std::reference_wrapper<Entities::PhysicalObject>>							m_physicalObjects;
+		/* Fixed time step */
+		const float		m_fixedTimeStep;
+		const uint32_t	m_maxSubSteps;
+		const bool		m_interpolation;
+		double			m_accumulator = 0.0;
+
+		/* Contacts (Pairs in contact, with the last step they were found in) */
+		std::unordered_map<ContactPair, uint64_t, ContactPairHash>		m_contacts;
+		std::vector<ContactEvent>										m_contactEvents;
+		std::unordered_set<Entities::PhysicalObject*>					m_destroyedObjects;
+		uint64_t														m_contactGeneration = 0;
+
+		std::vector<std::reference_wrapper<Entities::PhysicalObject>>	m_physicalObjects;
 	};
 }
@@ -263,6 +263,8 @@ namespace OvPhysics::Entities
 		btRigidBody&			GetBody();
 		void					UpdateBtTransform();
 		void					UpdateFTransform();
+		void					Interpolate(float p_alpha);
+		bool					IsPoseModified() const;
 
 	public:
 		OvTools::Eventing::Event<PhysicalObject&>			CollisionStartEvent;
@@ -289,6 +291,15 @@ namespace OvPhysics::Entities
 		/* Other */
 		std::any m_userData;
 		OvMaths::FVector3 m_previousScale = { 0.0f, 0.0f, 0.0f };
+
+		/* Interpolation (The last two simulated poses, and the transform version when the physics last posed it) */
+		OvMaths::FVector3		m_previousPosition;
+		OvMaths::FQuaternion	m_previousRotation;
+		OvMaths::FVector3		m_currentPosition;
+		OvMaths::FQuaternion	m_currentRotation;
+		uint64_t				m_poseVersion = 0;
+		bool					m_simulated = false;
+		bool					m_interpolated = false;
 		static OvTools::Eventing::Event<PhysicalObject&>	CreatedEvent;
 		static OvTools::Eventing::Event<PhysicalObject&>	DestroyedEvent;
 		static OvTools::Eventing::Event<btRigidBody&>		ConsiderEvent;
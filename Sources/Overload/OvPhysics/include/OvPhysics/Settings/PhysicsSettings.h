@@ -6,6 +6,8 @@
 
 #pragma once
 
+#include <cstdint>
+
 #include <OvMaths/FVector3.h>
 
 namespace OvPhysics::Settings
@@ -16,5 +18,14 @@ namespace OvPhysics::Settings
 	struct PhysicsSettings
 	{
 		OvMaths::FVector3 gravity = { 0.0f, -9.81f, 0.f };
+
+		/* Duration of a simulation step, in seconds. Every step simulates exactly this duration, whatever the frame rate is */
+		float fixedTimeStep = 1.0f / 60.0f;
+
+		/* Maximum number of steps simulated per update. Time the simulation can't catch up with is dropped (Slows the simulation down instead of making frames slower and slower) */
+		uint32_t maxSubSteps = 5;
+
+		/* If true, transforms are interpolated between the last two simulated poses for rendering */
+		bool interpolation = true;
 	};
 }
\ No newline at end of file
@@ -5,6 +5,7 @@
 */
 
 #include <algorithm>
+#include <cmath>
 
 #include "OvPhysics/Core/PhysicsEngine.h"
 #include "OvPhysics/Tools/Conversion.h"
@@ -15,9 +16,10 @@
 using namespace OvPhysics::Tools;
 using namespace OvPhysics::Entities;
 
-std::map< std::pair<PhysicalObject*, PhysicalObject*>, bool> OvPhysics::Core::PhysicsEngine::m_collisionEvents;
-
-OvPhysics::Core::PhysicsEngine::PhysicsEngine(const Settings::PhysicsSettings & p_settings)
+OvPhysics::Core::PhysicsEngine::PhysicsEngine(const Settings::PhysicsSettings & p_settings) :
+	m_fixedTimeStep(std::max(p_settings.fixedTimeStep, 0.001f)),
+	m_maxSubSteps(std::max(p_settings.maxSubSteps, 1u)),
+	m_interpolation(p_settings.interpolation)
 {
 	m_collisionConfig = std::make_unique<btDefaultCollisionConfiguration>();
 	m_dispatcher = std::make_unique<btCollisionDispatcher>(m_collisionConfig.get());
@@ -28,34 +30,53 @@ OvPhysics::Core::PhysicsEngine::PhysicsEngine(const Settings::PhysicsSettings &
 	m_world->setGravity(Conversion::ToBtVector3(p_settings.gravity));
 
 	ListenToPhysicalObjects();
-	SetCollisionCallback();
 }
 
 void OvPhysics::Core::PhysicsEngine::PreUpdate()
 {
 	std::for_each(m_physicalObjects.begin(), m_physicalObjects.end(), std::mem_fn(&PhysicalObject::UpdateBtTransform));
-
-	ResetCollisionEvents();
 }
 
 void OvPhysics::Core::PhysicsEngine::PostUpdate()
 {
 	std::for_each(m_physicalObjects.begin(), m_physicalObjects.end(), std::mem_fn(&PhysicalObject::UpdateFTransform));
 
-	CheckCollisionStopEvents();
+	UpdateContacts();
+	DispatchContactEvents();
 }
 
-bool OvPhysics::Core::PhysicsEngine::Update(float p_deltaTime)
+uint32_t OvPhysics::Core::PhysicsEngine::Update(float p_deltaTime, const std::function<void(float)>& p_fixedUpdate)
 {
-	PreUpdate();
+	m_accumulator += std::max(p_deltaTime, 0.0f);
 
-	if (m_world->stepSimulation(p_deltaTime, 10))
+	uint32_t steps = 0;
+
+	while (m_accumulator >= m_fixedTimeStep && steps < m_maxSubSteps)
 	{
+		PreUpdate();
+		m_world->stepSimulation(m_fixedTimeStep, 0);
 		PostUpdate();
-		return true;
+
+		if (p_fixedUpdate)
+			p_fixedUpdate(m_fixedTimeStep);
+
+		m_accumulator -= m_fixedTimeStep;
+		++steps;
+	}
+
+	/* Too much time to catch up with: the excess is dropped, so a slow frame doesn't make the next ones slower (Spiral of death) */
+	if (m_accumulator >= m_fixedTimeStep)
+		m_accumulator = std::fmod(m_accumulator, static_cast<double>(m_fixedTimeStep));
+
+	if (m_interpolation)
+	{
+		const float alpha = static_cast<float>(m_accumulator / m_fixedTimeStep);
+
+		for (PhysicalObject& physicalObject : m_physicalObjects)
+			physicalObject.Interpolate(alpha);
 	}
 
-	return false;
+	return steps;
 }
 
 std::optional<RaycastHit> OvPhysics::Core::PhysicsEngine::Raycast(OvMaths::FVector3 p_origin, OvMaths::FVector3 p_direction, float p_distance)
@@ -101,6 +122,11 @@ OvMaths::FVector3 OvPhysics::Core::PhysicsEngine::GetGravity() const
 	return Conversion::ToOvVector3(m_world->getGravity());
 }
 
+float OvPhysics::Core::PhysicsEngine::GetFixedTimeStep() const
+{
+	return m_fixedTimeStep;
+}
+
 void OvPhysics::Core::PhysicsEngine::ListenToPhysicalObjects()
 {
 	PhysicalObject::CreatedEvent += std::bind(static_cast<void(PhysicsEngine::*)(PhysicalObject&)>(&PhysicsEngine::Consider), this, std::placeholders::_1);
@@ -127,21 +153,8 @@ void OvPhysics::Core::PhysicsEngine::Unconsider(PhysicalObject& p_toUnconsider)
 			m_physicalObjects.erase(found);
 	}
 
-	{
-		decltype(m_collisionEvents)::iterator iter = m_collisionEvents.begin();
-		decltype(m_collisionEvents)::iterator endIter = m_collisionEvents.end();
-
-		for (; iter != endIter; )
-		{
-			if (iter->first.first == std::addressof(p_toUnconsider) || iter->first.second == std::addressof(p_toUnconsider))
-			{
-				m_collisionEvents.erase(iter++);
-			}
-			else {
-				++iter;
-			}
-		}
-	}
+	/* Contacts involving this object are dropped before the next contacts update (Or skipped if their events are being dispatched) */
+	m_destroyedObjects.insert(std::addressof(p_toUnconsider));
 }
 
 void OvPhysics::Core::PhysicsEngine::Consider(btRigidBody& p_toConsider)
@@ -154,122 +167,120 @@ void OvPhysics::Core::PhysicsEngine::Unconsider(btRigidBody& p_toUnconsider)
 	m_world->removeRigidBody(&p_toUnconsider);
 }
 
-void OvPhysics::Core::PhysicsEngine::ResetCollisionEvents()
+size_t OvPhysics::Core::PhysicsEngine::ContactPairHash::operator()(const ContactPair& p_pair) const
 {
-	for (auto& element : m_collisionEvents)
-		element.second = false;
+	const size_t first = std::hash<PhysicalObject*>{}(p_pair.first);
+	const size_t second = std::hash<PhysicalObject*>{}(p_pair.second);
+	return first ^ (second + 0x9e3779b9 + (first << 6) + (first >> 2));
 }
 
-void OvPhysics::Core::PhysicsEngine::CheckCollisionStopEvents()
+void OvPhysics::Core::PhysicsEngine::UpdateContacts()
 {
-	for (auto it = m_collisionEvents.begin(); it != m_collisionEvents.end();)
+	if (!m_destroyedObjects.empty())
 	{
-		auto objects = it->first;
-		if (!it->second)
+		for (auto it = m_contacts.begin(); it != m_contacts.end();)
 		{
-			if (!objects.first->IsTrigger() && !objects.second->IsTrigger())
-			{
-				objects.first->CollisionStopEvent.Invoke(*objects.second);
-				objects.second->CollisionStopEvent.Invoke(*objects.first);
-			}
+			if (m_destroyedObjects.find(it->first.first) != m_destroyedObjects.end() || m_destroyedObjects.find(it->first.second) != m_destroyedObjects.end())
+				it = m_contacts.erase(it);
 			else
-			{
-				if (objects.first->IsTrigger())
-					objects.first->TriggerStopEvent.Invoke(*objects.second);
-				else
-					objects.second->TriggerStopEvent.Invoke(*objects.first);
-			}
-
-			it = m_collisionEvents.erase(it);
+				++it;
+		}
+
+		m_destroyedObjects.clear();
+	}
+
+	++m_contactGeneration;
+
+	/* Pairs touching after this step, read from the persistent manifolds Bullet maintains */
+	for (int i = 0, manifoldCount = m_dispatcher->getNumManifolds(); i < manifoldCount; ++i)
+	{
+		const btPersistentManifold* manifold = m_dispatcher->getManifoldByIndexInternal(i);
+
+		if (manifold->getNumContacts() == 0)
+			continue;
+
+		auto first = static_cast<PhysicalObject*>(manifold->getBody0()->getUserPointer());
+		auto second = static_cast<PhysicalObject*>(manifold->getBody1()->getUserPointer());
+
+		/* Triggers don't interact with each other */
+		if (!first || !second || (first->IsTrigger() && second->IsTrigger()))
+			continue;
+
+		if (std::less<PhysicalObject*>{}(second, first))
+			std::swap(first, second);
+
+		auto [contact, inserted] = m_contacts.try_emplace({ first, second }, m_contactGeneration);
+
+		if (inserted)
+		{
+			m_contactEvents.push_back({ contact->first, EContactState::START });
+		}
+		else if (contact->second != m_contactGeneration) // A pair can have multiple manifolds
+		{
+			contact->second = m_contactGeneration;
+			m_contactEvents.push_back({ contact->first, EContactState::STAY });
+		}
+	}
+
+	/* Pairs not found in this step aren't touching anymore */
+	for (auto it = m_contacts.begin(); it != m_contacts.end();)
+	{
+		if (it->second != m_contactGeneration)
+		{
+			m_contactEvents.push_back({ it->first, EContactState::STOP });
+			it = m_contacts.erase(it);
 		}
 		else
 			++it;
 	}
 }
 
-bool OvPhysics::Core::PhysicsEngine::CollisionCallback(btManifoldPoint& cp, const btCollisionObjectWrapper* obj1, int id1, int index1, const btCollisionObjectWrapper* obj2, int id2, int index2)
+void OvPhysics::Core::PhysicsEngine::DispatchContactEvents()
 {
-	auto object1 = reinterpret_cast<PhysicalObject*>(obj1->getCollisionObject()->getUserPointer());
-	auto object2 = reinterpret_cast<PhysicalObject*>(obj2->getCollisionObject()->getUserPointer());
-
-	if (object1 && object2)
+	/* Indexed loop: listeners can destroy objects, which only marks them as destroyed */
+	for (size_t i = 0; i < m_contactEvents.size(); ++i)
 	{
-		/* If the objects are not all trigger, enter */
-		if (!object1->IsTrigger() || !object2->IsTrigger())
+		const auto [pair, state] = m_contactEvents[i];
+
+		if (!m_destroyedObjects.empty() && (m_destroyedObjects.find(pair.first) != m_destroyedObjects.end() || m_destroyedObjects.find(pair.second) != m_destroyedObjects.end()))
+			continue;
+
+		if (state == EContactState::START)
 		{
-			if (m_collisionEvents.find({ object1 , object2 }) == m_collisionEvents.end())
-			{
-				/* If object is trigger, invoke Trigger event,
-				 * else : is the other object trigger ? yes -> do nothing, no -> invoke Collision event
-				 */
-
-				 // Object 1 (Start event)
-				if (object1->IsTrigger())
-					object1->TriggerStartEvent.Invoke(*object2);
-				else
-				{
-					if (!object2->IsTrigger())
-						object1->CollisionStartEvent.Invoke(*object2);
-				}
-				// Object 2 (Start event)
-				if (object2->IsTrigger())
-					object2->TriggerStartEvent.Invoke(*object1);
-				else
-				{
-					if (!object1->IsTrigger())
-						object2->CollisionStartEvent.Invoke(*object1);
-				}
-
-				// Object 1 (Stay event)
-				if (object1->IsTrigger())
-					object1->TriggerStayEvent.Invoke(*object2);
-				else
-				{
-					if (!object2->IsTrigger())
-						object1->CollisionStayEvent.Invoke(*object2);
-				}
-				// Object 2 (Stay event)
-				if (object2->IsTrigger())
-					object2->TriggerStayEvent.Invoke(*object1);
-				else
-				{
-					if (!object1->IsTrigger())
-						object2->CollisionStayEvent.Invoke(*object1);
-				}
-
-				m_collisionEvents[{ object1, object2 }] = true;
-			}
-			else
-			{
-				if (!m_collisionEvents[{ object1, object2 }])
-				{
-					// Object 1 (Stay event)
-					if (object1->IsTrigger())
-						object1->TriggerStayEvent.Invoke(*object2);
-					else
-					{
-						if (!object2->IsTrigger())
-							object1->CollisionStayEvent.Invoke(*object2);
-					}
-					// Object 2 (Stay event)
-					if (object2->IsTrigger())
-						object2->TriggerStayEvent.Invoke(*object1);
-					else
-					{
-						if (!object1->IsTrigger())
-							object2->CollisionStayEvent.Invoke(*object1);
-					}
-
-					m_collisionEvents[{ object1, object2 }] = true;
-				}
-			}
+			InvokeContactEvent(*pair.first, *pair.second, EContactState::START);
+			InvokeContactEvent(*pair.second, *pair.first, EContactState::START);
+			InvokeContactEvent(*pair.first, *pair.second, EContactState::STAY);
+			InvokeContactEvent(*pair.second, *pair.first, EContactState::STAY);
+		}
+		else
+		{
+			InvokeContactEvent(*pair.first, *pair.second, state);
+			InvokeContactEvent(*pair.second, *pair.first, state);
 		}
 	}
 
-	return false;
+	m_contactEvents.clear();
 }
 
-void OvPhysics::Core::PhysicsEngine::SetCollisionCallback()
+void OvPhysics::Core::PhysicsEngine::InvokeContactEvent(PhysicalObject& p_object, PhysicalObject& p_other, EContactState p_state)
 {
-	gContactAddedCallback = &PhysicsEngine::CollisionCallback;
+	/* A trigger receives trigger events, an object touching a trigger receives nothing, other objects receive collision events */
+	if (p_object.IsTrigger())
+	{
+		switch (p_state)
+		{
+		case EContactState::START:	p_object.TriggerStartEvent.Invoke(p_other);	break;
+		case EContactState::STAY:	p_object.TriggerStayEvent.Invoke(p_other);	break;
+		case EContactState::STOP:	p_object.TriggerStopEvent.Invoke(p_other);	break;
+		}
+	}
+	else if (!p_other.IsTrigger())
+	{
+		switch (p_state)
+		{
+		case EContactState::START:	p_object.CollisionStartEvent.Invoke(p_other);	break;
+		case EContactState::STAY:	p_object.CollisionStayEvent.Invoke(p_other);	break;
+		case EContactState::STOP:	p_object.CollisionStopEvent.Invoke(p_other);	break;
+		}
+	}
 }
@@ -233,6 +233,18 @@ bool OvPhysics::Entities::PhysicalObject::IsEnabled() const
 
 void OvPhysics::Entities::PhysicalObject::UpdateBtTransform()
 {
+	/* If the transform still holds the interpolated pose (Nobody moved it since), the simulation continues from its own last pose */
+	if (m_interpolated)
+	{
+		if (!IsPoseModified())
+		{
+			m_transform->SetLocalPosition(m_currentPosition);
+			m_transform->SetLocalRotation(m_currentRotation);
+		}
+
+		m_interpolated = false;
+	}
+
 	m_body->setWorldTransform(Conversion::ToBtTransform(*m_transform));
 
 	if (OvMaths::FVector3::Distance(m_transform->GetWorldScale(), m_previousScale) >= 0.01f)
@@ -247,10 +259,43 @@ void OvPhysics::Entities::PhysicalObject::UpdateFTransform()
 {
 	if (!m_kinematic)
 	{
+		/* The step started from the transform pose (Which can differ from the last simulated one if the object was moved) */
+		m_previousPosition = m_transform->GetLocalPosition();
+		m_previousRotation = m_transform->GetLocalRotation();
+
 		const btTransform& result = m_body->getWorldTransform();
-		m_transform->SetLocalPosition(Conversion::ToOvVector3(result.getOrigin()));
-		m_transform->SetLocalRotation(Conversion::ToOvQuaternion(result.getRotation()));
+		m_currentPosition = Conversion::ToOvVector3(result.getOrigin());
+		m_currentRotation = Conversion::ToOvQuaternion(result.getRotation());
+		m_simulated = true;
+
+		m_transform->SetLocalPosition(m_currentPosition);
+		m_transform->SetLocalRotation(m_currentRotation);
+		m_poseVersion = m_transform->GetLocalVersion();
+	}
+}
+
+void OvPhysics::Entities::PhysicalObject::Interpolate(float p_alpha)
+{
+	if (m_kinematic || !m_simulated)
+		return;
+
+	/* An object moved since the physics last posed it (By a fixed update for instance) keeps the pose it was given */
+	if (IsPoseModified())
+	{
+		m_interpolated = false;
+		return;
 	}
+
+	m_interpolated = true;
+
+	m_transform->SetLocalPosition(OvMaths::FVector3::Lerp(m_previousPosition, m_currentPosition, p_alpha));
+	m_transform->SetLocalRotation(OvMaths::FQuaternion::Slerp(m_previousRotation, m_currentRotation, p_alpha));
+	m_poseVersion = m_transform->GetLocalVersion();
+}
+
+bool OvPhysics::Entities::PhysicalObject::IsPoseModified() const
+{
+	return m_transform->GetLocalVersion() != m_poseVersion;
 }
 
 void OvPhysics::Entities::PhysicalObject::RecreateBody()
@@ -297,8 +342,6 @@ void OvPhysics::Entities::PhysicalObject::CreateBody(const Settings::BodySetting
 	m_body->setAngularFactor(p_bodySettings.angularFactor);
 	m_body->setUserPointer(this);
 
-	AddFlag(btCollisionObject::CF_CUSTOM_MATERIAL_CALLBACK);
-
 	if (p_bodySettings.isTrigger)
 		AddFlag(btCollisionObject::CF_NO_CONTACT_RESPONSE);
 
@@ -0,0 +1,19 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#pragma once
+
+namespace OvRendering::Buffers
+{
+	/**
+	* Defines the indexed targets that buffers can be bound to
+	*/
+	enum class EBufferTarget
+	{
+		UNIFORM_BUFFER			= 0x8A11,
+		SHADER_STORAGE_BUFFER	= 0x90D2
+	};
+}
@@ -25,6 +25,13 @@ namespace OvRendering::Buffers
 		*/
 		IndexBuffer(unsigned int* p_data, size_t p_elements);
 
+		/**
+		* Create the EBO using a pointer to the first 16 bits element and a size (number of elements)
+		* @param p_data
+		* @parma p_elements
+		*/
+		IndexBuffer(const uint16_t* p_data, size_t p_elements);
+
 		/**
 		* Create the EBO using a vector
 		* @param p_data
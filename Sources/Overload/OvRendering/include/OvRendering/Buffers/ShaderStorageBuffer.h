@@ -48,6 +48,11 @@ namespace OvRendering::Buffers
 		template<typename T>
 		void SendBlocks(T* p_data, size_t p_size);
 
+		/**
+		* Return the ID of the SSBO
+		*/
+		uint32_t GetID() const;
+
 	private:
 		uint32_t m_bufferID;
 		uint32_t m_bindingPoint = 0;
@@ -62,6 +62,14 @@ namespace OvRendering::Buffers
 		template<typename T>
 		void SetSubData(const T& p_data, std::reference_wrapper<size_t> p_offsetInOut);
 
+		/**
+		* Set p_size bytes of the UBO, starting at p_offset, to the given raw data
+		* @param p_data
+		* @param p_size
+		* @param p_offset
+		*/
+		void SetSubData(const void* p_data, size_t p_size, size_t p_offset);
+
 		/**
 		* Return the ID of the UBO
 		*/
@@ -0,0 +1,29 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#pragma once
+
+#include "OvRendering/Context/IGLCalls.h"
+
+namespace OvRendering::Context
+{
+	/**
+	* Forwards the state changing calls to OpenGL
+	*/
+	class GLCalls final : public IGLCalls
+	{
+	public:
+		virtual void UseProgram(uint32_t p_program) override;
+		virtual void BindVertexArray(uint32_t p_vertexArray) override;
+		virtual void ActiveTexture(uint32_t p_unit) override;
+		virtual void BindTexture2D(uint32_t p_texture) override;
+		virtual void BindBufferBase(Buffers::EBufferTarget p_target, uint32_t p_index, uint32_t p_buffer) override;
+		virtual void SetCapability(Settings::ERenderingCapability p_capability, bool p_value) override;
+		virtual void DepthMask(bool p_enable) override;
+		virtual void ColorMask(bool p_red, bool p_green, bool p_blue, bool p_alpha) override;
+		virtual void CullFace(Settings::ECullFace p_cullFace) override;
+	};
+}
@@ -0,0 +1,36 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#pragma once
+
+#include <stdint.h>
+
+#include "OvRendering/Buffers/EBufferTarget.h"
+#include "OvRendering/Settings/ERenderingCapability.h"
+#include "OvRendering/Settings/ECullFace.h"
+
+namespace OvRendering::Context
+{
+	/**
+	* Interface for the OpenGL calls that change the state tracked by the GLStateCache.
+	* Implemented by GLCalls to reach OpenGL, and can be implemented by a fake to observe the calls without any context
+	*/
+	class IGLCalls
+	{
+	public:
+		virtual void UseProgram(uint32_t p_program) = 0;
+		virtual void BindVertexArray(uint32_t p_vertexArray) = 0;
+		virtual void ActiveTexture(uint32_t p_unit) = 0;
+		virtual void BindTexture2D(uint32_t p_texture) = 0;
+		virtual void BindBufferBase(Buffers::EBufferTarget p_target, uint32_t p_index, uint32_t p_buffer) = 0;
+		virtual void SetCapability(Settings::ERenderingCapability p_capability, bool p_value) = 0;
+		virtual void DepthMask(bool p_enable) = 0;
+		virtual void ColorMask(bool p_red, bool p_green, bool p_blue, bool p_alpha) = 0;
+		virtual void CullFace(Settings::ECullFace p_cullFace) = 0;
+
+		virtual ~IGLCalls() = default;
+	};
+}
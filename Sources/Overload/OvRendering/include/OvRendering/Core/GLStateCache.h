@@ -0,0 +1,135 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#pragma once
+
+#include <array>
+#include <optional>
+
+#include "OvRendering/Context/IGLCalls.h"
+
+namespace OvRendering::Core
+{
+	/**
+	* Keeps track of the OpenGL bindings and fixed-function state it changed (Program, vertex array, texture units,
+	* indexed UBO/SSBO bindings, capabilities, depth/color writing and cull face) and skips the calls that would set
+	* a value that is already in place.
+	* Any state changed without going through the cache makes it wrong, so Invalidate() must be called after
+	* OpenGL has been used directly (The next requests are then always issued)
+	*/
+	class GLStateCache
+	{
+	public:
+		static constexpr uint32_t kTextureUnitCount = 32;
+		static constexpr uint32_t kBufferBindingCount = 16;
+
+		/**
+		* Number of state changing calls sent to OpenGL and skipped because redundant
+		*/
+		struct Counters
+		{
+			uint64_t issuedCalls	= 0;
+			uint64_t skippedCalls	= 0;
+		};
+
+		/**
+		* Constructor
+		* @param p_calls
+		*/
+		GLStateCache(Context::IGLCalls& p_calls);
+
+		/**
+		* Forget every tracked value
+		*/
+		void Invalidate();
+
+		/**
+		* Use the given program
+		* @param p_program
+		*/
+		void UseProgram(uint32_t p_program);
+
+		/**
+		* Bind the given vertex array
+		* @param p_vertexArray
+		*/
+		void BindVertexArray(uint32_t p_vertexArray);
+
+		/**
+		* Bind the given 2D texture to the given texture unit
+		* @param p_unit
+		* @param p_texture
+		*/
+		void BindTexture(uint32_t p_unit, uint32_t p_texture);
+
+		/**
+		* Bind the given buffer to the given index of an indexed target
+		* @param p_target
+		* @param p_index
+		* @param p_buffer
+		*/
+		void BindBufferBase(Buffers::EBufferTarget p_target, uint32_t p_index, uint32_t p_buffer);
+
+		/**
+		* Enable or disable an OpenGL capability
+		* @param p_capability
+		* @param p_value
+		*/
+		void SetCapability(Settings::ERenderingCapability p_capability, bool p_value);
+
+		/**
+		* Enable or disable writing into the depth buffer
+		* @param p_enable
+		*/
+		void SetDepthWriting(bool p_enable);
+
+		/**
+		* Enable and disable writing color individual components into the frame buffer
+		* @param p_enableRed
+		* @param p_enableGreen
+		* @param p_enableBlue
+		* @param p_enableAlpha
+		*/
+		void SetColorWriting(bool p_enableRed, bool p_enableGreen, bool p_enableBlue, bool p_enableAlpha);
+
+		/**
+		* Defines the culling faces
+		* @param p_cullFace
+		*/
+		void SetCullFace(Settings::ECullFace p_cullFace);
+
+		/**
+		* Returns the calls counters
+		*/
+		const Counters& GetCounters() const;
+
+		/**
+		* Reset the calls counters
+		*/
+		void ResetCounters();
+
+	private:
+		template<typename T>
+		bool Update(std::optional<T>& p_current, const T& p_value);
+
+	private:
+		Context::IGLCalls& m_calls;
+		Counters m_counters;
+
+		std::optional<uint32_t> m_program;
+		std::optional<uint32_t> m_vertexArray;
+		std::optional<uint32_t> m_activeTexture;
+		std::array<std::optional<uint32_t>, kTextureUnitCount> m_textures;
+		std::array<std::optional<uint32_t>, kBufferBindingCount> m_uniformBuffers;
+		std::array<std::optional<uint32_t>, kBufferBindingCount> m_storageBuffers;
+		std::array<std::optional<bool>, 10> m_capabilities;
+		std::optional<bool> m_depthWriting;
+		std::optional<uint8_t> m_colorWriting;
+		std::optional<Settings::ECullFace> m_cullFace;
+	};
+}
+
+#include "OvRendering/Core/GLStateCache.inl"
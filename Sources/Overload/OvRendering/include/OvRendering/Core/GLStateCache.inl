@@ -0,0 +1,26 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#pragma once
+
+#include "OvRendering/Core/GLStateCache.h"
+
+namespace OvRendering::Core
+{
+	template<typename T>
+	inline bool GLStateCache::Update(std::optional<T>& p_current, const T& p_value)
+	{
+		if (p_current == p_value)
+		{
+			++m_counters.skippedCalls;
+			return false;
+		}
+
+		p_current = p_value;
+		++m_counters.issuedCalls;
+		return true;
+	}
+}
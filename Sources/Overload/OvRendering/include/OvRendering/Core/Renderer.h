@@ -9,6 +9,8 @@
 #include <optional>
 
 #include "OvRendering/Context/Driver.h"
+#include "OvRendering/Context/GLCalls.h"
+#include "OvRendering/Core/GLStateCache.h"
 #include "OvRendering/LowRenderer/Camera.h"
 #include "OvRendering/Resources/Shader.h"
 #include "OvRendering/Resources/Model.h"
@@ -39,6 +41,8 @@ namespace OvRendering::Core
 			uint64_t batchCount		= 0;
 			uint64_t instanceCount	= 0;
 			uint64_t polyCount		= 0;
+			uint64_t issuedGLCalls	= 0; // State changing calls sent to OpenGL through the state cache
+			uint64_t skippedGLCalls	= 0; // State changing calls skipped by the state cache because redundant
 		};
 
 		/**
@@ -47,6 +51,13 @@ namespace OvRendering::Core
 		*/
 		Renderer(Context::Driver& p_driver);
 
+		/**
+		* Constructor of a Renderer without driver, sending the state changes it tracks to the given calls
+		* instead of OpenGL (e.g. a fake recording them). Only the state cache and the frame info can be used
+		* @param p_calls
+		*/
+		explicit Renderer(Context::IGLCalls& p_calls);
+
 		/**
 		* Constructor of the Renderer
 		*/
@@ -290,7 +301,27 @@ namespace OvRendering::Core
 		);
 
 		/**
-		* Fetch and returns the actual OpenGL state
+		* Fill the given vector with the meshes from a model that should be rendered (The vector is cleared first)
+		* @param p_result
+		* @param p_model
+		* @param p_modelBoundingSphere
+		* @param p_modelTransform
+		* @param p_frustum
+		* @param p_cullingOptions
+		*/
+		static void GetMeshesInFrustum
+		(
+			std::vector<std::reference_wrapper<OvRendering::Resources::Mesh>>& p_result,
+			const OvRendering::Resources::Model& p_model,
+			const OvRendering::Geometry::BoundingSphere& p_modelBoundingSphere,
+			const OvMaths::FTransform& p_modelTransform,
+			const OvRendering::Data::Frustum& p_frustum,
+			OvRendering::Settings::ECullingOptions p_cullingOptions
+		);
+
+		/**
+		* Fetch and returns the actual OpenGL state. The state cache is invalidated, as OpenGL may
+		* have been used without going through it
 		*/
 		uint8_t FetchGLState();
 
@@ -311,9 +342,16 @@ namespace OvRendering::Core
 		*/
 		const FrameInfo& GetFrameInfo() const;
 
+		/**
+		* Returns the state cache used to bind programs, vertex arrays, textures and buffers without redundant calls
+		*/
+		GLStateCache& GetStateCache();
+
 	private:
-		Context::Driver&	m_driver;
-		FrameInfo			m_frameInfo;
+		Context::Driver*	m_driver; // Null for a renderer created without driver
+		Context::GLCalls	m_glCalls;
+		GLStateCache		m_stateCache;
+		mutable FrameInfo	m_frameInfo; // GL calls counters are gathered from the state cache when requested
 		uint8_t				m_state;
 	};
 }
\ No newline at end of file
@@ -7,6 +7,7 @@
 #pragma once
 
 #include <array>
+#include <cstdint>
 
 #include <OvMaths/FMatrix4.h>
 #include <OvMaths/FTransform.h>
@@ -61,6 +62,26 @@ namespace OvRendering::Data
 		*/
 		bool BoundingSphereInFrustum(const OvRendering::Geometry::BoundingSphere& p_boundingSphere, const OvMaths::FTransform& p_transform) const;
 
+		/**
+		* Test a batch of world space spheres (Given as structure of arrays) against the frustum.
+		* Bit (i % 32) of p_visibility[i / 32] is set if the sphere i is in frustum, with the exact same result as SphereInFrustum.
+		* Uses AVX2 or SSE2 when enabled at compile time, a scalar loop otherwise
+		* @param p_x
+		* @param p_y
+		* @param p_z
+		* @param p_radii
+		* @param p_count
+		* @param p_visibility (Must hold at least (p_count + 31) / 32 elements)
+		*/
+		void SpheresInFrustum(const float* p_x, const float* p_y, const float* p_z, const float* p_radii, size_t p_count, uint32_t* p_visibility) const;
+
+		/**
+		* Returns the given bounding sphere in world space
+		* @param p_boundingSphere
+		* @param p_transform
+		*/
+		static OvRendering::Geometry::BoundingSphere TransformBoundingSphere(const OvRendering::Geometry::BoundingSphere& p_boundingSphere, const OvMaths::FTransform& p_transform);
+
 		/**
 		* Returns the near plane
 		*/
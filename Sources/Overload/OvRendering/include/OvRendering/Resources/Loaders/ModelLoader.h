@@ -10,6 +10,7 @@
 
 #include "OvRendering/Resources/Model.h"
 #include "OvRendering/Resources/Parsers/AssimpParser.h"
+#include "OvRendering/Resources/Parsers/CookedModelParser.h"
 
 namespace OvRendering::Resources::Loaders
 {
@@ -31,6 +32,21 @@ namespace OvRendering::Resources::Loaders
 		*/
 		static Model* Create(const std::string& p_filepath, Parsers::EModelParserFlags p_parserFlags = Parsers::EModelParserFlags::NONE);
 
+		/**
+		* Parse a model without uploading its meshes to the GPU (See Upload).
+		* The cooked model is read if it is up to date, otherwise the source file is imported and cooked.
+		* Doesn't require any rendering context, so it can be called from any thread
+		* @param p_filepath
+		* @param p_parserFlags
+		*/
+		static Model* Parse(const std::string& p_filepath, Parsers::EModelParserFlags p_parserFlags = Parsers::EModelParserFlags::NONE);
+
+		/**
+		* Create the GPU buffers of a model returned by Parse
+		* @param p_model
+		*/
+		static void Upload(Model& p_model);
+
 		/**
 		* Reload a model from file
 		* @param p_model
@@ -47,5 +63,6 @@ namespace OvRendering::Resources::Loaders
 
 	private:
 		static Parsers::AssimpParser __ASSIMP;
+		static Parsers::CookedModelParser __COOKED;
 	};
 }
\ No newline at end of file
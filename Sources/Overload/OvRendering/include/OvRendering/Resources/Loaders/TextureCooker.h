@@ -0,0 +1,96 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#pragma once
+
+#include <string>
+
+#include "OvRendering/Resources/Loaders/TextureLoader.h"
+
+namespace OvRendering::Resources::Loaders
+{
+	/**
+	* CPU side texture processing (Mip chain generation, block compression) and cooked textures: a versioned
+	* binary image of a processed texture stored next to its source file, keyed by the source size, write time and content
+	* hash and by the texture settings. Nothing here requires a rendering context
+	*/
+	class TextureCooker
+	{
+	public:
+		/**
+		* Disabled constructor
+		*/
+		TextureCooker() = delete;
+
+		/**
+		* Replace the levels of an uncompressed texture by its full mip chain, from the first level down to 1x1.
+		* Each mip is a 2x2 box filter of the previous one
+		* @param p_data
+		* @param p_threadPool (Optional, rows are split over the pool)
+		*/
+		static void GenerateMipChain(TextureData& p_data, OvTools::Utils::ThreadPool* p_threadPool = nullptr);
+
+		/**
+		* Compress every level of an uncompressed texture into the given format
+		* @param p_data
+		* @param p_compression
+		* @param p_threadPool (Optional, block rows are split over the pool)
+		*/
+		static void Compress(TextureData& p_data, Settings::ETextureCompression p_compression, OvTools::Utils::ThreadPool* p_threadPool = nullptr);
+
+		/**
+		* Encode a 4x4 block of RGBA8 pixels (Row major) into the given format.
+		* Writes GetBlockSize(p_compression) bytes
+		* @param p_pixels
+		* @param p_compression (Must not be NONE)
+		* @param p_output
+		*/
+		static void EncodeBlock(const uint8_t* p_pixels, Settings::ETextureCompression p_compression, uint8_t* p_output);
+
+		/**
+		* Returns the size in bytes of a 4x4 block in the given format (Or of a pixel if the format is NONE)
+		* @param p_compression
+		*/
+		static size_t GetBlockSize(Settings::ETextureCompression p_compression);
+
+		/**
+		* Returns the size in bytes of a level with the given dimensions
+		* @param p_width
+		* @param p_height
+		* @param p_compression
+		*/
+		static size_t GetLevelSize(uint32_t p_width, uint32_t p_height, Settings::ETextureCompression p_compression);
+
+		/**
+		* Load the cooked texture of the given source file. Levels point into the mapped cooked file.
+		* Returns false if there is no cooked texture, or if it is outdated (Source content or settings changed since cooking).
+		* The source is only hashed if its size is unchanged but its write time changed
+		* @param p_filepath (Source file)
+		* @param p_outData
+		* @param p_firstFilter
+		* @param p_secondFilter
+		* @param p_generateMipmap
+		* @param p_compression
+		*/
+		static bool LoadCooked(const std::string& p_filepath, TextureData& p_outData, Settings::ETextureFilteringMode p_firstFilter, Settings::ETextureFilteringMode p_secondFilter, bool p_generateMipmap, Settings::ETextureCompression p_compression);
+
+		/**
+		* Write the cooked texture of the given source file. Returns true on success
+		* @param p_filepath (Source file)
+		* @param p_data
+		* @param p_firstFilter
+		* @param p_secondFilter
+		* @param p_generateMipmap
+		*/
+		static bool Cook(const std::string& p_filepath, const TextureData& p_data, Settings::ETextureFilteringMode p_firstFilter, Settings::ETextureFilteringMode p_secondFilter, bool p_generateMipmap);
+
+		/**
+		* Returns the path of the cooked texture of the given source file
+		* @param p_filepath
+		*/
+		static std::string GetCookedPath(const std::string& p_filepath);
+	};
+}
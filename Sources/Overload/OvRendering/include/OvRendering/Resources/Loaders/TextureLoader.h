@@ -6,14 +6,43 @@
 
 #pragma once
 
+#include <memory>
 #include <string>
 #include <vector>
 
 #include "OvRendering/Resources/Texture.h"
+#include "OvRendering/Settings/ETextureCompression.h"
+
+namespace OvTools::Utils { class ThreadPool; }
 
 
 namespace OvRendering::Resources::Loaders
 {
+	/**
+	* Pixels of one mip level, either RGBA8 pixels or compressed blocks
+	*/
+	struct TextureLevel
+	{
+		uint32_t width = 0;
+		uint32_t height = 0;
+		const uint8_t* data = nullptr;
+		size_t size = 0;
+	};
+
+	/**
+	* Decoded image waiting to be uploaded to the GPU. Levels are ordered from the full resolution image
+	* to the smallest mip, and point into the storage (A decoding buffer or a mapped cooked texture)
+	*/
+	struct TextureData
+	{
+		uint32_t width = 0;
+		uint32_t height = 0;
+		uint32_t bitsPerPixel = 0;
+		Settings::ETextureCompression compression = Settings::ETextureCompression::NONE;
+		std::vector<TextureLevel> levels;
+		std::shared_ptr<const void> storage;
+	};
+
 	/**
 	* Handle the Texture creation and destruction
 	*/
@@ -31,8 +60,35 @@ namespace OvRendering::Resources::Loaders
 		* @param p_firstFilter
 		* @param p_secondFilter
 		* @param p_generateMipmap
+		* @param p_compression
+		*/
+		static Texture* Create(const std::string& p_filepath, OvRendering::Settings::ETextureFilteringMode p_firstFilter, OvRendering::Settings::ETextureFilteringMode p_secondFilter, bool p_generateMipmap, OvRendering::Settings::ETextureCompression p_compression = OvRendering::Settings::ETextureCompression::NONE);
+
+		/**
+		* Read an image file without creating any texture (See Upload).
+		* The cooked texture is read if it is up to date, otherwise the image is decoded, its mip chain is
+		* generated and compressed, and the result is cooked for the next loads (See TextureCooker).
+		* Doesn't require any rendering context, so it can be called from any thread.
+		* Returns false if the file can't be decoded
+		* @param p_filepath
+		* @param p_outData
+		* @param p_firstFilter
+		* @param p_secondFilter
+		* @param p_generateMipmap
+		* @param p_compression
+		*/
+		static bool Decode(const std::string& p_filepath, TextureData& p_outData, OvRendering::Settings::ETextureFilteringMode p_firstFilter, OvRendering::Settings::ETextureFilteringMode p_secondFilter, bool p_generateMipmap, OvRendering::Settings::ETextureCompression p_compression = OvRendering::Settings::ETextureCompression::NONE);
+
+		/**
+		* Create a texture from decoded image data.
+		* Mips are generated by the driver only if a mipmapped texture has a single uncompressed level
+		* @param p_filepath
+		* @param p_data
+		* @param p_firstFilter
+		* @param p_secondFilter
+		* @param p_generateMipmap
 		*/
-		static Texture* Create(const std::string& p_filepath, OvRendering::Settings::ETextureFilteringMode p_firstFilter, OvRendering::Settings::ETextureFilteringMode p_secondFilter, bool p_generateMipmap);
+		static Texture* Upload(const std::string& p_filepath, const TextureData& p_data, OvRendering::Settings::ETextureFilteringMode p_firstFilter, OvRendering::Settings::ETextureFilteringMode p_secondFilter, bool p_generateMipmap);
 
 		/**
 		* Create a texture from a single pixel color
@@ -61,13 +117,24 @@ namespace OvRendering::Resources::Loaders
 		* @param p_firstFilter
 		* @param p_secondFilter
 		* @param p_generateMipmap
+		* @param p_compression
 		*/
-		static void Reload(Texture& p_texture, const std::string& p_filePath, OvRendering::Settings::ETextureFilteringMode p_firstFilter, OvRendering::Settings::ETextureFilteringMode p_secondFilter, bool p_generateMipmap);
+		static void Reload(Texture& p_texture, const std::string& p_filePath, OvRendering::Settings::ETextureFilteringMode p_firstFilter, OvRendering::Settings::ETextureFilteringMode p_secondFilter, bool p_generateMipmap, OvRendering::Settings::ETextureCompression p_compression = OvRendering::Settings::ETextureCompression::NONE);
 
 		/**
 		* Destroy a texture
 		* @param p_textureInstance
 		*/
 		static bool Destroy(Texture*& p_textureInstance);
+
+		/**
+		* Provide the thread pool used to generate and compress mip chains when cooking textures (nullptr to cook serially).
+		* Cooking dispatches on the pool from the loading thread, so only provide a pool that thread doesn't compete for
+		* @param p_threadPool
+		*/
+		static void ProvideThreadPool(OvTools::Utils::ThreadPool* p_threadPool);
+
+	private:
+		static OvTools::Utils::ThreadPool* __THREAD_POOL;
 	};
 }
\ No newline at end of file
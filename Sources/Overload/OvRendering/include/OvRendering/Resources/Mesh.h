@@ -39,8 +39,54 @@ namespace OvRendering::Resources
 		Mesh();
 		Mesh(std::vector<Geometry::Vertex>& p_vertices, const std::vector<uint32_t>& p_indices, uint32_t p_materialIndex, bool hasBone = false);
 
+		/**
+		* Initialize the mesh with the given vertices, indices and material index, then upload it to the GPU
+		* @param p_vertices
+		* @param p_indices
+		* @param p_materialIndex
+		* @param rigInfo
+		*/
 		template<class T>
 		void Init(std::vector<T>& p_vertices, const std::vector<uint32_t>& p_indices, uint32_t p_materialIndex, MeshRigInfo* rigInfo = nullptr);
+
+		/**
+		* Initialize the mesh with the given vertices, indices and material index without creating any GPU buffer.
+		* The vertices are packed into a staging buffer kept until Upload() is called, so this method
+		* doesn't require any rendering context and can be called from any thread
+		* @param p_vertices
+		* @param p_indices
+		* @param p_materialIndex
+		* @param rigInfo
+		*/
+		template<class T>
+		void InitDeferred(std::vector<T>& p_vertices, const std::vector<uint32_t>& p_indices, uint32_t p_materialIndex, MeshRigInfo* rigInfo = nullptr);
+
+		/**
+		* Initialize the mesh from vertices already packed with the layout of the mesh (See GetVertexSize) without creating any GPU buffer.
+		* The data is read as is when Upload() is called, the given storage keeps it alive until then
+		* @param p_vertexData
+		* @param p_vertexCount
+		* @param p_indexData
+		* @param p_indexCount
+		* @param p_indexType (UNSIGNED_SHORT or UNSIGNED_INT)
+		* @param p_materialIndex
+		* @param p_hasBone
+		* @param p_boundingSphere
+		* @param p_storage
+		*/
+		void InitFromMemory(const void* p_vertexData, uint32_t p_vertexCount, const void* p_indexData, uint32_t p_indexCount, Buffers::EType p_indexType, uint32_t p_materialIndex, bool p_hasBone, const Geometry::BoundingSphere& p_boundingSphere, std::shared_ptr<const void> p_storage);
+
+		/**
+		* Create the GPU buffers from the staging data prepared by InitDeferred() or InitFromMemory() and release it.
+		* Does nothing if the mesh is already uploaded
+		*/
+		void Upload();
+
+		/**
+		* Returns true if the GPU buffers of the mesh have been created
+		*/
+		bool IsUploaded() const;
+
 		/**
 		* Bind the mesh (Actually bind its VAO)
 		*/
@@ -61,11 +107,42 @@ namespace OvRendering::Resources
 		*/
 		virtual uint32_t GetIndexCount() override;
 
+		/**
+		* Returns the OpenGL ID of the mesh VAO
+		*/
+		virtual uint32_t GetVertexArrayID() override;
+
+		/**
+		* Returns the type of the indices (UNSIGNED_SHORT or UNSIGNED_INT)
+		*/
+		virtual Buffers::EType GetIndexType() override;
+
 		/**
 		* Returns the material index of the mesh
 		*/
 		uint32_t GetMaterialIndex() const;
 
+		/**
+		* Returns true if the vertices of the mesh hold bone IDs and weights
+		*/
+		bool HasBones() const;
+
+		/**
+		* Returns the packed vertices waiting for Upload() (nullptr once the mesh is uploaded)
+		*/
+		const void* GetStagingVertexData() const;
+
+		/**
+		* Returns the indices waiting for Upload() (nullptr once the mesh is uploaded)
+		*/
+		const void* GetStagingIndexData() const;
+
+		/**
+		* Returns the size in bytes of a packed vertex
+		* @param p_hasBone
+		*/
+		static uint32_t GetVertexSize(bool p_hasBone);
+
 		/**
 		* Returns the bounding sphere of the mesh
 		*/
@@ -76,6 +153,8 @@ namespace OvRendering::Resources
 		template<class T>
 		void CreateBuffers(std::vector<T>& p_vertices, const std::vector<uint32_t>& p_indices, bool hasBone);
 		template<class T>
+		void PackVertices(std::vector<T>& p_vertices, const std::vector<uint32_t>& p_indices, bool hasBone);
+		template<class T>
 		void ComputeBoundingSphere(std::vector<T>& p_vertices);
 
 	private:
@@ -83,15 +162,30 @@ namespace OvRendering::Resources
 		uint32_t m_indicesCount;
 		uint32_t m_materialIndex;
 
-		Buffers::VertexArray							m_vertexArray;
+		std::unique_ptr<Buffers::VertexArray>			m_vertexArray;
 		std::unique_ptr<Buffers::VertexBuffer<GLbyte>>	m_vertexBuffer;
 		std::unique_ptr<Buffers::IndexBuffer>			m_indexBuffer;
 
+		bool m_hasBone = false;
+		Buffers::EType m_indexType = Buffers::EType::UNSIGNED_INT;
+
+		/* Staging data waiting for Upload(), kept alive by its storage (Packed vertices or a mapped file) */
+		std::shared_ptr<const void>	m_stagingStorage;
+		const void*					m_stagingVertexData = nullptr;
+		const void*					m_stagingIndexData = nullptr;
+
 		Geometry::BoundingSphere m_boundingSphere;
 	};
 
 	template<class T>
 	inline void Mesh::Init(std::vector<T>& p_vertices, const std::vector<uint32_t>& p_indices, uint32_t p_materialIndex, MeshRigInfo* rigInfo)
+	{
+		InitDeferred(p_vertices, p_indices, p_materialIndex, rigInfo);
+		Upload();
+	}
+
+	template<class T>
+	inline void Mesh::InitDeferred(std::vector<T>& p_vertices, const std::vector<uint32_t>& p_indices, uint32_t p_materialIndex, MeshRigInfo* rigInfo)
 	{
 		m_vertexCount = static_cast<uint32_t>(p_vertices.size()),
 		m_indicesCount = static_cast<uint32_t>(p_indices.size()),
@@ -99,17 +193,21 @@ namespace OvRendering::Resources
 		if (nullptr != rigInfo)
 			m_rigInfo = *rigInfo;
 
-		CreateBuffers(p_vertices, p_indices, m_rigInfo.m_boneInfos.size() > 0);
+		PackVertices(p_vertices, p_indices, m_rigInfo.m_boneInfos.size() > 0);
 		ComputeBoundingSphere(p_vertices);
 	}
 
 	template<class T>
 	inline void Mesh::CreateBuffers(std::vector<T>& p_vertices, const std::vector<uint32_t>& p_indices, bool hasBone)
 	{
-		//std::vector<float> vertexData;
-		OvRendering::Buffers::BufferData vertexData;
+		PackVertices(p_vertices, p_indices, hasBone);
+		Upload();
+	}
 
-		std::vector<unsigned int> rawIndices;
+	template<class T>
+	inline void Mesh::PackVertices(std::vector<T>& p_vertices, const std::vector<uint32_t>& p_indices, bool hasBone)
+	{
+		OvRendering::Buffers::BufferData vertexData;
 
 		for (auto& vertex : p_vertices)
 		{
@@ -126,27 +224,13 @@ namespace OvRendering::Resources
 			}
 		}
 
-		m_vertexBuffer = std::make_unique<Buffers::VertexBuffer<GLbyte>>(vertexData.bytes);
-		m_indexBuffer = std::make_unique<Buffers::IndexBuffer>(const_cast<uint32_t*>(p_indices.data()), p_indices.size());
-
-		uint64_t vertexSize = sizeof(float) * (3+2+3+3+3);
-		if (hasBone)
-		{
-			vertexSize += sizeof(int) * 4;
-			vertexSize += sizeof(float) * 4;
-		}
+		auto storage = std::make_shared<std::pair<std::vector<GLbyte>, std::vector<uint32_t>>>(std::move(vertexData.bytes), p_indices);
 
-		m_vertexArray.BindAttribute(0, *m_vertexBuffer, Buffers::EType::FLOAT, 3, vertexSize, 0);
-		m_vertexArray.BindAttribute(1, *m_vertexBuffer, Buffers::EType::FLOAT, 2, vertexSize, sizeof(float) * 3);
-		m_vertexArray.BindAttribute(2, *m_vertexBuffer, Buffers::EType::FLOAT, 3, vertexSize, sizeof(float) * 5);
-		m_vertexArray.BindAttribute(3, *m_vertexBuffer, Buffers::EType::FLOAT, 3, vertexSize, sizeof(float) * 8);
-		m_vertexArray.BindAttribute(4, *m_vertexBuffer, Buffers::EType::FLOAT, 3, vertexSize, sizeof(float) * 11);
-
-		if (hasBone)
-		{
-			m_vertexArray.BindIntAttribute(5, *m_vertexBuffer, Buffers::EType::INT, 4, vertexSize, sizeof(float) * 14);
-			m_vertexArray.BindAttribute(6, *m_vertexBuffer, Buffers::EType::FLOAT, 4, vertexSize, sizeof(float) * 14 + sizeof(int) * 4);
-		}
+		m_stagingVertexData = storage->first.data();
+		m_stagingIndexData = storage->second.data();
+		m_stagingStorage = std::move(storage);
+		m_indexType = Buffers::EType::UNSIGNED_INT;
+		m_hasBone = hasBone;
 	}
 	
 	template<class T>
@@ -1,6 +1,8 @@
 #pragma once
 #include <string>
 #include <set>
+#include <vector>
+#include <unordered_map>
 #include "OvMaths/FTransform.h"
 
 struct aiScene;
@@ -29,6 +31,7 @@ namespace OvRendering::Resources
 		std::set<int> m_childrenIndices;
 		std::vector<std::string> m_meshNames;
 		int GetIndex(bool cached = false);
+		ModelHierarchyNode() = default;
 		ModelHierarchyNode(const aiScene* scene, aiNode* node);
 	};
 
@@ -45,6 +48,10 @@ namespace OvRendering::Resources
 		std::vector<std::tuple<double, OvMaths::FVector3>> scales;
 
 		OvMaths::FMatrix4 GetAnimationTransform(double time) const;
+		// Same as above, but key searches start from the given cursors (position, rotation, scale) which are updated,
+		// so sampling forward in time costs O(1) per key type instead of a search
+		OvMaths::FMatrix4 GetAnimationTransform(double time, uint32_t* cursors) const;
+		ModelNodeAnimation() = default;
 		ModelNodeAnimation(ModelHierarchy* hierarchy, aiNodeAnim* anim);
 	};
 
@@ -55,9 +62,13 @@ namespace OvRendering::Resources
 		ModelHierarchy* hierarchy;
 	public:
 		std::string m_animName;
+		double m_duration; // In ticks
+		double m_ticksPerSecond;
 		std::vector<ModelNodeAnimation> m_modelNodeAnimations;
+		std::vector<int> m_nodeChannels; // Hierarchy node index -> index in m_modelNodeAnimations (-1 if the node isn't animated)
+		ModelHierarchyAnimation() = default;
 		ModelHierarchyAnimation(ModelHierarchy* hierarchy, aiAnimation* anim);
-		const ModelNodeAnimation* GetNodeAnimation(std::string name) const;
+		const ModelNodeAnimation* GetNodeAnimation(const std::string& name) const;
 
 		//void CalculateTransforms(double time, MeshRigInfo& rigInfo, OvMaths::FMatrix4* transforms);
 	};
@@ -66,13 +77,16 @@ namespace OvRendering::Resources
 	{
 		const ModelHierarchy& m_hierarchy;
 		const ModelHierarchyAnimation& animation;
-		std::vector<OvMaths::FMatrix4> hierarchyLocalTransforms;
 		std::vector<OvMaths::FMatrix4> hierarchyWorldTransforms;
-		void CalculateNodeTransform(int nodeIndex, int parentIndex);
+		std::vector<uint32_t> m_keyCursors; // 3 per animation channel (position, rotation, scale)
+		double m_sampledTime;
 	public:
 
 		ModelNodeTransformCalculator(const ModelHierarchy& hierarchy, const ModelHierarchyAnimation& animation);
-		void GetRigBoneTransforms(const MeshRigInfo& rig, OvMaths::FMatrix4* transforms);
+		// Evaluate the pose of every hierarchy node at the given time (In seconds, the animation loops). Sampling the same time twice is free
+		void SampleAnimation(double time);
+		// Skinning matrices of the given rig for the last sampled pose
+		void GetRigBoneTransforms(const MeshRigInfo& rig, OvMaths::FMatrix4* transforms) const;
 	};
 
 	class ModelHierarchy
@@ -81,9 +95,17 @@ namespace OvRendering::Resources
 	public:
 		std::vector<ModelHierarchyNode> nodes;
 		std::vector<ModelHierarchyAnimation> animations;
-		ModelHierarchyNode* GetNode(std::string name);
-		int GetNodeIndex(std::string name) const;
+		// Flattened copies of the node data used by the animation sampling. Nodes are stored depth first, so a parent index is always lower than its children indices
+		std::vector<int> m_parentIndices;
+		std::vector<OvMaths::FMatrix4> m_localTransforms;
+		std::unordered_map<std::string, int> m_nodeIndices;
+		ModelHierarchyNode* GetNode(const std::string& name);
+		int GetNodeIndex(const std::string& name) const;
 		void Init(const aiScene* scene);
+		// Rebuild everything derived from the nodes (parent index and name of each node) and animations (name of each channel):
+		// node links and indices, children, flattened copies and animation channels. Used when the hierarchy isn't built by Init.
+		// Returns false (Leaving everything as is) if a node parent isn't a previous node
+		bool BuildLookups();
 
 		void DumpNodeTree(int index = 0, int depth = 0);
 		void DumpMeshList();
@@ -105,7 +127,9 @@ namespace OvRendering::Resources
 		std::string m_meshName;
 		std::string m_meshNodeName;
 		std::vector<MeshRigBoneInfo> m_boneInfos;
-		int GetBoneIndex(std::string name);
+		std::vector<int> m_boneNodeIndices; // Bone index -> hierarchy node index (-1 if the bone has no node)
+		int GetBoneIndex(const std::string& name);
+		void ResolveNodeIndices(const ModelHierarchy& hierarchy);
 	};
 
 	class AnimationPlayCtrl
@@ -0,0 +1,67 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "OvRendering/Resources/Parsers/IModelParser.h"
+
+namespace OvRendering::Resources::Parsers
+{
+	/**
+	* Reads and writes cooked models: a versioned binary image of an imported model (Packed vertices, 16 or 32 bits indices,
+	* bounding spheres, hierarchy, rigs and animations) stored next to its source file.
+	* The cooked file is mapped in memory and its vertex and index streams are handed as is to the meshes,
+	* so loading a cooked model doesn't import or re-pack anything
+	*/
+	class CookedModelParser : public IModelParser
+	{
+	public:
+		/**
+		* Load the cooked model of the given source file.
+		* Returns false if there is no cooked model, or if it is outdated (Source file or parser flags changed since cooking)
+		* @param p_fileName (Source file)
+		* @param p_meshes
+		* @param p_materials
+		* @param p_parserFlags
+		* @param p_modelHierarchy
+		*/
+		bool LoadModel
+		(
+			const std::string& p_fileName,
+			std::vector<Mesh*>& p_meshes,
+			std::vector<std::string>& p_materials,
+			EModelParserFlags p_parserFlags,
+			OvRendering::Resources::ModelHierarchy& p_modelHierarchy
+		) override;
+
+		/**
+		* Write the cooked model of the given source file. Meshes must not be uploaded yet (Their staging data is written).
+		* Returns true on success
+		* @param p_fileName (Source file)
+		* @param p_meshes
+		* @param p_materials
+		* @param p_parserFlags
+		* @param p_modelHierarchy
+		*/
+		static bool Cook
+		(
+			const std::string& p_fileName,
+			const std::vector<Mesh*>& p_meshes,
+			const std::vector<std::string>& p_materials,
+			EModelParserFlags p_parserFlags,
+			const OvRendering::Resources::ModelHierarchy& p_modelHierarchy
+		);
+
+		/**
+		* Returns the path of the cooked model of the given source file
+		* @param p_fileName
+		*/
+		static std::string GetCookedPath(const std::string& p_fileName);
+	};
+}
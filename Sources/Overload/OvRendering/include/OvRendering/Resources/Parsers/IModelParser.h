@@ -26,6 +26,7 @@ namespace OvRendering::Resources::Parsers
 	public:
 		/**
 		* Load meshes from a file
+		* Meshes are returned without their GPU buffers (See Mesh::Upload), so parsing doesn't require any rendering context
 		* Return true on success
 		* @param p_filename
 		* @param p_meshes
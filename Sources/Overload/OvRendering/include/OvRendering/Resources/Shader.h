@@ -81,6 +81,41 @@ namespace OvRendering::Resources
 		*/
 		void SetUniformMat4(const std::string& p_name, const OvMaths::FMatrix4& p_mat4);
 
+		/**
+		* Send a int to the GPU via a previously resolved uniform location
+		* @param p_location
+		* @param p_value
+		*/
+		void SetUniformInt(uint32_t p_location, int p_value);
+
+		/**
+		* Send a float to the GPU via a previously resolved uniform location
+		* @param p_location
+		* @param p_value
+		*/
+		void SetUniformFloat(uint32_t p_location, float p_value);
+
+		/**
+		* Send a vec2 to the GPU via a previously resolved uniform location
+		* @param p_location
+		* @param p_vec2
+		*/
+		void SetUniformVec2(uint32_t p_location, const OvMaths::FVector2& p_vec2);
+
+		/**
+		* Send a vec3 to the GPU via a previously resolved uniform location
+		* @param p_location
+		* @param p_vec3
+		*/
+		void SetUniformVec3(uint32_t p_location, const OvMaths::FVector3& p_vec3);
+
+		/**
+		* Send a vec4 to the GPU via a previously resolved uniform location
+		* @param p_location
+		* @param p_vec4
+		*/
+		void SetUniformVec4(uint32_t p_location, const OvMaths::FVector4& p_vec4);
+
 		/**
 		* Returns the int uniform value identified by the given name
 		* @param p_name
@@ -128,6 +163,43 @@ namespace OvRendering::Resources
 		*/
 		void QueryUniforms();
 
+		/**
+		* Returns the size (In bytes, std140 layout) of the MaterialUBO block declared by the program, or 0 if the program doesn't declare it
+		*/
+		uint32_t GetMaterialBlockSize() const;
+
+		/**
+		* Returns a number that changes every time the uniforms are queried (Ex: After a recompilation), so
+		* data derived from the uniforms can detect that it is outdated
+		*/
+		uint32_t GetUniformsRevision() const;
+
+		/**
+		* Check which optional engine inputs the program declares (Instancing: InstanceSSBO block and ubo_InstanceOffset uniform,
+		* skinning: BonePaletteSSBO block and ubo_BoneOffset uniform)
+		*/
+		void QueryEngineFeatures();
+
+		/**
+		* Returns true if the program can draw multiple instances using the engine instance SSBO
+		*/
+		bool SupportsInstancing() const;
+
+		/**
+		* Returns true if the program can read its bone palette from the engine bone palette SSBO
+		*/
+		bool SupportsSkinning() const;
+
+		/**
+		* Returns the location of the ubo_InstanceOffset uniform (Only valid if the program supports instancing)
+		*/
+		uint32_t GetInstanceOffsetLocation() const;
+
+		/**
+		* Returns the location of the ubo_BoneOffset uniform (Only valid if the program supports skinning)
+		*/
+		uint32_t GetBoneOffsetLocation() const;
+
 	private:
 		Shader(const std::string p_path, uint32_t p_id);
 		~Shader();
@@ -142,5 +214,11 @@ namespace OvRendering::Resources
 
 	private:
 		std::unordered_map<std::string, int> m_uniformLocationCache;
+		uint32_t m_materialBlockSize = 0;
+		uint32_t m_uniformsRevision = 0;
+		bool m_supportsInstancing = false;
+		bool m_supportsSkinning = false;
+		uint32_t m_instanceOffsetLocation = static_cast<uint32_t>(-1);
+		uint32_t m_boneOffsetLocation = static_cast<uint32_t>(-1);
 	};
 }
\ No newline at end of file
@@ -9,6 +9,7 @@
 #include <stdint.h>
 #include <string>
 
+#include "OvRendering/Settings/ETextureCompression.h"
 #include "OvRendering/Settings/ETextureFilteringMode.h"
 
 
@@ -37,7 +38,7 @@ namespace OvRendering::Resources
 		void Unbind() const;
 
 	private:
-		Texture(const std::string p_path, uint32_t p_id, uint32_t p_width, uint32_t p_height, uint32_t p_bpp, Settings::ETextureFilteringMode p_firstFilter, Settings::ETextureFilteringMode p_secondFilter, bool p_generateMipmap);
+		Texture(const std::string p_path, uint32_t p_id, uint32_t p_width, uint32_t p_height, uint32_t p_bpp, Settings::ETextureFilteringMode p_firstFilter, Settings::ETextureFilteringMode p_secondFilter, bool p_generateMipmap, Settings::ETextureCompression p_compression = Settings::ETextureCompression::NONE);
 		~Texture() = default;
 
 	public:
@@ -49,5 +50,6 @@ namespace OvRendering::Resources
 		const Settings::ETextureFilteringMode secondFilter;
 		const std::string path;
 		const bool isMimapped;
+		const Settings::ETextureCompression compression;
 	};
 }
\ No newline at end of file
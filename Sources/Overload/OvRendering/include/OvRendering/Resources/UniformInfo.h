@@ -22,5 +22,6 @@ namespace OvRendering::Resources
 		std::string		name;
 		uint32_t		location;
 		std::any		defaultValue;
+		int32_t			blockOffset = -1; // Offset of the uniform in the MaterialUBO block (std140), -1 if the uniform isn't a member of this block
 	};
 }
\ No newline at end of file
@@ -0,0 +1,23 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#pragma once
+
+
+
+namespace OvRendering::Settings
+{
+	/**
+	* OpenGL texture internal format enum wrapper, restricted to the formats textures can be cooked to
+	*/
+	enum class ETextureCompression
+	{
+		NONE	= 0x8058, // RGBA8
+		BC1		= 0x83F0, // RGB, S3TC DXT1
+		BC3		= 0x83F3, // RGBA, S3TC DXT5
+		BC5		= 0x8DBD  // RG, RGTC2 (Normal maps)
+	};
+}
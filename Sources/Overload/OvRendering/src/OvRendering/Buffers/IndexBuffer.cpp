@@ -15,6 +15,13 @@ OvRendering::Buffers::IndexBuffer::IndexBuffer(unsigned int* p_data, size_t p_el
 	glBufferData(GL_ELEMENT_ARRAY_BUFFER, p_elements * sizeof(unsigned int), p_data, GL_STATIC_DRAW);
 }
 
+OvRendering::Buffers::IndexBuffer::IndexBuffer(const uint16_t* p_data, size_t p_elements)
+{
+	glGenBuffers(1, &m_bufferID);
+	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_bufferID);
+	glBufferData(GL_ELEMENT_ARRAY_BUFFER, p_elements * sizeof(uint16_t), p_data, GL_STATIC_DRAW);
+}
+
 OvRendering::Buffers::IndexBuffer::IndexBuffer(std::vector<uint32_t>& p_data) : IndexBuffer(p_data.data(), p_data.size())
 {
 }
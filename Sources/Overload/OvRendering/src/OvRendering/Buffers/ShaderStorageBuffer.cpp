@@ -30,4 +30,9 @@ void OvRendering::Buffers::ShaderStorageBuffer::Bind(uint32_t p_bindingPoint)
 void OvRendering::Buffers::ShaderStorageBuffer::Unbind()
 {
 	glBindBufferBase(GL_SHADER_STORAGE_BUFFER, m_bindingPoint, 0);
-}
\ No newline at end of file
+}
+
+uint32_t OvRendering::Buffers::ShaderStorageBuffer::GetID() const
+{
+	return m_bufferID;
+}
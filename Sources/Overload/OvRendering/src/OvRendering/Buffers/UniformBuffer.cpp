@@ -33,6 +33,13 @@ void OvRendering::Buffers::UniformBuffer::Unbind()
 	glBindBuffer(GL_UNIFORM_BUFFER, 0);
 }
 
+void OvRendering::Buffers::UniformBuffer::SetSubData(const void* p_data, size_t p_size, size_t p_offset)
+{
+	Bind();
+	glBufferSubData(GL_UNIFORM_BUFFER, p_offset, p_size, p_data);
+	Unbind();
+}
+
 GLuint OvRendering::Buffers::UniformBuffer::GetID() const
 {
 	return m_bufferID;
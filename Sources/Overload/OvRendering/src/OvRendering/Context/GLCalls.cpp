@@ -0,0 +1,54 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#include <GL/glew.h>
+
+#include "OvRendering/Context/GLCalls.h"
+
+void OvRendering::Context::GLCalls::UseProgram(uint32_t p_program)
+{
+	glUseProgram(p_program);
+}
+
+void OvRendering::Context::GLCalls::BindVertexArray(uint32_t p_vertexArray)
+{
+	glBindVertexArray(p_vertexArray);
+}
+
+void OvRendering::Context::GLCalls::ActiveTexture(uint32_t p_unit)
+{
+	glActiveTexture(GL_TEXTURE0 + p_unit);
+}
+
+void OvRendering::Context::GLCalls::BindTexture2D(uint32_t p_texture)
+{
+	glBindTexture(GL_TEXTURE_2D, p_texture);
+}
+
+void OvRendering::Context::GLCalls::BindBufferBase(Buffers::EBufferTarget p_target, uint32_t p_index, uint32_t p_buffer)
+{
+	glBindBufferBase(static_cast<GLenum>(p_target), p_index, p_buffer);
+}
+
+void OvRendering::Context::GLCalls::SetCapability(Settings::ERenderingCapability p_capability, bool p_value)
+{
+	(p_value ? glEnable : glDisable)(static_cast<GLenum>(p_capability));
+}
+
+void OvRendering::Context::GLCalls::DepthMask(bool p_enable)
+{
+	glDepthMask(p_enable);
+}
+
+void OvRendering::Context::GLCalls::ColorMask(bool p_red, bool p_green, bool p_blue, bool p_alpha)
+{
+	glColorMask(p_red, p_green, p_blue, p_alpha);
+}
+
+void OvRendering::Context::GLCalls::CullFace(Settings::ECullFace p_cullFace)
+{
+	glCullFace(static_cast<GLenum>(p_cullFace));
+}
@@ -0,0 +1,145 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#include "OvRendering/Core/GLStateCache.h"
+
+namespace
+{
+	/* Returns the slot of the given capability in the capabilities array, or -1 if it isn't tracked */
+	int GetCapabilityIndex(OvRendering::Settings::ERenderingCapability p_capability)
+	{
+		using namespace OvRendering::Settings;
+
+		switch (p_capability)
+		{
+		case ERenderingCapability::BLEND:						return 0;
+		case ERenderingCapability::CULL_FACE:					return 1;
+		case ERenderingCapability::DEPTH_TEST:					return 2;
+		case ERenderingCapability::DITHER:						return 3;
+		case ERenderingCapability::POLYGON_OFFSET_FILL:			return 4;
+		case ERenderingCapability::SAMPLE_ALPHA_TO_COVERAGE:	return 5;
+		case ERenderingCapability::SAMPLE_COVERAGE:				return 6;
+		case ERenderingCapability::SCISSOR_TEST:				return 7;
+		case ERenderingCapability::STENCIL_TEST:				return 8;
+		case ERenderingCapability::MULTISAMPLE:					return 9;
+		default:												return -1;
+		}
+	}
+}
+
+OvRendering::Core::GLStateCache::GLStateCache(Context::IGLCalls& p_calls) : m_calls(p_calls)
+{
+}
+
+void OvRendering::Core::GLStateCache::Invalidate()
+{
+	m_program.reset();
+	m_vertexArray.reset();
+	m_activeTexture.reset();
+	m_textures.fill(std::nullopt);
+	m_uniformBuffers.fill(std::nullopt);
+	m_storageBuffers.fill(std::nullopt);
+	m_capabilities.fill(std::nullopt);
+	m_depthWriting.reset();
+	m_colorWriting.reset();
+	m_cullFace.reset();
+}
+
+void OvRendering::Core::GLStateCache::UseProgram(uint32_t p_program)
+{
+	if (Update(m_program, p_program))
+		m_calls.UseProgram(p_program);
+}
+
+void OvRendering::Core::GLStateCache::BindVertexArray(uint32_t p_vertexArray)
+{
+	if (Update(m_vertexArray, p_vertexArray))
+		m_calls.BindVertexArray(p_vertexArray);
+}
+
+void OvRendering::Core::GLStateCache::BindTexture(uint32_t p_unit, uint32_t p_texture)
+{
+	if (p_unit >= kTextureUnitCount)
+	{
+		/* Untracked unit, it also leaves the active unit unknown */
+		m_activeTexture.reset();
+		m_calls.ActiveTexture(p_unit);
+		m_calls.BindTexture2D(p_texture);
+		m_counters.issuedCalls += 2;
+		return;
+	}
+
+	if (m_textures[p_unit] == p_texture)
+	{
+		++m_counters.skippedCalls;
+		return;
+	}
+
+	if (Update(m_activeTexture, p_unit))
+		m_calls.ActiveTexture(p_unit);
+
+	m_textures[p_unit] = p_texture;
+	m_calls.BindTexture2D(p_texture);
+	++m_counters.issuedCalls;
+}
+
+void OvRendering::Core::GLStateCache::BindBufferBase(Buffers::EBufferTarget p_target, uint32_t p_index, uint32_t p_buffer)
+{
+	auto& bindings = p_target == Buffers::EBufferTarget::UNIFORM_BUFFER ? m_uniformBuffers : m_storageBuffers;
+
+	if (p_index >= kBufferBindingCount)
+	{
+		m_calls.BindBufferBase(p_target, p_index, p_buffer);
+		++m_counters.issuedCalls;
+	}
+	else if (Update(bindings[p_index], p_buffer))
+	{
+		m_calls.BindBufferBase(p_target, p_index, p_buffer);
+	}
+}
+
+void OvRendering::Core::GLStateCache::SetCapability(Settings::ERenderingCapability p_capability, bool p_value)
+{
+	if (const int index = GetCapabilityIndex(p_capability); index == -1)
+	{
+		m_calls.SetCapability(p_capability, p_value);
+		++m_counters.issuedCalls;
+	}
+	else if (Update(m_capabilities[index], p_value))
+	{
+		m_calls.SetCapability(p_capability, p_value);
+	}
+}
+
+void OvRendering::Core::GLStateCache::SetDepthWriting(bool p_enable)
+{
+	if (Update(m_depthWriting, p_enable))
+		m_calls.DepthMask(p_enable);
+}
+
+void OvRendering::Core::GLStateCache::SetColorWriting(bool p_enableRed, bool p_enableGreen, bool p_enableBlue, bool p_enableAlpha)
+{
+	const uint8_t mask = (p_enableRed ? 0b0001 : 0) | (p_enableGreen ? 0b0010 : 0) | (p_enableBlue ? 0b0100 : 0) | (p_enableAlpha ? 0b1000 : 0);
+
+	if (Update(m_colorWriting, mask))
+		m_calls.ColorMask(p_enableRed, p_enableGreen, p_enableBlue, p_enableAlpha);
+}
+
+void OvRendering::Core::GLStateCache::SetCullFace(Settings::ECullFace p_cullFace)
+{
+	if (Update(m_cullFace, p_cullFace))
+		m_calls.CullFace(p_cullFace);
+}
+
+const OvRendering::Core::GLStateCache::Counters& OvRendering::Core::GLStateCache::GetCounters() const
+{
+	return m_counters;
+}
+
+void OvRendering::Core::GLStateCache::ResetCounters()
+{
+	m_counters = Counters();
+}
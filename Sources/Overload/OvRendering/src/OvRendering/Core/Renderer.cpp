@@ -8,7 +8,11 @@
 
 #include "OvRendering/Core/Renderer.h"
 
-OvRendering::Core::Renderer::Renderer(Context::Driver& p_driver) : m_driver(p_driver), m_state(0)
+OvRendering::Core::Renderer::Renderer(Context::Driver& p_driver) : m_driver(&p_driver), m_stateCache(m_glCalls), m_state(0)
+{
+}
+
+OvRendering::Core::Renderer::Renderer(Context::IGLCalls& p_calls) : m_driver(nullptr), m_stateCache(p_calls), m_state(0)
 {
 }
 
@@ -54,7 +58,7 @@ void OvRendering::Core::Renderer::SetRasterizationMode(Settings::ERasterizationM
 
 void OvRendering::Core::Renderer::SetCapability(Settings::ERenderingCapability p_capability, bool p_value)
 {
-	(p_value ? glEnable : glDisable)(static_cast<GLenum>(p_capability));
+	m_stateCache.SetCapability(p_capability, p_value);
 }
 
 bool OvRendering::Core::Renderer::GetCapability(Settings::ERenderingCapability p_capability) const
@@ -84,22 +88,22 @@ void OvRendering::Core::Renderer::SetStencilOperations(Settings::EOperation p_st
 
 void OvRendering::Core::Renderer::SetCullFace(Settings::ECullFace p_cullFace)
 {
-	glCullFace(static_cast<GLenum>(p_cullFace));
+	m_stateCache.SetCullFace(p_cullFace);
 }
 
 void OvRendering::Core::Renderer::SetDepthWriting(bool p_enable)
 {
-	glDepthMask(p_enable);
+	m_stateCache.SetDepthWriting(p_enable);
 }
 
 void OvRendering::Core::Renderer::SetColorWriting(bool p_enableRed, bool p_enableGreen, bool p_enableBlue, bool p_enableAlpha)
 {
-	glColorMask(p_enableRed, p_enableGreen, p_enableBlue, p_enableAlpha);
+	m_stateCache.SetColorWriting(p_enableRed, p_enableGreen, p_enableBlue, p_enableAlpha);
 }
 
 void OvRendering::Core::Renderer::SetColorWriting(bool p_enable)
 {
-	glColorMask(p_enable, p_enable, p_enable, p_enable);
+	m_stateCache.SetColorWriting(p_enable, p_enable, p_enable, p_enable);
 }
 
 void OvRendering::Core::Renderer::SetViewPort(uint32_t x, uint32_t y, uint32_t width, uint32_t height)
@@ -199,6 +203,8 @@ void OvRendering::Core::Renderer::ClearFrameInfo()
 	m_frameInfo.batchCount		= 0;
 	m_frameInfo.instanceCount	= 0;
 	m_frameInfo.polyCount		= 0;
+
+	m_stateCache.ResetCounters();
 }
 
 void OvRendering::Core::Renderer::Draw(Resources::IMesh& p_mesh, Settings::EPrimitiveMode p_primitiveMode, uint32_t p_instances)
@@ -209,15 +215,15 @@ void OvRendering::Core::Renderer::Draw(Resources::IMesh& p_mesh, Settings::EPrim
 		m_frameInfo.instanceCount += p_instances;
 		m_frameInfo.polyCount += (p_mesh.GetIndexCount() / 3) * p_instances;
 
-		p_mesh.Bind();
-		
+		m_stateCache.BindVertexArray(p_mesh.GetVertexArrayID());
+
 		if (p_mesh.GetIndexCount() > 0)
 		{
 			/* With EBO */
 			if (p_instances == 1)
-				glDrawElements(static_cast<GLenum>(p_primitiveMode), p_mesh.GetIndexCount(), GL_UNSIGNED_INT, nullptr);
+				glDrawElements(static_cast<GLenum>(p_primitiveMode), p_mesh.GetIndexCount(), static_cast<GLenum>(p_mesh.GetIndexType()), nullptr);
 			else
-				glDrawElementsInstanced(static_cast<GLenum>(p_primitiveMode), p_mesh.GetIndexCount(), GL_UNSIGNED_INT, nullptr, p_instances);
+				glDrawElementsInstanced(static_cast<GLenum>(p_primitiveMode), p_mesh.GetIndexCount(), static_cast<GLenum>(p_mesh.GetIndexType()), nullptr, p_instances);
 		}
 		else
 		{
@@ -227,8 +233,6 @@ void OvRendering::Core::Renderer::Draw(Resources::IMesh& p_mesh, Settings::EPrim
 			else
 				glDrawArraysInstanced(static_cast<GLenum>(p_primitiveMode), 0, p_mesh.GetVertexCount(), p_instances);
 		}
-
-		p_mesh.Unbind();
 	}
 }
 
@@ -241,12 +245,27 @@ std::vector<std::reference_wrapper<OvRendering::Resources::Mesh>> OvRendering::C
 	OvRendering::Settings::ECullingOptions p_cullingOptions
 )
 {
+	std::vector<std::reference_wrapper<OvRendering::Resources::Mesh>> result;
+	GetMeshesInFrustum(result, p_model, p_modelBoundingSphere, p_modelTransform, p_frustum, p_cullingOptions);
+	return result;
+}
+
+void OvRendering::Core::Renderer::GetMeshesInFrustum
+(
+	std::vector<std::reference_wrapper<OvRendering::Resources::Mesh>>& p_result,
+	const OvRendering::Resources::Model& p_model,
+	const OvRendering::Geometry::BoundingSphere& p_modelBoundingSphere,
+	const OvMaths::FTransform& p_modelTransform,
+	const OvRendering::Data::Frustum& p_frustum,
+	OvRendering::Settings::ECullingOptions p_cullingOptions
+)
+{
+	p_result.clear();
+
 	const bool frustumPerModel = OvRendering::Settings::IsFlagSet(Settings::ECullingOptions::FRUSTUM_PER_MODEL, p_cullingOptions);
 
 	if (!frustumPerModel || p_frustum.BoundingSphereInFrustum(p_modelBoundingSphere, p_modelTransform))
 	{
-		std::vector<std::reference_wrapper<OvRendering::Resources::Mesh>> result;
-
 		const bool frustumPerMesh = OvRendering::Settings::IsFlagSet(Settings::ECullingOptions::FRUSTUM_PER_MESH, p_cullingOptions);
 
 		const auto& meshes = p_model.GetMeshes();
@@ -256,20 +275,18 @@ std::vector<std::reference_wrapper<OvRendering::Resources::Mesh>> OvRendering::C
 			// Do not check if the mesh is in frustum if the model has only one mesh, because model and mesh bounding sphere are equals
 			if (meshes.size() == 1 || !frustumPerMesh || p_frustum.BoundingSphereInFrustum(mesh->GetBoundingSphere(), p_modelTransform))
 			{
-				result.emplace_back(*mesh);
+				p_result.emplace_back(*mesh);
 			}
 		}
-
-		return result;
 	}
-
-	return {};
 }
 
 uint8_t OvRendering::Core::Renderer::FetchGLState()
 {
 	using namespace OvRendering::Settings;
 
+	m_stateCache.Invalidate();
+
 	uint8_t result = 0;
 
 	GLboolean cMask[4];
@@ -321,5 +338,14 @@ void OvRendering::Core::Renderer::SetState(uint8_t p_state)
 
 const OvRendering::Core::Renderer::FrameInfo& OvRendering::Core::Renderer::GetFrameInfo() const
 {
+	const auto& counters = m_stateCache.GetCounters();
+	m_frameInfo.issuedGLCalls	= counters.issuedCalls;
+	m_frameInfo.skippedGLCalls	= counters.skippedCalls;
+
 	return m_frameInfo;
 }
+
+OvRendering::Core::GLStateCache& OvRendering::Core::Renderer::GetStateCache()
+{
+	return m_stateCache;
+}
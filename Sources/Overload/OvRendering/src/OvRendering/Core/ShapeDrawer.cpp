@@ -102,18 +102,16 @@ OvRendering::Core::ShapeDrawer::~ShapeDrawer()
 
 void OvRendering::Core::ShapeDrawer::SetViewProjection(const OvMaths::FMatrix4& p_viewProjection)
 {
-	m_lineShader->Bind();
+	m_renderer.GetStateCache().UseProgram(m_lineShader->id);
 	m_lineShader->SetUniformMat4("viewProjection", p_viewProjection);
-	m_lineShader->Unbind();
 
-	m_gridShader->Bind();
+	m_renderer.GetStateCache().UseProgram(m_gridShader->id);
 	m_gridShader->SetUniformMat4("viewProjection", p_viewProjection);
-	m_gridShader->Unbind();
 }
 
 void OvRendering::Core::ShapeDrawer::DrawLine(const OvMaths::FVector3& p_start, const OvMaths::FVector3& p_end, const OvMaths::FVector3& p_color, float p_lineWidth)
 {
-	m_lineShader->Bind();
+	m_renderer.GetStateCache().UseProgram(m_lineShader->id);
 
 	m_lineShader->SetUniformVec3("start", p_start);
 	m_lineShader->SetUniformVec3("end", p_end);
@@ -124,13 +122,11 @@ void OvRendering::Core::ShapeDrawer::DrawLine(const OvMaths::FVector3& p_start,
 	m_renderer.Draw(*m_lineMesh, Settings::EPrimitiveMode::LINES);
 	m_renderer.SetRasterizationLinesWidth(1.0f);
 	m_renderer.SetRasterizationMode(OvRendering::Settings::ERasterizationMode::FILL);
-
-	m_lineShader->Unbind();
 }
 
 void OvRendering::Core::ShapeDrawer::DrawGrid(const OvMaths::FVector3& p_viewPos, const OvMaths::FVector3& p_color, int32_t p_gridSize, float p_linear, float p_quadratic, float p_fadeThreshold, float p_lineWidth)
 {
-	m_gridShader->Bind();
+	m_renderer.GetStateCache().UseProgram(m_gridShader->id);
 	m_gridShader->SetUniformVec3("color", p_color);
 	m_gridShader->SetUniformVec3("viewPos", p_viewPos);
 	m_gridShader->SetUniformFloat("linear", p_linear);
@@ -155,5 +151,4 @@ void OvRendering::Core::ShapeDrawer::DrawGrid(const OvMaths::FVector3& p_viewPos
 	m_renderer.SetCapability(OvRendering::Settings::ERenderingCapability::BLEND, false);
 	m_renderer.SetRasterizationLinesWidth(1.0f);
 	m_renderer.SetRasterizationMode(OvRendering::Settings::ERasterizationMode::FILL);
-	m_gridShader->Unbind();
 }
\ No newline at end of file
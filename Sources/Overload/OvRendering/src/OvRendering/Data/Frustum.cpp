@@ -9,6 +9,14 @@
 
 #include "OvRendering/Data/Frustum.h"
 
+#if defined(__AVX2__)
+	#include <immintrin.h>
+	#define OV_FRUSTUM_AVX2
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+	#include <emmintrin.h>
+	#define OV_FRUSTUM_SSE2
+#endif
+
 // We create an enum of the sides so we don't have to call each side 0 or 1.
 // This way it makes it more understandable and readable when dealing with frustum sides.
 enum FrustumSide
@@ -252,6 +260,98 @@ bool OvRendering::Data::Frustum::CubeInFrustum(float x, float y, float z, float
 }
 
 bool OvRendering::Data::Frustum::BoundingSphereInFrustum(const OvRendering::Geometry::BoundingSphere& p_boundingSphere, const OvMaths::FTransform& p_transform) const
+{
+	const auto worldSphere = TransformBoundingSphere(p_boundingSphere, p_transform);
+	return SphereInFrustum(worldSphere.position.x, worldSphere.position.y, worldSphere.position.z, worldSphere.radius);
+}
+
+///////////////////////////////// SPHERES IN FRUSTUM \\\\\\\\\\\\\\\\*
+/////
+/////	This determines which spheres of a batch are inside of our frustum, 8 (AVX2) or 4 (SSE2) at a time.
+/////
+///////////////////////////////// SPHERES IN FRUSTUM \\\\\\\\\\\\\\\\*
+
+void OvRendering::Data::Frustum::SpheresInFrustum(const float* p_x, const float* p_y, const float* p_z, const float* p_radii, size_t p_count, uint32_t* p_visibility) const
+{
+	std::fill(p_visibility, p_visibility + (p_count + 31) / 32, 0u);
+
+	size_t i = 0;
+
+	// The vector paths evaluate the plane equation in the same order as SphereInFrustum() and test
+	// "distance <= -radius" for the rejection (Not "distance > -radius" for the acceptance), so
+	// every sphere, NaN included, gets the same result as with the scalar path
+
+#if defined(OV_FRUSTUM_AVX2)
+	__m256 planes[6][4];
+
+	for (int side = 0; side < 6; ++side)
+		for (int data = 0; data < 4; ++data)
+			planes[side][data] = _mm256_set1_ps(m_frustum[side][data]);
+
+	const __m256 signMask = _mm256_set1_ps(-0.0f);
+
+	for (; i + 8 <= p_count; i += 8)
+	{
+		const __m256 x = _mm256_loadu_ps(p_x + i);
+		const __m256 y = _mm256_loadu_ps(p_y + i);
+		const __m256 z = _mm256_loadu_ps(p_z + i);
+		const __m256 negativeRadius = _mm256_xor_ps(_mm256_loadu_ps(p_radii + i), signMask);
+
+		__m256 outside = _mm256_setzero_ps();
+
+		for (int side = 0; side < 6; ++side)
+		{
+			__m256 distance = _mm256_mul_ps(planes[side][A], x);
+			distance = _mm256_add_ps(distance, _mm256_mul_ps(planes[side][B], y));
+			distance = _mm256_add_ps(distance, _mm256_mul_ps(planes[side][C], z));
+			distance = _mm256_add_ps(distance, planes[side][D]);
+			outside = _mm256_or_ps(outside, _mm256_cmp_ps(distance, negativeRadius, _CMP_LE_OQ));
+		}
+
+		const uint32_t visible = ~static_cast<uint32_t>(_mm256_movemask_ps(outside)) & 0xFFu;
+		p_visibility[i / 32] |= visible << (i % 32);
+	}
+#elif defined(OV_FRUSTUM_SSE2)
+	__m128 planes[6][4];
+
+	for (int side = 0; side < 6; ++side)
+		for (int data = 0; data < 4; ++data)
+			planes[side][data] = _mm_set1_ps(m_frustum[side][data]);
+
+	const __m128 signMask = _mm_set1_ps(-0.0f);
+
+	for (; i + 4 <= p_count; i += 4)
+	{
+		const __m128 x = _mm_loadu_ps(p_x + i);
+		const __m128 y = _mm_loadu_ps(p_y + i);
+		const __m128 z = _mm_loadu_ps(p_z + i);
+		const __m128 negativeRadius = _mm_xor_ps(_mm_loadu_ps(p_radii + i), signMask);
+
+		__m128 outside = _mm_setzero_ps();
+
+		for (int side = 0; side < 6; ++side)
+		{
+			__m128 distance = _mm_mul_ps(planes[side][A], x);
+			distance = _mm_add_ps(distance, _mm_mul_ps(planes[side][B], y));
+			distance = _mm_add_ps(distance, _mm_mul_ps(planes[side][C], z));
+			distance = _mm_add_ps(distance, planes[side][D]);
+			outside = _mm_or_ps(outside, _mm_cmple_ps(distance, negativeRadius));
+		}
+
+		const uint32_t visible = ~static_cast<uint32_t>(_mm_movemask_ps(outside)) & 0xFu;
+		p_visibility[i / 32] |= visible << (i % 32);
+	}
+#endif
+
+	// Remaining spheres (Or every sphere without SIMD support)
+	for (; i < p_count; ++i)
+	{
+		if (SphereInFrustum(p_x[i], p_y[i], p_z[i], p_radii[i]))
+			p_visibility[i / 32] |= 1u << (i % 32);
+	}
+}
+
+OvRendering::Geometry::BoundingSphere OvRendering::Data::Frustum::TransformBoundingSphere(const OvRendering::Geometry::BoundingSphere& p_boundingSphere, const OvMaths::FTransform& p_transform)
 {
 	const auto& position = p_transform.GetWorldPosition();
 	const auto& rotation = p_transform.GetWorldRotation();
@@ -261,9 +361,7 @@ bool OvRendering::Data::Frustum::BoundingSphereInFrustum(const OvRendering::Geom
 	float scaledRadius = p_boundingSphere.radius * maxScale;
 	auto sphereOffset = OvMaths::FQuaternion::RotatePoint(p_boundingSphere.position, rotation) * maxScale;
 
-	OvMaths::FVector3 worldCenter = position + sphereOffset;
-
-	return SphereInFrustum(worldCenter.x, worldCenter.y, worldCenter.z, scaledRadius);
+	return { position + sphereOffset, scaledRadius };
 }
 
 std::array<float, 4> OvRendering::Data::Frustum::GetNearPlane() const
@@ -7,13 +7,32 @@
 #include "OvRendering/Resources/Loaders/ModelLoader.h"
 
 OvRendering::Resources::Parsers::AssimpParser OvRendering::Resources::Loaders::ModelLoader::__ASSIMP;
+OvRendering::Resources::Parsers::CookedModelParser OvRendering::Resources::Loaders::ModelLoader::__COOKED;
 
 OvRendering::Resources::Model* OvRendering::Resources::Loaders::ModelLoader::Create(const std::string& p_filepath, Parsers::EModelParserFlags p_parserFlags)
+{
+	Model* result = Parse(p_filepath, p_parserFlags);
+
+	if (result)
+		Upload(*result);
+
+	return result;
+}
+
+OvRendering::Resources::Model* OvRendering::Resources::Loaders::ModelLoader::Parse(const std::string& p_filepath, Parsers::EModelParserFlags p_parserFlags)
 {
 	Model* result = new Model(p_filepath);
 
+	if (__COOKED.LoadModel(p_filepath, result->m_meshes, result->m_materialNames, p_parserFlags, result->m_hierarchy))
+	{
+		result->ComputeBoundingSphere();
+		return result;
+	}
+
 	if (__ASSIMP.LoadModel(p_filepath, result->m_meshes, result->m_materialNames, p_parserFlags, result->m_hierarchy))
 	{
+		/* Meshes aren't uploaded yet, so their packed vertices can be cooked for the next loads */
+		Parsers::CookedModelParser::Cook(p_filepath, result->m_meshes, result->m_materialNames, p_parserFlags, result->m_hierarchy);
 		result->ComputeBoundingSphere();
 		return result;
 	}
@@ -23,6 +42,12 @@ OvRendering::Resources::Model* OvRendering::Resources::Loaders::ModelLoader::Cre
 	return nullptr;
 }
 
+void OvRendering::Resources::Loaders::ModelLoader::Upload(Model& p_model)
+{
+	for (auto mesh : p_model.m_meshes)
+		mesh->Upload();
+}
+
 void OvRendering::Resources::Loaders::ModelLoader::Reload(Model& p_model, const std::string& p_filePath, Parsers::EModelParserFlags p_parserFlags)
 {
 	Model* newModel = Create(p_filePath, p_parserFlags);
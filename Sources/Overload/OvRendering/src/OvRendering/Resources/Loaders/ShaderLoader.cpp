@@ -60,6 +60,7 @@ void OvRendering::Resources::Loaders::ShaderLoader::Recompile(Shader& p_shader,
 		*shaderID = newProgram;
 
 		p_shader.QueryUniforms();
+		p_shader.QueryEngineFeatures();
 
 		OVLOG_INFO("[COMPILE] \"" + __FILE_TRACE + "\": Success!");
 	}
@@ -0,0 +1,608 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <limits>
+
+#include <OvTools/Filesystem/MappedFile.h>
+#include <OvTools/Utils/ThreadPool.h>
+
+#include "OvRendering/Resources/Loaders/TextureCooker.h"
+
+namespace
+{
+	constexpr char kMagic[4] = { 'O', 'V', 'C', 'T' };
+	constexpr uint32_t kVersion = 2;
+	constexpr uint32_t kMaxLevels = 32;
+	constexpr size_t kLevelAlignment = 16;
+	constexpr uint32_t kRowsPerJob = 32;
+
+	struct CookedHeader
+	{
+		char magic[4];
+		uint32_t version;
+		uint64_t sourceHash;
+		uint64_t sourceSize;
+		int64_t sourceWriteTime;
+		uint32_t firstFilter;
+		uint32_t secondFilter;
+		uint32_t generateMipmap;
+		uint32_t compression;
+		uint32_t width;
+		uint32_t height;
+		uint32_t bitsPerPixel;
+		uint32_t levelCount;
+	};
+
+	struct CookedLevel
+	{
+		uint32_t width;
+		uint32_t height;
+		uint64_t offset;
+		uint64_t size;
+	};
+
+	bool GetSourceStamp(const std::string& p_filepath, uint64_t& p_outSize, int64_t& p_outWriteTime)
+	{
+		std::error_code error;
+		p_outSize = static_cast<uint64_t>(std::filesystem::file_size(p_filepath, error));
+		if (error)
+			return false;
+
+		p_outWriteTime = static_cast<int64_t>(std::filesystem::last_write_time(p_filepath, error).time_since_epoch().count());
+		return !error;
+	}
+
+	/* FNV-1a hash of the whole source file */
+	bool HashSource(const std::string& p_filepath, uint64_t& p_outHash)
+	{
+		OvTools::Filesystem::MappedFile source(p_filepath);
+
+		if (!source.IsOpen())
+			return false;
+
+		uint64_t hash = 0xcbf29ce484222325ull;
+
+		for (size_t i = 0; i < source.GetSize(); ++i)
+			hash = (hash ^ source.GetData()[i]) * 0x100000001b3ull;
+
+		p_outHash = hash;
+		return true;
+	}
+
+	/*
+	* A cooked texture is up to date if its source has the same size and write time as when it was cooked. Only a source
+	* with the same size but another write time (Touched, copied or checked out) is hashed, and if its content didn't
+	* change, the new write time is stored in the cooked texture so the next loads don't hash it again
+	*/
+	bool IsSourceUpToDate(const std::string& p_filepath, const std::string& p_cookedPath, const CookedHeader& p_header)
+	{
+		uint64_t sourceSize;
+		int64_t sourceWriteTime;
+		uint64_t sourceHash;
+
+		if (!GetSourceStamp(p_filepath, sourceSize, sourceWriteTime) || sourceSize != p_header.sourceSize)
+			return false;
+
+		if (sourceWriteTime == p_header.sourceWriteTime)
+			return true;
+
+		if (!HashSource(p_filepath, sourceHash) || sourceHash != p_header.sourceHash)
+			return false;
+
+		std::fstream cooked(p_cookedPath, std::ios::binary | std::ios::in | std::ios::out);
+		cooked.seekp(offsetof(CookedHeader, sourceWriteTime));
+		cooked.write(reinterpret_cast<const char*>(&sourceWriteTime), sizeof(sourceWriteTime));
+
+		return true;
+	}
+
+	size_t AlignOffset(size_t p_offset)
+	{
+		return (p_offset + kLevelAlignment - 1) / kLevelAlignment * kLevelAlignment;
+	}
+
+	void ParallelFor(OvTools::Utils::ThreadPool* p_threadPool, uint32_t p_jobCount, const std::function<void(uint32_t)>& p_job)
+	{
+		if (p_threadPool && p_jobCount > 1)
+		{
+			p_threadPool->Dispatch(p_jobCount, p_job);
+		}
+		else
+		{
+			for (uint32_t i = 0; i < p_jobCount; ++i)
+				p_job(i);
+		}
+	}
+
+	uint16_t PackColor(const uint8_t* p_color)
+	{
+		const auto quantize = [](uint8_t p_value, uint32_t p_max)
+		{
+			return static_cast<uint16_t>((p_value * p_max + 127) / 255);
+		};
+
+		return static_cast<uint16_t>(quantize(p_color[0], 31) << 11 | quantize(p_color[1], 63) << 5 | quantize(p_color[2], 31));
+	}
+
+	void UnpackColor(uint16_t p_packed, int* p_color)
+	{
+		const int r = (p_packed >> 11) & 31;
+		const int g = (p_packed >> 5) & 63;
+		const int b = p_packed & 31;
+
+		p_color[0] = (r << 3) | (r >> 2);
+		p_color[1] = (g << 2) | (g >> 4);
+		p_color[2] = (b << 3) | (b >> 2);
+	}
+
+	void WriteLittleEndian(uint8_t* p_output, uint64_t p_value, uint32_t p_byteCount)
+	{
+		for (uint32_t i = 0; i < p_byteCount; ++i)
+			p_output[i] = static_cast<uint8_t>(p_value >> (8 * i));
+	}
+
+	/* BC1 color block (8 bytes). Endpoints are the pixels at both ends of the principal axis of the block colors */
+	void EncodeColorBlock(const uint8_t* p_pixels, uint8_t* p_output)
+	{
+		float mean[3] = { 0.0f, 0.0f, 0.0f };
+		float axis[3];
+		uint8_t minColor[3] = { 255, 255, 255 };
+		uint8_t maxColor[3] = { 0, 0, 0 };
+
+		for (uint32_t i = 0; i < 16; ++i)
+		{
+			for (uint32_t c = 0; c < 3; ++c)
+			{
+				mean[c] += p_pixels[i * 4 + c] / 16.0f;
+				minColor[c] = std::min(minColor[c], p_pixels[i * 4 + c]);
+				maxColor[c] = std::max(maxColor[c], p_pixels[i * 4 + c]);
+			}
+		}
+
+		float covariance[3][3] = {};
+
+		for (uint32_t i = 0; i < 16; ++i)
+		{
+			const float delta[3] = { p_pixels[i * 4] - mean[0], p_pixels[i * 4 + 1] - mean[1], p_pixels[i * 4 + 2] - mean[2] };
+
+			for (uint32_t row = 0; row < 3; ++row)
+				for (uint32_t column = 0; column < 3; ++column)
+					covariance[row][column] += delta[row] * delta[column];
+		}
+
+		/* Power iteration, starting from the diagonal of the bounding box */
+		for (uint32_t c = 0; c < 3; ++c)
+			axis[c] = static_cast<float>(maxColor[c] - minColor[c]);
+
+		for (uint32_t iteration = 0; iteration < 8; ++iteration)
+		{
+			float next[3];
+
+			for (uint32_t row = 0; row < 3; ++row)
+				next[row] = covariance[row][0] * axis[0] + covariance[row][1] * axis[1] + covariance[row][2] * axis[2];
+
+			const float length = std::sqrt(next[0] * next[0] + next[1] * next[1] + next[2] * next[2]);
+
+			if (length < 1e-6f)
+				break;
+
+			for (uint32_t c = 0; c < 3; ++c)
+				axis[c] = next[c] / length;
+		}
+
+		uint32_t minIndex = 0;
+		uint32_t maxIndex = 0;
+		float minProjection = std::numeric_limits<float>::max();
+		float maxProjection = std::numeric_limits<float>::lowest();
+
+		for (uint32_t i = 0; i < 16; ++i)
+		{
+			const float projection = p_pixels[i * 4] * axis[0] + p_pixels[i * 4 + 1] * axis[1] + p_pixels[i * 4 + 2] * axis[2];
+
+			if (projection < minProjection) { minProjection = projection; minIndex = i; }
+			if (projection > maxProjection) { maxProjection = projection; maxIndex = i; }
+		}
+
+		uint16_t color0 = PackColor(p_pixels + maxIndex * 4);
+		uint16_t color1 = PackColor(p_pixels + minIndex * 4);
+
+		/* color0 > color1 selects the four colors mode */
+		if (color0 < color1)
+			std::swap(color0, color1);
+
+		uint32_t indices = 0;
+
+		if (color0 != color1)
+		{
+			int palette[4][3];
+			UnpackColor(color0, palette[0]);
+			UnpackColor(color1, palette[1]);
+
+			for (uint32_t c = 0; c < 3; ++c)
+			{
+				palette[2][c] = (2 * palette[0][c] + palette[1][c] + 1) / 3;
+				palette[3][c] = (palette[0][c] + 2 * palette[1][c] + 1) / 3;
+			}
+
+			for (uint32_t i = 0; i < 16; ++i)
+			{
+				uint32_t bestIndex = 0;
+				int bestDistance = std::numeric_limits<int>::max();
+
+				for (uint32_t candidate = 0; candidate < 4; ++candidate)
+				{
+					int distance = 0;
+
+					for (uint32_t c = 0; c < 3; ++c)
+					{
+						const int delta = p_pixels[i * 4 + c] - palette[candidate][c];
+						distance += delta * delta;
+					}
+
+					if (distance < bestDistance)
+					{
+						bestDistance = distance;
+						bestIndex = candidate;
+					}
+				}
+
+				indices |= bestIndex << (2 * i);
+			}
+		}
+
+		WriteLittleEndian(p_output, color0, 2);
+		WriteLittleEndian(p_output + 2, color1, 2);
+		WriteLittleEndian(p_output + 4, indices, 4);
+	}
+
+	/* BC4 single channel block (8 bytes), always in the eight values mode */
+	void EncodeChannelBlock(const uint8_t* p_pixels, uint32_t p_channel, uint8_t* p_output)
+	{
+		int minValue = 255;
+		int maxValue = 0;
+
+		for (uint32_t i = 0; i < 16; ++i)
+		{
+			minValue = std::min(minValue, static_cast<int>(p_pixels[i * 4 + p_channel]));
+			maxValue = std::max(maxValue, static_cast<int>(p_pixels[i * 4 + p_channel]));
+		}
+
+		uint64_t indices = 0;
+
+		if (maxValue != minValue)
+		{
+			int palette[8] = { maxValue, minValue };
+
+			for (int i = 2; i < 8; ++i)
+				palette[i] = ((8 - i) * maxValue + (i - 1) * minValue + 3) / 7;
+
+			for (uint32_t i = 0; i < 16; ++i)
+			{
+				const int value = p_pixels[i * 4 + p_channel];
+				uint64_t bestIndex = 0;
+
+				for (uint64_t candidate = 1; candidate < 8; ++candidate)
+				{
+					if (std::abs(value - palette[candidate]) < std::abs(value - palette[bestIndex]))
+						bestIndex = candidate;
+				}
+
+				indices |= bestIndex << (3 * i);
+			}
+		}
+
+		p_output[0] = static_cast<uint8_t>(maxValue);
+		p_output[1] = static_cast<uint8_t>(minValue);
+		WriteLittleEndian(p_output + 2, indices, 6);
+	}
+}
+
+void OvRendering::Resources::Loaders::TextureCooker::GenerateMipChain(TextureData& p_data, OvTools::Utils::ThreadPool* p_threadPool)
+{
+	if (p_data.compression != Settings::ETextureCompression::NONE || p_data.levels.empty())
+		return;
+
+	std::vector<TextureLevel> levels{ p_data.levels[0] };
+	std::vector<size_t> offsets{ 0 };
+	size_t totalSize = levels[0].size;
+
+	while (levels.back().width > 1 || levels.back().height > 1)
+	{
+		TextureLevel level;
+		level.width = std::max(levels.back().width / 2, 1u);
+		level.height = std::max(levels.back().height / 2, 1u);
+		level.size = GetLevelSize(level.width, level.height, Settings::ETextureCompression::NONE);
+
+		offsets.push_back(totalSize);
+		levels.push_back(level);
+		totalSize += level.size;
+	}
+
+	auto storage = std::make_shared<std::vector<uint8_t>>(totalSize);
+	std::memcpy(storage->data(), p_data.levels[0].data, p_data.levels[0].size);
+
+	for (size_t i = 0; i < levels.size(); ++i)
+		levels[i].data = storage->data() + offsets[i];
+
+	for (size_t i = 1; i < levels.size(); ++i)
+	{
+		const TextureLevel& source = levels[i - 1];
+		const TextureLevel& destination = levels[i];
+		uint8_t* output = storage->data() + offsets[i];
+
+		ParallelFor(p_threadPool, (destination.height + kRowsPerJob - 1) / kRowsPerJob, [&](uint32_t p_job)
+		{
+			const uint32_t lastRow = std::min((p_job + 1) * kRowsPerJob, destination.height);
+
+			for (uint32_t y = p_job * kRowsPerJob; y < lastRow; ++y)
+			{
+				/* Odd dimensions clamp the 2x2 footprint to the last source row/column */
+				const uint32_t y0 = std::min(y * 2, source.height - 1);
+				const uint32_t y1 = std::min(y * 2 + 1, source.height - 1);
+
+				for (uint32_t x = 0; x < destination.width; ++x)
+				{
+					const uint32_t x0 = std::min(x * 2, source.width - 1);
+					const uint32_t x1 = std::min(x * 2 + 1, source.width - 1);
+
+					for (uint32_t c = 0; c < 4; ++c)
+					{
+						const uint32_t sum =
+							source.data[(y0 * source.width + x0) * 4 + c] +
+							source.data[(y0 * source.width + x1) * 4 + c] +
+							source.data[(y1 * source.width + x0) * 4 + c] +
+							source.data[(y1 * source.width + x1) * 4 + c];
+
+						output[(y * destination.width + x) * 4 + c] = static_cast<uint8_t>((sum + 2) / 4);
+					}
+				}
+			}
+		});
+	}
+
+	p_data.levels = std::move(levels);
+	p_data.storage = storage;
+}
+
+void OvRendering::Resources::Loaders::TextureCooker::Compress(TextureData& p_data, Settings::ETextureCompression p_compression, OvTools::Utils::ThreadPool* p_threadPool)
+{
+	if (p_data.compression != Settings::ETextureCompression::NONE || p_compression == Settings::ETextureCompression::NONE)
+		return;
+
+	std::vector<TextureLevel> levels;
+	std::vector<size_t> offsets;
+	size_t totalSize = 0;
+
+	for (const auto& sourceLevel : p_data.levels)
+	{
+		TextureLevel level;
+		level.width = sourceLevel.width;
+		level.height = sourceLevel.height;
+		level.size = GetLevelSize(level.width, level.height, p_compression);
+
+		offsets.push_back(totalSize);
+		levels.push_back(level);
+		totalSize += level.size;
+	}
+
+	auto storage = std::make_shared<std::vector<uint8_t>>(totalSize);
+	const size_t blockSize = GetBlockSize(p_compression);
+
+	for (size_t i = 0; i < levels.size(); ++i)
+	{
+		const TextureLevel& source = p_data.levels[i];
+		uint8_t* output = storage->data() + offsets[i];
+		const uint32_t blocksPerRow = (source.width + 3) / 4;
+		const uint32_t blockRows = (source.height + 3) / 4;
+
+		ParallelFor(p_threadPool, blockRows, [&](uint32_t p_blockRow)
+		{
+			uint8_t block[16 * 4];
+
+			for (uint32_t blockColumn = 0; blockColumn < blocksPerRow; ++blockColumn)
+			{
+				/* Blocks crossing the border of the level repeat its last row/column */
+				for (uint32_t y = 0; y < 4; ++y)
+				{
+					const uint32_t sourceY = std::min(p_blockRow * 4 + y, source.height - 1);
+
+					for (uint32_t x = 0; x < 4; ++x)
+					{
+						const uint32_t sourceX = std::min(blockColumn * 4 + x, source.width - 1);
+						std::memcpy(block + (y * 4 + x) * 4, source.data + (sourceY * source.width + sourceX) * 4, 4);
+					}
+				}
+
+				EncodeBlock(block, p_compression, output + (static_cast<size_t>(p_blockRow) * blocksPerRow + blockColumn) * blockSize);
+			}
+		});
+
+		levels[i].data = output;
+	}
+
+	p_data.compression = p_compression;
+	p_data.levels = std::move(levels);
+	p_data.storage = storage;
+}
+
+void OvRendering::Resources::Loaders::TextureCooker::EncodeBlock(const uint8_t* p_pixels, Settings::ETextureCompression p_compression, uint8_t* p_output)
+{
+	switch (p_compression)
+	{
+	case Settings::ETextureCompression::BC1:
+		EncodeColorBlock(p_pixels, p_output);
+		break;
+
+	case Settings::ETextureCompression::BC3:
+		EncodeChannelBlock(p_pixels, 3, p_output);
+		EncodeColorBlock(p_pixels, p_output + 8);
+		break;
+
+	case Settings::ETextureCompression::BC5:
+		EncodeChannelBlock(p_pixels, 0, p_output);
+		EncodeChannelBlock(p_pixels, 1, p_output + 8);
+		break;
+
+	default:
+		break;
+	}
+}
+
+size_t OvRendering::Resources::Loaders::TextureCooker::GetBlockSize(Settings::ETextureCompression p_compression)
+{
+	switch (p_compression)
+	{
+	case Settings::ETextureCompression::BC1:	return 8;
+	case Settings::ETextureCompression::BC3:	return 16;
+	case Settings::ETextureCompression::BC5:	return 16;
+	default:									return 4;
+	}
+}
+
+size_t OvRendering::Resources::Loaders::TextureCooker::GetLevelSize(uint32_t p_width, uint32_t p_height, Settings::ETextureCompression p_compression)
+{
+	if (p_compression == Settings::ETextureCompression::NONE)
+		return static_cast<size_t>(p_width) * p_height * 4;
+
+	return static_cast<size_t>((p_width + 3) / 4) * ((p_height + 3) / 4) * GetBlockSize(p_compression);
+}
+
+bool OvRendering::Resources::Loaders::TextureCooker::LoadCooked(const std::string& p_filepath, TextureData& p_outData, Settings::ETextureFilteringMode p_firstFilter, Settings::ETextureFilteringMode p_secondFilter, bool p_generateMipmap, Settings::ETextureCompression p_compression)
+{
+	const std::string cookedPath = GetCookedPath(p_filepath);
+	CookedHeader header;
+
+	/* The header is checked before mapping the file, as checking the source may have to update it */
+	if (!std::ifstream(cookedPath, std::ios::binary).read(reinterpret_cast<char*>(&header), sizeof(CookedHeader)))
+		return false;
+
+	if (std::memcmp(header.magic, kMagic, sizeof(kMagic)) != 0 ||
+		header.version != kVersion ||
+		header.firstFilter != static_cast<uint32_t>(p_firstFilter) ||
+		header.secondFilter != static_cast<uint32_t>(p_secondFilter) ||
+		header.generateMipmap != static_cast<uint32_t>(p_generateMipmap) ||
+		header.compression != static_cast<uint32_t>(p_compression) ||
+		header.levelCount == 0 || header.levelCount > kMaxLevels ||
+		!IsSourceUpToDate(p_filepath, cookedPath, header))
+		return false;
+
+	auto file = std::make_shared<OvTools::Filesystem::MappedFile>(cookedPath);
+
+	if (!file->IsOpen() || file->GetSize() < sizeof(CookedHeader) + header.levelCount * sizeof(CookedLevel))
+		return false;
+
+	std::vector<TextureLevel> levels(header.levelCount);
+
+	for (uint32_t i = 0; i < header.levelCount; ++i)
+	{
+		CookedLevel cookedLevel;
+		std::memcpy(&cookedLevel, file->GetData() + sizeof(CookedHeader) + i * sizeof(CookedLevel), sizeof(CookedLevel));
+
+		if (cookedLevel.offset > file->GetSize() || cookedLevel.size > file->GetSize() - cookedLevel.offset ||
+			cookedLevel.size != GetLevelSize(cookedLevel.width, cookedLevel.height, p_compression))
+			return false;
+
+		levels[i].width = cookedLevel.width;
+		levels[i].height = cookedLevel.height;
+		levels[i].data = file->GetData() + cookedLevel.offset;
+		levels[i].size = static_cast<size_t>(cookedLevel.size);
+	}
+
+	/* The levels are read by the calling (Loading) thread rather than by the GPU upload */
+	file->Prefetch();
+
+	p_outData.width = header.width;
+	p_outData.height = header.height;
+	p_outData.bitsPerPixel = header.bitsPerPixel;
+	p_outData.compression = p_compression;
+	p_outData.levels = std::move(levels);
+	p_outData.storage = file;
+
+	return true;
+}
+
+bool OvRendering::Resources::Loaders::TextureCooker::Cook(const std::string& p_filepath, const TextureData& p_data, Settings::ETextureFilteringMode p_firstFilter, Settings::ETextureFilteringMode p_secondFilter, bool p_generateMipmap)
+{
+	if (p_data.levels.empty() || p_data.levels.size() > kMaxLevels)
+		return false;
+
+	CookedHeader header;
+	std::memcpy(header.magic, kMagic, sizeof(kMagic));
+	header.version = kVersion;
+	header.firstFilter = static_cast<uint32_t>(p_firstFilter);
+	header.secondFilter = static_cast<uint32_t>(p_secondFilter);
+	header.generateMipmap = static_cast<uint32_t>(p_generateMipmap);
+	header.compression = static_cast<uint32_t>(p_data.compression);
+	header.width = p_data.width;
+	header.height = p_data.height;
+	header.bitsPerPixel = p_data.bitsPerPixel;
+	header.levelCount = static_cast<uint32_t>(p_data.levels.size());
+
+	if (!GetSourceStamp(p_filepath, header.sourceSize, header.sourceWriteTime) || !HashSource(p_filepath, header.sourceHash))
+		return false;
+
+	std::vector<CookedLevel> cookedLevels(p_data.levels.size());
+	size_t fileSize = sizeof(CookedHeader) + cookedLevels.size() * sizeof(CookedLevel);
+
+	for (size_t i = 0; i < p_data.levels.size(); ++i)
+	{
+		fileSize = AlignOffset(fileSize);
+
+		cookedLevels[i].width = p_data.levels[i].width;
+		cookedLevels[i].height = p_data.levels[i].height;
+		cookedLevels[i].offset = static_cast<uint64_t>(fileSize);
+		cookedLevels[i].size = static_cast<uint64_t>(p_data.levels[i].size);
+
+		fileSize += p_data.levels[i].size;
+	}
+
+	std::vector<uint8_t> bytes(fileSize, 0);
+	std::memcpy(bytes.data(), &header, sizeof(CookedHeader));
+	std::memcpy(bytes.data() + sizeof(CookedHeader), cookedLevels.data(), cookedLevels.size() * sizeof(CookedLevel));
+
+	for (size_t i = 0; i < p_data.levels.size(); ++i)
+		std::memcpy(bytes.data() + cookedLevels[i].offset, p_data.levels[i].data, p_data.levels[i].size);
+
+	/* Write to a temporary file first, so a cooked texture is either complete or missing */
+	const std::string cookedPath = GetCookedPath(p_filepath);
+	const std::string temporaryPath = cookedPath + ".tmp";
+
+	{
+		std::ofstream output(temporaryPath, std::ios::binary | std::ios::trunc);
+
+		if (!output)
+			return false;
+
+		output.write(reinterpret_cast<const char*>(bytes.data()), bytes.size());
+
+		if (!output)
+		{
+			output.close();
+			std::filesystem::remove(temporaryPath);
+			return false;
+		}
+	}
+
+	std::error_code error;
+	std::filesystem::rename(temporaryPath, cookedPath, error);
+
+	if (error)
+		std::filesystem::remove(temporaryPath, error);
+
+	return !error;
+}
+
+std::string OvRendering::Resources::Loaders::TextureCooker::GetCookedPath(const std::string& p_filepath)
+{
+	return p_filepath + ".ovcooked";
+}
@@ -10,45 +10,89 @@
 #include <stb_image/stb_image.h>
 
 #include "OvRendering/Resources/Loaders/TextureLoader.h"
+#include "OvRendering/Resources/Loaders/TextureCooker.h"
 
-OvRendering::Resources::Texture* OvRendering::Resources::Loaders::TextureLoader::Create(const std::string& p_filepath, OvRendering::Settings::ETextureFilteringMode p_firstFilter, OvRendering::Settings::ETextureFilteringMode p_secondFilter, bool p_generateMipmap)
+OvTools::Utils::ThreadPool* OvRendering::Resources::Loaders::TextureLoader::__THREAD_POOL = nullptr;
+
+OvRendering::Resources::Texture* OvRendering::Resources::Loaders::TextureLoader::Create(const std::string& p_filepath, OvRendering::Settings::ETextureFilteringMode p_firstFilter, OvRendering::Settings::ETextureFilteringMode p_secondFilter, bool p_generateMipmap, OvRendering::Settings::ETextureCompression p_compression)
 {
-	GLuint textureID;
+	if (TextureData data; Decode(p_filepath, data, p_firstFilter, p_secondFilter, p_generateMipmap, p_compression))
+		return Upload(p_filepath, data, p_firstFilter, p_secondFilter, p_generateMipmap);
+
+	return nullptr;
+}
+
+bool OvRendering::Resources::Loaders::TextureLoader::Decode(const std::string& p_filepath, TextureData& p_outData, OvRendering::Settings::ETextureFilteringMode p_firstFilter, OvRendering::Settings::ETextureFilteringMode p_secondFilter, bool p_generateMipmap, OvRendering::Settings::ETextureCompression p_compression)
+{
+	if (TextureCooker::LoadCooked(p_filepath, p_outData, p_firstFilter, p_secondFilter, p_generateMipmap, p_compression))
+		return true;
+
 	int textureWidth;
 	int textureHeight;
 	int bitsPerPixel;
-	glGenTextures(1, &textureID);
 
 	stbi_set_flip_vertically_on_load(true);
 	unsigned char* dataBuffer = stbi_load(p_filepath.c_str(), &textureWidth, &textureHeight, &bitsPerPixel, 4);
 
 	if (dataBuffer)
 	{
-		glBindTexture(GL_TEXTURE_2D, textureID);
+		auto pixels = std::make_shared<std::vector<uint8_t>>(dataBuffer, dataBuffer + static_cast<size_t>(textureWidth) * textureHeight * 4);
+		stbi_image_free(dataBuffer);
 
-		glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, textureWidth, textureHeight, 0, GL_RGBA, GL_UNSIGNED_BYTE, dataBuffer);
+		p_outData.width = static_cast<uint32_t>(textureWidth);
+		p_outData.height = static_cast<uint32_t>(textureHeight);
+		p_outData.bitsPerPixel = static_cast<uint32_t>(bitsPerPixel);
+		p_outData.compression = OvRendering::Settings::ETextureCompression::NONE;
+		p_outData.levels = { TextureLevel{ p_outData.width, p_outData.height, pixels->data(), pixels->size() } };
+		p_outData.storage = pixels;
 
 		if (p_generateMipmap)
-		{
-			glGenerateMipmap(GL_TEXTURE_2D);
-		}
-		
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, static_cast<GLint>(p_firstFilter));
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, static_cast<GLint>(p_secondFilter));
+			TextureCooker::GenerateMipChain(p_outData, __THREAD_POOL);
 
-		stbi_image_free(dataBuffer);
-		glBindTexture(GL_TEXTURE_2D, 0);
+		TextureCooker::Compress(p_outData, p_compression, __THREAD_POOL);
+		TextureCooker::Cook(p_filepath, p_outData, p_firstFilter, p_secondFilter, p_generateMipmap);
 
-		return new Texture(p_filepath, textureID, textureWidth, textureHeight, bitsPerPixel, p_firstFilter, p_secondFilter, p_generateMipmap);
+		return true;
+	}
+
+	return false;
+}
+
+OvRendering::Resources::Texture* OvRendering::Resources::Loaders::TextureLoader::Upload(const std::string& p_filepath, const TextureData& p_data, OvRendering::Settings::ETextureFilteringMode p_firstFilter, OvRendering::Settings::ETextureFilteringMode p_secondFilter, bool p_generateMipmap)
+{
+	GLuint textureID;
+	glGenTextures(1, &textureID);
+	glBindTexture(GL_TEXTURE_2D, textureID);
+
+	const bool isCompressed = p_data.compression != OvRendering::Settings::ETextureCompression::NONE;
+
+	for (size_t i = 0; i < p_data.levels.size(); ++i)
+	{
+		const auto& level = p_data.levels[i];
+
+		if (isCompressed)
+			glCompressedTexImage2D(GL_TEXTURE_2D, static_cast<GLint>(i), static_cast<GLenum>(p_data.compression), level.width, level.height, 0, static_cast<GLsizei>(level.size), level.data);
+		else
+			glTexImage2D(GL_TEXTURE_2D, static_cast<GLint>(i), GL_RGBA8, level.width, level.height, 0, GL_RGBA, GL_UNSIGNED_BYTE, level.data);
+	}
+
+	if (p_generateMipmap && p_data.levels.size() == 1 && !isCompressed)
+	{
+		glGenerateMipmap(GL_TEXTURE_2D);
 	}
 	else
 	{
-		stbi_image_free(dataBuffer);
-		glBindTexture(GL_TEXTURE_2D, 0);
-		return nullptr;
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, static_cast<GLint>(p_data.levels.size()) - 1);
 	}
+
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, static_cast<GLint>(p_firstFilter));
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, static_cast<GLint>(p_secondFilter));
+
+	glBindTexture(GL_TEXTURE_2D, 0);
+
+	return new Texture(p_filepath, textureID, p_data.width, p_data.height, p_data.bitsPerPixel, p_firstFilter, p_secondFilter, p_generateMipmap, p_data.compression);
 }
 
 OvRendering::Resources::Texture* OvRendering::Resources::Loaders::TextureLoader::CreateColor(uint32_t p_data, OvRendering::Settings::ETextureFilteringMode p_firstFilter, OvRendering::Settings::ETextureFilteringMode p_secondFilter, bool p_generateMipmap)
@@ -97,9 +141,9 @@ OvRendering::Resources::Texture* OvRendering::Resources::Loaders::TextureLoader:
 	return new Texture("", textureID, 1, 1, 32, p_firstFilter, p_secondFilter, p_generateMipmap);
 }
 
-void OvRendering::Resources::Loaders::TextureLoader::Reload(Texture& p_texture, const std::string& p_filePath, OvRendering::Settings::ETextureFilteringMode p_firstFilter, OvRendering::Settings::ETextureFilteringMode p_secondFilter, bool p_generateMipmap)
+void OvRendering::Resources::Loaders::TextureLoader::Reload(Texture& p_texture, const std::string& p_filePath, OvRendering::Settings::ETextureFilteringMode p_firstFilter, OvRendering::Settings::ETextureFilteringMode p_secondFilter, bool p_generateMipmap, OvRendering::Settings::ETextureCompression p_compression)
 {
-	Texture* newTexture = Create(p_filePath, p_firstFilter, p_secondFilter, p_generateMipmap);
+	Texture* newTexture = Create(p_filePath, p_firstFilter, p_secondFilter, p_generateMipmap, p_compression);
 
 	if (newTexture)
 	{
@@ -112,6 +156,7 @@ void OvRendering::Resources::Loaders::TextureLoader::Reload(Texture& p_texture,
 		*const_cast<Settings::ETextureFilteringMode*>(&p_texture.firstFilter) = newTexture->firstFilter;
 		*const_cast<Settings::ETextureFilteringMode*>(&p_texture.secondFilter) = newTexture->secondFilter;
 		*const_cast<bool*>(&p_texture.isMimapped) = newTexture->isMimapped;
+		*const_cast<Settings::ETextureCompression*>(&p_texture.compression) = newTexture->compression;
 		delete newTexture;
 	}
 }
@@ -128,3 +173,8 @@ bool OvRendering::Resources::Loaders::TextureLoader::Destroy(Texture*& p_texture
 
 	return false;
 }
+
+void OvRendering::Resources::Loaders::TextureLoader::ProvideThreadPool(OvTools::Utils::ThreadPool* p_threadPool)
+{
+	__THREAD_POOL = p_threadPool;
+}
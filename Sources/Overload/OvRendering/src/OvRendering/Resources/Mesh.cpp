@@ -21,14 +21,66 @@ OvRendering::Resources::Mesh::Mesh(std::vector<Geometry::Vertex>& p_vertices, co
 	ComputeBoundingSphere(p_vertices);
 }
 
+void OvRendering::Resources::Mesh::InitFromMemory(const void* p_vertexData, uint32_t p_vertexCount, const void* p_indexData, uint32_t p_indexCount, Buffers::EType p_indexType, uint32_t p_materialIndex, bool p_hasBone, const Geometry::BoundingSphere& p_boundingSphere, std::shared_ptr<const void> p_storage)
+{
+	m_vertexCount = p_vertexCount;
+	m_indicesCount = p_indexCount;
+	m_materialIndex = p_materialIndex;
+	m_boundingSphere = p_boundingSphere;
+	m_hasBone = p_hasBone;
+	m_indexType = p_indexType;
+
+	m_stagingVertexData = p_vertexData;
+	m_stagingIndexData = p_indexData;
+	m_stagingStorage = std::move(p_storage);
+}
+
+void OvRendering::Resources::Mesh::Upload()
+{
+	if (m_vertexArray)
+		return;
+
+	const uint64_t vertexSize = GetVertexSize(m_hasBone);
+
+	m_vertexArray = std::make_unique<Buffers::VertexArray>();
+	m_vertexBuffer = std::make_unique<Buffers::VertexBuffer<GLbyte>>(static_cast<GLbyte*>(const_cast<void*>(m_stagingVertexData)), m_vertexCount * vertexSize);
+
+	if (m_indexType == Buffers::EType::UNSIGNED_SHORT)
+		m_indexBuffer = std::make_unique<Buffers::IndexBuffer>(static_cast<const uint16_t*>(m_stagingIndexData), m_indicesCount);
+	else
+		m_indexBuffer = std::make_unique<Buffers::IndexBuffer>(static_cast<uint32_t*>(const_cast<void*>(m_stagingIndexData)), m_indicesCount);
+
+	m_vertexArray->BindAttribute(0, *m_vertexBuffer, Buffers::EType::FLOAT, 3, vertexSize, 0);
+	m_vertexArray->BindAttribute(1, *m_vertexBuffer, Buffers::EType::FLOAT, 2, vertexSize, sizeof(float) * 3);
+	m_vertexArray->BindAttribute(2, *m_vertexBuffer, Buffers::EType::FLOAT, 3, vertexSize, sizeof(float) * 5);
+	m_vertexArray->BindAttribute(3, *m_vertexBuffer, Buffers::EType::FLOAT, 3, vertexSize, sizeof(float) * 8);
+	m_vertexArray->BindAttribute(4, *m_vertexBuffer, Buffers::EType::FLOAT, 3, vertexSize, sizeof(float) * 11);
+
+	if (m_hasBone)
+	{
+		m_vertexArray->BindIntAttribute(5, *m_vertexBuffer, Buffers::EType::INT, 4, vertexSize, sizeof(float) * 14);
+		m_vertexArray->BindAttribute(6, *m_vertexBuffer, Buffers::EType::FLOAT, 4, vertexSize, sizeof(float) * 14 + sizeof(int) * 4);
+	}
+
+	/* The staging data is not needed anymore */
+	m_stagingVertexData = nullptr;
+	m_stagingIndexData = nullptr;
+	m_stagingStorage.reset();
+}
+
+bool OvRendering::Resources::Mesh::IsUploaded() const
+{
+	return m_vertexArray != nullptr;
+}
+
 void OvRendering::Resources::Mesh::Bind()
 {
-	m_vertexArray.Bind();
+	m_vertexArray->Bind();
 }
 
 void OvRendering::Resources::Mesh::Unbind()
 {
-	m_vertexArray.Unbind();
+	m_vertexArray->Unbind();
 }
 
 uint32_t OvRendering::Resources::Mesh::GetVertexCount()
@@ -41,11 +93,49 @@ uint32_t OvRendering::Resources::Mesh::GetIndexCount()
 	return m_indicesCount;
 }
 
+uint32_t OvRendering::Resources::Mesh::GetVertexArrayID()
+{
+	return m_vertexArray ? static_cast<uint32_t>(m_vertexArray->GetID()) : 0;
+}
+
+OvRendering::Buffers::EType OvRendering::Resources::Mesh::GetIndexType()
+{
+	return m_indexType;
+}
+
 uint32_t OvRendering::Resources::Mesh::GetMaterialIndex() const
 {
 	return m_materialIndex;
 }
 
+bool OvRendering::Resources::Mesh::HasBones() const
+{
+	return m_hasBone;
+}
+
+const void* OvRendering::Resources::Mesh::GetStagingVertexData() const
+{
+	return m_stagingVertexData;
+}
+
+const void* OvRendering::Resources::Mesh::GetStagingIndexData() const
+{
+	return m_stagingIndexData;
+}
+
+uint32_t OvRendering::Resources::Mesh::GetVertexSize(bool p_hasBone)
+{
+	uint32_t vertexSize = sizeof(float) * (3+2+3+3+3);
+
+	if (p_hasBone)
+	{
+		vertexSize += sizeof(int) * 4;
+		vertexSize += sizeof(float) * 4;
+	}
+
+	return vertexSize;
+}
+
 const OvRendering::Geometry::BoundingSphere& OvRendering::Resources::Mesh::GetBoundingSphere() const
 {
 	return m_boundingSphere;
@@ -7,6 +7,8 @@
 #include "OvRendering/Resources/ModelHierarchy.h"
 #include <iostream>
 #include <cassert>
+#include <cmath>
+#include <algorithm>
 int OvRendering::Resources::ModelHierarchyNode::GetIndex(bool cached)
 {
 	if (cached)
@@ -37,81 +39,146 @@ OvRendering::Resources::ModelNodeAnimation::ModelNodeAnimation(ModelHierarchy* h
 	for (int i = 0; i < anim->mNumPositionKeys; i++)
 		this->positions.emplace_back(anim->mPositionKeys[i].mTime, *(OvMaths::FVector3*)&anim->mPositionKeys[i].mValue);
 
+	// aiQuaternion is stored as (w, x, y, z), it can't be reinterpreted as a FQuaternion
 	for (int i = 0; i < anim->mNumRotationKeys; i++)
-		this->rotations.emplace_back(anim->mRotationKeys[i].mTime, *(OvMaths::FQuaternion*)&anim->mRotationKeys[i].mValue);
+	{
+		const auto& value = anim->mRotationKeys[i].mValue;
+		this->rotations.emplace_back(anim->mRotationKeys[i].mTime, OvMaths::FQuaternion(value.x, value.y, value.z, value.w));
+	}
 
 	for (int i = 0; i < anim->mNumScalingKeys; i++)
 		this->scales.emplace_back(anim->mScalingKeys[i].mTime, *(OvMaths::FVector3*)&anim->mScalingKeys[i].mValue);
 
 }
 
+// Index of the last key at or before the given time (0 if the time is before the first key).
+// The cursor (Result of the previous search) is checked first, then a binary search is done
 template<class T>
-T Interpolate(std::vector<std::tuple<double, T>> keys, double time)
+uint32_t FindKey(const std::vector<std::tuple<double, T>>& keys, double time, uint32_t& cursor)
 {
-	int len = keys.size();
-	assert(len > 0);
-	if (time < std::get<0>(keys.front()))
-		return std::get<1>(keys.front());
-	int left = -1;
-	int right = -1;
-	for (int i = 1; i < len; i++)
+	const uint32_t last = static_cast<uint32_t>(keys.size()) - 1;
+
+	if (cursor > last)
+		cursor = 0;
+
+	if (std::get<0>(keys[cursor]) <= time)
 	{
-		if (std::get<0>(keys[i]) > time)
-		{
-			left = i - 1;
-			right = i;
-			break;
-		}
+		if (cursor == last || time < std::get<0>(keys[cursor + 1]))
+			return cursor;
+
+		if (cursor + 1 == last || time < std::get<0>(keys[cursor + 2]))
+			return ++cursor;
 	}
-	if (left < 0 || right < 0)
-		return std::get<1>(keys[len -1]);
 
-	T& vl = std::get<1>(keys[left]);
-	T& vr = std::get<1>(keys[right]);
+	auto next = std::upper_bound(keys.begin(), keys.end(), time, [](double t, const std::tuple<double, T>& key) { return t < std::get<0>(key); });
+	cursor = next == keys.begin() ? 0 : static_cast<uint32_t>(next - keys.begin() - 1);
+	return cursor;
+}
+
+template<class T, class Mixer>
+T Interpolate(const std::vector<std::tuple<double, T>>& keys, double time, uint32_t& cursor, const T& defaultValue, Mixer mix)
+{
+	if (keys.empty())
+		return defaultValue;
+
+	const uint32_t left = FindKey(keys, time, cursor);
 
-	double d = std::get<0>(keys[right]) - std::get<0>(keys[left]);
-	double dl = time - std::get<0>(keys[left]);
-	double dr = std::get<0>(keys[right]) - time;
+	if (left + 1 >= keys.size() || time <= std::get<0>(keys[left]))
+		return std::get<1>(keys[left]);
 
-	return (vl * dl + vr * dr) / d;
+	const double leftTime = std::get<0>(keys[left]);
+	const double rightTime = std::get<0>(keys[left + 1]);
+	const float alpha = static_cast<float>((time - leftTime) / (rightTime - leftTime));
+
+	return mix(std::get<1>(keys[left]), std::get<1>(keys[left + 1]), alpha);
 }
 
 OvMaths::FMatrix4 OvRendering::Resources::ModelNodeAnimation::GetAnimationTransform(double time) const
 {
-	auto position = Interpolate(positions, time);// getvec(find(time, positions), positions);
-	auto rotation = Interpolate(rotations, time);//getqua(find(time, rotations), rotations);
-	auto scale = Interpolate(scales, time);
+	uint32_t cursors[3] = { 0, 0, 0 };
+	return GetAnimationTransform(time, cursors);
+}
 
-	return OvMaths::FMatrix4::Translation(position) * OvMaths::FQuaternion::ToMatrix4(OvMaths::FQuaternion::Normalize(rotation)) * OvMaths::FMatrix4::Scaling(scale);
+OvMaths::FMatrix4 OvRendering::Resources::ModelNodeAnimation::GetAnimationTransform(double time, uint32_t* cursors) const
+{
+	auto position = Interpolate(positions, time, cursors[0], OvMaths::FVector3::Zero, OvMaths::FVector3::Lerp);
+	auto rotation = Interpolate(rotations, time, cursors[1], OvMaths::FQuaternion::Identity, OvMaths::FQuaternion::Slerp);
+	auto scale = Interpolate(scales, time, cursors[2], OvMaths::FVector3::One, OvMaths::FVector3::Lerp);
 
+	return OvMaths::FMatrix4::Translation(position) * OvMaths::FQuaternion::ToMatrix4(OvMaths::FQuaternion::Normalize(rotation)) * OvMaths::FMatrix4::Scaling(scale);
 }
 
-OvRendering::Resources::ModelHierarchyNode* OvRendering::Resources::ModelHierarchy::GetNode(std::string name)
+OvRendering::Resources::ModelHierarchyNode* OvRendering::Resources::ModelHierarchy::GetNode(const std::string& name)
 {
-	for (auto& it : this->nodes)
-		if (it.m_name == name)
-			return &it;
-	return nullptr;
+	int index = GetNodeIndex(name);
+	return index < 0 ? nullptr : &nodes[index];
 }
 
-int OvRendering::Resources::ModelHierarchy::GetNodeIndex(std::string name) const
+int OvRendering::Resources::ModelHierarchy::GetNodeIndex(const std::string& name) const
 {
-	for (int i = 0; i < nodes.size(); i++)
-	{
-		if (nodes[i].m_name == name)
-			return i;
-	}
-	return -1;
+	auto found = m_nodeIndices.find(name);
+	return found == m_nodeIndices.end() ? -1 : found->second;
 }
 
 void OvRendering::Resources::ModelHierarchy::Init(const aiScene* scene)
 {
 	CreateChildNode(scene, scene->mRootNode, -1);
 
+	m_parentIndices.resize(nodes.size());
+	m_localTransforms.resize(nodes.size());
+	for (size_t i = 0; i < nodes.size(); i++)
+	{
+		assert(nodes[i].parent < static_cast<int>(i));
+		m_parentIndices[i] = nodes[i].parent;
+		m_localTransforms[i] = nodes[i].m_localTransform;
+	}
+
 	for (int i = 0; i < scene->mNumAnimations; i++)
 		this->animations.emplace_back(this, scene->mAnimations[i]);
 }
 
+bool OvRendering::Resources::ModelHierarchy::BuildLookups()
+{
+	// Nodes are linked to their parent by index below, so an invalid parent would be written out of bounds
+	for (size_t i = 0; i < nodes.size(); i++)
+	{
+		if (nodes[i].parent < -1 || nodes[i].parent >= static_cast<int>(i))
+			return false;
+	}
+
+	m_nodeIndices.clear();
+	m_parentIndices.resize(nodes.size());
+	m_localTransforms.resize(nodes.size());
+	for (size_t i = 0; i < nodes.size(); i++)
+	{
+		auto& node = nodes[i];
+		node.m_hierarchy = this;
+		node.index = static_cast<int>(i);
+		node.m_childrenIndices.clear();
+		if (node.parent >= 0)
+			nodes[node.parent].m_childrenIndices.insert(node.index);
+		m_nodeIndices.emplace(node.m_name, node.index);
+		m_parentIndices[i] = node.parent;
+		m_localTransforms[i] = node.m_localTransform;
+	}
+
+	for (auto& animation : animations)
+	{
+		animation.hierarchy = this;
+		animation.m_nodeChannels.assign(nodes.size(), -1);
+		for (size_t i = 0; i < animation.m_modelNodeAnimations.size(); i++)
+		{
+			auto& channel = animation.m_modelNodeAnimations[i];
+			channel.m_hierarchy = this;
+			int nodeIndex = GetNodeIndex(channel.m_hierarchyNodeName);
+			if (nodeIndex >= 0)
+				animation.m_nodeChannels[nodeIndex] = static_cast<int>(i);
+		}
+	}
+
+	return true;
+}
+
 void OvRendering::Resources::ModelHierarchy::CreateChildNode(const aiScene* scene, aiNode* node, int parentIndex)
 {
 	assert(parentIndex < (int)nodes.size());
@@ -119,8 +186,9 @@ void OvRendering::Resources::ModelHierarchy::CreateChildNode(const aiScene* scen
 
 	auto& mnode = nodes.emplace_back(scene, node);
 	mnode.m_hierarchy = this;
-	int index = mnode.GetIndex();
+	int index = static_cast<int>(nodes.size()) - 1;
 	mnode.index = index;
+	m_nodeIndices.emplace(mnode.m_name, index);
 	mnode.parent = parentIndex;
 	if (parentIndex >= 0)
 	{
@@ -172,11 +240,22 @@ OvRendering::Resources::ModelHierarchyAnimation::ModelHierarchyAnimation(ModelHi
 {
 	this->hierarchy = hierarchy;
 	this->m_animName = anim->mName.C_Str();
+	this->m_duration = anim->mDuration;
+	this->m_ticksPerSecond = anim->mTicksPerSecond != 0.0 ? anim->mTicksPerSecond : 25.0; // Assimp default when the file doesn't specify it
 	for (int i = 0; i < anim->mNumChannels; i++)
 		this->m_modelNodeAnimations.emplace_back(hierarchy, anim->mChannels[i]);
+
+	// Hierarchy nodes are created before the animations, so channels can be bound to their nodes once here
+	m_nodeChannels.assign(hierarchy->nodes.size(), -1);
+	for (int i = 0; i < m_modelNodeAnimations.size(); i++)
+	{
+		int nodeIndex = hierarchy->GetNodeIndex(m_modelNodeAnimations[i].m_hierarchyNodeName);
+		if (nodeIndex >= 0)
+			m_nodeChannels[nodeIndex] = i;
+	}
 }
 
-const OvRendering::Resources::ModelNodeAnimation* OvRendering::Resources::ModelHierarchyAnimation::GetNodeAnimation(std::string name) const
+const OvRendering::Resources::ModelNodeAnimation* OvRendering::Resources::ModelHierarchyAnimation::GetNodeAnimation(const std::string& name) const
 {
 	for (auto& n : m_modelNodeAnimations)
 		if (n.m_hierarchyNodeName == name)
@@ -192,50 +271,56 @@ OvRendering::Resources::MeshRigBoneInfo::MeshRigBoneInfo(std::string name, OvMat
 	:m_boneName(name), m_worldToRigSpaceMatrix(offset)
 {}
 
-void OvRendering::Resources::ModelNodeTransformCalculator::CalculateNodeTransform(int nodeIndex, int parentIndex)
-{
-	auto& node = m_hierarchy.nodes[nodeIndex];
-	auto& parentWorldTransfom = parentIndex < 0 ? OvMaths::FMatrix4::Identity : hierarchyWorldTransforms[parentIndex];
-	hierarchyWorldTransforms[nodeIndex] = parentWorldTransfom * hierarchyLocalTransforms[nodeIndex];
-	for (auto i : node.m_childrenIndices)
-		CalculateNodeTransform(i, nodeIndex);
-}
-
 OvRendering::Resources::ModelNodeTransformCalculator::ModelNodeTransformCalculator(const ModelHierarchy& hierarchy, const ModelHierarchyAnimation& animation)
-	:m_hierarchy(hierarchy), animation(animation)
+	:m_hierarchy(hierarchy), animation(animation), m_sampledTime(-1.0)
 {
 	hierarchyWorldTransforms.resize(hierarchy.nodes.size());
-	hierarchyLocalTransforms.resize(hierarchy.nodes.size());
+	m_keyCursors.resize(animation.m_modelNodeAnimations.size() * 3, 0);
+	SampleAnimation(0.0);
 }
 
-void OvRendering::Resources::ModelNodeTransformCalculator::GetRigBoneTransforms(const MeshRigInfo& rig, OvMaths::FMatrix4* transforms)
+void OvRendering::Resources::ModelNodeTransformCalculator::SampleAnimation(double time)
 {
+	if (time == m_sampledTime)
+		return;
 
-	for (int i = 0; i < m_hierarchy.nodes.size(); i++)
-	{
-		hierarchyLocalTransforms[i] = m_hierarchy.nodes[i].m_localTransform;
+	m_sampledTime = time;
 
-		// bug to fix 
-		/*auto pNodeAnimation = animation.GetNodeAnimation(hierarchy.nodes[i].name);
-		if (nullptr != pNodeAnimation)
-			hierarchyLocalTransforms[i] = pNodeAnimation->GetAnimationTransform(0);*/
+	double ticks = time * animation.m_ticksPerSecond;
+	if (animation.m_duration > 0.0)
+	{
+		ticks = std::fmod(ticks, animation.m_duration);
+		if (ticks < 0.0)
+			ticks += animation.m_duration;
 	}
 
+	// Parents are always evaluated before their children (See ModelHierarchy::m_parentIndices)
+	const size_t nodeCount = hierarchyWorldTransforms.size();
+	for (size_t i = 0; i < nodeCount; i++)
+	{
+		const int channel = animation.m_nodeChannels[i];
+		const OvMaths::FMatrix4 localTransform = channel < 0 ?
+			m_hierarchy.m_localTransforms[i] :
+			animation.m_modelNodeAnimations[channel].GetAnimationTransform(ticks, &m_keyCursors[channel * 3]);
 
-	CalculateNodeTransform(0, -1);
-
+		const int parent = m_hierarchy.m_parentIndices[i];
+		hierarchyWorldTransforms[i] = parent < 0 ? localTransform : hierarchyWorldTransforms[parent] * localTransform;
+	}
+}
 
-	int count = rig.m_boneInfos.size();
-	int nodeIndex = m_hierarchy.GetNodeIndex(rig.m_meshNodeName);
+void OvRendering::Resources::ModelNodeTransformCalculator::GetRigBoneTransforms(const MeshRigInfo& rig, OvMaths::FMatrix4* transforms) const
+{
+	const bool resolved = rig.m_boneNodeIndices.size() == rig.m_boneInfos.size();
+	const int count = static_cast<int>(rig.m_boneInfos.size());
 
 	for (int i = 0; i < count; i++)
 	{
-		int matrixIndex = m_hierarchy.GetNodeIndex(rig.m_boneInfos[i].m_boneName);
-		transforms[i] = hierarchyWorldTransforms[matrixIndex] * rig.m_boneInfos[i].m_worldToRigSpaceMatrix;
+		const int nodeIndex = resolved ? rig.m_boneNodeIndices[i] : m_hierarchy.GetNodeIndex(rig.m_boneInfos[i].m_boneName);
+		transforms[i] = nodeIndex < 0 ? OvMaths::FMatrix4::Identity : hierarchyWorldTransforms[nodeIndex] * rig.m_boneInfos[i].m_worldToRigSpaceMatrix;
 	}
 }
 
-int OvRendering::Resources::MeshRigInfo::GetBoneIndex(std::string name)
+int OvRendering::Resources::MeshRigInfo::GetBoneIndex(const std::string& name)
 {
 	for (int i = 0; i < m_boneInfos.size(); i++)
 	{
@@ -244,3 +329,10 @@ int OvRendering::Resources::MeshRigInfo::GetBoneIndex(std::string name)
 	}
 	return -1;
 }
+
+void OvRendering::Resources::MeshRigInfo::ResolveNodeIndices(const ModelHierarchy& hierarchy)
+{
+	m_boneNodeIndices.resize(m_boneInfos.size());
+	for (int i = 0; i < m_boneInfos.size(); i++)
+		m_boneNodeIndices[i] = hierarchy.GetNodeIndex(m_boneInfos[i].m_boneName);
+}
\ No newline at end of file
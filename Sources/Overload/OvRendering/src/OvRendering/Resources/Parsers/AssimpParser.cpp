@@ -86,6 +86,10 @@ bool OvRendering::Resources::Parsers::AssimpParser::LoadModel(const std::string
 	p_modelHierarchy.DumpNodeTree();
 	std::cout << "=========== end ===========" << std::endl;
 	ProcessNode(&identity, scene->mRootNode, scene, p_meshes);
+
+	for (auto mesh : p_meshes)
+		mesh->m_rigInfo.ResolveNodeIndices(p_modelHierarchy);
+
 	return true;
 }
 
@@ -118,7 +122,7 @@ void OvRendering::Resources::Parsers::AssimpParser::ProcessNode(void* p_transfor
 		ovmesh->m_rigInfo.m_meshName = mesh->mName.C_Str();
 		ProcessMesh(&nodeTransformation, mesh, p_scene, vertices, indices, ovmesh->m_rigInfo);
 		std::cout << "Init mesh " << ovmesh->m_rigInfo.m_meshName << " on node " << ovmesh->m_rigInfo.m_meshNodeName << std::endl;
-		ovmesh->Init(vertices, indices, mesh->mMaterialIndex);
+		ovmesh->InitDeferred(vertices, indices, mesh->mMaterialIndex); // GPU buffers are created later by the model loader
 		p_meshes.push_back(ovmesh); // The model will handle mesh destruction
 	}
 
@@ -0,0 +1,441 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#include <atomic>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <random>
+
+#include <OvTools/Filesystem/MappedFile.h>
+
+#include "OvRendering/Resources/Parsers/CookedModelParser.h"
+
+namespace
+{
+	constexpr char kMagic[4] = { 'O', 'V', 'C', 'M' };
+	constexpr uint32_t kVersion = 1;
+	constexpr uint32_t kStreamAlignment = 16;
+
+	/* Smallest serialized size of each element, used to reject counts that can't fit in the file before allocating anything */
+	constexpr size_t kMinStringSize = sizeof(uint32_t);
+	constexpr size_t kMinNodeSize = kMinStringSize + sizeof(OvMaths::FMatrix4) + sizeof(int32_t) + sizeof(uint32_t);
+	constexpr size_t kMinAnimationSize = kMinStringSize + 2 * sizeof(double) + sizeof(uint32_t);
+	constexpr size_t kMinChannelSize = kMinStringSize + 3 * sizeof(uint32_t);
+	constexpr size_t kMinBoneSize = kMinStringSize + sizeof(OvMaths::FMatrix4);
+	constexpr size_t kMinMeshSize = 3 * sizeof(uint32_t) + 2 * sizeof(uint8_t) + sizeof(OvRendering::Geometry::BoundingSphere) + 2 * kMinStringSize + sizeof(uint32_t);
+
+	/* Identifies the state of a source file, a cooked model is outdated as soon as it changes */
+	struct SourceStamp
+	{
+		uint64_t size = 0;
+		int64_t writeTime = 0;
+	};
+
+	bool GetSourceStamp(const std::string& p_fileName, SourceStamp& p_out)
+	{
+		std::error_code error;
+		p_out.size = static_cast<uint64_t>(std::filesystem::file_size(p_fileName, error));
+		if (error)
+			return false;
+
+		p_out.writeTime = static_cast<int64_t>(std::filesystem::last_write_time(p_fileName, error).time_since_epoch().count());
+		return !error;
+	}
+
+	class Writer
+	{
+	public:
+		template<typename T>
+		void Write(const T& p_value)
+		{
+			WriteBytes(&p_value, sizeof(T));
+		}
+
+		void WriteBytes(const void* p_data, size_t p_size)
+		{
+			const auto bytes = static_cast<const uint8_t*>(p_data);
+			m_bytes.insert(m_bytes.end(), bytes, bytes + p_size);
+		}
+
+		void WriteString(const std::string& p_value)
+		{
+			Write(static_cast<uint32_t>(p_value.size()));
+			WriteBytes(p_value.data(), p_value.size());
+		}
+
+		void Align(size_t p_alignment)
+		{
+			m_bytes.resize((m_bytes.size() + p_alignment - 1) / p_alignment * p_alignment, 0);
+		}
+
+		const std::vector<uint8_t>& GetBytes() const
+		{
+			return m_bytes;
+		}
+
+	private:
+		std::vector<uint8_t> m_bytes;
+	};
+
+	/* Reads from the mapped file. Reading past the end invalidates the reader instead of reading out of bounds */
+	class Reader
+	{
+	public:
+		Reader(const uint8_t* p_data, size_t p_size) : m_data(p_data), m_size(p_size) {}
+
+		template<typename T>
+		T Read()
+		{
+			T value{};
+
+			if (const uint8_t* bytes = ReadBytes(sizeof(T)))
+				std::memcpy(&value, bytes, sizeof(T));
+
+			return value;
+		}
+
+		const uint8_t* ReadBytes(size_t p_size)
+		{
+			if (!m_valid || p_size > m_size - m_offset)
+			{
+				m_valid = false;
+				return nullptr;
+			}
+
+			const uint8_t* bytes = m_data + m_offset;
+			m_offset += p_size;
+			return bytes;
+		}
+
+		/* Read an element count, invalidating the reader if the remaining bytes can't hold that many elements of the given minimum size */
+		uint32_t ReadCount(size_t p_minElementSize)
+		{
+			const uint32_t count = Read<uint32_t>();
+
+			if (!m_valid || static_cast<uint64_t>(count) * p_minElementSize > m_size - m_offset)
+			{
+				m_valid = false;
+				return 0;
+			}
+
+			return count;
+		}
+
+		std::string ReadString()
+		{
+			const uint32_t size = Read<uint32_t>();
+
+			if (const uint8_t* bytes = ReadBytes(size))
+				return std::string(reinterpret_cast<const char*>(bytes), size);
+
+			return {};
+		}
+
+		void Align(size_t p_alignment)
+		{
+			const size_t aligned = (m_offset + p_alignment - 1) / p_alignment * p_alignment;
+
+			if (aligned > m_size)
+				m_valid = false;
+			else
+				m_offset = aligned;
+		}
+
+		bool IsValid() const
+		{
+			return m_valid;
+		}
+
+	private:
+		const uint8_t* m_data;
+		size_t m_size;
+		size_t m_offset = 0;
+		bool m_valid = true;
+	};
+
+	template<typename T>
+	void WriteKeys(Writer& p_writer, const std::vector<std::tuple<double, T>>& p_keys)
+	{
+		p_writer.Write(static_cast<uint32_t>(p_keys.size()));
+
+		for (const auto& [time, value] : p_keys)
+		{
+			p_writer.Write(time);
+			p_writer.Write(value);
+		}
+	}
+
+	template<typename T>
+	void ReadKeys(Reader& p_reader, std::vector<std::tuple<double, T>>& p_keys)
+	{
+		const uint32_t count = p_reader.ReadCount(sizeof(double) + sizeof(T));
+
+		for (uint32_t i = 0; i < count && p_reader.IsValid(); ++i)
+		{
+			const double time = p_reader.Read<double>();
+			p_keys.emplace_back(time, p_reader.Read<T>());
+		}
+	}
+
+	std::string GetTemporaryPath(const std::string& p_cookedPath)
+	{
+		static const uint64_t processToken = (static_cast<uint64_t>(std::random_device{}()) << 32) | std::random_device{}();
+		static std::atomic<uint32_t> counter = 0;
+
+		return p_cookedPath + "." + std::to_string(processToken) + "-" + std::to_string(counter++) + ".tmp";
+	}
+}
+
+bool OvRendering::Resources::Parsers::CookedModelParser::LoadModel(const std::string& p_fileName, std::vector<Mesh*>& p_meshes, std::vector<std::string>& p_materials, EModelParserFlags p_parserFlags, OvRendering::Resources::ModelHierarchy& p_modelHierarchy)
+{
+	SourceStamp stamp;
+
+	if (!GetSourceStamp(p_fileName, stamp))
+		return false;
+
+	auto file = std::make_shared<OvTools::Filesystem::MappedFile>(GetCookedPath(p_fileName));
+
+	if (!file->IsOpen())
+		return false;
+
+	Reader reader(file->GetData(), file->GetSize());
+
+	const uint8_t* magic = reader.ReadBytes(sizeof(kMagic));
+
+	if (!magic || std::memcmp(magic, kMagic, sizeof(kMagic)) != 0 ||
+		reader.Read<uint32_t>() != kVersion ||
+		reader.Read<uint64_t>() != stamp.size ||
+		reader.Read<int64_t>() != stamp.writeTime ||
+		reader.Read<uint32_t>() != static_cast<uint32_t>(p_parserFlags))
+		return false;
+
+	/* Everything is read into locals first, so the outputs are left untouched if the file is truncated or invalid */
+	std::vector<std::string> materials(reader.ReadCount(kMinStringSize));
+	for (auto& material : materials)
+		material = reader.ReadString();
+
+	ModelHierarchy hierarchy;
+	hierarchy.nodes.resize(reader.ReadCount(kMinNodeSize));
+	for (size_t i = 0; i < hierarchy.nodes.size(); ++i)
+	{
+		auto& node = hierarchy.nodes[i];
+		node.m_name = reader.ReadString();
+		node.m_localTransform = reader.Read<OvMaths::FMatrix4>();
+		node.parent = reader.Read<int32_t>();
+		node.m_meshNames.resize(reader.ReadCount(kMinStringSize));
+		for (auto& meshName : node.m_meshNames)
+			meshName = reader.ReadString();
+
+		/* Nodes are stored depth first, so a parent is always a previous node */
+		if (!reader.IsValid() || node.parent < -1 || node.parent >= static_cast<int>(i))
+			return false;
+	}
+
+	hierarchy.animations.resize(reader.ReadCount(kMinAnimationSize));
+	for (auto& animation : hierarchy.animations)
+	{
+		animation.m_animName = reader.ReadString();
+		animation.m_duration = reader.Read<double>();
+		animation.m_ticksPerSecond = reader.Read<double>();
+		animation.m_modelNodeAnimations.resize(reader.ReadCount(kMinChannelSize));
+		for (auto& channel : animation.m_modelNodeAnimations)
+		{
+			channel.m_hierarchyNodeName = reader.ReadString();
+			ReadKeys(reader, channel.positions);
+			ReadKeys(reader, channel.rotations);
+			ReadKeys(reader, channel.scales);
+
+			if (!reader.IsValid())
+				return false;
+		}
+	}
+
+	std::vector<std::unique_ptr<Mesh>> meshes(reader.ReadCount(kMinMeshSize));
+	for (auto& mesh : meshes)
+	{
+		const uint32_t materialIndex = reader.Read<uint32_t>();
+		const uint32_t vertexCount = reader.Read<uint32_t>();
+		const uint32_t indexCount = reader.Read<uint32_t>();
+		const bool hasBone = reader.Read<uint8_t>() != 0;
+		const uint8_t indexSize = reader.Read<uint8_t>();
+		const auto boundingSphere = reader.Read<Geometry::BoundingSphere>();
+
+		if (materialIndex >= materials.size())
+			return false;
+
+		mesh = std::make_unique<Mesh>();
+		mesh->m_rigInfo.m_meshName = reader.ReadString();
+		mesh->m_rigInfo.m_meshNodeName = reader.ReadString();
+
+		const uint32_t boneCount = reader.ReadCount(kMinBoneSize);
+		for (uint32_t i = 0; i < boneCount && reader.IsValid(); ++i)
+		{
+			std::string boneName = reader.ReadString();
+			auto offset = reader.Read<OvMaths::FMatrix4>();
+			mesh->m_rigInfo.m_boneInfos.emplace_back(boneName, offset);
+		}
+
+		reader.Align(kStreamAlignment);
+		const size_t vertexDataSize = static_cast<size_t>(vertexCount) * Mesh::GetVertexSize(hasBone);
+		const uint8_t* vertexData = reader.ReadBytes(vertexDataSize);
+
+		reader.Align(kStreamAlignment);
+		const size_t indexDataSize = static_cast<size_t>(indexCount) * indexSize;
+		const uint8_t* indexData = reader.ReadBytes(indexDataSize);
+
+		if (!reader.IsValid() || (indexSize != sizeof(uint16_t) && indexSize != sizeof(uint32_t)))
+			return false;
+
+		const auto indexType = indexSize == sizeof(uint16_t) ? Buffers::EType::UNSIGNED_SHORT : Buffers::EType::UNSIGNED_INT;
+		mesh->InitFromMemory(vertexData, vertexCount, indexData, indexCount, indexType, materialIndex, hasBone, boundingSphere, file);
+	}
+
+	/* A count read past the end is 0, so a file truncated before a count is only detected here */
+	if (!reader.IsValid())
+		return false;
+
+	/* The streams are read by the calling (Loading) thread rather than by the GPU upload */
+	file->Prefetch();
+
+	p_materials = std::move(materials);
+	p_modelHierarchy.nodes = std::move(hierarchy.nodes);
+	p_modelHierarchy.animations = std::move(hierarchy.animations);
+	p_modelHierarchy.BuildLookups();
+
+	for (auto& mesh : meshes)
+	{
+		mesh->m_rigInfo.ResolveNodeIndices(p_modelHierarchy);
+		p_meshes.push_back(mesh.release()); // The model will handle mesh destruction
+	}
+
+	return true;
+}
+
+bool OvRendering::Resources::Parsers::CookedModelParser::Cook(const std::string& p_fileName, const std::vector<Mesh*>& p_meshes, const std::vector<std::string>& p_materials, EModelParserFlags p_parserFlags, const OvRendering::Resources::ModelHierarchy& p_modelHierarchy)
+{
+	SourceStamp stamp;
+
+	if (!GetSourceStamp(p_fileName, stamp))
+		return false;
+
+	Writer writer;
+	writer.WriteBytes(kMagic, sizeof(kMagic));
+	writer.Write(kVersion);
+	writer.Write(stamp.size);
+	writer.Write(stamp.writeTime);
+	writer.Write(static_cast<uint32_t>(p_parserFlags));
+
+	writer.Write(static_cast<uint32_t>(p_materials.size()));
+	for (const auto& material : p_materials)
+		writer.WriteString(material);
+
+	writer.Write(static_cast<uint32_t>(p_modelHierarchy.nodes.size()));
+	for (const auto& node : p_modelHierarchy.nodes)
+	{
+		writer.WriteString(node.m_name);
+		writer.Write(node.m_localTransform);
+		writer.Write(static_cast<int32_t>(node.parent));
+		writer.Write(static_cast<uint32_t>(node.m_meshNames.size()));
+		for (const auto& meshName : node.m_meshNames)
+			writer.WriteString(meshName);
+	}
+
+	writer.Write(static_cast<uint32_t>(p_modelHierarchy.animations.size()));
+	for (const auto& animation : p_modelHierarchy.animations)
+	{
+		writer.WriteString(animation.m_animName);
+		writer.Write(animation.m_duration);
+		writer.Write(animation.m_ticksPerSecond);
+		writer.Write(static_cast<uint32_t>(animation.m_modelNodeAnimations.size()));
+		for (const auto& channel : animation.m_modelNodeAnimations)
+		{
+			writer.WriteString(channel.m_hierarchyNodeName);
+			WriteKeys(writer, channel.positions);
+			WriteKeys(writer, channel.rotations);
+			WriteKeys(writer, channel.scales);
+		}
+	}
+
+	writer.Write(static_cast<uint32_t>(p_meshes.size()));
+	for (const auto mesh : p_meshes)
+	{
+		const void* vertexData = mesh->GetStagingVertexData();
+		const void* indexData = mesh->GetStagingIndexData();
+
+		if (!vertexData || (!indexData && mesh->GetIndexCount() > 0))
+			return false;
+
+		const uint32_t vertexCount = mesh->GetVertexCount();
+		const uint32_t indexCount = mesh->GetIndexCount();
+		const bool sourceIsShort = mesh->GetIndexType() == Buffers::EType::UNSIGNED_SHORT;
+		const bool shortIndices = vertexCount <= 0x10000; // Every index fits in 16 bits
+
+		writer.Write(mesh->GetMaterialIndex());
+		writer.Write(vertexCount);
+		writer.Write(indexCount);
+		writer.Write(static_cast<uint8_t>(mesh->HasBones() ? 1 : 0));
+		writer.Write(static_cast<uint8_t>(shortIndices ? sizeof(uint16_t) : sizeof(uint32_t)));
+		writer.Write(mesh->GetBoundingSphere());
+		writer.WriteString(mesh->m_rigInfo.m_meshName);
+		writer.WriteString(mesh->m_rigInfo.m_meshNodeName);
+		writer.Write(static_cast<uint32_t>(mesh->m_rigInfo.m_boneInfos.size()));
+		for (const auto& bone : mesh->m_rigInfo.m_boneInfos)
+		{
+			writer.WriteString(bone.m_boneName);
+			writer.Write(bone.m_worldToRigSpaceMatrix);
+		}
+
+		writer.Align(kStreamAlignment);
+		writer.WriteBytes(vertexData, static_cast<size_t>(vertexCount) * Mesh::GetVertexSize(mesh->HasBones()));
+
+		writer.Align(kStreamAlignment);
+		for (uint32_t i = 0; i < indexCount; ++i)
+		{
+			const uint32_t index = sourceIsShort ? static_cast<const uint16_t*>(indexData)[i] : static_cast<const uint32_t*>(indexData)[i];
+
+			if (shortIndices)
+				writer.Write(static_cast<uint16_t>(index));
+			else
+				writer.Write(index);
+		}
+	}
+
+	/* Write to a temporary file first, so a cooked model is either complete or missing. The temporary file is unique
+	to this call, so concurrent cooks of the same model (Several threads or processes) don't write into each other */
+	const std::string cookedPath = GetCookedPath(p_fileName);
+	const std::string temporaryPath = GetTemporaryPath(cookedPath);
+
+	{
+		std::ofstream output(temporaryPath, std::ios::binary | std::ios::trunc);
+
+		if (!output)
+			return false;
+
+		output.write(reinterpret_cast<const char*>(writer.GetBytes().data()), writer.GetBytes().size());
+
+		if (!output)
+		{
+			output.close();
+			std::filesystem::remove(temporaryPath);
+			return false;
+		}
+	}
+
+	std::error_code error;
+	std::filesystem::rename(temporaryPath, cookedPath, error);
+
+	if (error)
+		std::filesystem::remove(temporaryPath, error);
+
+	return !error;
+}
+
+std::string OvRendering::Resources::Parsers::CookedModelParser::GetCookedPath(const std::string& p_fileName)
+{
+	return p_fileName + ".ovcooked";
+}
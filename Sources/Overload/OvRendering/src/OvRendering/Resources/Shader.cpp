@@ -14,6 +14,7 @@
 OvRendering::Resources::Shader::Shader(const std::string p_path, uint32_t p_id) : path(p_path), id(p_id)
 {
 	QueryUniforms();
+	QueryEngineFeatures();
 }
 
 OvRendering::Resources::Shader::~Shader()
@@ -61,6 +62,31 @@ void OvRendering::Resources::Shader::SetUniformMat4(const std::string& p_name, c
 	glUniformMatrix4fv(GetUniformLocation(p_name), 1, GL_TRUE, &p_mat4.data[0]);
 }
 
+void OvRendering::Resources::Shader::SetUniformInt(uint32_t p_location, int p_value)
+{
+	glUniform1i(p_location, p_value);
+}
+
+void OvRendering::Resources::Shader::SetUniformFloat(uint32_t p_location, float p_value)
+{
+	glUniform1f(p_location, p_value);
+}
+
+void OvRendering::Resources::Shader::SetUniformVec2(uint32_t p_location, const OvMaths::FVector2& p_vec2)
+{
+	glUniform2f(p_location, p_vec2.x, p_vec2.y);
+}
+
+void OvRendering::Resources::Shader::SetUniformVec3(uint32_t p_location, const OvMaths::FVector3& p_vec3)
+{
+	glUniform3f(p_location, p_vec3.x, p_vec3.y, p_vec3.z);
+}
+
+void OvRendering::Resources::Shader::SetUniformVec4(uint32_t p_location, const OvMaths::FVector4& p_vec4)
+{
+	glUniform4f(p_location, p_vec4.x, p_vec4.y, p_vec4.z, p_vec4.w);
+}
+
 int OvRendering::Resources::Shader::GetUniformInt(const std::string& p_name)
 {
 	int value;
@@ -127,6 +153,20 @@ void OvRendering::Resources::Shader::QueryUniforms()
 {
 	GLint numActiveUniforms = 0;
 	uniforms.clear();
+	m_uniformLocationCache.clear(); // Locations are only valid for the program they have been queried from
+	++m_uniformsRevision;
+
+	/* Uniforms declared in the MaterialUBO block are stored by the material in a std140 buffer instead of being sent one by one */
+	const GLuint materialBlockIndex = glGetUniformBlockIndex(id, "MaterialUBO");
+	m_materialBlockSize = 0;
+
+	if (materialBlockIndex != GL_INVALID_INDEX)
+	{
+		GLint blockSize = 0;
+		glGetActiveUniformBlockiv(id, materialBlockIndex, GL_UNIFORM_BLOCK_DATA_SIZE, &blockSize);
+		m_materialBlockSize = static_cast<uint32_t>(blockSize);
+	}
+
 	glGetProgramiv(id, GL_ACTIVE_UNIFORMS, &numActiveUniforms);
 	std::vector<GLchar> nameData(256);
 	for (int unif = 0; unif < numActiveUniforms; ++unif)
@@ -139,17 +179,28 @@ void OvRendering::Resources::Shader::QueryUniforms()
 
 		if (!IsEngineUBOMember(name))
 		{
+			const GLuint uniformIndex = static_cast<GLuint>(unif);
+			GLint blockIndex = -1;
+			glGetActiveUniformsiv(id, 1, &uniformIndex, GL_UNIFORM_BLOCK_INDEX, &blockIndex);
+
+			const bool isMaterialBlockMember = materialBlockIndex != GL_INVALID_INDEX && blockIndex == static_cast<GLint>(materialBlockIndex);
+
+			GLint blockOffset = -1;
+			if (isMaterialBlockMember)
+				glGetActiveUniformsiv(id, 1, &uniformIndex, GL_UNIFORM_OFFSET, &blockOffset);
+
 			std::any defaultValue;
 
+			/* Block members have no location to read a default value from, they start zeroed like the buffer that stores them */
 			switch (static_cast<UniformType>(type))
 			{
-			case OvRendering::Resources::UniformType::UNIFORM_BOOL:			defaultValue = std::make_any<bool>(GetUniformInt(name));					break;
-			case OvRendering::Resources::UniformType::UNIFORM_INT:			defaultValue = std::make_any<int>(GetUniformInt(name));						break;
-			case OvRendering::Resources::UniformType::UNIFORM_FLOAT:		defaultValue = std::make_any<float>(GetUniformFloat(name));					break;
-			case OvRendering::Resources::UniformType::UNIFORM_FLOAT_VEC2:	defaultValue = std::make_any<OvMaths::FVector2>(GetUniformVec2(name));		break;
-			case OvRendering::Resources::UniformType::UNIFORM_FLOAT_VEC3:	defaultValue = std::make_any<OvMaths::FVector3>(GetUniformVec3(name));		break;
-			case OvRendering::Resources::UniformType::UNIFORM_FLOAT_VEC4:	defaultValue = std::make_any<OvMaths::FVector4>(GetUniformVec4(name));		break;
-			case OvRendering::Resources::UniformType::UNIFORM_SAMPLER_2D:	defaultValue = std::make_any<OvRendering::Resources::Texture*>(nullptr);	break;
+			case OvRendering::Resources::UniformType::UNIFORM_BOOL:			defaultValue = std::make_any<bool>(isMaterialBlockMember ? false : GetUniformInt(name));											break;
+			case OvRendering::Resources::UniformType::UNIFORM_INT:			defaultValue = std::make_any<int>(isMaterialBlockMember ? 0 : GetUniformInt(name));												break;
+			case OvRendering::Resources::UniformType::UNIFORM_FLOAT:		defaultValue = std::make_any<float>(isMaterialBlockMember ? 0.0f : GetUniformFloat(name));										break;
+			case OvRendering::Resources::UniformType::UNIFORM_FLOAT_VEC2:	defaultValue = std::make_any<OvMaths::FVector2>(isMaterialBlockMember ? OvMaths::FVector2::Zero : GetUniformVec2(name));		break;
+			case OvRendering::Resources::UniformType::UNIFORM_FLOAT_VEC3:	defaultValue = std::make_any<OvMaths::FVector3>(isMaterialBlockMember ? OvMaths::FVector3::Zero : GetUniformVec3(name));		break;
+			case OvRendering::Resources::UniformType::UNIFORM_FLOAT_VEC4:	defaultValue = std::make_any<OvMaths::FVector4>(isMaterialBlockMember ? OvMaths::FVector4::Zero : GetUniformVec4(name));		break;
+			case OvRendering::Resources::UniformType::UNIFORM_SAMPLER_2D:	defaultValue = std::make_any<OvRendering::Resources::Texture*>(nullptr);						break;
 			}
 
 			if (defaultValue.has_value())
@@ -158,14 +209,60 @@ void OvRendering::Resources::Shader::QueryUniforms()
 				({
 					static_cast<UniformType>(type),
 					name,
-					GetUniformLocation(nameData.data()),
-					defaultValue
+					isMaterialBlockMember ? static_cast<uint32_t>(-1) : GetUniformLocation(nameData.data()),
+					defaultValue,
+					blockOffset
 				});
 			}
 		}
 	}
 }
 
+void OvRendering::Resources::Shader::QueryEngineFeatures()
+{
+	const bool hasInstanceBlock = glGetProgramResourceIndex(id, GL_SHADER_STORAGE_BLOCK, "InstanceSSBO") != GL_INVALID_INDEX;
+	const int instanceOffsetLocation = glGetUniformLocation(id, "ubo_InstanceOffset");
+
+	m_supportsInstancing = hasInstanceBlock && instanceOffsetLocation != -1;
+	m_instanceOffsetLocation = static_cast<uint32_t>(instanceOffsetLocation);
+
+	const bool hasBonePaletteBlock = glGetProgramResourceIndex(id, GL_SHADER_STORAGE_BLOCK, "BonePaletteSSBO") != GL_INVALID_INDEX;
+	const int boneOffsetLocation = glGetUniformLocation(id, "ubo_BoneOffset");
+
+	m_supportsSkinning = hasBonePaletteBlock && boneOffsetLocation != -1;
+	m_boneOffsetLocation = static_cast<uint32_t>(boneOffsetLocation);
+}
+
+uint32_t OvRendering::Resources::Shader::GetMaterialBlockSize() const
+{
+	return m_materialBlockSize;
+}
+
+uint32_t OvRendering::Resources::Shader::GetUniformsRevision() const
+{
+	return m_uniformsRevision;
+}
+
+bool OvRendering::Resources::Shader::SupportsInstancing() const
+{
+	return m_supportsInstancing;
+}
+
+bool OvRendering::Resources::Shader::SupportsSkinning() const
+{
+	return m_supportsSkinning;
+}
+
+uint32_t OvRendering::Resources::Shader::GetInstanceOffsetLocation() const
+{
+	return m_instanceOffsetLocation;
+}
+
+uint32_t OvRendering::Resources::Shader::GetBoneOffsetLocation() const
+{
+	return m_boneOffsetLocation;
+}
+
 const OvRendering::Resources::UniformInfo* OvRendering::Resources::Shader::GetUniformInfo(const std::string& p_name) const
 {
 	auto found = std::find_if(uniforms.begin(), uniforms.end(), [&p_name](const UniformInfo& p_element)
@@ -0,0 +1,120 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include <stdexcept>
+#include <cstdint>
+
+/**
+* Declare and register a test case. The body of the test must follow the macro
+*/
+#define OVTEST(suite, name)\
+		static void suite##_##name();\
+		static const bool __##suite##_##name##_registered__ = OvTests::TestRegistry::Register(#suite, #name, OvTests::ECaseType::TEST, &suite##_##name);\
+		static void suite##_##name()
+
+/**
+* Declare and register a benchmark. Benchmarks only run when asked to (--benchmarks)
+*/
+#define OVBENCHMARK(suite, name)\
+		static void suite##_##name();\
+		static const bool __##suite##_##name##_registered__ = OvTests::TestRegistry::Register(#suite, #name, OvTests::ECaseType::BENCHMARK, &suite##_##name);\
+		static void suite##_##name()
+
+/**
+* Fail the current test case if the given condition is false
+*/
+#define OVTEST_CHECK(condition)\
+		OvTests::TestRegistry::Check(static_cast<bool>(condition), #condition, __FILE__, __LINE__)
+
+namespace OvTests
+{
+	/**
+	* Defines the kind of a registered case
+	*/
+	enum class ECaseType
+	{
+		TEST,
+		BENCHMARK
+	};
+
+	/**
+	* Thrown by a failing check, stops the current case
+	*/
+	class TestFailure : public std::runtime_error
+	{
+	public:
+		using std::runtime_error::runtime_error;
+	};
+
+	/**
+	* A registered test case or benchmark
+	*/
+	struct TestCase
+	{
+		std::string suite;
+		std::string name;
+		ECaseType type;
+		void(*function)();
+	};
+
+	/**
+	* Keeps track of every test case of the executable. Cases register themselves through the OVTEST and OVBENCHMARK macros
+	*/
+	class TestRegistry
+	{
+	public:
+		/**
+		* Disabled constructor
+		*/
+		TestRegistry() = delete;
+
+		/**
+		* Register a case, returns true (Used to register cases during static initialization)
+		* @param p_suite
+		* @param p_name
+		* @param p_type
+		* @param p_function
+		*/
+		static bool Register(const std::string& p_suite, const std::string& p_name, ECaseType p_type, void(*p_function)());
+
+		/**
+		* Returns every registered case, in registration order
+		*/
+		static const std::vector<TestCase>& GetCases();
+
+		/**
+		* Throws a TestFailure describing the given expression if the condition is false
+		* @param p_condition
+		* @param p_expression
+		* @param p_file
+		* @param p_line
+		*/
+		static void Check(bool p_condition, const char* p_expression, const char* p_file, int p_line);
+
+		/**
+		* Returns the average duration (In milliseconds) of the given function over the given number of iterations
+		* @param p_function
+		* @param p_iterations
+		*/
+		template<typename T>
+		static double Measure(T p_function, uint32_t p_iterations = 1);
+
+		/**
+		* Returns a path in the temporary directory for the given file name, unique to the running process
+		* @param p_fileName
+		*/
+		static std::string GetTemporaryPath(const std::string& p_fileName);
+
+	private:
+		static std::vector<TestCase>& GetMutableCases();
+	};
+}
+
+#include "OvTests/TestRegistry.inl"
@@ -0,0 +1,26 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#pragma once
+
+#include <chrono>
+
+#include "OvTests/TestRegistry.h"
+
+namespace OvTests
+{
+	template<typename T>
+	inline double TestRegistry::Measure(T p_function, uint32_t p_iterations)
+	{
+		const auto start = std::chrono::steady_clock::now();
+
+		for (uint32_t i = 0; i < p_iterations; ++i)
+			p_function();
+
+		const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+		return elapsed.count() / static_cast<double>(p_iterations == 0 ? 1 : p_iterations);
+	}
+}
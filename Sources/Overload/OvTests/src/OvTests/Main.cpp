@@ -0,0 +1,62 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#include <iostream>
+#include <string>
+
+#include "OvTests/TestRegistry.h"
+
+/**
+* Runs every registered test (And benchmark if --benchmarks is given). Only cases whose "Suite.Name"
+* contains the --filter argument are run. Returns a non-zero code if any case failed
+*/
+int main(int p_argc, char** p_argv)
+{
+	bool runBenchmarks = false;
+	std::string filter;
+
+	for (int i = 1; i < p_argc; ++i)
+	{
+		const std::string argument = p_argv[i];
+
+		if (argument == "--benchmarks")
+			runBenchmarks = true;
+		else if (argument == "--filter" && i + 1 < p_argc)
+			filter = p_argv[++i];
+	}
+
+	uint32_t passed = 0;
+	uint32_t failed = 0;
+
+	for (const auto& testCase : OvTests::TestRegistry::GetCases())
+	{
+		const std::string fullName = testCase.suite + "." + testCase.name;
+
+		if (testCase.type == OvTests::ECaseType::BENCHMARK && !runBenchmarks)
+			continue;
+
+		if (!filter.empty() && fullName.find(filter) == std::string::npos)
+			continue;
+
+		std::cout << "[ RUN    ] " << fullName << std::endl;
+
+		try
+		{
+			testCase.function();
+			std::cout << "[     OK ] " << fullName << std::endl;
+			++passed;
+		}
+		catch (const std::exception& e)
+		{
+			std::cout << e.what() << std::endl << "[ FAILED ] " << fullName << std::endl;
+			++failed;
+		}
+	}
+
+	std::cout << passed << " passed, " << failed << " failed" << std::endl;
+
+	return failed == 0 ? 0 : 1;
+}
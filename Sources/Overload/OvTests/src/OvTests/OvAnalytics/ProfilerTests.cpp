@@ -0,0 +1,232 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <thread>
+
+#include <OvAnalytics/Profiling/Profiler.h>
+#include <OvAnalytics/Profiling/ProfilerSpy.h>
+
+#include "OvTests/TestRegistry.h"
+
+namespace
+{
+	using OvAnalytics::Profiling::Profiler;
+	using OvAnalytics::Profiling::ProfilerEventBuffer;
+	using OvAnalytics::Profiling::ProfilerFrame;
+	using OvAnalytics::Profiling::ProfilerReport;
+
+	const ProfilerFrame::Thread* FindThread(const ProfilerFrame& p_frame, std::thread::id p_id)
+	{
+		for (const auto& thread : p_frame.threads)
+		{
+			if (thread.id == p_id)
+				return &thread;
+		}
+
+		return nullptr;
+	}
+
+	uint64_t GetCalls(const ProfilerReport& p_report, const std::string& p_name)
+	{
+		for (const auto& action : p_report.actions)
+		{
+			if (action.name == p_name)
+				return action.calls;
+		}
+
+		return 0;
+	}
+
+	bool IsScope(const ProfilerFrame::Scope& p_scope, const char* p_name, uint32_t p_depth, int32_t p_parent)
+	{
+		return std::strcmp(p_scope.name, p_name) == 0 && p_scope.depth == p_depth && p_scope.parent == p_parent && p_scope.start <= p_scope.end;
+	}
+
+	bool IsNestedIn(const ProfilerFrame::Scope& p_child, const ProfilerFrame::Scope& p_parent)
+	{
+		return p_child.start >= p_parent.start && p_child.end <= p_parent.end;
+	}
+}
+
+OVTEST(Profiler, FramesRebuildTheScopeTree)
+{
+	Profiler profiler;
+	profiler.Enable();
+	profiler.ClearHistory();
+
+	/* Scopes of another thread are collected into their own timeline */
+	std::thread worker([]
+	{
+		PROFILER_SPY("Worker");
+		{ PROFILER_SPY("Worker Child"); }
+	});
+
+	const std::thread::id workerID = worker.get_id();
+	worker.join();
+
+	auto running = std::make_unique<OvAnalytics::Profiling::ProfilerSpy>("Running");
+
+	{
+		PROFILER_SPY("Root");
+		{
+			PROFILER_SPY("First Child");
+			{ PROFILER_SPY("Grandchild"); }
+		}
+		{ PROFILER_SPY("Second Child"); }
+	}
+
+	profiler.Update();
+
+	const ProfilerFrame& frame = profiler.GetLastFrame();
+	const auto mainThread = FindThread(frame, std::this_thread::get_id());
+	const auto workerThread = FindThread(frame, workerID);
+	OVTEST_CHECK(mainThread && workerThread);
+
+	/* Scopes are listed in the order they began, each knowing its depth and enclosing scope */
+	const auto& scopes = mainThread->scopes;
+	OVTEST_CHECK(scopes.size() == 5);
+	OVTEST_CHECK(IsScope(scopes[0], "Running", 0, -1));
+	OVTEST_CHECK(IsScope(scopes[1], "Root", 1, 0));
+	OVTEST_CHECK(IsScope(scopes[2], "First Child", 2, 1));
+	OVTEST_CHECK(IsScope(scopes[3], "Grandchild", 3, 2));
+	OVTEST_CHECK(IsScope(scopes[4], "Second Child", 2, 1));
+
+	for (size_t i = 1; i < scopes.size(); ++i)
+		OVTEST_CHECK(IsNestedIn(scopes[i], scopes[scopes[i].parent]) && scopes[i].start >= scopes[i - 1].start);
+
+	OVTEST_CHECK(scopes[4].start >= scopes[2].end);
+
+	/* A scope still running ends at the collection time */
+	OVTEST_CHECK(scopes[0].end == frame.end && scopes[1].end < frame.end);
+
+	OVTEST_CHECK(workerThread->scopes.size() == 2);
+	OVTEST_CHECK(IsScope(workerThread->scopes[0], "Worker", 0, -1) && IsScope(workerThread->scopes[1], "Worker Child", 1, 0));
+
+	/* Scopes begun in a previous frame are still the parents of the new ones, but outside of the frame */
+	{ PROFILER_SPY("Next Frame Child"); }
+	running.reset();
+	profiler.Update();
+
+	const auto nextThread = FindThread(profiler.GetLastFrame(), std::this_thread::get_id());
+	OVTEST_CHECK(nextThread && nextThread->scopes.size() == 1);
+	OVTEST_CHECK(IsScope(nextThread->scopes[0], "Next Frame Child", 1, -1));
+
+	const ProfilerReport report = profiler.GenerateReport();
+	OVTEST_CHECK(GetCalls(report, "Running") == 1 && GetCalls(report, "Grandchild") == 1 && GetCalls(report, "Worker Child") == 1);
+	OVTEST_CHECK(report.droppedScopes == 0);
+
+	profiler.Disable();
+	profiler.ClearHistory();
+}
+
+OVTEST(Profiler, FullBuffersDropScopesButKeepTheirEnds)
+{
+	constexpr uint32_t kScopeCount = 10000;
+
+	Profiler profiler;
+	profiler.Enable();
+	profiler.ClearHistory();
+
+	/* Each scope takes two events: the ring holds half its capacity in scopes, the others are dropped */
+	for (uint32_t i = 0; i < kScopeCount; ++i)
+		PROFILER_SPY("Flat");
+
+	profiler.Update();
+
+	ProfilerReport report = profiler.GenerateReport();
+	OVTEST_CHECK(GetCalls(report, "Flat") == ProfilerEventBuffer::Capacity / 2);
+	OVTEST_CHECK(report.droppedScopes == kScopeCount - ProfilerEventBuffer::Capacity / 2);
+	profiler.ClearHistory();
+
+	/* Room is kept for the end of every opened scope, so the enclosing scope still ends */
+	{
+		PROFILER_SPY("Outer");
+
+		for (uint32_t i = 0; i < kScopeCount; ++i)
+			PROFILER_SPY("Inner");
+	}
+
+	profiler.Update();
+
+	const uint32_t recordedInner = (ProfilerEventBuffer::Capacity - 2) / 2;
+	report = profiler.GenerateReport();
+	OVTEST_CHECK(GetCalls(report, "Outer") == 1 && GetCalls(report, "Inner") == recordedInner);
+	OVTEST_CHECK(report.droppedScopes == kScopeCount - recordedInner);
+
+	const ProfilerFrame& frame = profiler.GetLastFrame();
+	const auto thread = FindThread(frame, std::this_thread::get_id());
+	OVTEST_CHECK(thread && thread->scopes.size() == recordedInner + 1);
+	OVTEST_CHECK(IsScope(thread->scopes.front(), "Outer", 0, -1) && thread->scopes.front().end < frame.end);
+	OVTEST_CHECK(IsScope(thread->scopes.back(), "Inner", 1, 0));
+
+	/* Once collected, the buffer records again and the following frames stay paired */
+	{
+		PROFILER_SPY("After");
+		{ PROFILER_SPY("After Child"); }
+	}
+
+	profiler.Update();
+
+	const auto nextThread = FindThread(profiler.GetLastFrame(), std::this_thread::get_id());
+	OVTEST_CHECK(nextThread && nextThread->scopes.size() == 2);
+	OVTEST_CHECK(IsScope(nextThread->scopes[0], "After", 0, -1) && IsScope(nextThread->scopes[1], "After Child", 1, 0));
+
+	profiler.Disable();
+	profiler.ClearHistory();
+}
+
+OVBENCHMARK(Profiler, SpyOverhead)
+{
+	/* Spies per collection, below the ring capacity so that no scope is dropped */
+	constexpr uint32_t kSpiesPerFrame = 2000;
+	constexpr uint32_t kFrames = 500;
+
+	Profiler profiler;
+
+	const auto measure = [&profiler]
+	{
+		double spies = 0.0;
+		double collection = 0.0;
+
+		for (uint32_t frame = 0; frame < kFrames; ++frame)
+		{
+			spies += OvTests::TestRegistry::Measure([]
+			{
+				for (uint32_t i = 0; i < kSpiesPerFrame; ++i)
+					PROFILER_SPY("Benchmark Spy");
+			});
+
+			collection += OvTests::TestRegistry::Measure([&profiler] { profiler.Update(); });
+		}
+
+		return std::make_pair(spies * 1e6 / (kFrames * kSpiesPerFrame), collection / kFrames);
+	};
+
+	profiler.Disable();
+	const auto disabled = measure();
+
+	profiler.Enable();
+	profiler.ClearHistory();
+	const auto enabled = measure();
+
+	const ProfilerReport report = profiler.GenerateReport();
+	profiler.Disable();
+	profiler.ClearHistory();
+
+	/* A recorded scope reads the profiler clock twice, which is most of its cost on machines where reading it is slow (e.g. virtual machines) */
+	volatile int64_t timestamp = 0;
+	const double clockRead = OvTests::TestRegistry::Measure([&timestamp]
+	{
+		for (uint32_t i = 0; i < kSpiesPerFrame; ++i)
+			timestamp = ProfilerEventBuffer::GetTimestamp();
+	}, kFrames) * 1e6 / kSpiesPerFrame;
+
+	std::cout << "Disabled: " << disabled.first << " ns per spy" << std::endl;
+	std::cout << "Enabled: " << enabled.first << " ns per spy (" << enabled.first - 2.0 * clockRead << " ns without its two " << clockRead << " ns clock reads), " << enabled.second << " ms per collection of " << kSpiesPerFrame << " scopes (" << report.droppedScopes << " dropped)" << std::endl;
+}
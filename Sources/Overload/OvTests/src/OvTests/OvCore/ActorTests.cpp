@@ -0,0 +1,170 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#include <atomic>
+#include <iostream>
+#include <memory>
+
+#include <OvCore/ECS/Components/CAmbientBoxLight.h>
+#include <OvCore/ECS/Components/CAmbientSphereLight.h>
+#include <OvCore/ECS/Components/CCamera.h>
+#include <OvCore/ECS/Components/CPointLight.h>
+#include <OvCore/ECS/Components/CSpotLight.h>
+#include <OvCore/SceneSystem/Scene.h>
+#include <OvTools/Utils/ThreadPool.h>
+
+#include "OvTests/TestRegistry.h"
+
+namespace
+{
+	using namespace OvCore::ECS::Components;
+
+	/* The way GetComponent found components before its lookup existed */
+	template<typename T>
+	T* ScanComponents(OvCore::ECS::Actor& p_actor)
+	{
+		for (auto& component : p_actor.GetComponents())
+		{
+			if (auto result = std::dynamic_pointer_cast<T>(component))
+				return result.get();
+		}
+
+		return nullptr;
+	}
+
+	bool LookupMatchesScan(OvCore::ECS::Actor& p_actor)
+	{
+		return
+			p_actor.GetComponent<CTransform>() == ScanComponents<CTransform>(p_actor) &&
+			p_actor.GetComponent<CPointLight>() == ScanComponents<CPointLight>(p_actor) &&
+			p_actor.GetComponent<CSpotLight>() == ScanComponents<CSpotLight>(p_actor) &&
+			p_actor.GetComponent<CCamera>() == ScanComponents<CCamera>(p_actor) &&
+			p_actor.GetComponent<CLight>() == ScanComponents<CLight>(p_actor);
+	}
+}
+
+OVTEST(Actor, ComponentLookupMatchesScan)
+{
+	OvCore::SceneSystem::Scene scene;
+	auto& actor = scene.CreateActor();
+
+	OVTEST_CHECK(LookupMatchesScan(actor));
+	OVTEST_CHECK(actor.GetComponent<CLight>() == nullptr);
+
+	/* Queries by base class find the first matching component, and misses are cached like hits */
+	auto& spotLight = actor.AddComponent<CSpotLight>();
+	OVTEST_CHECK(LookupMatchesScan(actor) && LookupMatchesScan(actor));
+	OVTEST_CHECK(actor.GetComponent<CLight>() == &spotLight);
+
+	actor.AddComponent<CPointLight>();
+	actor.AddComponent<CCamera>();
+	OVTEST_CHECK(LookupMatchesScan(actor));
+
+	actor.RemoveComponent<CSpotLight>();
+	OVTEST_CHECK(LookupMatchesScan(actor));
+	OVTEST_CHECK(actor.GetComponent<CLight>() == actor.GetComponent<CPointLight>());
+
+	actor.RemoveComponent<CLight>();
+	OVTEST_CHECK(LookupMatchesScan(actor));
+	OVTEST_CHECK(actor.GetComponent<CLight>() == nullptr);
+
+	/* A type queried for the first time, possibly without a slot yet */
+	actor.AddComponent<CAmbientBoxLight>();
+	OVTEST_CHECK(actor.GetComponent<CAmbientBoxLight>() == ScanComponents<CAmbientBoxLight>(actor));
+	OVTEST_CHECK(LookupMatchesScan(actor));
+}
+
+OVTEST(Actor, ConcurrentComponentQueries)
+{
+	constexpr uint32_t kActorCount = 256;
+	constexpr uint32_t kJobCount = 64;
+
+	OvCore::SceneSystem::Scene scene;
+	OvTools::Utils::ThreadPool threadPool(4);
+
+	for (uint32_t i = 0; i < kActorCount; ++i)
+	{
+		auto& actor = scene.CreateActor();
+
+		if (i % 2 == 0)
+			actor.AddComponent<CPointLight>();
+
+		if (i % 3 == 0)
+			actor.AddComponent<CCamera>();
+	}
+
+	for (uint32_t round = 0; round < 8; ++round)
+	{
+		/* Changed serially, leaving every slot unresolved for the concurrent queries */
+		for (auto* actor : scene.GetActors())
+		{
+			if (!actor->RemoveComponent<CSpotLight>())
+				actor->AddComponent<CSpotLight>();
+		}
+
+		std::atomic<uint32_t> mismatches = 0;
+
+		threadPool.Dispatch(kJobCount, [&scene, &mismatches](uint32_t)
+		{
+			for (auto* actor : scene.GetActors())
+			{
+				if (!LookupMatchesScan(*actor))
+					++mismatches;
+			}
+		});
+
+		OVTEST_CHECK(mismatches == 0);
+	}
+}
+
+OVBENCHMARK(Actor, GetComponent)
+{
+	constexpr uint32_t kActorCount = 10000;
+	constexpr uint32_t kFrames = 20;
+
+	OvCore::SceneSystem::Scene scene;
+
+	for (uint32_t i = 0; i < kActorCount; ++i)
+	{
+		auto& actor = scene.CreateActor();
+		actor.AddComponent<CCamera>();
+		actor.AddComponent<CAmbientBoxLight>();
+		actor.AddComponent<CSpotLight>();
+		actor.AddComponent<CPointLight>();
+	}
+
+	/* Four queries per actor: the transform, a component added first (So found last by a scan), a base class and a miss */
+	volatile uintptr_t sink = 0; // Keeps the queries from being optimized out
+
+	const auto measure = [&](const auto& p_query, const char* p_label)
+	{
+		const double elapsed = OvTests::TestRegistry::Measure([&]
+		{
+			for (auto* actor : scene.GetActors())
+				sink = sink + p_query(*actor);
+		}, kFrames);
+
+		std::cout << p_label << ": " << elapsed * 1e6 / kActorCount << " ns per actor (" << kActorCount << " actors, 5 components each)" << std::endl;
+	};
+
+	measure([](OvCore::ECS::Actor& p_actor)
+	{
+		return
+			reinterpret_cast<uintptr_t>(ScanComponents<CTransform>(p_actor)) ^
+			reinterpret_cast<uintptr_t>(ScanComponents<CCamera>(p_actor)) ^
+			reinterpret_cast<uintptr_t>(ScanComponents<CLight>(p_actor)) ^
+			reinterpret_cast<uintptr_t>(ScanComponents<CAmbientSphereLight>(p_actor));
+	}, "Before (Scan with dynamic_pointer_cast)");
+
+	measure([](OvCore::ECS::Actor& p_actor)
+	{
+		return
+			reinterpret_cast<uintptr_t>(p_actor.GetComponent<CTransform>()) ^
+			reinterpret_cast<uintptr_t>(p_actor.GetComponent<CCamera>()) ^
+			reinterpret_cast<uintptr_t>(p_actor.GetComponent<CLight>()) ^
+			reinterpret_cast<uintptr_t>(p_actor.GetComponent<CAmbientSphereLight>());
+	}, "After (Type-indexed lookup)");
+}
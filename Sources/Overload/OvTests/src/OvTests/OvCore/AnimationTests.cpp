@@ -0,0 +1,382 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#include <cmath>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <memory>
+
+#include <OvTools/Utils/ThreadPool.h>
+
+#include <OvRendering/Resources/Loaders/ModelLoader.h>
+
+#include <OvCore/ECS/DrawableGatherer.h>
+#include <OvCore/ECS/Components/CAnimation.h>
+#include <OvCore/ECS/Components/CModelRenderer.h>
+#include <OvCore/ECS/Components/CMaterialRenderer.h>
+#include <OvCore/Global/ServiceLocator.h>
+#include <OvCore/ResourceManagement/ModelManager.h>
+#include <OvCore/ResourceManagement/MaterialManager.h>
+#include <OvCore/SceneSystem/Scene.h>
+
+#include "OvTests/TestRegistry.h"
+
+namespace
+{
+	using namespace OvCore::ECS;
+	using namespace OvCore::ECS::Components;
+	using namespace OvRendering::Resources;
+
+	struct ModelDeleter
+	{
+		void operator()(Model* p_model) const
+		{
+			Loaders::ModelLoader::Destroy(p_model);
+		}
+	};
+
+	using ModelPtr = std::unique_ptr<Model, ModelDeleter>;
+
+	constexpr uint32_t kBoneCount = 6;
+
+	/**
+	* Create a GL-free model of the given number of meshes (Meshes are never uploaded). If animated, the model has a chain of
+	* bones rotating and moving at their own speed, and every mesh is skinned by its own subset of bones, in its own order
+	*/
+	ModelPtr CreateModel(const std::string& p_name, uint32_t p_meshCount, bool p_animated, uint32_t p_boneCount = kBoneCount)
+	{
+		const std::string sourcePath = OvTests::TestRegistry::GetTemporaryPath(p_name);
+		std::ofstream(sourcePath) << p_name;
+
+		std::vector<Mesh*> meshes;
+
+		for (uint32_t i = 0; i < p_meshCount; ++i)
+		{
+			std::vector<OvRendering::Geometry::Vertex> vertices(3);
+			vertices[1].position[0] = 1.0f;
+			vertices[2].position[1] = 1.0f;
+
+			auto mesh = new Mesh();
+			mesh->InitDeferred(vertices, { 0, 1, 2 }, 0);
+			meshes.push_back(mesh);
+		}
+
+		Parsers::CookedModelParser::Cook(sourcePath, meshes, { "A" }, Parsers::EModelParserFlags::NONE, {});
+
+		for (auto mesh : meshes)
+			delete mesh;
+
+		/* The cooked file is up to date, so the model is parsed from it without going through Assimp */
+		ModelPtr result(Loaders::ModelLoader::Parse(sourcePath, Parsers::EModelParserFlags::NONE));
+
+		std::filesystem::remove(Parsers::CookedModelParser::GetCookedPath(sourcePath));
+		std::filesystem::remove(sourcePath);
+
+		if (!result || !p_animated)
+			return result;
+
+		auto& hierarchy = *result->GetHierarchy();
+		hierarchy.nodes.resize(p_boneCount);
+
+		auto& animation = hierarchy.animations.emplace_back();
+		animation.m_animName = p_name;
+		animation.m_duration = 100.0;
+		animation.m_ticksPerSecond = 10.0;
+
+		for (uint32_t i = 0; i < p_boneCount; ++i)
+		{
+			auto& node = hierarchy.nodes[i];
+			node.m_name = "Bone" + std::to_string(i);
+			node.parent = static_cast<int>(i) - 1;
+			node.m_localTransform = OvMaths::FMatrix4::Identity;
+
+			const float halfAngle = 0.05f * (i + 1);
+			auto& channel = animation.m_modelNodeAnimations.emplace_back();
+			channel.m_hierarchyNodeName = node.m_name;
+			channel.positions = { { 0.0, { 0.0f, 1.0f, 0.0f } }, { 100.0, { 2.0f * i, 1.0f, 0.0f } } };
+			channel.rotations = { { 0.0, OvMaths::FQuaternion::Identity }, { 100.0, OvMaths::FQuaternion(0.0f, std::sin(halfAngle), 0.0f, std::cos(halfAngle)) } };
+		}
+
+		hierarchy.BuildLookups();
+
+		for (uint32_t i = 0; i < p_meshCount; ++i)
+		{
+			auto& rig = result->GetMeshes()[i]->m_rigInfo;
+
+			for (uint32_t j = 0; j < p_boneCount - i; ++j)
+			{
+				OvMaths::FMatrix4 offset = OvMaths::FMatrix4::Translation({ 0.0f, -1.0f * j, static_cast<float>(i) });
+				rig.m_boneInfos.emplace_back("Bone" + std::to_string(p_boneCount - 1 - j), offset);
+			}
+
+			rig.ResolveNodeIndices(hierarchy);
+		}
+
+		return result;
+	}
+
+	/**
+	* Skinning matrices of the given mesh, computed from scratch at the given animation time (In seconds)
+	*/
+	std::vector<OvMaths::FMatrix4> GetExpectedPalette(Model& p_model, const Mesh& p_mesh, double p_time)
+	{
+		auto& hierarchy = *p_model.GetHierarchy();
+		ModelNodeTransformCalculator calculator(hierarchy, hierarchy.animations.front());
+		calculator.SampleAnimation(p_time);
+
+		std::vector<OvMaths::FMatrix4> result(p_mesh.m_rigInfo.m_boneInfos.size());
+		calculator.GetRigBoneTransforms(p_mesh.m_rigInfo, result.data());
+		return result;
+	}
+
+	bool HasPalette(const std::vector<OvMaths::FMatrix4>& p_palettes, int32_t p_offset, const std::vector<OvMaths::FMatrix4>& p_expected)
+	{
+		if (p_offset < 0 || p_offset + p_expected.size() > p_palettes.size())
+			return false;
+
+		for (size_t i = 0; i < p_expected.size(); ++i)
+		{
+			for (uint32_t j = 0; j < 16; ++j)
+			{
+				if (std::abs(p_palettes[p_offset + i].data[j] - p_expected[i].data[j]) > 1e-4f)
+					return false;
+			}
+		}
+
+		return true;
+	}
+
+	std::vector<OvMaths::FMatrix4> GetPalette(const CAnimation& p_animation, const Mesh& p_mesh)
+	{
+		std::vector<OvMaths::FMatrix4> result(p_mesh.m_rigInfo.m_boneInfos.size());
+		p_animation.GetBonePalette(p_mesh.m_rigInfo, result.data());
+		return result;
+	}
+
+	Actor& CreateAnimatedActor(OvCore::SceneSystem::Scene& p_scene, Model* p_model, bool p_animation = true)
+	{
+		Actor& actor = p_scene.CreateActor();
+		actor.AddComponent<CModelRenderer>().SetModel(p_model);
+		actor.AddComponent<CMaterialRenderer>();
+
+		if (p_animation)
+			actor.AddComponent<CAnimation>();
+
+		return actor;
+	}
+}
+
+OVTEST(Animation, PoseIsSampledOncePerFrame)
+{
+	OvCore::ResourceManagement::ModelManager modelManager;
+	OvCore::ResourceManagement::MaterialManager materialManager;
+	OvCore::Global::ServiceLocator::Provide(modelManager);
+	OvCore::Global::ServiceLocator::Provide(materialManager);
+
+	const auto model = CreateModel("PoseSampling.fbx", 2, true);
+	OVTEST_CHECK(model);
+
+	OvCore::SceneSystem::Scene scene;
+	auto& animation = *CreateAnimatedActor(scene, model.get()).GetComponent<CAnimation>();
+	const Mesh& firstMesh = *model->GetMeshes()[0];
+	const Mesh& secondMesh = *model->GetMeshes()[1];
+
+	scene.Update(0.25f);
+	OVTEST_CHECK(animation.GetPlayCtrls() && animation.GetPlayCtrls()->front().time == 0.25);
+	OVTEST_CHECK(HasPalette(GetPalette(animation, firstMesh), 0, GetExpectedPalette(*model, firstMesh, 0.25)));
+	OVTEST_CHECK(HasPalette(GetPalette(animation, secondMesh), 0, GetExpectedPalette(*model, secondMesh, 0.25)));
+
+	/* Keys changed after the update are only seen by the next update: meshes and render passes read the pose evaluated by the update */
+	const auto firstPalette = GetPalette(animation, firstMesh);
+	const auto secondPalette = GetPalette(animation, secondMesh);
+
+	for (auto& channel : model->GetHierarchy()->animations.front().m_modelNodeAnimations)
+		std::get<1>(channel.positions.back()).z = 5.0f;
+
+	for (uint32_t pass = 0; pass < 3; ++pass)
+	{
+		OVTEST_CHECK(HasPalette(GetPalette(animation, firstMesh), 0, firstPalette));
+		OVTEST_CHECK(HasPalette(GetPalette(animation, secondMesh), 0, secondPalette));
+	}
+
+	scene.Update(0.25f);
+	OVTEST_CHECK(HasPalette(GetPalette(animation, firstMesh), 0, GetExpectedPalette(*model, firstMesh, 0.5)));
+	OVTEST_CHECK(HasPalette(GetPalette(animation, secondMesh), 0, GetExpectedPalette(*model, secondMesh, 0.5)));
+	OVTEST_CHECK(!HasPalette(GetPalette(animation, firstMesh), 0, firstPalette));
+
+	/* A paused animation keeps its pose */
+	animation.isPaused = true;
+	scene.Update(0.25f);
+	OVTEST_CHECK(animation.GetPlayCtrls()->front().time == 0.5);
+	OVTEST_CHECK(HasPalette(GetPalette(animation, firstMesh), 0, GetExpectedPalette(*model, firstMesh, 0.5)));
+}
+
+OVTEST(Animation, ControllersFollowTheModel)
+{
+	OvCore::ResourceManagement::ModelManager modelManager;
+	OvCore::ResourceManagement::MaterialManager materialManager;
+	OvCore::Global::ServiceLocator::Provide(modelManager);
+	OvCore::Global::ServiceLocator::Provide(materialManager);
+
+	const auto firstModel = CreateModel("FirstControllers.fbx", 1, true);
+	const auto secondModel = CreateModel("SecondControllers.fbx", 3, true);
+	const auto staticModel = CreateModel("StaticControllers.fbx", 1, false);
+	OVTEST_CHECK(firstModel && secondModel && staticModel);
+
+	OvCore::SceneSystem::Scene scene;
+	Actor& actor = CreateAnimatedActor(scene, firstModel.get());
+	auto& modelRenderer = *actor.GetComponent<CModelRenderer>();
+	auto& animation = *actor.GetComponent<CAnimation>();
+
+	scene.Update(1.0f);
+	auto ctrls = animation.GetPlayCtrls();
+	OVTEST_CHECK(ctrls && ctrls->size() == 1);
+	OVTEST_CHECK(ctrls->front().m_animation == &firstModel->GetHierarchy()->animations.front());
+	OVTEST_CHECK(ctrls->front().time == 1.0);
+
+	/* A new model gets new controllers, starting from the beginning of its animation, and palettes for each of its meshes */
+	modelRenderer.SetModel(secondModel.get());
+	ctrls = animation.GetPlayCtrls();
+	OVTEST_CHECK(ctrls && ctrls->size() == 1);
+	OVTEST_CHECK(ctrls->front().m_animation == &secondModel->GetHierarchy()->animations.front());
+	OVTEST_CHECK(ctrls->front().time == 0.0);
+
+	for (auto mesh : secondModel->GetMeshes())
+		OVTEST_CHECK(HasPalette(GetPalette(animation, *mesh), 0, GetExpectedPalette(*secondModel, *mesh, 0.0)));
+
+	scene.Update(0.5f);
+
+	for (auto mesh : secondModel->GetMeshes())
+		OVTEST_CHECK(HasPalette(GetPalette(animation, *mesh), 0, GetExpectedPalette(*secondModel, *mesh, 0.5)));
+
+	/* Models without animation have no controllers */
+	modelRenderer.SetModel(staticModel.get());
+	OVTEST_CHECK(!animation.GetPlayCtrls());
+
+	modelRenderer.SetModel(nullptr);
+	OVTEST_CHECK(!animation.GetPlayCtrls());
+	scene.Update(0.5f);
+
+	/* Going back to a previous model starts its animation over */
+	modelRenderer.SetModel(firstModel.get());
+	ctrls = animation.GetPlayCtrls();
+	OVTEST_CHECK(ctrls && ctrls->front().m_animation == &firstModel->GetHierarchy()->animations.front() && ctrls->front().time == 0.0);
+}
+
+OVTEST(Animation, DrawablesGetTheirBonePaletteSlice)
+{
+	OvCore::ResourceManagement::ModelManager modelManager;
+	OvCore::ResourceManagement::MaterialManager materialManager;
+	OvCore::Global::ServiceLocator::Provide(modelManager);
+	OvCore::Global::ServiceLocator::Provide(materialManager);
+
+	const auto animatedModel = CreateModel("PaletteAnimated.fbx", 3, true);
+	const auto staticModel = CreateModel("PaletteStatic.fbx", 2, false);
+	OVTEST_CHECK(animatedModel && staticModel);
+
+	OvCore::Resources::Material opaqueMaterial;
+	OvCore::Resources::Material transparentMaterial;
+	transparentMaterial.SetBlendable(true);
+
+	/* Animated actors at different times, an actor without animation and an animation without animated model */
+	OvCore::SceneSystem::Scene scene;
+	auto& slowAnimation = *CreateAnimatedActor(scene, animatedModel.get()).GetComponent<CAnimation>();
+	auto& fastAnimation = *CreateAnimatedActor(scene, animatedModel.get()).GetComponent<CAnimation>();
+	CreateAnimatedActor(scene, staticModel.get(), false);
+	CreateAnimatedActor(scene, staticModel.get());
+
+	scene.Update(1.0f);
+	fastAnimation.UpdatePose(2.5f);
+
+	RenderQueue opaques, transparents, ignored;
+	DrawableGatherer gatherer;
+	gatherer.Gather(opaques, ignored, scene, OvMaths::FVector3::Zero, nullptr, &opaqueMaterial);
+	gatherer.Gather(ignored, transparents, scene, OvMaths::FVector3::Zero, nullptr, &transparentMaterial);
+	OVTEST_CHECK(opaques.Size() == 10 && transparents.Size() == 10);
+
+	/* Drawables of the last mesh use a shader without skinning */
+	const Mesh* const unskinnedMesh = animatedModel->GetMeshes()[2];
+	const auto isSkinned = [unskinnedMesh](const Drawable& p_drawable) { return p_drawable.mesh != unskinnedMesh; };
+
+	/* Both queues share the frame palettes, like a render pass does */
+	std::vector<OvMaths::FMatrix4> palettes;
+	std::vector<int32_t> opaqueOffsets, transparentOffsets;
+	opaques.CollectBonePalettes(palettes, opaqueOffsets, isSkinned);
+	const size_t opaquePaletteSize = palettes.size();
+	transparents.CollectBonePalettes(palettes, transparentOffsets, isSkinned);
+
+	const std::pair<const RenderQueue*, const std::vector<int32_t>*> queues[] = { { &opaques, &opaqueOffsets }, { &transparents, &transparentOffsets } };
+	size_t expectedSize = 0;
+
+	for (const auto& [queue, offsets] : queues)
+	{
+		OVTEST_CHECK(offsets->size() == queue->Size());
+
+		for (size_t i = 0; i < queue->Size(); ++i)
+		{
+			const Drawable& drawable = (*queue)[i];
+			const int32_t offset = (*offsets)[i];
+
+			if (!drawable.animation || drawable.mesh == unskinnedMesh)
+			{
+				OVTEST_CHECK(offset == -1);
+				continue;
+			}
+
+			/* Each skinned drawable owns a distinct slice, holding the pose of its own actor */
+			const double time = drawable.animation == &slowAnimation ? 1.0 : 3.5;
+			OVTEST_CHECK(drawable.animation == &slowAnimation || drawable.animation == &fastAnimation);
+			OVTEST_CHECK(HasPalette(palettes, offset, GetExpectedPalette(*animatedModel, *drawable.mesh, time)));
+			OVTEST_CHECK(queue == &opaques ? offset + drawable.mesh->m_rigInfo.m_boneInfos.size() <= opaquePaletteSize : offset >= static_cast<int32_t>(opaquePaletteSize));
+
+			expectedSize += drawable.mesh->m_rigInfo.m_boneInfos.size();
+		}
+	}
+
+	/* Slices are packed: 2 actors with a 6 bones and a 5 bones skinned mesh, in both queues */
+	OVTEST_CHECK(expectedSize == 2 * 2 * (kBoneCount + kBoneCount - 1));
+	OVTEST_CHECK(palettes.size() == expectedSize);
+}
+
+OVBENCHMARK(Animation, UpdateCrowd)
+{
+	constexpr uint32_t kActorCount = 1000;
+	constexpr uint32_t kFrames = 60;
+	constexpr float kFrameTime = 1.0f / 60.0f;
+
+	OvCore::ResourceManagement::ModelManager modelManager;
+	OvCore::ResourceManagement::MaterialManager materialManager;
+	OvCore::Global::ServiceLocator::Provide(modelManager);
+	OvCore::Global::ServiceLocator::Provide(materialManager);
+
+	/* 64 bones, skinning a 64 bones mesh and a 63 bones mesh */
+	const auto model = CreateModel("Crowd.fbx", 2, true, 64);
+
+	OvCore::SceneSystem::Scene scene;
+
+	for (uint32_t i = 0; i < kActorCount; ++i)
+		CreateAnimatedActor(scene, model.get()).GetComponent<CAnimation>()->UpdatePose(i * 0.01f);
+
+	const auto measure = [&](OvTools::Utils::ThreadPool* p_threadPool, const std::string& p_label)
+	{
+		const double elapsed = OvTests::TestRegistry::Measure([&]
+		{
+			scene.Update(kFrameTime, p_threadPool);
+		}, kFrames);
+
+		std::cout << p_label << ": " << elapsed << " ms per frame (" << kActorCount << " animated actors)" << std::endl;
+	};
+
+	measure(nullptr, "Serial");
+
+	for (const uint32_t threadCount : { 1, 2, 4, 8 })
+	{
+		OvTools::Utils::ThreadPool threadPool(threadCount);
+		measure(&threadPool, std::to_string(threadCount) + " pool threads");
+	}
+}
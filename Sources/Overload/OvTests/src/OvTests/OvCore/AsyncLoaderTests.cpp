@@ -0,0 +1,227 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <future>
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <OvCore/ResourceManagement/AResourceManager.h>
+
+#include "OvTests/TestRegistry.h"
+
+namespace
+{
+	struct DummyResource
+	{
+		std::string path;
+	};
+
+	/**
+	* Resource manager creating its resources without any file
+	*/
+	class DummyResourceManager : public OvCore::ResourceManagement::AResourceManager<DummyResource>
+	{
+	public:
+		~DummyResourceManager()
+		{
+			UnloadResources();
+		}
+
+	protected:
+		virtual DummyResource* CreateResource(const std::string& p_path) override { return new DummyResource{ p_path }; }
+		virtual void DestroyResource(DummyResource* p_resource) override { delete p_resource; }
+		virtual void ReloadResource(DummyResource* p_resource, const std::string& p_path) override {}
+	};
+
+	struct DecodedResource
+	{
+		uint64_t checksum;
+	};
+
+	/**
+	* Resource manager reading and decoding its resources from files, on a worker thread when loaded asynchronously
+	*/
+	class FileResourceManager : public OvCore::ResourceManagement::AResourceManager<DecodedResource>
+	{
+	public:
+		~FileResourceManager()
+		{
+			UnloadResources();
+		}
+
+	protected:
+		virtual DecodedResource* CreateResource(const std::string& p_path) override { return DecodeResource(p_path)(); }
+		virtual void DestroyResource(DecodedResource* p_resource) override { delete p_resource; }
+		virtual void ReloadResource(DecodedResource* p_resource, const std::string& p_path) override {}
+
+		virtual std::function<DecodedResource*()> DecodeResource(const std::string& p_path) override
+		{
+			std::ifstream file(p_path, std::ios::binary);
+			const std::vector<char> content((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+			/* Stands for the decoding work (e.g. image decompression), a few passes over the file content */
+			uint64_t checksum = 14695981039346656037ull;
+
+			for (uint32_t pass = 0; pass < 8; ++pass)
+			{
+				for (const char byte : content)
+					checksum = (checksum ^ static_cast<uint8_t>(byte)) * 1099511628211ull;
+			}
+
+			return [checksum] { return new DecodedResource{ checksum }; };
+		}
+	};
+
+	bool IsReady(const std::shared_future<DummyResource*>& p_future)
+	{
+		return p_future.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+	}
+}
+
+OVTEST(AsyncLoader, LoadedResourcesAreRegistered)
+{
+	DummyResourceManager manager;
+	auto loader = std::make_unique<OvCore::ResourceManagement::AsyncLoader>(2);
+	DummyResourceManager::ProvideAsyncLoader(loader.get());
+
+	DummyResource* received = nullptr;
+	const auto future = manager.LoadResourceAsync("A", [&received](DummyResource* p_resource) { received = p_resource; });
+	loader->Flush();
+
+	OVTEST_CHECK(IsReady(future) && future.get() && future.get()->path == "A");
+	OVTEST_CHECK(received == future.get());
+	OVTEST_CHECK(manager.GetResource("A", false) == received);
+	OVTEST_CHECK(!manager.IsResourcePending("A"));
+
+	loader.reset();
+	DummyResourceManager::ProvideAsyncLoader(nullptr);
+}
+
+OVTEST(AsyncLoader, DestructionFailsDiscardedRequests)
+{
+	DummyResourceManager manager;
+	auto loader = std::make_unique<OvCore::ResourceManagement::AsyncLoader>(1);
+	DummyResourceManager::ProvideAsyncLoader(loader.get());
+
+	/* The only worker is kept busy, so the following requests are still queued when the loader is destroyed */
+	std::promise<void> gate;
+	std::promise<void> started;
+	bool blockingTaskUploaded = false;
+
+	loader->Submit([&]() -> OvCore::ResourceManagement::AsyncLoader::UploadTask
+	{
+		started.set_value();
+		gate.get_future().wait();
+		return [&blockingTaskUploaded] { blockingTaskUploaded = true; };
+	});
+
+	started.get_future().wait();
+
+	uint32_t callbackCalls = 0;
+	bool callbacksReceivedNull = true;
+
+	const auto callback = [&](DummyResource* p_resource)
+	{
+		++callbackCalls;
+		callbacksReceivedNull &= p_resource == nullptr;
+	};
+
+	const auto futureA = manager.LoadResourceAsync("A", callback);
+	const auto futureB = manager.LoadResourceAsync("B", callback);
+	const auto futureA2 = manager.LoadResourceAsync("A", callback);
+
+	OVTEST_CHECK(manager.IsResourcePending("A") && manager.IsResourcePending("B"));
+	OVTEST_CHECK(!IsReady(futureA) && !IsReady(futureB));
+
+	/* The worker is released once the destructor discarded the queued requests and waits for it */
+	std::thread releaser([&gate]
+	{
+		std::this_thread::sleep_for(std::chrono::milliseconds(100));
+		gate.set_value();
+	});
+
+	loader.reset();
+	releaser.join();
+	DummyResourceManager::ProvideAsyncLoader(nullptr);
+
+	/* The running task completed normally, the queued requests failed instead of waiting forever */
+	OVTEST_CHECK(blockingTaskUploaded);
+	OVTEST_CHECK(IsReady(futureA) && IsReady(futureB) && IsReady(futureA2));
+	OVTEST_CHECK(futureA.get() == nullptr && futureB.get() == nullptr && futureA2.get() == nullptr);
+	OVTEST_CHECK(callbackCalls == 3 && callbacksReceivedNull);
+	OVTEST_CHECK(!manager.IsResourcePending("A") && !manager.IsResourcePending("B"));
+	OVTEST_CHECK(manager.GetResources().empty());
+}
+
+OVBENCHMARK(AsyncLoader, LoadAssets)
+{
+	constexpr uint32_t kAssetCount = 500;
+	constexpr uint32_t kAssetSize = 64 * 1024;
+
+	std::vector<std::string> paths;
+
+	for (uint32_t i = 0; i < kAssetCount; ++i)
+	{
+		paths.push_back(OvTests::TestRegistry::GetTemporaryPath("AsyncLoaderAsset" + std::to_string(i) + ".bin"));
+
+		std::vector<char> content(kAssetSize);
+		for (uint32_t j = 0; j < kAssetSize; ++j)
+			content[j] = static_cast<char>((i * 31 + j * 7) & 0xFF);
+
+		std::ofstream(paths.back(), std::ios::binary).write(content.data(), content.size());
+	}
+
+	/* Synchronous loading, as every resource was loaded before the asynchronous loader */
+	const double synchronous = OvTests::TestRegistry::Measure([&paths]
+	{
+		FileResourceManager manager;
+
+		for (const auto& path : paths)
+			manager.LoadResource(path);
+	});
+
+	std::cout << "Synchronous: " << synchronous << " ms (" << kAssetCount << " assets of " << kAssetSize / 1024 << " KB)" << std::endl;
+
+	for (const uint32_t workerCount : { 1, 2, 4, 8 })
+	{
+		auto loader = std::make_unique<OvCore::ResourceManagement::AsyncLoader>(workerCount);
+		FileResourceManager::ProvideAsyncLoader(loader.get());
+
+		double submission = 0.0;
+		uint32_t loaded = 0;
+
+		/* Time until every asset is registered, and the part of it the main thread spends submitting the requests */
+		const double total = OvTests::TestRegistry::Measure([&]
+		{
+			FileResourceManager manager;
+
+			submission = OvTests::TestRegistry::Measure([&]
+			{
+				for (const auto& path : paths)
+					manager.LoadResourceAsync(path);
+			});
+
+			loader->Flush();
+			loaded = static_cast<uint32_t>(manager.GetResources().size());
+		});
+
+		OVTEST_CHECK(loaded == kAssetCount);
+
+		loader.reset();
+		FileResourceManager::ProvideAsyncLoader(nullptr);
+
+		std::cout << workerCount << " worker(s): " << total << " ms (" << submission << " ms submitting)" << std::endl;
+	}
+
+	for (const auto& path : paths)
+		std::filesystem::remove(path);
+}
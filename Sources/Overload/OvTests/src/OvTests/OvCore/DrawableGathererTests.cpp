@@ -0,0 +1,250 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+
+#include <OvTools/Utils/ThreadPool.h>
+
+#include <OvMaths/FMatrix4.h>
+
+#include <OvRendering/Data/Frustum.h>
+#include <OvRendering/Resources/Loaders/ModelLoader.h>
+
+#include <OvCore/ECS/DrawableGatherer.h>
+#include <OvCore/ECS/Components/CModelRenderer.h>
+#include <OvCore/ECS/Components/CMaterialRenderer.h>
+#include <OvCore/Global/ServiceLocator.h>
+#include <OvCore/ResourceManagement/ModelManager.h>
+#include <OvCore/ResourceManagement/MaterialManager.h>
+#include <OvCore/SceneSystem/Scene.h>
+
+#include "OvTests/TestRegistry.h"
+
+namespace
+{
+	using namespace OvCore::ECS;
+	using namespace OvCore::ECS::Components;
+
+	struct ModelDeleter
+	{
+		void operator()(OvRendering::Resources::Model* p_model) const
+		{
+			OvRendering::Resources::Loaders::ModelLoader::Destroy(p_model);
+		}
+	};
+
+	using ModelPtr = std::unique_ptr<OvRendering::Resources::Model, ModelDeleter>;
+
+	/**
+	* Create a GL-free model whose meshes are spread along the X axis (Meshes are never uploaded)
+	*/
+	ModelPtr CreateModel(const std::string& p_name, uint32_t p_meshCount)
+	{
+		using namespace OvRendering::Resources;
+
+		const std::string sourcePath = OvTests::TestRegistry::GetTemporaryPath(p_name);
+		std::ofstream(sourcePath) << p_name;
+
+		std::vector<Mesh*> meshes;
+
+		for (uint32_t i = 0; i < p_meshCount; ++i)
+		{
+			std::vector<OvRendering::Geometry::Vertex> vertices(3);
+			const float offset = 10.0f * static_cast<float>(i);
+
+			vertices[0].position[0] = offset - 1.0f;
+			vertices[1].position[0] = offset + 1.0f;
+			vertices[2].position[1] = 1.0f;
+			vertices[2].position[0] = offset;
+
+			auto mesh = new Mesh();
+			mesh->InitDeferred(vertices, { 0, 1, 2 }, i % 2);
+			meshes.push_back(mesh);
+		}
+
+		Parsers::CookedModelParser::Cook(sourcePath, meshes, { "A", "B" }, Parsers::EModelParserFlags::NONE, {});
+
+		for (auto mesh : meshes)
+			delete mesh;
+
+		/* The cooked file is up to date, so the model is parsed from it without going through Assimp */
+		ModelPtr result(Loaders::ModelLoader::Parse(sourcePath, Parsers::EModelParserFlags::NONE));
+
+		std::filesystem::remove(Parsers::CookedModelParser::GetCookedPath(sourcePath));
+		std::filesystem::remove(sourcePath);
+
+		return result;
+	}
+
+	void CheckSameQueues(const RenderQueue& p_expected, const RenderQueue& p_actual)
+	{
+		OVTEST_CHECK(p_expected.Size() == p_actual.Size());
+
+		for (size_t i = 0; i < p_expected.Size(); ++i)
+		{
+			const Drawable& expected = p_expected[i];
+			const Drawable& actual = p_actual[i];
+
+			OVTEST_CHECK(expected.matrix == actual.matrix);
+			OVTEST_CHECK(expected.mesh == actual.mesh);
+			OVTEST_CHECK(expected.material == actual.material);
+			OVTEST_CHECK(expected.userMatrix == actual.userMatrix);
+			OVTEST_CHECK(expected.animation == actual.animation);
+		}
+	}
+}
+
+OVTEST(DrawableGatherer, ParallelGatheringMatchesSerialGathering)
+{
+	OvCore::ResourceManagement::ModelManager modelManager;
+	OvCore::ResourceManagement::MaterialManager materialManager;
+	OvCore::Global::ServiceLocator::Provide(modelManager);
+	OvCore::Global::ServiceLocator::Provide(materialManager);
+
+	const auto singleMeshModel = CreateModel("GathererSingleMesh.fbx", 1);
+	const auto multiMeshModel = CreateModel("GathererMultiMesh.fbx", 4);
+	OVTEST_CHECK(singleMeshModel && multiMeshModel);
+
+	OvCore::Resources::Material opaqueMaterial;
+	OvCore::Resources::Material transparentMaterial;
+	transparentMaterial.SetBlendable(true);
+
+	{
+		OvCore::SceneSystem::Scene scene;
+		std::mt19937 generator(42);
+		std::uniform_real_distribution<float> position(-150.0f, 150.0f);
+		Actor* previous = nullptr;
+
+		/* Enough actors to fill several chunks, with every frustum behaviour and some nested transforms */
+		for (uint32_t i = 0; i < 3000; ++i)
+		{
+			Actor& actor = scene.CreateActor();
+			actor.transform.SetLocalPosition({ position(generator), position(generator), position(generator) });
+
+			if (previous && i % 7 == 0)
+				actor.SetParent(*previous);
+
+			auto& modelRenderer = actor.AddComponent<CModelRenderer>();
+			modelRenderer.SetFrustumBehaviour(static_cast<CModelRenderer::EFrustumBehaviour>(i % 4));
+			modelRenderer.SetCustomBoundingSphere({ OvMaths::FVector3::Zero, 5.0f });
+			modelRenderer.SetModel(i % 3 == 0 ? multiMeshModel.get() : singleMeshModel.get());
+
+			if (i % 11 != 0)
+				actor.AddComponent<CMaterialRenderer>();
+
+			if (i % 13 == 0)
+				actor.SetActive(false);
+
+			previous = &actor;
+		}
+
+		OvMaths::FMatrix4 viewProjection =
+			OvMaths::FMatrix4::CreatePerspective(60.0f, 16.0f / 9.0f, 0.1f, 100.0f) *
+			OvMaths::FMatrix4::CreateView(0.0f, 0.0f, 0.0f, 0.0f, 0.0f, -1.0f, 0.0f, 1.0f, 0.0f);
+
+		OvRendering::Data::Frustum frustum;
+		frustum.CalculateFrustum(viewProjection);
+
+		OvTools::Utils::ThreadPool threadPool(4);
+		DrawableGatherer serialGatherer;
+		DrawableGatherer parallelGatherer(&threadPool);
+
+		const OvMaths::FVector3 cameraPosition = { 1.0f, 2.0f, 3.0f };
+		const OvRendering::Data::Frustum* cullings[] = { nullptr, &frustum };
+
+		for (auto defaultMaterial : { &opaqueMaterial, &transparentMaterial })
+		{
+			for (auto culling : cullings)
+			{
+				RenderQueue serialOpaques, serialTransparents, parallelOpaques, parallelTransparents;
+
+				serialGatherer.Gather(serialOpaques, serialTransparents, scene, cameraPosition, culling, defaultMaterial);
+				parallelGatherer.Gather(parallelOpaques, parallelTransparents, scene, cameraPosition, culling, defaultMaterial);
+
+				OVTEST_CHECK(serialOpaques.Size() + serialTransparents.Size() > 0);
+				CheckSameQueues(serialOpaques, parallelOpaques);
+				CheckSameQueues(serialTransparents, parallelTransparents);
+			}
+		}
+
+		/* Moving actors outdates their world matrices, which the parallel gathering must compute before dispatching */
+		for (auto modelRenderer : scene.GetActiveComponents().modelRenderers)
+			modelRenderer->owner.transform.SetLocalPosition(modelRenderer->owner.transform.GetLocalPosition() * 0.5f);
+
+		RenderQueue serialOpaques, serialTransparents, parallelOpaques, parallelTransparents;
+		parallelGatherer.Gather(parallelOpaques, parallelTransparents, scene, cameraPosition, &frustum, &opaqueMaterial);
+		serialGatherer.Gather(serialOpaques, serialTransparents, scene, cameraPosition, &frustum, &opaqueMaterial);
+
+		CheckSameQueues(serialOpaques, parallelOpaques);
+		CheckSameQueues(serialTransparents, parallelTransparents);
+	}
+}
+
+OVBENCHMARK(DrawableGatherer, CullModelRenderers)
+{
+	constexpr uint32_t kActorCount = 100000;
+	constexpr uint32_t kFrames = 10;
+
+	OvCore::ResourceManagement::ModelManager modelManager;
+	OvCore::ResourceManagement::MaterialManager materialManager;
+	OvCore::Global::ServiceLocator::Provide(modelManager);
+	OvCore::Global::ServiceLocator::Provide(materialManager);
+
+	const auto model = CreateModel("GathererBenchmark.fbx", 1);
+	OvCore::Resources::Material material;
+
+	OvCore::SceneSystem::Scene scene;
+	std::mt19937 generator(7);
+	std::uniform_real_distribution<float> position(-300.0f, 300.0f);
+
+	/* Spread around the camera, so part of the model renderers is culled */
+	for (uint32_t i = 0; i < kActorCount; ++i)
+	{
+		Actor& actor = scene.CreateActor();
+		actor.transform.SetLocalPosition({ position(generator), position(generator), position(generator) });
+
+		auto& modelRenderer = actor.AddComponent<CModelRenderer>();
+		modelRenderer.SetFrustumBehaviour(CModelRenderer::EFrustumBehaviour::CULL_CUSTOM);
+		modelRenderer.SetCustomBoundingSphere({ OvMaths::FVector3::Zero, 2.0f });
+		modelRenderer.SetModel(model.get());
+
+		actor.AddComponent<CMaterialRenderer>();
+	}
+
+	OvRendering::Data::Frustum frustum;
+	frustum.CalculateFrustum
+	(
+		OvMaths::FMatrix4::CreatePerspective(60.0f, 16.0f / 9.0f, 0.1f, 500.0f) *
+		OvMaths::FMatrix4::CreateView(0.0f, 0.0f, 0.0f, 0.0f, 0.0f, -1.0f, 0.0f, 1.0f, 0.0f)
+	);
+
+	const auto measure = [&](DrawableGatherer& p_gatherer, const std::string& p_label)
+	{
+		RenderQueue opaques, transparents;
+
+		const double elapsed = OvTests::TestRegistry::Measure([&]
+		{
+			p_gatherer.Gather(opaques, transparents, scene, OvMaths::FVector3::Zero, &frustum, &material);
+		}, kFrames);
+
+		std::cout << p_label << ": " << elapsed << " ms (" << opaques.Size() << " of " << kActorCount << " model renderers in frustum)" << std::endl;
+	};
+
+	DrawableGatherer serialGatherer;
+	measure(serialGatherer, "Serial");
+
+	for (const uint32_t threadCount : { 1, 2, 4, 8 })
+	{
+		OvTools::Utils::ThreadPool threadPool(threadCount);
+		DrawableGatherer gatherer(&threadPool);
+		measure(gatherer, std::to_string(threadCount) + " pool threads");
+	}
+}
@@ -0,0 +1,155 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#include <cstring>
+
+#include <OvMaths/FVector2.h>
+#include <OvMaths/FVector3.h>
+#include <OvMaths/FVector4.h>
+
+#include <OvCore/Resources/MaterialParameterBlock.h>
+
+#include "OvTests/TestRegistry.h"
+
+namespace
+{
+	using namespace OvRendering::Resources;
+
+	template<typename T>
+	T Read(const std::vector<uint8_t>& p_data, uint32_t p_offset)
+	{
+		OVTEST_CHECK(p_offset + sizeof(T) <= p_data.size());
+
+		T value;
+		std::memcpy(&value, p_data.data() + p_offset, sizeof(T));
+		return value;
+	}
+
+	const OvCore::Resources::MaterialParameterBlock::Parameter& FindParameter(const OvCore::Resources::MaterialParameterBlock& p_block, uint32_t p_location)
+	{
+		for (const auto& parameter : p_block.GetParameters())
+		{
+			if (parameter.location == p_location)
+				return parameter;
+		}
+
+		throw OvTests::TestFailure("No parameter at location " + std::to_string(p_location));
+	}
+
+	/**
+	* Reflection data as a shader would report it, with uniforms of every supported type, members of the
+	* MaterialUBO block and uniforms that can't be baked
+	*/
+	std::vector<UniformInfo> CreateUniforms()
+	{
+		return
+		{
+			{ UniformType::UNIFORM_FLOAT_VEC4,	"u_Diffuse",		3 },
+			{ UniformType::UNIFORM_SAMPLER_2D,	"u_DiffuseMap",		4 },
+			{ UniformType::UNIFORM_FLOAT,		"u_Shininess",		5 },
+			{ UniformType::UNIFORM_BOOL,		"u_EnableFog",		6 },
+			{ UniformType::UNIFORM_INT,			"u_Layers",			7 },
+			{ UniformType::UNIFORM_FLOAT_VEC2,	"u_TextureTiling",	8 },
+			{ UniformType::UNIFORM_SAMPLER_2D,	"u_NormalMap",		9 },
+			{ UniformType::UNIFORM_FLOAT,		"u_Missing",		10 },
+			{ UniformType::UNIFORM_FLOAT,		"u_Mismatching",	11 },
+			{ UniformType::UNIFORM_FLOAT_MAT4,	"u_Matrix",			12 },
+			{ UniformType::UNIFORM_FLOAT,		"u_Scale",			0, {}, 0 },
+			{ UniformType::UNIFORM_FLOAT_VEC3,	"u_Specular",		0, {}, 16 },
+			{ UniformType::UNIFORM_FLOAT_VEC3,	"u_OutOfBlock",		0, {}, 28 }
+		};
+	}
+}
+
+OVTEST(MaterialParameterBlock, BakeMatchesReflection)
+{
+	/* Fake texture addresses, textures are only referenced by the block */
+	alignas(8) uint8_t textureStorage[2];
+	const auto diffuseMap = reinterpret_cast<Texture*>(&textureStorage[0]);
+
+	std::map<std::string, std::any> values =
+	{
+		{ "u_Diffuse",			OvMaths::FVector4{ 1.0f, 0.5f, 0.25f, 1.0f } },
+		{ "u_DiffuseMap",		diffuseMap },
+		{ "u_Shininess",		32.0f },
+		{ "u_EnableFog",		true },
+		{ "u_Layers",			3 },
+		{ "u_TextureTiling",	OvMaths::FVector2{ 2.0f, 4.0f } },
+		{ "u_NormalMap",		static_cast<Texture*>(nullptr) },
+		{ "u_Mismatching",		7 },
+		{ "u_Matrix",			1.0f },
+		{ "u_Scale",			0.5f },
+		{ "u_Specular",			OvMaths::FVector3{ 0.1f, 0.2f, 0.3f } },
+		{ "u_OutOfBlock",		OvMaths::FVector3{ 1.0f, 1.0f, 1.0f } },
+		{ "u_NotInShader",		1.0f }
+	};
+
+	OvCore::Resources::MaterialParameterBlock block;
+	block.Bake(CreateUniforms(), values, 32);
+
+	/* Only the matching loose uniforms become parameters (No missing, mismatching, unsupported or block member) */
+	OVTEST_CHECK(block.GetParameters().size() == 5);
+
+	const auto& packedValues = block.GetValues();
+
+	const auto diffuse = Read<OvMaths::FVector4>(packedValues, FindParameter(block, 3).offset);
+	OVTEST_CHECK(diffuse.x == 1.0f && diffuse.y == 0.5f && diffuse.z == 0.25f && diffuse.w == 1.0f);
+	OVTEST_CHECK(FindParameter(block, 3).type == UniformType::UNIFORM_FLOAT_VEC4);
+	OVTEST_CHECK(Read<float>(packedValues, FindParameter(block, 5).offset) == 32.0f);
+	OVTEST_CHECK(Read<int32_t>(packedValues, FindParameter(block, 6).offset) == 1);
+	OVTEST_CHECK(Read<int>(packedValues, FindParameter(block, 7).offset) == 3);
+
+	const auto tiling = Read<OvMaths::FVector2>(packedValues, FindParameter(block, 8).offset);
+	OVTEST_CHECK(tiling.x == 2.0f && tiling.y == 4.0f);
+
+	/* Texture slots are given in the order of the reflection, textureless samplers included */
+	const auto& samplers = block.GetSamplers();
+	OVTEST_CHECK(samplers.size() == 2);
+	OVTEST_CHECK(samplers[0].location == 4 && samplers[0].slot == 0 && samplers[0].texture == diffuseMap);
+	OVTEST_CHECK(samplers[1].location == 9 && samplers[1].slot == 1 && samplers[1].texture == nullptr);
+
+	/* MaterialUBO members are packed at their std140 offsets, members past the block size are ignored */
+	const auto& bufferData = block.GetBufferData();
+	OVTEST_CHECK(bufferData.size() == 32);
+	OVTEST_CHECK(Read<float>(bufferData, 0) == 0.5f);
+
+	const auto specular = Read<OvMaths::FVector3>(bufferData, 16);
+	OVTEST_CHECK(specular.x == 0.1f && specular.y == 0.2f && specular.z == 0.3f);
+	OVTEST_CHECK(Read<float>(bufferData, 28) == 0.0f);
+}
+
+OVTEST(MaterialParameterBlock, RebakeReflectsEditedValues)
+{
+	std::map<std::string, std::any> values =
+	{
+		{ "u_Shininess",	32.0f },
+		{ "u_EnableFog",	true },
+		{ "u_Specular",		OvMaths::FVector3{ 0.1f, 0.2f, 0.3f } }
+	};
+
+	OvCore::Resources::MaterialParameterBlock block;
+	block.Bake(CreateUniforms(), values, 32);
+	OVTEST_CHECK(block.GetParameters().size() == 2);
+
+	/* Edit the values in place, as the material editor widgets do, then bake again */
+	*std::any_cast<float>(&values["u_Shininess"]) = 64.0f;
+	*std::any_cast<bool>(&values["u_EnableFog"]) = false;
+	std::any_cast<OvMaths::FVector3>(&values["u_Specular"])->y = 0.8f;
+	values["u_Layers"] = 5;
+
+	block.Bake(CreateUniforms(), values, 32);
+
+	OVTEST_CHECK(block.GetParameters().size() == 3);
+	OVTEST_CHECK(Read<float>(block.GetValues(), FindParameter(block, 5).offset) == 64.0f);
+	OVTEST_CHECK(Read<int32_t>(block.GetValues(), FindParameter(block, 6).offset) == 0);
+	OVTEST_CHECK(Read<int>(block.GetValues(), FindParameter(block, 7).offset) == 5);
+	OVTEST_CHECK(Read<float>(block.GetBufferData(), 20) == 0.8f);
+
+	/* Without a MaterialUBO block, its members are dropped instead of packed */
+	block.Bake(CreateUniforms(), values, 0);
+	OVTEST_CHECK(block.GetBufferData().empty());
+	OVTEST_CHECK(block.GetParameters().size() == 3);
+}
@@ -0,0 +1,343 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <iostream>
+#include <map>
+#include <random>
+#include <vector>
+
+#include <OvCore/ECS/RenderQueue.h>
+
+#include "OvTests/TestRegistry.h"
+
+namespace
+{
+	using namespace OvCore::ECS;
+
+	/**
+	* Drawables are identified by their matrix, each drawable pointing to its own matrix of the given array
+	*/
+	Drawable CreateDrawable(const std::vector<OvMaths::FMatrix4>& p_matrices, size_t p_index, OvCore::Resources::Material* p_material = nullptr)
+	{
+		return { &p_matrices[p_index], nullptr, p_material, nullptr, nullptr };
+	}
+
+	size_t GetIndex(const std::vector<OvMaths::FMatrix4>& p_matrices, const Drawable& p_drawable)
+	{
+		return static_cast<size_t>(p_drawable.matrix - p_matrices.data());
+	}
+
+	/**
+	* Sort random keys where only the given bytes vary, and compare the result with a stable sort
+	*/
+	bool SortsLikeStableSort(size_t p_count, uint64_t p_varyingBytes, uint32_t p_seed)
+	{
+		std::mt19937_64 generator(p_seed);
+		const uint64_t constantBits = generator() & ~p_varyingBytes;
+
+		std::vector<OvMaths::FMatrix4> matrices(p_count);
+		std::vector<std::pair<uint64_t, size_t>> expected;
+		RenderQueue queue;
+
+		for (size_t i = 0; i < p_count; ++i)
+		{
+			/* Few distinct values per byte, so equal keys are frequent and stability is checked */
+			const uint64_t key = constantBits | ((generator() & 0x0303030303030303ULL) & p_varyingBytes);
+			queue.Push(CreateDrawable(matrices, i), key);
+			expected.emplace_back(key, i);
+		}
+
+		queue.Sort();
+
+		std::stable_sort(expected.begin(), expected.end(), [](const auto& p_a, const auto& p_b) { return p_a.first < p_b.first; });
+
+		for (size_t i = 0; i < p_count; ++i)
+		{
+			if (queue.GetSortKey(i) != expected[i].first || GetIndex(matrices, queue[i]) != expected[i].second)
+				return false;
+		}
+
+		return true;
+	}
+
+	/* Batching only compares pointers, so meshes and materials don't need to exist */
+	template<typename T>
+	T* FakePointer(uintptr_t p_value)
+	{
+		return reinterpret_cast<T*>(p_value * 64);
+	}
+
+	/**
+	* Push drawables with the same key (So they keep their submission order), each drawable pointing to its own matrix
+	*/
+	struct BatchingScenario
+	{
+		std::vector<OvMaths::FMatrix4> matrices = std::vector<OvMaths::FMatrix4>(64);
+		OvMaths::FMatrix4 userMatrix = OvMaths::FMatrix4::Identity;
+		OvMaths::FMatrix4 sameUserMatrix = OvMaths::FMatrix4::Identity;
+		OvMaths::FMatrix4 otherUserMatrix = OvMaths::FMatrix4::Translation({ 1.0f, 0.0f, 0.0f });
+		RenderQueue queue;
+
+		void Push(uintptr_t p_mesh, uintptr_t p_material, const OvMaths::FMatrix4& p_userMatrix)
+		{
+			const size_t index = queue.Size();
+			queue.Push({ &matrices[index], FakePointer<OvRendering::Resources::Mesh>(p_mesh), FakePointer<OvCore::Resources::Material>(p_material), &p_userMatrix, nullptr }, 0);
+		}
+
+		std::vector<RenderQueue::Batch> BuildBatches(bool p_instanceable = true)
+		{
+			queue.Sort();
+
+			std::vector<RenderQueue::Batch> batches = { { 42, 42 } }; // Cleared by BuildBatches
+			queue.BuildBatches(batches, [p_instanceable](const Drawable& p_drawable) { return p_instanceable && p_drawable.material != FakePointer<OvCore::Resources::Material>(99); });
+			return batches;
+		}
+
+		bool HasBatches(const std::vector<RenderQueue::Batch>& p_batches, const std::vector<uint32_t>& p_counts) const
+		{
+			if (p_batches.size() != p_counts.size())
+				return false;
+
+			size_t first = 0;
+
+			for (size_t i = 0; i < p_batches.size(); ++i)
+			{
+				if (p_batches[i].first != first || p_batches[i].count != p_counts[i])
+					return false;
+
+				first += p_counts[i];
+			}
+
+			return first == queue.Size();
+		}
+	};
+}
+
+OVTEST(RenderQueue, RadixSortIsStableAndSkipsConstantBytes)
+{
+	/* Every byte constant, a single varying byte (Odd number of passes), two and eight varying bytes (Even number of passes) */
+	const uint64_t varyingBytes[] =
+	{
+		0x0000000000000000ULL,
+		0x00000000000000FFULL,
+		0xFF00000000000000ULL,
+		0x0000FF00000000FFULL,
+		0x00FF00FF00FF0000ULL,
+		0xFFFFFFFFFFFFFFFFULL
+	};
+
+	uint32_t seed = 0;
+
+	for (const uint64_t bytes : varyingBytes)
+	{
+		for (const size_t count : { 0, 1, 2, 3, 1000 })
+			OVTEST_CHECK(SortsLikeStableSort(count, bytes, ++seed));
+	}
+
+	/* The queue is reused between frames: sorting again after a clear gives the same result */
+	std::vector<OvMaths::FMatrix4> matrices(3);
+	RenderQueue queue;
+
+	for (uint32_t frame = 0; frame < 2; ++frame)
+	{
+		queue.Clear();
+		queue.Push(CreateDrawable(matrices, 0), 0x0100);
+		queue.Push(CreateDrawable(matrices, 1), 0x0001);
+		queue.Push(CreateDrawable(matrices, 2), 0x0100);
+		queue.Sort();
+
+		OVTEST_CHECK(queue.Size() == 3);
+		OVTEST_CHECK(GetIndex(matrices, queue[0]) == 1 && GetIndex(matrices, queue[1]) == 0 && GetIndex(matrices, queue[2]) == 2);
+	}
+}
+
+OVTEST(RenderQueue, OpaquesSortFrontToBackAndTransparentsBackToFront)
+{
+	constexpr size_t kCount = 500;
+
+	OvCore::Resources::Material firstMaterial;
+	OvCore::Resources::Material secondMaterial;
+
+	/* Distances far enough from each other to keep distinct opaque keys (The opaque key only keeps part of the distance) */
+	std::vector<float> distances(kCount);
+	for (size_t i = 0; i < kCount; ++i)
+		distances[i] = 1.0f + 0.5f * static_cast<float>(i);
+
+	std::shuffle(distances.begin(), distances.end(), std::mt19937(3));
+
+	std::vector<OvMaths::FMatrix4> matrices(kCount);
+	RenderQueue opaques;
+	RenderQueue transparents;
+
+	for (size_t i = 0; i < kCount; ++i)
+	{
+		const Drawable drawable = CreateDrawable(matrices, i, i % 2 ? &firstMaterial : &secondMaterial);
+		opaques.Push(drawable, RenderQueue::GenerateOpaqueSortKey(drawable, distances[i]));
+		transparents.Push(drawable, RenderQueue::GenerateTransparentSortKey(distances[i]));
+	}
+
+	/* Ties keep the submission order */
+	const Drawable last = CreateDrawable(matrices, 0, &firstMaterial);
+	transparents.Push(last, RenderQueue::GenerateTransparentSortKey(distances[0]));
+
+	opaques.Sort();
+	transparents.Sort();
+
+	/* Opaques: grouped by material (Each material once), front to back within a group */
+	uint32_t materialChanges = 0;
+
+	for (size_t i = 1; i < opaques.Size(); ++i)
+	{
+		if (opaques[i].material != opaques[i - 1].material)
+			++materialChanges;
+		else
+			OVTEST_CHECK(distances[GetIndex(matrices, opaques[i - 1])] < distances[GetIndex(matrices, opaques[i])]);
+	}
+
+	OVTEST_CHECK(materialChanges == 1);
+
+	/* Transparents: back to front, whatever the material is */
+	for (size_t i = 1; i < transparents.Size(); ++i)
+		OVTEST_CHECK(distances[GetIndex(matrices, transparents[i - 1])] >= distances[GetIndex(matrices, transparents[i])]);
+
+	for (size_t i = 0; i < transparents.Size(); ++i)
+	{
+		if (GetIndex(matrices, transparents[i]) == 0)
+		{
+			OVTEST_CHECK(i + 1 < transparents.Size() && transparents[i].material == &secondMaterial && transparents[i + 1].material == &firstMaterial);
+			break;
+		}
+	}
+
+	/* Invalid distances (Behind the camera or NaN) are treated as 0 */
+	const Drawable drawable = CreateDrawable(matrices, 0, &firstMaterial);
+	OVTEST_CHECK(RenderQueue::GenerateOpaqueSortKey(drawable, -5.0f) == RenderQueue::GenerateOpaqueSortKey(drawable, 0.0f));
+	OVTEST_CHECK(RenderQueue::GenerateTransparentSortKey(std::nanf("")) == RenderQueue::GenerateTransparentSortKey(0.0f));
+}
+
+OVBENCHMARK(RenderQueue, SortAgainstMultimap)
+{
+	using OpaqueDrawables = std::multimap<float, Drawable, std::less<float>>;
+
+	OvCore::Resources::Material materials[8];
+	constexpr uint32_t kFrames = 20;
+
+	for (const size_t count : { 1000, 10000, 100000 })
+	{
+		std::mt19937 generator(11);
+		std::uniform_real_distribution<float> distance(0.1f, 500.0f);
+
+		std::vector<OvMaths::FMatrix4> matrices(count);
+		std::vector<Drawable> drawables;
+		std::vector<float> distances;
+
+		for (size_t i = 0; i < count; ++i)
+		{
+			drawables.push_back(CreateDrawable(matrices, i, &materials[i % 8]));
+			distances.push_back(distance(generator));
+		}
+
+		/* What the renderer did before: a multimap filled every frame. The checksum keeps the iterations from being optimized out */
+		volatile uintptr_t checksum = 0;
+		const double multimapElapsed = OvTests::TestRegistry::Measure([&]
+		{
+			OpaqueDrawables opaques;
+
+			for (size_t i = 0; i < count; ++i)
+				opaques.emplace(distances[i], drawables[i]);
+
+			for (const auto& [key, drawable] : opaques)
+				checksum = checksum + reinterpret_cast<uintptr_t>(drawable.matrix);
+		}, kFrames);
+
+		/* The queue is kept between frames, so only the first frame allocates */
+		RenderQueue queue;
+		const double queueElapsed = OvTests::TestRegistry::Measure([&]
+		{
+			queue.Clear();
+
+			for (size_t i = 0; i < count; ++i)
+				queue.Push(drawables[i], RenderQueue::GenerateOpaqueSortKey(drawables[i], distances[i]));
+
+			queue.Sort();
+
+			for (const auto& drawable : queue)
+				checksum = checksum + reinterpret_cast<uintptr_t>(drawable.matrix);
+		}, kFrames);
+
+		std::cout << count << " drawables: multimap " << multimapElapsed << " ms, render queue " << queueElapsed << " ms (Fill, sort and iterate, per frame)" << std::endl;
+	}
+}
+
+OVTEST(RenderQueue, BatchesBreakOnMeshMaterialAndUserMatrixChanges)
+{
+	BatchingScenario scenario;
+
+	scenario.Push(1, 1, scenario.userMatrix);
+	scenario.Push(1, 1, scenario.userMatrix);
+	scenario.Push(1, 1, scenario.sameUserMatrix);	// Other user matrix with equal values: same batch
+	scenario.Push(2, 1, scenario.userMatrix);		// Mesh change
+	scenario.Push(2, 1, scenario.userMatrix);
+	scenario.Push(2, 2, scenario.userMatrix);		// Material change
+	scenario.Push(2, 2, scenario.otherUserMatrix);	// User matrix change
+	scenario.Push(2, 2, scenario.otherUserMatrix);
+	scenario.Push(1, 1, scenario.userMatrix);		// Same as the first batch, but not consecutive to it
+
+	const auto batches = scenario.BuildBatches();
+	OVTEST_CHECK(scenario.HasBatches(batches, { 3, 2, 1, 2, 1 }));
+
+	/* Every drawable of a batch shares the mesh, material and user matrix values of its first drawable */
+	for (const auto& batch : batches)
+	{
+		const Drawable& first = scenario.queue[batch.first];
+
+		for (size_t i = batch.first; i < batch.first + batch.count; ++i)
+		{
+			OVTEST_CHECK(scenario.queue[i].mesh == first.mesh && scenario.queue[i].material == first.material);
+			OVTEST_CHECK(std::memcmp(scenario.queue[i].userMatrix->data, first.userMatrix->data, sizeof(first.userMatrix->data)) == 0);
+		}
+	}
+
+	/* An empty queue has no batch */
+	BatchingScenario empty;
+	OVTEST_CHECK(empty.BuildBatches().empty());
+}
+
+OVTEST(RenderQueue, BatchesKeepInstanceMatricesInOrder)
+{
+	BatchingScenario scenario;
+
+	for (uint32_t i = 0; i < 40; ++i)
+		scenario.Push(i < 25 ? 1 : 2, 1, scenario.userMatrix);
+
+	const auto batches = scenario.BuildBatches();
+	OVTEST_CHECK(scenario.HasBatches(batches, { 25, 15 }));
+
+	/* The model matrices of a batch (Uploaded as the per-instance data) follow the submission order */
+	for (const auto& batch : batches)
+	{
+		for (size_t i = batch.first; i < batch.first + batch.count; ++i)
+			OVTEST_CHECK(scenario.queue[i].matrix == &scenario.matrices[i]);
+	}
+}
+
+OVTEST(RenderQueue, NonInstanceableDrawablesGetTheirOwnBatch)
+{
+	/* Rejected by the predicate (Material 99): alone, even between drawables that could be batched with it */
+	BatchingScenario scenario;
+	scenario.Push(1, 1, scenario.userMatrix);
+	scenario.Push(1, 1, scenario.userMatrix);
+	scenario.Push(1, 99, scenario.userMatrix);
+	scenario.Push(1, 99, scenario.userMatrix);
+	scenario.Push(1, 1, scenario.userMatrix);
+	OVTEST_CHECK(scenario.HasBatches(scenario.BuildBatches(), { 2, 1, 1, 1 }));
+
+	/* Nothing can be instanced: one batch per drawable */
+	OVTEST_CHECK(scenario.HasBatches(scenario.BuildBatches(false), { 1, 1, 1, 1, 1 }));
+}
@@ -0,0 +1,143 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#include <array>
+
+#include <OvCore/ResourceManagement/AResourceManager.h>
+
+#include "OvTests/TestRegistry.h"
+
+namespace
+{
+	struct SlotResource
+	{
+		std::string path;
+		bool used = false;
+	};
+
+	/**
+	* Resource manager creating its resources in the first free slot of a fixed array, so a resource created
+	* after an unloading reuses the address of the unloaded one
+	*/
+	class SlotResourceManager : public OvCore::ResourceManagement::AResourceManager<SlotResource>
+	{
+	public:
+		using AResourceManager::ReloadResource;
+
+		~SlotResourceManager()
+		{
+			UnloadResources();
+		}
+
+		uint32_t GetUsedSlotCount() const
+		{
+			uint32_t count = 0;
+
+			for (const auto& slot : m_slots)
+				count += slot.used ? 1 : 0;
+
+			return count;
+		}
+
+	protected:
+		virtual SlotResource* CreateResource(const std::string& p_path) override
+		{
+			for (auto& slot : m_slots)
+			{
+				if (!slot.used)
+				{
+					slot = { p_path, true };
+					return &slot;
+				}
+			}
+
+			return nullptr;
+		}
+
+		virtual void DestroyResource(SlotResource* p_resource) override { p_resource->used = false; }
+		virtual void ReloadResource(SlotResource* p_resource, const std::string& p_path) override {}
+		virtual OvCore::ResourceManagement::ResourceMemory GetResourceMemory(SlotResource& p_resource) override { return { 100, 0 }; }
+
+	private:
+		std::array<SlotResource, 4> m_slots;
+	};
+}
+
+OVTEST(ResourceHandle, HandlesProtectResourcesFromEviction)
+{
+	SlotResourceManager manager;
+	manager.SetMemoryBudget(50);
+
+	auto handle = manager.GetHandle("A");
+	manager.GetResource("B");
+	OVTEST_CHECK(handle && handle->path == "A");
+
+	/* Only the unreferenced resource is evicted */
+	OVTEST_CHECK(manager.EvictUnusedResources() == 1);
+	OVTEST_CHECK(manager.IsResourceRegistered("A") && !manager.IsResourceRegistered("B"));
+
+	/* Copies are counted as well */
+	auto copy = handle;
+	handle.Reset();
+	OVTEST_CHECK(manager.EvictUnusedResources() == 0);
+
+	copy.Reset();
+	OVTEST_CHECK(manager.EvictUnusedResources() == 1);
+	OVTEST_CHECK(manager.GetResources().empty() && manager.GetUsedSlotCount() == 0);
+}
+
+OVTEST(ResourceHandle, StaleHandlesDontCountForReusedAddresses)
+{
+	SlotResourceManager manager;
+	manager.SetMemoryBudget(50);
+
+	/* A is unloaded while referenced, then B is created at its address */
+	auto staleHandle = manager.GetHandle("A");
+	SlotResource* const address = staleHandle.Get();
+	manager.UnloadResource("A");
+
+	auto handle = manager.GetHandle("B");
+	OVTEST_CHECK(handle.Get() == address);
+
+	/* Neither copying nor releasing the stale handle affects the reference count of B */
+	auto staleCopy = staleHandle;
+	staleCopy.Reset();
+	staleHandle.Reset();
+
+	OVTEST_CHECK(manager.EvictUnusedResources() == 0);
+	OVTEST_CHECK(manager.IsResourceRegistered("B") && handle->used && handle->path == "B");
+
+	/* The same goes for handles alive while every resource is unloaded */
+	auto otherStaleHandle = manager.GetHandle("C");
+	manager.UnloadResources();
+
+	auto otherHandle = manager.GetHandle("D");
+	OVTEST_CHECK(otherHandle.Get() == address);
+
+	handle.Reset();
+	otherStaleHandle.Reset();
+	OVTEST_CHECK(manager.EvictUnusedResources() == 0);
+	OVTEST_CHECK(manager.IsResourceRegistered("D") && otherHandle->used && otherHandle->path == "D");
+
+	otherHandle.Reset();
+	OVTEST_CHECK(manager.EvictUnusedResources() == 1);
+	OVTEST_CHECK(manager.GetUsedSlotCount() == 0);
+}
+
+OVTEST(ResourceHandle, ReloadingKeepsHandlesCounted)
+{
+	SlotResourceManager manager;
+	manager.SetMemoryBudget(50);
+
+	auto handle = manager.GetHandle("A");
+	manager.ReloadResource("A");
+	OVTEST_CHECK(manager.GetMemoryUsage().cpuBytes == 100);
+	OVTEST_CHECK(manager.EvictUnusedResources() == 0);
+
+	handle.Reset();
+	OVTEST_CHECK(manager.EvictUnusedResources() == 1);
+	OVTEST_CHECK(manager.GetMemoryUsage().cpuBytes == 0);
+}
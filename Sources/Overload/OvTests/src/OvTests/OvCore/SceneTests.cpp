@@ -0,0 +1,715 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#include <algorithm>
+#include <cstddef>
+#include <filesystem>
+#include <functional>
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <random>
+#include <type_traits>
+
+#include <OvTools/Filesystem/tinyxml2.h>
+
+#include <OvCore/ECS/Components/CAmbientBoxLight.h>
+#include <OvCore/ECS/Components/CAmbientSphereLight.h>
+#include <OvCore/ECS/Components/CCamera.h>
+#include <OvCore/ECS/Components/CDirectionalLight.h>
+#include <OvCore/ECS/Components/CMaterialRenderer.h>
+#include <OvCore/ECS/Components/CModelRenderer.h>
+#include <OvCore/ECS/Components/CPointLight.h>
+#include <OvCore/ECS/Components/CSpotLight.h>
+#include <OvCore/Global/ServiceLocator.h>
+#include <OvCore/ResourceManagement/MaterialManager.h>
+#include <OvCore/SceneSystem/BinarySceneFormat.h>
+#include <OvCore/SceneSystem/Scene.h>
+
+#include "OvTests/TestRegistry.h"
+
+namespace
+{
+	using namespace OvCore::ECS;
+	using namespace OvCore::ECS::Components;
+
+	/**
+	* Fill the given scene with a hierarchy of actors. Some children are created before their parent, so
+	* parents can't be resolved while the actors are loaded
+	*/
+	void PopulateScene(OvCore::SceneSystem::Scene& p_scene, uint32_t p_actorCount)
+	{
+		std::vector<Actor*> actors;
+
+		for (uint32_t i = 0; i < p_actorCount; ++i)
+		{
+			Actor& actor = p_scene.CreateActor("Actor" + std::to_string(i), i % 3 == 0 ? "Tagged" : "");
+			actor.transform.SetLocalPosition({ static_cast<float>(i), 2.0f, -static_cast<float>(i) });
+
+			if (i % 4 == 0)
+				actor.AddComponent<CPointLight>();
+
+			if (i % 10 == 0)
+				actor.AddComponent<CCamera>().SetFov(30.0f + i % 50);
+
+			if (i % 9 == 5)
+				actor.SetActive(false);
+
+			actors.push_back(&actor);
+		}
+
+		for (uint32_t i = 0; i < p_actorCount; ++i)
+		{
+			/* Chains of nested actors, and chain roots parented to the root of a chain created after them */
+			if (i % 5 != 0)
+				actors[i]->SetParent(*actors[i - 1]);
+			else if (i % 10 == 0 && i + 5 < p_actorCount)
+				actors[i]->SetParent(*actors[i + 5]);
+		}
+	}
+
+	bool IsSame(const OvMaths::FVector3& p_first, const OvMaths::FVector3& p_second)
+	{
+		return p_first.x == p_second.x && p_first.y == p_second.y && p_first.z == p_second.z;
+	}
+
+	void Serialize(OvCore::SceneSystem::Scene& p_scene, tinyxml2::XMLDocument& p_doc)
+	{
+		tinyxml2::XMLNode* root = p_doc.NewElement("root");
+		p_doc.InsertFirstChild(root);
+		p_scene.OnSerialize(p_doc, root);
+	}
+
+	void Deserialize(OvCore::SceneSystem::Scene& p_scene, tinyxml2::XMLDocument& p_doc)
+	{
+		p_scene.OnDeserialize(p_doc, p_doc.FirstChild()->FirstChildElement("scene"));
+	}
+
+	std::string ToXML(OvCore::SceneSystem::Scene& p_scene)
+	{
+		tinyxml2::XMLDocument doc;
+		Serialize(p_scene, doc);
+
+		tinyxml2::XMLPrinter printer;
+		doc.Print(&printer);
+		return printer.CStr();
+	}
+
+	/**
+	* Save the given scene to the binary format, and load it into the other scene
+	*/
+	bool BinaryRoundTrip(OvCore::SceneSystem::Scene& p_source, OvCore::SceneSystem::Scene& p_loaded)
+	{
+		const std::vector<uint8_t> data = OvCore::SceneSystem::BinarySceneFormat::Encode(p_source);
+		return OvCore::SceneSystem::BinarySceneFormat::Decode(data.data(), data.size(), p_loaded);
+	}
+}
+
+OVTEST(Scene, BulkDeserializationRestoresTheScene)
+{
+	OvCore::SceneSystem::Scene source;
+	PopulateScene(source, 200);
+
+	tinyxml2::XMLDocument doc;
+	Serialize(source, doc);
+
+	OvCore::SceneSystem::Scene loaded;
+	Deserialize(loaded, doc);
+
+	auto& expectedActors = source.GetActors();
+	auto& actualActors = loaded.GetActors();
+	OVTEST_CHECK(actualActors.size() == expectedActors.size());
+
+	for (size_t i = 0; i < expectedActors.size(); ++i)
+	{
+		Actor& expected = *expectedActors[i];
+		Actor& actual = *actualActors[i];
+
+		OVTEST_CHECK(actual.GetID() == expected.GetID());
+		OVTEST_CHECK(actual.GetName() == expected.GetName() && actual.GetTag() == expected.GetTag());
+		OVTEST_CHECK(actual.IsSelfActive() == expected.IsSelfActive() && actual.IsActive() == expected.IsActive());
+		OVTEST_CHECK(IsSame(actual.transform.GetLocalPosition(), expected.transform.GetLocalPosition()));
+		OVTEST_CHECK(IsSame(actual.transform.GetWorldPosition(), expected.transform.GetWorldPosition()));
+
+		/* Parents are resolved to the loaded actors, children are attached in the same order */
+		OVTEST_CHECK(actual.GetParentID() == expected.GetParentID());
+		OVTEST_CHECK((actual.GetParent() != nullptr) == (expected.GetParent() != nullptr));
+		OVTEST_CHECK(!actual.GetParent() || actual.GetParent() == loaded.FindActorByID(expected.GetParent()->GetID()));
+		OVTEST_CHECK(actual.GetChildren().size() == expected.GetChildren().size());
+
+		for (size_t j = 0; j < expected.GetChildren().size(); ++j)
+			OVTEST_CHECK(actual.GetChildren()[j]->GetID() == expected.GetChildren()[j]->GetID());
+
+		OVTEST_CHECK(actual.GetComponents().size() == expected.GetComponents().size());
+
+		if (auto camera = expected.GetComponent<CCamera>())
+			OVTEST_CHECK(actual.GetComponent<CCamera>() && actual.GetComponent<CCamera>()->GetFov() == camera->GetFov());
+
+		OVTEST_CHECK((actual.GetComponent<CPointLight>() != nullptr) == (expected.GetComponent<CPointLight>() != nullptr));
+	}
+
+	/* Components added while loading are registered in a single batch */
+	OVTEST_CHECK(loaded.GetFastAccessComponents().lights.size() == source.GetFastAccessComponents().lights.size());
+	OVTEST_CHECK(loaded.GetFastAccessComponents().cameras.size() == source.GetFastAccessComponents().cameras.size());
+	OVTEST_CHECK(loaded.GetActiveComponents().lights.size() == source.GetActiveComponents().lights.size());
+	OVTEST_CHECK(loaded.GetActiveComponents().cameras.size() == source.GetActiveComponents().cameras.size());
+
+	/* Loaded actors are listened to like created ones, and new actors don't reuse loaded IDs */
+	const auto litActor = std::find_if(actualActors.begin(), actualActors.end(), [](Actor* p_actor) { return p_actor->IsActive() && p_actor->GetComponent<CPointLight>(); });
+	OVTEST_CHECK(litActor != actualActors.end());
+
+	const size_t activeLights = loaded.GetActiveComponents().lights.size();
+	(*litActor)->SetActive(false);
+	OVTEST_CHECK(loaded.GetActiveComponents().lights.size() < activeLights);
+
+	Actor& created = loaded.CreateActor();
+	OVTEST_CHECK(loaded.FindActorByID(created.GetID()) == &created);
+
+	for (size_t i = 0; i + 1 < actualActors.size(); ++i)
+		OVTEST_CHECK(actualActors[i]->GetID() != created.GetID());
+}
+
+OVBENCHMARK(Scene, BulkDeserialization)
+{
+	for (uint32_t actorCount : { 1000, 10000, 100000 })
+	{
+		OvCore::SceneSystem::Scene source;
+		PopulateScene(source, actorCount);
+
+		tinyxml2::XMLDocument doc;
+		Serialize(source, doc);
+
+		const double elapsed = OvTests::TestRegistry::Measure([&doc]
+		{
+			OvCore::SceneSystem::Scene loaded;
+			Deserialize(loaded, doc);
+		});
+
+		std::cout << actorCount << " actors: " << elapsed << " ms (Deserialization and destruction)" << std::endl;
+	}
+}
+
+OVTEST(Scene, BinaryComponentsRoundTrip)
+{
+	using namespace OvCore::SceneSystem;
+
+	OvCore::ResourceManagement::MaterialManager materialManager;
+	OvCore::Global::ServiceLocator::Provide(materialManager);
+
+	/* Registered with its path, like a loaded material (See MaterialManager::CreateResource) */
+	auto material = new OvCore::Resources::Material();
+	*reinterpret_cast<std::string*>(reinterpret_cast<char*>(material) + offsetof(OvCore::Resources::Material, path)) = "Test.ovmat";
+	materialManager.RegisterResource("Test.ovmat", material);
+
+	Scene source;
+
+	Actor& cameraActor = source.CreateActor("Camera", "Tag");
+	cameraActor.transform.SetLocalPosition({ 1.5f, -2.25f, 3.0f });
+	cameraActor.transform.SetLocalRotation(OvMaths::FQuaternion({ 10.0f, 20.0f, 30.0f }));
+	cameraActor.transform.SetLocalScale({ 2.0f, 0.5f, 4.0f });
+
+	auto& camera = cameraActor.AddComponent<CCamera>();
+	camera.SetFov(72.5f);
+	camera.SetSize(12.0f);
+	camera.SetNear(0.25f);
+	camera.SetFar(750.0f);
+	camera.SetClearColor({ 0.1f, 0.2f, 0.3f });
+	camera.SetFrustumGeometryCulling(true);
+	camera.SetFrustumLightCulling(true);
+	camera.SetProjectionMode(OvRendering::Settings::EProjectionMode::ORTHOGRAPHIC);
+
+	auto& pointLight = source.CreateActor("Point").AddComponent<CPointLight>();
+	pointLight.SetColor({ 0.5f, 0.25f, 1.0f });
+	pointLight.SetIntensity(3.5f);
+	pointLight.SetConstant(0.5f);
+	pointLight.SetLinear(0.125f);
+	pointLight.SetQuadratic(0.0625f);
+
+	auto& spotLight = source.CreateActor("Spot").AddComponent<CSpotLight>();
+	spotLight.SetColor({ 1.0f, 0.0f, 0.5f });
+	spotLight.SetConstant(2.0f);
+	spotLight.SetLinear(0.25f);
+	spotLight.SetQuadratic(0.5f);
+	spotLight.SetCutoff(17.5f);
+	spotLight.SetOuterCutoff(22.5f);
+
+	auto& directionalLight = source.CreateActor("Directional").AddComponent<CDirectionalLight>();
+	directionalLight.SetIntensity(0.75f);
+
+	auto& boxLight = source.CreateActor("Box").AddComponent<CAmbientBoxLight>();
+	boxLight.SetSize({ 4.0f, 5.0f, 6.0f });
+
+	auto& sphereLight = source.CreateActor("Sphere").AddComponent<CAmbientSphereLight>();
+	sphereLight.SetRadius(42.0f);
+
+	/* Without a model, so no model manager is needed */
+	Actor& rendererActor = source.CreateActor("Renderer");
+	auto& modelRenderer = rendererActor.AddComponent<CModelRenderer>();
+	modelRenderer.SetFrustumBehaviour(CModelRenderer::EFrustumBehaviour::CULL_CUSTOM);
+	modelRenderer.SetCustomBoundingSphere({ { 1.0f, 2.0f, 3.0f }, 9.5f });
+
+	auto& materialRenderer = rendererActor.AddComponent<CMaterialRenderer>();
+	materialRenderer.SetMaterialAtIndex(2, *material);
+
+	Scene loaded;
+	OVTEST_CHECK(BinaryRoundTrip(source, loaded));
+	OVTEST_CHECK(loaded.GetActors().size() == source.GetActors().size());
+
+	Actor* loadedCameraActor = loaded.FindActorByName("Camera");
+	OVTEST_CHECK(loadedCameraActor && loadedCameraActor->GetTag() == "Tag" && loadedCameraActor->GetID() == cameraActor.GetID());
+	OVTEST_CHECK(IsSame(loadedCameraActor->transform.GetLocalPosition(), cameraActor.transform.GetLocalPosition()));
+	OVTEST_CHECK(IsSame(loadedCameraActor->transform.GetLocalScale(), cameraActor.transform.GetLocalScale()));
+
+	const OvMaths::FQuaternion expectedRotation = cameraActor.transform.GetLocalRotation();
+	const OvMaths::FQuaternion actualRotation = loadedCameraActor->transform.GetLocalRotation();
+	OVTEST_CHECK(actualRotation.x == expectedRotation.x && actualRotation.y == expectedRotation.y && actualRotation.z == expectedRotation.z && actualRotation.w == expectedRotation.w);
+
+	auto loadedCamera = loadedCameraActor->GetComponent<CCamera>();
+	OVTEST_CHECK(loadedCamera);
+	OVTEST_CHECK(loadedCamera->GetFov() == 72.5f && loadedCamera->GetSize() == 12.0f);
+	OVTEST_CHECK(loadedCamera->GetNear() == 0.25f && loadedCamera->GetFar() == 750.0f);
+	OVTEST_CHECK(IsSame(loadedCamera->GetClearColor(), camera.GetClearColor()));
+	OVTEST_CHECK(loadedCamera->HasFrustumGeometryCulling() && loadedCamera->HasFrustumLightCulling());
+	OVTEST_CHECK(loadedCamera->GetProjectionMode() == OvRendering::Settings::EProjectionMode::ORTHOGRAPHIC);
+
+	auto loadedPointLight = loaded.FindActorByName("Point")->GetComponent<CPointLight>();
+	OVTEST_CHECK(loadedPointLight);
+	OVTEST_CHECK(IsSame(loadedPointLight->GetData().color, pointLight.GetData().color));
+	OVTEST_CHECK(loadedPointLight->GetIntensity() == 3.5f);
+	OVTEST_CHECK(loadedPointLight->GetConstant() == 0.5f && loadedPointLight->GetLinear() == 0.125f && loadedPointLight->GetQuadratic() == 0.0625f);
+
+	auto loadedSpotLight = loaded.FindActorByName("Spot")->GetComponent<CSpotLight>();
+	OVTEST_CHECK(loadedSpotLight);
+	OVTEST_CHECK(IsSame(loadedSpotLight->GetData().color, spotLight.GetData().color));
+	OVTEST_CHECK(loadedSpotLight->GetConstant() == 2.0f && loadedSpotLight->GetLinear() == 0.25f && loadedSpotLight->GetQuadratic() == 0.5f);
+	OVTEST_CHECK(loadedSpotLight->GetCutoff() == 17.5f && loadedSpotLight->GetOuterCutoff() == 22.5f);
+
+	auto loadedDirectionalLight = loaded.FindActorByName("Directional")->GetComponent<CDirectionalLight>();
+	OVTEST_CHECK(loadedDirectionalLight && loadedDirectionalLight->GetIntensity() == 0.75f);
+
+	auto loadedBoxLight = loaded.FindActorByName("Box")->GetComponent<CAmbientBoxLight>();
+	OVTEST_CHECK(loadedBoxLight && IsSame(loadedBoxLight->GetSize(), { 4.0f, 5.0f, 6.0f }));
+
+	auto loadedSphereLight = loaded.FindActorByName("Sphere")->GetComponent<CAmbientSphereLight>();
+	OVTEST_CHECK(loadedSphereLight && loadedSphereLight->GetData().constant == 42.0f); // The radius (GetRadius reads another field)
+
+	Actor* loadedRendererActor = loaded.FindActorByName("Renderer");
+	auto loadedModelRenderer = loadedRendererActor->GetComponent<CModelRenderer>();
+	OVTEST_CHECK(loadedModelRenderer && !loadedModelRenderer->GetModel());
+	OVTEST_CHECK(loadedModelRenderer->GetFrustumBehaviour() == CModelRenderer::EFrustumBehaviour::CULL_CUSTOM);
+	OVTEST_CHECK(IsSame(loadedModelRenderer->GetCustomBoundingSphere().position, { 1.0f, 2.0f, 3.0f }));
+	OVTEST_CHECK(loadedModelRenderer->GetCustomBoundingSphere().radius == 9.5f);
+
+	/* Materials are restored at their index, from their path */
+	auto loadedMaterialRenderer = loadedRendererActor->GetComponent<CMaterialRenderer>();
+	OVTEST_CHECK(loadedMaterialRenderer);
+	OVTEST_CHECK(!loadedMaterialRenderer->GetMaterialAtIndex(0) && !loadedMaterialRenderer->GetMaterialAtIndex(1));
+	OVTEST_CHECK(loadedMaterialRenderer->GetMaterialAtIndex(2) == material);
+	OVTEST_CHECK(!loadedMaterialRenderer->GetMaterialAtIndex(3));
+
+	/* Components are registered to the loaded scene */
+	OVTEST_CHECK(loaded.GetFastAccessComponents().lights.size() == source.GetFastAccessComponents().lights.size());
+	OVTEST_CHECK(loaded.GetFastAccessComponents().cameras.size() == 1);
+	OVTEST_CHECK(loaded.GetFastAccessComponents().modelRenderers.size() == 1);
+}
+
+OVTEST(Scene, BinaryScenesMatchXMLScenes)
+{
+	OvCore::SceneSystem::Scene source;
+	PopulateScene(source, 200);
+
+	tinyxml2::XMLDocument doc;
+	Serialize(source, doc);
+
+	OvCore::SceneSystem::Scene xmlLoaded;
+	Deserialize(xmlLoaded, doc);
+
+	/* Loading the binary scene gives the same scene as loading the XML scene */
+	OvCore::SceneSystem::Scene binaryLoaded;
+	OVTEST_CHECK(BinaryRoundTrip(source, binaryLoaded));
+	OVTEST_CHECK(ToXML(binaryLoaded) == ToXML(xmlLoaded));
+
+	/* Same when converting files back and forth */
+	const std::string xmlPath = OvTests::TestRegistry::GetTemporaryPath("SceneConversion.ovscene");
+	const std::string binaryPath = OvTests::TestRegistry::GetTemporaryPath("SceneConversion.ovscenebin");
+	const std::string convertedPath = OvTests::TestRegistry::GetTemporaryPath("SceneConversionBack.ovscene");
+
+	OVTEST_CHECK(doc.SaveFile(xmlPath.c_str()) == tinyxml2::XML_SUCCESS);
+	OVTEST_CHECK(OvCore::SceneSystem::BinarySceneFormat::ConvertToBinary(xmlPath, binaryPath));
+	OVTEST_CHECK(OvCore::SceneSystem::BinarySceneFormat::ConvertToXML(binaryPath, convertedPath));
+
+	OvCore::SceneSystem::Scene fromBinaryFile;
+	OVTEST_CHECK(OvCore::SceneSystem::BinarySceneFormat::Load(binaryPath, fromBinaryFile));
+	OVTEST_CHECK(fromBinaryFile.GetActors().size() == source.GetActors().size());
+
+	/* Components are added in front of the previous ones, so each loading reverses their order: the converted file has been loaded twice */
+	OvCore::SceneSystem::Scene fromConvertedFile;
+	OVTEST_CHECK(OvCore::SceneSystem::BinarySceneFormat::Load(convertedPath, fromConvertedFile));
+	OVTEST_CHECK(ToXML(fromConvertedFile) == ToXML(xmlLoaded));
+
+	std::filesystem::remove(xmlPath);
+	std::filesystem::remove(binaryPath);
+	std::filesystem::remove(convertedPath);
+}
+
+OVTEST(Scene, CorruptedBinaryScenesAreRejected)
+{
+	OvCore::SceneSystem::Scene source;
+	PopulateScene(source, 20);
+
+	const std::vector<uint8_t> data = OvCore::SceneSystem::BinarySceneFormat::Encode(source);
+	OVTEST_CHECK(OvCore::SceneSystem::BinarySceneFormat::Validate(data.data(), data.size()));
+
+	OvCore::SceneSystem::Scene target;
+	target.CreateActor("Existing");
+
+	const auto isRejected = [&target](const std::vector<uint8_t>& p_data, size_t p_size)
+	{
+		return !OvCore::SceneSystem::BinarySceneFormat::Validate(p_data.data(), p_size) &&
+			!OvCore::SceneSystem::BinarySceneFormat::Decode(p_data.data(), p_size, target) &&
+			target.GetActors().size() == 1;
+	};
+
+	/* Truncated anywhere */
+	for (size_t size = 0; size < data.size(); ++size)
+		OVTEST_CHECK(isRejected(data, size));
+
+	/* Wrong header or unsupported version */
+	std::vector<uint8_t> corrupted = data;
+	corrupted[0] = 'X';
+	OVTEST_CHECK(isRejected(corrupted, corrupted.size()));
+
+	corrupted = data;
+	corrupted[4] = 3;
+	OVTEST_CHECK(isRejected(corrupted, corrupted.size()));
+
+	/* Actor count larger than the data (The actor count of an empty scene is the last byte of the file) */
+	OvCore::SceneSystem::Scene empty;
+	corrupted = OvCore::SceneSystem::BinarySceneFormat::Encode(empty);
+	OVTEST_CHECK(corrupted.back() == 0);
+	OVTEST_CHECK(OvCore::SceneSystem::BinarySceneFormat::Decode(corrupted.data(), corrupted.size(), target) && target.GetActors().size() == 1);
+
+	corrupted.back() = 100;
+	OVTEST_CHECK(isRejected(corrupted, corrupted.size()));
+}
+
+OVBENCHMARK(Scene, BinaryDeserialization)
+{
+	/* Loading and destruction are measured apart, destroying a scene doesn't depend on the format it was loaded from */
+	const auto measureLoad = [](const auto& p_load, double& p_destruction)
+	{
+		auto loaded = std::make_unique<OvCore::SceneSystem::Scene>();
+		const double loading = OvTests::TestRegistry::Measure([&] { p_load(*loaded); });
+		p_destruction = OvTests::TestRegistry::Measure([&loaded] { loaded.reset(); });
+		return loading;
+	};
+
+	for (uint32_t actorCount : { 1000, 10000 })
+	{
+		OvCore::SceneSystem::Scene source;
+		PopulateScene(source, actorCount);
+
+		const std::string xml = ToXML(source);
+		const std::vector<uint8_t> binary = OvCore::SceneSystem::BinarySceneFormat::Encode(source);
+
+		/* Both include parsing the file content, as loading a scene file does */
+		double xmlDestruction = 0.0;
+		const double xmlLoading = measureLoad([&xml](OvCore::SceneSystem::Scene& p_scene)
+		{
+			tinyxml2::XMLDocument doc;
+			doc.Parse(xml.c_str(), xml.size());
+			Deserialize(p_scene, doc);
+		}, xmlDestruction);
+
+		double binaryDestruction = 0.0;
+		const double binaryLoading = measureLoad([&binary](OvCore::SceneSystem::Scene& p_scene)
+		{
+			OvCore::SceneSystem::BinarySceneFormat::Decode(binary.data(), binary.size(), p_scene);
+		}, binaryDestruction);
+
+		/* The actors, components and hierarchy created by both formats, which no format can load faster than */
+		double builtDestruction = 0.0;
+		const double building = measureLoad([actorCount](OvCore::SceneSystem::Scene& p_scene) { PopulateScene(p_scene, actorCount); }, builtDestruction);
+
+		std::cout << actorCount << " actors: XML " << xml.size() / 1024 << " KiB, " << xmlLoading << " ms | Binary " << binary.size() / 1024 << " KiB, " << binaryLoading << " ms (" << xmlLoading / binaryLoading << "x faster)" << std::endl;
+		std::cout << "  Building the same scene from code: " << building << " ms | Destruction: " << xmlDestruction << " ms (XML), " << binaryDestruction << " ms (Binary), " << builtDestruction << " ms (Code)" << std::endl;
+	}
+}
+
+OVTEST(Scene, IndexedQueriesMatchLinearSearch)
+{
+	OvCore::SceneSystem::Scene scene;
+	std::mt19937 random(7);
+
+	const auto randomIndex = [&random](size_t p_count) { return std::uniform_int_distribution<size_t>(0, p_count - 1)(random); };
+	const auto randomKey = [&randomIndex]() { return std::string(1, static_cast<char>('A' + randomIndex(5))); };
+
+	const auto matchesLinearSearch = [&scene](auto p_matches, Actor* p_found, const std::vector<std::reference_wrapper<Actor>>& p_foundActors)
+	{
+		std::vector<Actor*> expected;
+		std::copy_if(scene.GetActors().begin(), scene.GetActors().end(), std::back_inserter(expected), p_matches);
+
+		std::vector<Actor*> found;
+		std::transform(p_foundActors.begin(), p_foundActors.end(), std::back_inserter(found), [](Actor& p_actor) { return &p_actor; });
+
+		return p_found == (expected.empty() ? nullptr : expected.front()) && found == expected;
+	};
+
+	for (uint32_t i = 0; i < 200; ++i)
+		scene.CreateActor(randomKey(), randomKey()).AddComponent<CCamera>();
+
+	for (uint32_t mutation = 0; mutation < 5000; ++mutation)
+	{
+		auto& actors = scene.GetActors();
+
+		if (actors.empty())
+			scene.CreateActor(randomKey(), randomKey()).AddComponent<CCamera>();
+
+		Actor& actor = *actors[randomIndex(actors.size())];
+
+		switch (randomIndex(8))
+		{
+		case 0: case 7: scene.CreateActor(randomKey(), randomKey()).AddComponent<CCamera>(); break;
+		case 1: scene.DestroyActor(actor); break;
+		case 2: actor.SetName(randomKey()); break;
+		case 3: actor.SetTag(randomKey()); break;
+		case 4: actor.SetID(static_cast<int64_t>(randomIndex(50))); break;
+		case 5: actor.SetActive(!actor.IsSelfActive()); break;
+		case 6: actor.MarkAsDestroy(); scene.CollectGarbages(); break;
+		}
+
+		const std::string key = randomKey();
+		const int64_t id = static_cast<int64_t>(randomIndex(50));
+
+		OVTEST_CHECK(matchesLinearSearch([&key](Actor* p_actor) { return p_actor->GetName() == key; }, scene.FindActorByName(key), scene.FindActorsByName(key)));
+		OVTEST_CHECK(matchesLinearSearch([&key](Actor* p_actor) { return p_actor->GetTag() == key; }, scene.FindActorByTag(key), scene.FindActorsByTag(key)));
+
+		Actor* expectedByID = nullptr;
+		for (Actor* candidate : scene.GetActors())
+		{
+			if (candidate->GetID() == id)
+			{
+				expectedByID = candidate;
+				break;
+			}
+		}
+
+		OVTEST_CHECK(scene.FindActorByID(id) == expectedByID);
+	}
+
+	/* Active cameras are the cameras of active actors, in registration order */
+	std::vector<CCamera*> expectedCameras;
+	const auto& cameras = scene.GetFastAccessComponents().cameras;
+	std::copy_if(cameras.begin(), cameras.end(), std::back_inserter(expectedCameras), [](CCamera* p_camera) { return p_camera->owner.IsActive(); });
+	OVTEST_CHECK(scene.GetActiveComponents().cameras == expectedCameras);
+}
+
+OVBENCHMARK(Scene, MixedLookups)
+{
+	constexpr uint32_t kActorCount = 100000;
+	constexpr uint32_t kTagCount = 100;
+
+	OvCore::SceneSystem::Scene scene;
+
+	/* Unique names and IDs, and tags shared by a thousand actors each */
+	for (uint32_t i = 0; i < kActorCount; ++i)
+		scene.CreateActor("Actor" + std::to_string(i), "Tag" + std::to_string(i % kTagCount)).SetID(i + 1);
+
+	std::mt19937 random(3);
+	std::vector<uint32_t> keys(1000);
+	std::generate(keys.begin(), keys.end(), [&random] { return std::uniform_int_distribution<uint32_t>(0, kActorCount - 1)(random); });
+
+	std::vector<std::string> names;
+	std::vector<std::string> tags;
+
+	for (const uint32_t key : keys)
+	{
+		names.push_back("Actor" + std::to_string(key));
+		tags.push_back("Tag" + std::to_string(key % kTagCount));
+	}
+
+	volatile uintptr_t sink = 0; // Keeps the queries from being optimized out
+
+	/* Through the indices, per kind of query, the tag queries going through the thousand actors sharing the tag */
+	const auto measureIndexed = [&keys, &sink](const auto& p_query)
+	{
+		return OvTests::TestRegistry::Measure([&]
+		{
+			for (size_t i = 0; i < keys.size(); ++i)
+				sink = sink + p_query(i);
+		});
+	};
+
+	const double byID = measureIndexed([&](size_t p_key) { return reinterpret_cast<uintptr_t>(scene.FindActorByID(keys[p_key] + 1)); });
+	const double byName = measureIndexed([&](size_t p_key) { return reinterpret_cast<uintptr_t>(scene.FindActorByName(names[p_key])); });
+	const double byTag = measureIndexed([&](size_t p_key) { return reinterpret_cast<uintptr_t>(scene.FindActorByTag(tags[p_key])); });
+	const double allByTag = measureIndexed([&](size_t p_key) { return static_cast<uintptr_t>(scene.FindActorsByTag(tags[p_key]).size()); });
+
+	/* The same queries through a search of the actor list */
+	const double linear = OvTests::TestRegistry::Measure([&]
+	{
+		const auto& actors = scene.GetActors();
+
+		for (size_t i = 0; i < keys.size(); i += 10)
+		{
+			const auto findFirst = [&actors](auto p_matches) { return *std::find_if(actors.begin(), actors.end(), p_matches); };
+
+			sink = sink + reinterpret_cast<uintptr_t>(findFirst([&](Actor* p_actor) { return p_actor->GetID() == keys[i] + 1; }));
+			sink = sink + reinterpret_cast<uintptr_t>(findFirst([&](Actor* p_actor) { return p_actor->GetName() == names[i]; }));
+			sink = sink + reinterpret_cast<uintptr_t>(findFirst([&](Actor* p_actor) { return p_actor->GetTag() == tags[i]; }));
+			sink = sink + std::count_if(actors.begin(), actors.end(), [&](Actor* p_actor) { return p_actor->GetTag() == tags[i]; });
+		}
+	}) * 10.0;
+
+	std::cout << kActorCount << " actors, " << keys.size() << " lookups of each kind: indexed " << byID + byName + byTag + allByTag << " ms, linear search " << linear << " ms (Extrapolated from a tenth of the lookups)" << std::endl;
+	std::cout << "  Indexed: " << byID << " ms (ID), " << byName << " ms (Name), " << byTag << " ms (First of a tag), " << allByTag << " ms (Every actor of a tag)" << std::endl;
+}
+
+OVTEST(Scene, ActiveStateMatchesHierarchy)
+{
+	OvCore::SceneSystem::Scene scene;
+	std::mt19937 random(11);
+
+	const auto randomIndex = [&random](size_t p_count) { return std::uniform_int_distribution<size_t>(0, p_count - 1)(random); };
+
+	/* Components of the listed types, in the order they were added */
+	std::vector<AComponent*> registered;
+
+	const auto addComponent = [&registered, &randomIndex](Actor& p_actor)
+	{
+		AComponent* added = nullptr;
+
+		switch (randomIndex(4))
+		{
+		case 0: if (!p_actor.GetComponent<CModelRenderer>()) added = &p_actor.AddComponent<CModelRenderer>(); break;
+		case 1: if (!p_actor.GetComponent<CCamera>()) added = &p_actor.AddComponent<CCamera>(); break;
+		case 2: if (!p_actor.GetComponent<CPointLight>()) added = &p_actor.AddComponent<CPointLight>(); break;
+		case 3: if (!p_actor.GetComponent<CSpotLight>()) added = &p_actor.AddComponent<CSpotLight>(); break;
+		}
+
+		if (added)
+			registered.push_back(added);
+	};
+
+	const auto forgetComponents = [&registered](const std::function<bool(AComponent*)>& p_removed)
+	{
+		registered.erase(std::remove_if(registered.begin(), registered.end(), p_removed), registered.end());
+	};
+
+	const auto isInSubtree = [](const Actor* p_actor, const Actor* p_root)
+	{
+		for (; p_actor; p_actor = p_actor->GetParent())
+		{
+			if (p_actor == p_root)
+				return true;
+		}
+
+		return false;
+	};
+
+	/* Recomputed from the hierarchy, the way IsActive was evaluated before being cached */
+	const std::function<bool(const Actor*)> isHierarchyActive = [&isHierarchyActive](const Actor* p_actor)
+	{
+		return p_actor->IsSelfActive() && (!p_actor->GetParent() || isHierarchyActive(p_actor->GetParent()));
+	};
+
+	const auto expectedActive = [&registered, &isHierarchyActive](auto* p_type)
+	{
+		using Type = std::remove_pointer_t<decltype(p_type)>;
+		std::vector<Type*> expected;
+
+		for (AComponent* component : registered)
+		{
+			if (auto result = dynamic_cast<Type*>(component); result && isHierarchyActive(&result->owner))
+				expected.push_back(result);
+		}
+
+		return expected;
+	};
+
+	for (uint32_t i = 0; i < 60; ++i)
+		addComponent(scene.CreateActor());
+
+	for (uint32_t mutation = 0; mutation < 3000; ++mutation)
+	{
+		auto& actors = scene.GetActors();
+		Actor& actor = *actors[randomIndex(actors.size())];
+		Actor& other = *actors[randomIndex(actors.size())];
+
+		switch (randomIndex(10))
+		{
+		case 0: case 1: actor.SetActive(!actor.IsSelfActive()); break;
+
+		/* Reparented under an actor outside of its subtree, so the hierarchy can't have cycles */
+		case 2: case 3:
+			if (!isInSubtree(&other, &actor))
+				actor.SetParent(other);
+			break;
+
+		case 4: actor.DetachFromParent(); break;
+		case 5: addComponent(actor); break;
+
+		case 6:
+			forgetComponents([&actor](AComponent* p_component) { return &p_component->owner == &actor && !dynamic_cast<CTransform*>(p_component); });
+			actor.RemoveComponent<CModelRenderer>();
+			actor.RemoveComponent<CCamera>();
+			actor.RemoveComponent<CLight>();
+			actor.RemoveComponent<CLight>();
+			break;
+
+		/* Destroying an actor detaches its children, which stay in the scene */
+		case 7:
+			forgetComponents([&actor](AComponent* p_component) { return &p_component->owner == &actor; });
+			scene.DestroyActor(actor);
+			addComponent(scene.CreateActor());
+			break;
+
+		/* While marking an actor as destroyed destroys its whole subtree */
+		case 8:
+			if (mutation % 10 == 0)
+			{
+				forgetComponents([&actor, &isInSubtree](AComponent* p_component) { return isInSubtree(&p_component->owner, &actor); });
+				actor.MarkAsDestroy();
+				scene.CollectGarbages();
+			}
+			break;
+
+		case 9: addComponent(scene.CreateActor()); break;
+		}
+
+		if (scene.GetActors().empty())
+			addComponent(scene.CreateActor());
+
+		OVTEST_CHECK(std::all_of(scene.GetActors().begin(), scene.GetActors().end(), [&isHierarchyActive](Actor* p_actor) { return p_actor->IsActive() == isHierarchyActive(p_actor); }));
+
+		const auto& active = scene.GetActiveComponents();
+		OVTEST_CHECK(active.modelRenderers == expectedActive(static_cast<CModelRenderer*>(nullptr)));
+		OVTEST_CHECK(active.cameras == expectedActive(static_cast<CCamera*>(nullptr)));
+		OVTEST_CHECK(active.lights == expectedActive(static_cast<CLight*>(nullptr)));
+	}
+}
+
+OVBENCHMARK(Scene, DestroyActorsSharingAName)
+{
+	for (uint32_t actorCount : { 10000, 100000 })
+	{
+		OvCore::SceneSystem::Scene scene;
+
+		for (uint32_t i = 0; i < actorCount; ++i)
+			scene.CreateActor("Enemy", "Enemies");
+
+		/* Destroyed from the first one, so every destruction removes the first actor of the name and tag buckets */
+		const double elapsed = OvTests::TestRegistry::Measure([&scene]
+		{
+			for (Actor* actor : scene.GetActors())
+				actor->MarkAsDestroy();
+
+			scene.CollectGarbages();
+		});
+
+		std::cout << actorCount << " actors: " << elapsed << " ms (Destruction)" << std::endl;
+	}
+}
@@ -0,0 +1,312 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#include <functional>
+#include <iostream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <OvCore/SceneSystem/Scene.h>
+#include <OvTools/Utils/ThreadPool.h>
+
+#include "OvTests/TestRegistry.h"
+
+namespace
+{
+	using OvCore::ECS::Actor;
+	using OvCore::ECS::Components::AComponent;
+
+	/**
+	* Component with nothing to serialize or inspect
+	*/
+	class ATestComponent : public AComponent
+	{
+	public:
+		ATestComponent(Actor& p_owner) : AComponent(p_owner) {}
+
+		std::string GetName() override { return "Test"; }
+		void OnSerialize(tinyxml2::XMLDocument& p_doc, tinyxml2::XMLNode* p_node) override {}
+		void OnDeserialize(tinyxml2::XMLDocument& p_doc, tinyxml2::XMLNode* p_node) override {}
+		void OnBinarySerialize(OvCore::Helpers::BinaryWriter& p_writer) override {}
+		void OnBinaryDeserialize(OvCore::Helpers::BinaryReader& p_reader) override {}
+		void OnInspector(OvUI::Internal::WidgetContainer& p_root) override {}
+	};
+
+	/**
+	* Appends its ID to a log on update, then runs its pending action once
+	*/
+	class CRecorder : public ATestComponent
+	{
+	public:
+		CRecorder(Actor& p_owner, std::vector<int>& p_log, int p_id) : ATestComponent(p_owner), m_log(p_log), m_id(p_id) {}
+
+		void OnUpdate(float p_deltaTime) override
+		{
+			m_log.push_back(m_id);
+
+			if (action)
+			{
+				const auto pending = std::move(action);
+				action = nullptr;
+				pending();
+			}
+		}
+
+		std::function<void()> action;
+
+	private:
+		std::vector<int>& m_log;
+		int m_id;
+	};
+
+	class CPooledRecorder : public CRecorder
+	{
+	public:
+		static constexpr bool kPooledStorage = true;
+
+		CPooledRecorder(Actor& p_owner, std::vector<int>& p_log, int p_id) : CRecorder(p_owner, p_log, p_id) {}
+	};
+
+	class CParallelCounter : public ATestComponent
+	{
+	public:
+		static constexpr bool kThreadSafeUpdate = true;
+
+		CParallelCounter(Actor& p_owner) : ATestComponent(p_owner) {}
+
+		void OnUpdate(float p_deltaTime) override { ++updateCount; }
+
+		uint32_t updateCount = 0;
+	};
+
+	/* Moves its owner along a line, standing for a typical scripted update */
+	template<bool Pooled, bool ThreadSafe>
+	class CMover : public ATestComponent
+	{
+	public:
+		static constexpr bool kPooledStorage = Pooled;
+		static constexpr bool kThreadSafeUpdate = ThreadSafe;
+
+		CMover(Actor& p_owner) : ATestComponent(p_owner) {}
+
+		void OnUpdate(float p_deltaTime) override { position += speed * p_deltaTime; }
+
+		float position = 0.0f;
+		float speed = 1.0f;
+	};
+
+	std::vector<int> TakeLog(std::vector<int>& p_log)
+	{
+		std::vector<int> log;
+		log.swap(p_log);
+		return log;
+	}
+}
+
+OVTEST(UpdateSystem, ComponentsAreUpdatedInRegistrationOrder)
+{
+	OvCore::SceneSystem::Scene scene;
+	std::vector<int> log;
+	std::vector<Actor*> actors;
+
+	for (int i = 0; i < 6; ++i)
+		actors.push_back(&scene.CreateActor());
+
+	/* Registered in another order than the actors were created */
+	for (int id = 0; id < 6; ++id)
+		actors[(id * 5 + 3) % 6]->AddComponent<CRecorder>(log, id);
+
+	scene.Update(0.0f);
+	OVTEST_CHECK((TakeLog(log) == std::vector<int>{ 0, 1, 2, 3, 4, 5 }));
+
+	/* Components with an inactive owner are skipped, and phases they don't implement never call them */
+	actors[(2 * 5 + 3) % 6]->SetActive(false);
+	scene.Update(0.0f);
+	scene.FixedUpdate(0.0f);
+	scene.LateUpdate(0.0f);
+	OVTEST_CHECK((TakeLog(log) == std::vector<int>{ 0, 1, 3, 4, 5 }));
+}
+
+OVTEST(UpdateSystem, ComponentsCanBeAddedAndRemovedDuringAnUpdate)
+{
+	OvCore::SceneSystem::Scene scene;
+	std::vector<int> log;
+	std::vector<Actor*> actors;
+	std::vector<CRecorder*> recorders;
+
+	for (int id = 0; id < 8; ++id)
+		actors.push_back(&scene.CreateActor());
+
+	for (int id = 0; id < 6; ++id)
+		recorders.push_back(&actors[id]->AddComponent<CRecorder>(log, id));
+
+	/* Removes a component already called this frame and one not called yet, whose slot is left empty */
+	recorders[2]->action = [&]
+	{
+		actors[0]->RemoveComponent<CRecorder>();
+		actors[4]->RemoveComponent<CRecorder>();
+	};
+
+	scene.Update(0.0f);
+	OVTEST_CHECK((TakeLog(log) == std::vector<int>{ 0, 1, 2, 3, 5 }));
+
+	/* The list was compacted without reordering the remaining components */
+	scene.Update(0.0f);
+	OVTEST_CHECK((TakeLog(log) == std::vector<int>{ 1, 2, 3, 5 }));
+
+	/* Components added while running are appended, and first called on the next run */
+	recorders[3]->action = [&]
+	{
+		actors[6]->AddComponent<CRecorder>(log, 6);
+	};
+
+	actors[0]->AddComponent<CRecorder>(log, 7);
+
+	scene.Update(0.0f);
+	OVTEST_CHECK((TakeLog(log) == std::vector<int>{ 1, 2, 3, 5, 7 }));
+
+	scene.Update(0.0f);
+	OVTEST_CHECK((TakeLog(log) == std::vector<int>{ 1, 2, 3, 5, 7, 6 }));
+
+	/* Removing every component then adding one leaves only that one */
+	for (int id = 0; id < 7; ++id)
+		actors[id]->RemoveComponent<CRecorder>();
+
+	actors[7]->AddComponent<CRecorder>(log, 8);
+	scene.Update(0.0f);
+	OVTEST_CHECK((TakeLog(log) == std::vector<int>{ 8 }));
+}
+
+OVTEST(UpdateSystem, PooledComponentsArePackedAndReused)
+{
+	OvCore::SceneSystem::Scene scene;
+	std::vector<int> log;
+	std::vector<Actor*> actors;
+	std::vector<CPooledRecorder*> recorders;
+
+	for (int id = 0; id < 4; ++id)
+		actors.push_back(&scene.CreateActor());
+
+	/* First components of their type, taken from a new chunk in address order */
+	for (int id = 0; id < 3; ++id)
+		recorders.push_back(&actors[id]->AddComponent<CPooledRecorder>(log, id));
+
+	const auto address = [&recorders](size_t p_index) { return reinterpret_cast<uintptr_t>(recorders[p_index]); };
+
+	OVTEST_CHECK(address(1) > address(0) && address(2) - address(1) == address(1) - address(0));
+	OVTEST_CHECK(actors[1]->GetComponent<CRecorder>() == recorders[1]);
+
+	scene.Update(0.0f);
+	OVTEST_CHECK((TakeLog(log) == std::vector<int>{ 0, 1, 2 }));
+
+	/* A freed slot is the next one given */
+	const uintptr_t removed = address(1);
+	actors[1]->RemoveComponent<CPooledRecorder>();
+	recorders[1] = &actors[3]->AddComponent<CPooledRecorder>(log, 3);
+
+	OVTEST_CHECK(address(1) == removed);
+	OVTEST_CHECK(actors[1]->GetComponent<CPooledRecorder>() == nullptr && actors[3]->GetComponent<CPooledRecorder>() == recorders[1]);
+
+	scene.Update(0.0f);
+	OVTEST_CHECK((TakeLog(log) == std::vector<int>{ 0, 2, 3 }));
+}
+
+OVTEST(UpdateSystem, ThreadSafeUpdatesRunInParallel)
+{
+	constexpr uint32_t kActorCount = 1000;
+
+	OvCore::SceneSystem::Scene scene;
+	OvTools::Utils::ThreadPool threadPool(4);
+	std::vector<Actor*> actors;
+	std::vector<CParallelCounter*> counters;
+
+	for (uint32_t i = 0; i < kActorCount; ++i)
+	{
+		actors.push_back(&scene.CreateActor());
+		counters.push_back(&actors.back()->AddComponent<CParallelCounter>());
+		actors.back()->SetActive(i % 7 != 0);
+	}
+
+	const auto countsAre = [&](uint32_t p_expected)
+	{
+		for (uint32_t i = 0; i < kActorCount; ++i)
+		{
+			if (counters[i] && counters[i]->updateCount != (i % 7 != 0 ? p_expected : 0))
+				return false;
+		}
+
+		return true;
+	};
+
+	for (uint32_t frame = 0; frame < 3; ++frame)
+		scene.Update(0.0f, &threadPool);
+
+	OVTEST_CHECK(countsAre(3));
+
+	/* Without a thread pool, they are called serially */
+	scene.Update(0.0f);
+	OVTEST_CHECK(countsAre(4));
+
+	/* Removed components empty their slot, the others still being updated once per frame after compaction */
+	for (uint32_t i = 0; i < kActorCount; i += 3)
+	{
+		actors[i]->RemoveComponent<CParallelCounter>();
+		counters[i] = nullptr;
+	}
+
+	scene.Update(0.0f, &threadPool);
+	scene.Update(0.0f, &threadPool);
+	OVTEST_CHECK(countsAre(6));
+}
+
+OVBENCHMARK(UpdateSystem, UpdateComponents)
+{
+	constexpr uint32_t kComponentCount = 100000;
+	constexpr uint32_t kFrames = 20;
+	constexpr float kFrameTime = 1.0f / 60.0f;
+
+	/* One moving component per actor, besides its transform */
+	const auto measure = [&](auto* p_type, const std::string& p_label, OvTools::Utils::ThreadPool* p_threadPool, bool p_compareToActorWalk)
+	{
+		using Mover = std::remove_pointer_t<decltype(p_type)>;
+
+		OvCore::SceneSystem::Scene scene;
+
+		for (uint32_t i = 0; i < kComponentCount; ++i)
+			scene.CreateActor().AddComponent<Mover>();
+
+		if (p_compareToActorWalk)
+		{
+			/* The way the scene updated its actors before the update system existed */
+			const double actorWalk = OvTests::TestRegistry::Measure([&]
+			{
+				auto actors = scene.GetActors();
+
+				for (auto* actor : actors)
+					actor->OnUpdate(kFrameTime);
+			}, kFrames);
+
+			std::cout << "Actor walk (" << p_label << "): " << actorWalk << " ms per frame" << std::endl;
+		}
+
+		const double updateSystem = OvTests::TestRegistry::Measure([&]
+		{
+			scene.Update(kFrameTime, p_threadPool);
+		}, kFrames);
+
+		std::cout << "Update system (" << p_label << "): " << updateSystem << " ms per frame (" << kComponentCount << " components)" << std::endl;
+	};
+
+	measure(static_cast<CMover<false, false>*>(nullptr), "Heap components", nullptr, true);
+	measure(static_cast<CMover<true, false>*>(nullptr), "Pooled components", nullptr, true);
+
+	for (const uint32_t threadCount : { 1, 2, 4 })
+	{
+		OvTools::Utils::ThreadPool threadPool(threadCount);
+		measure(static_cast<CMover<true, true>*>(nullptr), "Pooled thread-safe components, " + std::to_string(threadCount) + " pool threads", &threadPool, false);
+	}
+}
@@ -0,0 +1,100 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#include <chrono>
+#include <iostream>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <OvDebug/Logger.h>
+
+#include "OvTests/TestRegistry.h"
+
+OVTEST(Logger, ListenersAreNotifiedOnTheWriterThread)
+{
+	std::mutex mutex;
+	std::vector<std::string> messages;
+	bool calledOnLoggingThread = false;
+	const auto loggingThread = std::this_thread::get_id();
+
+	const auto listener = OvDebug::Logger::AddLogListener([&](const OvDebug::LogData& p_logData)
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		messages.push_back(p_logData.message);
+		calledOnLoggingThread |= std::this_thread::get_id() == loggingThread;
+	});
+
+	for (uint32_t i = 0; i < 1000; ++i)
+		OvDebug::Logger::Log(std::to_string(i), OvDebug::ELogLevel::LOG_INFO, OvDebug::ELogMode::HISTORY, "OvTests");
+
+	OvDebug::Logger::Flush();
+
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		OVTEST_CHECK(!calledOnLoggingThread);
+		OVTEST_CHECK(messages.size() == 1000);
+
+		for (uint32_t i = 0; i < messages.size(); ++i)
+			OVTEST_CHECK(messages[i] == std::to_string(i));
+	}
+
+	/* A removed listener is never called again */
+	OVTEST_CHECK(OvDebug::Logger::RemoveLogListener(listener));
+	OvDebug::Logger::Log("After removal", OvDebug::ELogLevel::LOG_INFO, OvDebug::ELogMode::HISTORY, "OvTests");
+	OvDebug::Logger::Flush();
+
+	std::lock_guard<std::mutex> lock(mutex);
+	OVTEST_CHECK(messages.size() == 1000);
+}
+
+OVBENCHMARK(Logger, Contention)
+{
+	/* Bursts are flushed before the queue (8192 records) can overflow, so no log is dropped */
+	constexpr uint32_t kBurstSize = 512;
+	constexpr uint32_t kBurstsPerThread = 40;
+
+	/* A listener is attached, as in the editor, to measure that it doesn't slow the logging threads down */
+	const auto listener = OvDebug::Logger::AddLogListener([](const OvDebug::LogData&) {});
+
+	for (uint32_t threadCount : { 1, 2, 4, 8 })
+	{
+		std::vector<std::thread> threads;
+		std::vector<double> loggingTimes(threadCount, 0.0);
+		const auto start = std::chrono::steady_clock::now();
+
+		for (uint32_t i = 0; i < threadCount; ++i)
+		{
+			threads.emplace_back([&loggingTimes, i]
+			{
+				for (uint32_t burst = 0; burst < kBurstsPerThread; ++burst)
+				{
+					loggingTimes[i] += OvTests::TestRegistry::Measure([]
+					{
+						OvDebug::Logger::Log("Benchmark log message", OvDebug::ELogLevel::LOG_INFO, OvDebug::ELogMode::HISTORY, "OvTests");
+					}, kBurstSize) * kBurstSize;
+
+					OvDebug::Logger::Flush();
+				}
+			});
+		}
+
+		for (auto& thread : threads)
+			thread.join();
+
+		const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+
+		double loggingTime = 0.0;
+		for (double time : loggingTimes)
+			loggingTime += time;
+
+		const double logsPerThread = static_cast<double>(kBurstSize) * kBurstsPerThread;
+		std::cout << threadCount << " thread(s): " << threadCount * logsPerThread / elapsed.count() * 1000.0 << " logs/s handled, "
+			<< loggingTime / (threadCount * logsPerThread) * 1000000.0 << " ns per Log call" << std::endl;
+	}
+
+	OvDebug::Logger::RemoveLogListener(listener);
+}
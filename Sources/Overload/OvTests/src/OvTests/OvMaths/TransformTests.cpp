@@ -0,0 +1,208 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#include <array>
+#include <cmath>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <OvMaths/FTransform.h>
+
+#include "OvTests/TestRegistry.h"
+
+namespace
+{
+	constexpr size_t kTransformCount = 12;
+	constexpr int kNoParent = -1;
+
+	/**
+	* Transforms with the parent each of them is expected to have, so their world matrix can be recomputed from scratch
+	*/
+	struct Hierarchy
+	{
+		std::array<std::unique_ptr<OvMaths::FTransform>, kTransformCount> transforms;
+		std::array<int, kTransformCount> parents;
+
+		Hierarchy()
+		{
+			for (auto& transform : transforms)
+				transform = std::make_unique<OvMaths::FTransform>();
+
+			parents.fill(kNoParent);
+		}
+
+		/* Computed eagerly, the way the world matrix was computed before it became lazy */
+		OvMaths::FMatrix4 GetExpectedWorldMatrix(size_t p_index) const
+		{
+			const OvMaths::FTransform& transform = *transforms[p_index];
+
+			const OvMaths::FMatrix4 local =
+				OvMaths::FMatrix4::Translation(transform.GetLocalPosition()) *
+				OvMaths::FQuaternion::ToMatrix4(OvMaths::FQuaternion::Normalize(transform.GetLocalRotation())) *
+				OvMaths::FMatrix4::Scaling(transform.GetLocalScale());
+
+			return parents[p_index] == kNoParent ? local : GetExpectedWorldMatrix(parents[p_index]) * local;
+		}
+	};
+
+	bool AreNearlyEqual(const OvMaths::FMatrix4& p_a, const OvMaths::FMatrix4& p_b)
+	{
+		for (uint32_t i = 0; i < 16; ++i)
+		{
+			if (std::abs(p_a.data[i] - p_b.data[i]) > 1e-3f * std::max(1.0f, std::abs(p_b.data[i])))
+				return false;
+		}
+
+		return true;
+	}
+
+	bool HasExpectedWorld(const Hierarchy& p_hierarchy, size_t p_index)
+	{
+		const OvMaths::FTransform& transform = *p_hierarchy.transforms[p_index];
+		const OvMaths::FMatrix4 expected = p_hierarchy.GetExpectedWorldMatrix(p_index);
+		const OvMaths::FVector3& position = transform.GetWorldPosition();
+
+		return
+			AreNearlyEqual(transform.GetWorldMatrix(), expected) &&
+			AreNearlyEqual(OvMaths::FMatrix4::Translation(position), OvMaths::FMatrix4::Translation({ expected.data[3], expected.data[7], expected.data[11] }));
+	}
+}
+
+OVTEST(Transform, LazyWorldMatchesEagerWorld)
+{
+	Hierarchy hierarchy;
+	std::mt19937 random(42);
+
+	const auto randomFloat = [&random](float p_min, float p_max) { return std::uniform_real_distribution<float>(p_min, p_max)(random); };
+	const auto randomIndex = [&random](size_t p_count) { return std::uniform_int_distribution<size_t>(0, p_count - 1)(random); };
+
+	for (uint32_t mutation = 0; mutation < 5000; ++mutation)
+	{
+		const size_t index = randomIndex(kTransformCount);
+		OvMaths::FTransform& transform = *hierarchy.transforms[index];
+
+		switch (randomIndex(7))
+		{
+		case 0: transform.SetLocalPosition({ randomFloat(-10.0f, 10.0f), randomFloat(-10.0f, 10.0f), randomFloat(-10.0f, 10.0f) }); break;
+		case 1: transform.SetLocalRotation(OvMaths::FQuaternion({ randomFloat(-180.0f, 180.0f), randomFloat(-180.0f, 180.0f), randomFloat(-180.0f, 180.0f) })); break;
+		case 2: transform.SetLocalScale({ randomFloat(0.5f, 2.0f), randomFloat(0.5f, 2.0f), randomFloat(0.5f, 2.0f) }); break;
+		case 3: transform.TranslateLocal({ randomFloat(-1.0f, 1.0f), 0.0f, randomFloat(-1.0f, 1.0f) }); break;
+
+		/* Reparented to a transform with a lower index, so the hierarchy can't have cycles */
+		case 4:
+			if (index > 0)
+			{
+				transform.RemoveParent();
+				hierarchy.parents[index] = static_cast<int>(randomIndex(index));
+				transform.SetParent(*hierarchy.transforms[hierarchy.parents[index]]);
+			}
+			break;
+
+		case 5:
+			transform.RemoveParent();
+			hierarchy.parents[index] = kNoParent;
+			break;
+
+		/* Reading resolves part of the hierarchy only, leaving the rest outdated */
+		case 6:
+			OVTEST_CHECK(HasExpectedWorld(hierarchy, index));
+			break;
+		}
+	}
+
+	for (size_t i = 0; i < kTransformCount; ++i)
+		OVTEST_CHECK(HasExpectedWorld(hierarchy, i));
+}
+
+OVTEST(Transform, ChildrenKeepTheirWorldWhenTheirParentIsDestroyed)
+{
+	Hierarchy hierarchy;
+
+	for (size_t i = 1; i < kTransformCount; ++i)
+	{
+		hierarchy.parents[i] = static_cast<int>(i - 1);
+		hierarchy.transforms[i]->SetParent(*hierarchy.transforms[i - 1]);
+		hierarchy.transforms[i]->SetLocalPosition({ 1.0f, 0.0f, 0.0f });
+		hierarchy.transforms[i]->SetLocalRotation(OvMaths::FQuaternion({ 0.0f, 15.0f, 0.0f }));
+	}
+
+	/* Modified after its children, which are still outdated when it is destroyed */
+	const size_t destroyed = kTransformCount / 2;
+	hierarchy.transforms[destroyed - 1]->SetLocalPosition({ 0.0f, 5.0f, 0.0f });
+
+	const OvMaths::FMatrix4 expected = hierarchy.GetExpectedWorldMatrix(destroyed + 1);
+	hierarchy.transforms[destroyed].reset();
+
+	OVTEST_CHECK(!hierarchy.transforms[destroyed + 1]->HasParent());
+	OVTEST_CHECK(AreNearlyEqual(hierarchy.transforms[destroyed + 1]->GetWorldMatrix(), expected));
+
+	/* The rest of the chain still follows its new root */
+	hierarchy.parents[destroyed + 1] = kNoParent;
+	hierarchy.transforms[destroyed + 1]->SetLocalPosition({ 3.0f, 0.0f, 0.0f });
+
+	for (size_t i = destroyed + 1; i < kTransformCount; ++i)
+		OVTEST_CHECK(HasExpectedWorld(hierarchy, i));
+}
+
+OVBENCHMARK(Transform, DeepAndWideHierarchies)
+{
+	constexpr uint32_t kNodeCount = 500;
+	constexpr uint32_t kMovesPerFrame = 5;
+	constexpr uint32_t kFrames = 100;
+
+	/* Reading the world data of every node, as eager propagation computed it on every change */
+	const auto resolve = [](const std::vector<std::unique_ptr<OvMaths::FTransform>>& p_nodes)
+	{
+		float sum = 0.0f;
+
+		for (const auto& node : p_nodes)
+			sum += node->GetWorldMatrix().data[3] + node->GetWorldRotation().x;
+
+		return sum;
+	};
+
+	const auto measure = [&](const std::string& p_shape, bool p_deep)
+	{
+		std::vector<std::unique_ptr<OvMaths::FTransform>> nodes;
+
+		for (uint32_t i = 0; i < kNodeCount; ++i)
+		{
+			nodes.push_back(std::make_unique<OvMaths::FTransform>(OvMaths::FVector3{ 1.0f, 0.0f, 0.0f }, OvMaths::FQuaternion({ 0.0f, 5.0f, 0.0f })));
+
+			if (i > 0)
+				nodes.back()->SetParent(p_deep ? *nodes[i - 1] : *nodes.front());
+		}
+
+		OvMaths::FTransform& root = *nodes.front();
+		volatile float sink = 0.0f; // Keeps the reads from being optimized out
+
+		/* The root moves several times per frame, and every node is read once per frame (e.g. for rendering) */
+		const double lazy = OvTests::TestRegistry::Measure([&]
+		{
+			for (uint32_t move = 0; move < kMovesPerFrame; ++move)
+				root.TranslateLocal({ 0.01f, 0.0f, 0.0f });
+
+			sink = sink + resolve(nodes);
+		}, kFrames);
+
+		const double eager = OvTests::TestRegistry::Measure([&]
+		{
+			for (uint32_t move = 0; move < kMovesPerFrame; ++move)
+			{
+				root.TranslateLocal({ 0.01f, 0.0f, 0.0f });
+				sink = sink + resolve(nodes);
+			}
+		}, kFrames);
+
+		std::cout << p_shape << " (" << kNodeCount << " nodes, " << kMovesPerFrame << " root moves per frame): lazy " << lazy << " ms, eager " << eager << " ms per frame (" << eager / lazy << "x)" << std::endl;
+	};
+
+	measure("Deep chain", true);
+	measure("Wide hierarchy", false);
+}
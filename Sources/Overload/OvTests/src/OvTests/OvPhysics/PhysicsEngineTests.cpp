@@ -0,0 +1,247 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#include <iostream>
+#include <memory>
+#include <vector>
+
+#include <OvPhysics/Core/PhysicsEngine.h>
+#include <OvPhysics/Entities/PhysicalBox.h>
+#include <OvPhysics/Entities/PhysicalSphere.h>
+
+#include "OvTests/TestRegistry.h"
+
+namespace
+{
+	struct SimulatedPose
+	{
+		OvMaths::FVector3 position;
+		OvMaths::FQuaternion rotation;
+	};
+
+	/**
+	* Drop a spinning sphere on a kinematic ground at the given frame rate, and return the pose of the sphere after each fixed step
+	*/
+	std::vector<SimulatedPose> Simulate(float p_frameRate, uint32_t p_stepCount, bool p_interpolation, bool& p_fixedDeltasMatch)
+	{
+		OvPhysics::Settings::PhysicsSettings settings;
+		settings.maxSubSteps = 8;
+		settings.interpolation = p_interpolation;
+
+		OvPhysics::Core::PhysicsEngine engine(settings);
+
+		OvPhysics::Entities::PhysicalBox ground({ 10.0f, 0.5f, 10.0f });
+		ground.SetKinematic(true);
+
+		OvPhysics::Entities::PhysicalSphere sphere(0.5f);
+		sphere.GetTransform().SetLocalPosition({ 0.0f, 3.0f, 0.0f });
+		sphere.SetLinearVelocity({ 1.0f, 0.0f, 0.5f });
+		sphere.SetAngularVelocity({ 0.0f, 2.0f, 3.0f });
+
+		std::vector<SimulatedPose> poses;
+		p_fixedDeltasMatch = true;
+
+		const auto fixedUpdate = [&](float p_deltaTime)
+		{
+			p_fixedDeltasMatch = p_fixedDeltasMatch && p_deltaTime == settings.fixedTimeStep;
+			poses.push_back({ sphere.GetTransform().GetLocalPosition(), sphere.GetTransform().GetLocalRotation() });
+		};
+
+		/* A frame can run several steps, so the last frame may go past the requested step count */
+		while (poses.size() < p_stepCount)
+			engine.Update(1.0f / p_frameRate, fixedUpdate);
+
+		poses.resize(p_stepCount);
+		return poses;
+	}
+
+	struct ContactRecord
+	{
+		OvPhysics::Entities::PhysicalObject* object;
+		OvPhysics::Entities::PhysicalObject* other;
+		char state;
+	};
+
+	/**
+	* Record the collision events received by the given object, each as 'S' (Start), 'C' (Stay) or 'E' (Stop)
+	*/
+	void RecordContacts(OvPhysics::Entities::PhysicalObject& p_object, std::vector<ContactRecord>& p_records)
+	{
+		auto object = &p_object;
+		p_object.CollisionStartEvent += [object, &p_records](OvPhysics::Entities::PhysicalObject& p_other) { p_records.push_back({ object, &p_other, 'S' }); };
+		p_object.CollisionStayEvent += [object, &p_records](OvPhysics::Entities::PhysicalObject& p_other) { p_records.push_back({ object, &p_other, 'C' }); };
+		p_object.CollisionStopEvent += [object, &p_records](OvPhysics::Entities::PhysicalObject& p_other) { p_records.push_back({ object, &p_other, 'E' }); };
+	}
+
+	uint32_t CountContacts(const std::vector<ContactRecord>& p_records, OvPhysics::Entities::PhysicalObject* p_object, OvPhysics::Entities::PhysicalObject* p_other, char p_state)
+	{
+		uint32_t count = 0;
+
+		for (const ContactRecord& record : p_records)
+			count += record.object == p_object && record.other == p_other && record.state == p_state ? 1 : 0;
+
+		return count;
+	}
+
+	bool HaveSamePoses(const std::vector<SimulatedPose>& p_a, const std::vector<SimulatedPose>& p_b)
+	{
+		if (p_a.size() != p_b.size())
+			return false;
+
+		for (size_t i = 0; i < p_a.size(); ++i)
+		{
+			const SimulatedPose& a = p_a[i];
+			const SimulatedPose& b = p_b[i];
+
+			if (a.position.x != b.position.x || a.position.y != b.position.y || a.position.z != b.position.z ||
+				a.rotation.x != b.rotation.x || a.rotation.y != b.rotation.y || a.rotation.z != b.rotation.z || a.rotation.w != b.rotation.w)
+				return false;
+		}
+
+		return true;
+	}
+}
+
+OVTEST(PhysicsEngine, SimulationDoesntDependOnFrameRate)
+{
+	constexpr uint32_t kStepCount = 180;
+
+	bool fixedDeltasMatch = false;
+	const auto reference = Simulate(60.0f, kStepCount, false, fixedDeltasMatch);
+	OVTEST_CHECK(fixedDeltasMatch);
+
+	/* The sphere fell, and the ground stopped it */
+	OVTEST_CHECK(reference.back().position.y < 3.0f && reference.back().position.y > 0.0f);
+
+	/* Interpolated transforms are only given between steps: every step starts from the last simulated pose, so the poses match exactly */
+	for (const float frameRate : { 30.0f, 60.0f, 144.0f })
+	{
+		const auto poses = Simulate(frameRate, kStepCount, true, fixedDeltasMatch);
+		OVTEST_CHECK(fixedDeltasMatch);
+		OVTEST_CHECK(HaveSamePoses(poses, reference));
+	}
+}
+
+OVTEST(PhysicsEngine, MovedObjectsKeepTheirPose)
+{
+	OvPhysics::Settings::PhysicsSettings settings;
+	OvPhysics::Core::PhysicsEngine engine(settings);
+
+	OvPhysics::Entities::PhysicalSphere sphere(0.5f);
+
+	/* Half a step left over: the transform holds a pose interpolated between the last two steps */
+	engine.Update(settings.fixedTimeStep * 2.5f);
+
+	/* The next step starts from the pose given to the moved object, not from the last simulated one */
+	sphere.GetTransform().SetLocalPosition({ 0.0f, 10.0f, 0.0f });
+	engine.Update(settings.fixedTimeStep);
+
+	const float height = sphere.GetTransform().GetLocalPosition().y;
+	OVTEST_CHECK(height < 10.0f && height > 9.9f);
+}
+
+OVTEST(PhysicsEngine, ContactsWithDestroyedObjectsAreDropped)
+{
+	using OvPhysics::Entities::PhysicalObject;
+
+	OvPhysics::Settings::PhysicsSettings settings;
+	settings.interpolation = false;
+
+	OvPhysics::Core::PhysicsEngine engine(settings);
+
+	/* Two spheres sinking into the ground (Not touching each other) */
+	OvPhysics::Entities::PhysicalBox ground({ 10.0f, 0.5f, 10.0f });
+	ground.SetKinematic(true);
+
+	auto first = std::make_unique<OvPhysics::Entities::PhysicalSphere>(0.5f);
+	auto second = std::make_unique<OvPhysics::Entities::PhysicalSphere>(0.5f);
+	first->GetTransform().SetLocalPosition({ -2.0f, 0.9f, 0.0f });
+	second->GetTransform().SetLocalPosition({ 2.0f, 0.9f, 0.0f });
+
+	std::vector<ContactRecord> records;
+	RecordContacts(ground, records);
+	RecordContacts(*first, records);
+	RecordContacts(*second, records);
+
+	PhysicalObject* const groundAddress = &ground;
+	PhysicalObject* const firstAddress = first.get();
+	PhysicalObject* const secondAddress = second.get();
+
+	/* The second sphere is destroyed by a listener, while the events of the step are being dispatched */
+	size_t destructionRecord = 0;
+	first->CollisionStartEvent += [&](PhysicalObject& p_other)
+	{
+		if (second)
+		{
+			second.reset();
+			destructionRecord = records.size();
+		}
+	};
+
+	engine.Update(settings.fixedTimeStep);
+	OVTEST_CHECK(!second);
+
+	/* Pairs with the destroyed sphere receive nothing once it is destroyed, whatever the dispatch order is */
+	for (size_t i = destructionRecord; i < records.size(); ++i)
+		OVTEST_CHECK(records[i].object != secondAddress && records[i].other != secondAddress);
+
+	/* The other pair receives each of its events exactly once */
+	OVTEST_CHECK(CountContacts(records, firstAddress, groundAddress, 'S') == 1 && CountContacts(records, groundAddress, firstAddress, 'S') == 1);
+	OVTEST_CHECK(CountContacts(records, firstAddress, groundAddress, 'C') == 1 && CountContacts(records, groundAddress, firstAddress, 'C') == 1);
+	OVTEST_CHECK(CountContacts(records, firstAddress, groundAddress, 'E') == 0 && CountContacts(records, groundAddress, firstAddress, 'E') == 0);
+
+	/* Next steps: the remaining pair stays, without being started again */
+	records.clear();
+	engine.Update(settings.fixedTimeStep);
+	OVTEST_CHECK(records.size() == 2);
+	OVTEST_CHECK(CountContacts(records, firstAddress, groundAddress, 'C') == 1 && CountContacts(records, groundAddress, firstAddress, 'C') == 1);
+
+	/* Then stops, once */
+	records.clear();
+	first->GetTransform().SetLocalPosition({ -2.0f, 50.0f, 0.0f });
+	engine.Update(settings.fixedTimeStep);
+	OVTEST_CHECK(records.size() == 2);
+	OVTEST_CHECK(CountContacts(records, firstAddress, groundAddress, 'E') == 1 && CountContacts(records, groundAddress, firstAddress, 'E') == 1);
+
+	records.clear();
+	engine.Update(settings.fixedTimeStep);
+	OVTEST_CHECK(records.empty());
+}
+
+OVBENCHMARK(PhysicsEngine, Contacts)
+{
+	constexpr uint32_t kSide = 100;
+	constexpr uint32_t kStepCount = 60;
+
+	OvPhysics::Settings::PhysicsSettings settings;
+	OvPhysics::Core::PhysicsEngine engine(settings);
+
+	OvPhysics::Entities::PhysicalBox ground({ kSide * 1.1f, 0.5f, kSide * 1.1f });
+	ground.SetKinematic(true);
+
+	/* Every sphere rests on the ground, so each step has as many contact pairs as spheres */
+	std::vector<std::unique_ptr<OvPhysics::Entities::PhysicalSphere>> spheres;
+	spheres.reserve(kSide * kSide);
+
+	uint64_t stayEvents = 0;
+
+	for (uint32_t x = 0; x < kSide; ++x)
+	{
+		for (uint32_t z = 0; z < kSide; ++z)
+		{
+			auto& sphere = spheres.emplace_back(std::make_unique<OvPhysics::Entities::PhysicalSphere>(0.5f));
+			sphere->GetTransform().SetLocalPosition({ (x - kSide / 2.0f) * 1.1f, 0.95f, (z - kSide / 2.0f) * 1.1f });
+			sphere->CollisionStayEvent += [&stayEvents](OvPhysics::Entities::PhysicalObject&) { ++stayEvents; };
+		}
+	}
+
+	const double elapsed = OvTests::TestRegistry::Measure([&engine, &settings]
+	{
+		engine.Update(settings.fixedTimeStep);
+	}, kStepCount);
+
+	std::cout << spheres.size() << " bodies: " << elapsed << " ms per step (Simulation and contact events), " << stayEvents / kStepCount << " stay events per step" << std::endl;
+}
@@ -0,0 +1,406 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <thread>
+
+#include <OvRendering/Resources/Loaders/ModelLoader.h>
+#include <OvRendering/Resources/Mesh.h>
+#include <OvRendering/Resources/Parsers/CookedModelParser.h>
+
+#include "OvTests/TestRegistry.h"
+
+namespace
+{
+	using namespace OvRendering::Resources;
+
+	constexpr auto kFlags = Parsers::EModelParserFlags::TRIANGULATE;
+
+	/**
+	* Source data of a cooked model: a 16 bits indexed mesh, a 32 bits indexed mesh, a hierarchy and an animation
+	*/
+	struct SourceModel
+	{
+		std::string path;
+		std::vector<Mesh*> meshes;
+		std::vector<std::string> materials = { "MaterialA", "MaterialB" };
+		ModelHierarchy hierarchy;
+
+		SourceModel(const std::string& p_name)
+		{
+			path = OvTests::TestRegistry::GetTemporaryPath(p_name);
+			std::ofstream(path) << p_name;
+
+			for (uint32_t i = 0; i < 2; ++i)
+			{
+				const uint32_t vertexCount = i == 0 ? 300 : 70000;
+				std::vector<OvRendering::Geometry::Vertex> vertices(vertexCount);
+				std::vector<uint32_t> indices;
+
+				for (uint32_t j = 0; j < vertexCount; ++j)
+				{
+					vertices[j].position[0] = static_cast<float>(j);
+					vertices[j].position[1] = static_cast<float>(i);
+					vertices[j].texCoords[0] = 0.5f * j;
+				}
+
+				for (uint32_t j = 0; j + 2 < vertexCount; j += 3)
+					indices.insert(indices.end(), { j, j + 1, j + 2 });
+
+				auto mesh = new Mesh();
+				mesh->InitDeferred(vertices, indices, i);
+				meshes.push_back(mesh);
+			}
+
+			hierarchy.nodes.resize(2);
+			hierarchy.nodes[0].m_name = "Root";
+			hierarchy.nodes[0].parent = -1;
+			hierarchy.nodes[0].m_localTransform = OvMaths::FMatrix4::Identity;
+			hierarchy.nodes[1].m_name = "Child";
+			hierarchy.nodes[1].parent = 0;
+			hierarchy.nodes[1].m_localTransform = OvMaths::FMatrix4::Translation({ 1.0f, 2.0f, 3.0f });
+			hierarchy.nodes[1].m_meshNames = { "Mesh" };
+
+			auto& animation = hierarchy.animations.emplace_back();
+			animation.m_animName = "Walk";
+			animation.m_duration = 10.0;
+			animation.m_ticksPerSecond = 25.0;
+
+			auto& channel = animation.m_modelNodeAnimations.emplace_back();
+			channel.m_hierarchyNodeName = "Child";
+			channel.positions.emplace_back(0.0, OvMaths::FVector3{ 1.0f, 2.0f, 3.0f });
+			channel.rotations.emplace_back(1.0, OvMaths::FQuaternion::Identity);
+			channel.scales.emplace_back(2.0, OvMaths::FVector3::One);
+
+			OVTEST_CHECK(hierarchy.BuildLookups());
+		}
+
+		~SourceModel()
+		{
+			for (auto mesh : meshes)
+				delete mesh;
+
+			std::filesystem::remove(Parsers::CookedModelParser::GetCookedPath(path));
+			std::filesystem::remove(path);
+		}
+
+		bool Cook() const
+		{
+			return Parsers::CookedModelParser::Cook(path, meshes, materials, kFlags, hierarchy);
+		}
+	};
+
+	/**
+	* Outputs of a cooked model loading
+	*/
+	struct LoadedModel
+	{
+		std::vector<Mesh*> meshes;
+		std::vector<std::string> materials;
+		ModelHierarchy hierarchy;
+
+		~LoadedModel()
+		{
+			for (auto mesh : meshes)
+				delete mesh;
+		}
+
+		bool Load(const std::string& p_path, Parsers::EModelParserFlags p_flags = kFlags)
+		{
+			Parsers::CookedModelParser parser;
+			return parser.LoadModel(p_path, meshes, materials, p_flags, hierarchy);
+		}
+
+		bool IsEmpty() const
+		{
+			return meshes.empty() && materials.empty() && hierarchy.nodes.empty() && hierarchy.animations.empty();
+		}
+	};
+
+	std::vector<char> ReadFile(const std::string& p_path)
+	{
+		std::ifstream file(p_path, std::ios::binary);
+		return std::vector<char>(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+	}
+
+	void Patch(const std::string& p_path, size_t p_offset, uint32_t p_value)
+	{
+		std::fstream file(p_path, std::ios::binary | std::ios::in | std::ios::out);
+		file.seekp(p_offset);
+		file.write(reinterpret_cast<const char*>(&p_value), sizeof(p_value));
+	}
+
+	std::vector<std::string> GetTemporaryFiles(const std::string& p_cookedPath)
+	{
+		const std::filesystem::path cookedPath(p_cookedPath);
+		std::vector<std::string> result;
+
+		for (const auto& entry : std::filesystem::directory_iterator(cookedPath.parent_path()))
+		{
+			const std::string fileName = entry.path().filename().string();
+
+			if (fileName.rfind(cookedPath.filename().string(), 0) == 0 && entry.path().extension() == ".tmp")
+				result.push_back(fileName);
+		}
+
+		return result;
+	}
+
+	/**
+	* Writes a grid of the given size as an OBJ file, returning its vertices and indices
+	*/
+	void WriteGrid(const std::string& p_path, uint32_t p_size, std::vector<OvRendering::Geometry::Vertex>& p_vertices, std::vector<uint32_t>& p_indices)
+	{
+		std::ofstream file(p_path);
+
+		for (uint32_t y = 0; y <= p_size; ++y)
+		{
+			for (uint32_t x = 0; x <= p_size; ++x)
+			{
+				auto& vertex = p_vertices.emplace_back();
+				vertex.position[0] = static_cast<float>(x);
+				vertex.position[2] = static_cast<float>(y);
+				vertex.texCoords[0] = static_cast<float>(x) / p_size;
+				vertex.texCoords[1] = static_cast<float>(y) / p_size;
+				vertex.normals[1] = 1.0f;
+
+				file << "v " << x << " 0 " << y << "\nvt " << vertex.texCoords[0] << " " << vertex.texCoords[1] << "\nvn 0 1 0\n";
+			}
+		}
+
+		for (uint32_t y = 0; y < p_size; ++y)
+		{
+			for (uint32_t x = 0; x < p_size; ++x)
+			{
+				/* OBJ indices start at 1 */
+				const uint32_t corner = y * (p_size + 1) + x;
+				const uint32_t quad[4] = { corner, corner + 1, corner + p_size + 2, corner + p_size + 1 };
+
+				file << "f";
+				for (const uint32_t index : quad)
+					file << " " << index + 1 << "/" << index + 1 << "/" << index + 1;
+				file << "\n";
+
+				p_indices.insert(p_indices.end(), { quad[0], quad[1], quad[2], quad[0], quad[2], quad[3] });
+			}
+		}
+	}
+}
+
+OVTEST(CookedModelParser, LoadMatchesCookedData)
+{
+	SourceModel source("RoundTrip.fbx");
+	LoadedModel loaded;
+
+	OVTEST_CHECK(!loaded.Load(source.path));
+	OVTEST_CHECK(source.Cook());
+	OVTEST_CHECK(!loaded.Load(source.path, Parsers::EModelParserFlags::NONE));
+	OVTEST_CHECK(loaded.Load(source.path));
+
+	OVTEST_CHECK(loaded.materials == source.materials);
+	OVTEST_CHECK(loaded.hierarchy.nodes.size() == 2 && loaded.hierarchy.GetNodeIndex("Child") == 1);
+	OVTEST_CHECK(loaded.hierarchy.nodes[0].m_childrenIndices.count(1) == 1);
+	OVTEST_CHECK(loaded.hierarchy.m_localTransforms[1] == source.hierarchy.m_localTransforms[1]);
+	OVTEST_CHECK(loaded.hierarchy.animations.size() == 1 && loaded.hierarchy.animations[0].m_nodeChannels[1] == 0);
+	OVTEST_CHECK(loaded.meshes.size() == 2);
+
+	for (size_t i = 0; i < loaded.meshes.size(); ++i)
+	{
+		Mesh& expected = *source.meshes[i];
+		Mesh& actual = *loaded.meshes[i];
+
+		OVTEST_CHECK(actual.GetVertexCount() == expected.GetVertexCount() && actual.GetIndexCount() == expected.GetIndexCount());
+		OVTEST_CHECK(actual.GetMaterialIndex() == expected.GetMaterialIndex());
+		OVTEST_CHECK(actual.GetBoundingSphere().radius == expected.GetBoundingSphere().radius);
+		OVTEST_CHECK(std::memcmp(actual.GetStagingVertexData(), expected.GetStagingVertexData(), expected.GetVertexCount() * Mesh::GetVertexSize(false)) == 0);
+
+		/* Indices are narrowed to 16 bits when every vertex can be addressed with them */
+		const bool shortIndices = actual.GetIndexType() == OvRendering::Buffers::EType::UNSIGNED_SHORT;
+		OVTEST_CHECK(shortIndices == (i == 0));
+
+		for (uint32_t j = 0; j < expected.GetIndexCount(); ++j)
+		{
+			const uint32_t expectedIndex = static_cast<const uint32_t*>(expected.GetStagingIndexData())[j];
+			const uint32_t actualIndex = shortIndices ? static_cast<const uint16_t*>(actual.GetStagingIndexData())[j] : static_cast<const uint32_t*>(actual.GetStagingIndexData())[j];
+			OVTEST_CHECK(expectedIndex == actualIndex);
+		}
+	}
+
+	/* A modified source outdates the cooked model */
+	std::ofstream(source.path) << "Modified source";
+	LoadedModel outdated;
+	OVTEST_CHECK(!outdated.Load(source.path) && outdated.IsEmpty());
+}
+
+OVTEST(CookedModelParser, InvalidFilesAreRejected)
+{
+	SourceModel source("Invalid.fbx");
+	const std::string cookedPath = Parsers::CookedModelParser::GetCookedPath(source.path);
+
+	/* Truncated files, at every point of the headers and some points of the streams */
+	OVTEST_CHECK(source.Cook());
+	const std::vector<char> cookedData = ReadFile(cookedPath);
+
+	for (size_t truncatedSize = cookedData.size() - 1; truncatedSize > 0; truncatedSize -= (truncatedSize > 2048 ? 997 : 1))
+	{
+		std::ofstream(cookedPath, std::ios::binary | std::ios::trunc).write(cookedData.data(), truncatedSize);
+
+		LoadedModel loaded;
+		OVTEST_CHECK(!loaded.Load(source.path) && loaded.IsEmpty());
+	}
+
+	/* Counts that can't fit in the file are rejected before allocating (The material count follows the 28 bytes header) */
+	for (uint32_t count : { 0xFFFFFFFFu, 0x10000000u, 100000u })
+	{
+		OVTEST_CHECK(source.Cook());
+		Patch(cookedPath, 28, count);
+
+		LoadedModel loaded;
+		OVTEST_CHECK(!loaded.Load(source.path) && loaded.IsEmpty());
+	}
+
+	/* Parents must be previous nodes, otherwise building the hierarchy would write out of bounds */
+	for (int parent : { 1, 2, 1000, -2 })
+	{
+		source.hierarchy.nodes[1].parent = 0;
+		source.hierarchy.nodes[0].parent = parent;
+		OVTEST_CHECK(source.Cook());
+
+		LoadedModel loaded;
+		OVTEST_CHECK(!loaded.Load(source.path) && loaded.IsEmpty());
+	}
+
+	source.hierarchy.nodes[0].parent = -1;
+
+	/* Material indices must refer to a material of the model */
+	source.materials.pop_back();
+	OVTEST_CHECK(source.Cook());
+
+	LoadedModel loaded;
+	OVTEST_CHECK(!loaded.Load(source.path) && loaded.IsEmpty());
+}
+
+OVTEST(CookedModelParser, BuildLookupsRejectsInvalidParents)
+{
+	ModelHierarchy hierarchy;
+	hierarchy.nodes.resize(3);
+	hierarchy.nodes[0].parent = -1;
+	hierarchy.nodes[1].parent = 0;
+	hierarchy.nodes[2].parent = 1;
+	OVTEST_CHECK(hierarchy.BuildLookups());
+
+	hierarchy.nodes[1].parent = 5;
+	OVTEST_CHECK(!hierarchy.BuildLookups());
+
+	hierarchy.nodes[1].parent = 1;
+	OVTEST_CHECK(!hierarchy.BuildLookups());
+}
+
+OVTEST(CookedModelParser, ConcurrentCooksUseDistinctTemporaryFiles)
+{
+	SourceModel source("Concurrent.fbx");
+	const std::string cookedPath = Parsers::CookedModelParser::GetCookedPath(source.path);
+
+	/* Every cook writes its own temporary file, so concurrent cooks can't interleave their writes */
+	for (uint32_t iteration = 0; iteration < 10; ++iteration)
+	{
+		bool results[4] = {};
+		std::vector<std::thread> threads;
+
+		for (auto& result : results)
+			threads.emplace_back([&source, &result] { result = source.Cook(); });
+
+		for (auto& thread : threads)
+			thread.join();
+
+		/* A rename can fail on some platforms if another cook replaces the file at the same time, but the cooked model stays complete */
+		OVTEST_CHECK(results[0] || results[1] || results[2] || results[3]);
+		OVTEST_CHECK(GetTemporaryFiles(cookedPath).empty());
+
+		LoadedModel loaded;
+		OVTEST_CHECK(loaded.Load(source.path) && loaded.meshes.size() == 2);
+	}
+}
+
+OVBENCHMARK(CookedModelParser, ColdAndWarmLoads)
+{
+	constexpr uint32_t kGridSize = 200;
+	constexpr uint32_t kColdLoads = 5;
+	constexpr uint32_t kWarmLoads = 20;
+
+	const std::string path = OvTests::TestRegistry::GetTemporaryPath("Grid.obj");
+	const std::string cookedPath = Parsers::CookedModelParser::GetCookedPath(path);
+
+	std::vector<OvRendering::Geometry::Vertex> vertices;
+	std::vector<uint32_t> indices;
+	WriteGrid(path, kGridSize, vertices, indices);
+
+	/* Cold loads import the source with Assimp and cook it, as the first load of a model does */
+	double cold = 0.0;
+	bool imported = true;
+
+	for (uint32_t i = 0; i < kColdLoads && imported; ++i)
+	{
+		std::filesystem::remove(cookedPath);
+
+		Model* model = nullptr;
+		cold += OvTests::TestRegistry::Measure([&] { model = Loaders::ModelLoader::Parse(path, kFlags); });
+
+		imported = model != nullptr;
+		Loaders::ModelLoader::Destroy(model);
+	}
+
+	if (imported)
+	{
+		std::cout << "Cold (Assimp import and cook): " << cold / kColdLoads << " ms" << std::endl;
+	}
+	else
+	{
+		/* The importer isn't available on every platform, the same mesh is cooked directly so warm loads can still be measured */
+		std::cout << "Cold: Assimp couldn't import the model" << std::endl;
+
+		Mesh mesh;
+		mesh.InitDeferred(vertices, indices, 0);
+		OVTEST_CHECK(Parsers::CookedModelParser::Cook(path, { &mesh }, { "Material" }, kFlags, ModelHierarchy()));
+	}
+
+	/* Warm loads read the cooked model. Its vertices stay in the mapped file until the upload reads them, so they are read here too */
+	uint32_t vertexCount = 0;
+	volatile uint32_t checksum = 0;
+
+	const double warm = OvTests::TestRegistry::Measure([&]
+	{
+		Model* model = Loaders::ModelLoader::Parse(path, kFlags);
+		vertexCount = model && model->GetMeshes().size() == 1 ? model->GetMeshes()[0]->GetVertexCount() : 0;
+
+		if (vertexCount > 0)
+		{
+			Mesh& mesh = *model->GetMeshes()[0];
+			const auto data = static_cast<const uint8_t*>(mesh.GetStagingVertexData());
+			uint32_t sum = 0;
+
+			for (size_t i = 0; i < mesh.GetVertexCount() * Mesh::GetVertexSize(false); i += 64)
+				sum += data[i];
+
+			checksum = sum;
+		}
+
+		Loaders::ModelLoader::Destroy(model);
+	}, kWarmLoads);
+
+	OVTEST_CHECK(vertexCount > 0);
+	std::cout << "Warm (cooked): " << warm << " ms (" << vertexCount << " vertices, " << indices.size() / 3 << " triangles)" << std::endl;
+
+	if (imported)
+		std::cout << "Warm loads are " << (cold / kColdLoads) / warm << "x faster" << std::endl;
+
+	std::filesystem::remove(cookedPath);
+	std::filesystem::remove(path);
+}
@@ -0,0 +1,127 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#include <iostream>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include <OvMaths/FMatrix4.h>
+
+#include <OvRendering/Data/Frustum.h>
+
+#include "OvTests/TestRegistry.h"
+
+namespace
+{
+	/**
+	* Random spheres (Structure of arrays) around the origin, including some degenerated ones (NaN centers and infinite radii)
+	*/
+	struct Spheres
+	{
+		std::vector<float> x;
+		std::vector<float> y;
+		std::vector<float> z;
+		std::vector<float> radii;
+
+		Spheres(size_t p_count, uint32_t p_seed, bool p_degenerated) :
+			x(p_count), y(p_count), z(p_count), radii(p_count)
+		{
+			std::mt19937 generator(p_seed);
+			std::uniform_real_distribution<float> position(-120.0f, 120.0f);
+			std::uniform_real_distribution<float> radius(0.0f, 10.0f);
+
+			for (size_t i = 0; i < p_count; ++i)
+			{
+				x[i] = position(generator);
+				y[i] = position(generator);
+				z[i] = position(generator);
+				radii[i] = radius(generator);
+
+				if (p_degenerated && i % 97 == 5)
+					x[i] = std::numeric_limits<float>::quiet_NaN();
+
+				if (p_degenerated && i % 89 == 3)
+					radii[i] = std::numeric_limits<float>::infinity();
+			}
+		}
+	};
+
+	OvRendering::Data::Frustum CreateFrustum()
+	{
+		OvRendering::Data::Frustum frustum;
+		frustum.CalculateFrustum
+		(
+			OvMaths::FMatrix4::CreatePerspective(60.0f, 1.6f, 0.1f, 100.0f) *
+			OvMaths::FMatrix4::CreateView(0.0f, 0.0f, 0.0f, 0.3f, 0.1f, -1.0f, 0.0f, 1.0f, 0.0f)
+		);
+		return frustum;
+	}
+}
+
+OVTEST(Frustum, SpheresInFrustumMatchesSphereInFrustum)
+{
+	const auto frustum = CreateFrustum();
+	constexpr uint32_t kSentinel = 0xDEADBEEF;
+
+	/* Counts around the SIMD widths and the 32 bits visibility words, with unaligned inputs (Offset of 1) */
+	for (size_t count : { 0, 1, 3, 4, 7, 8, 9, 31, 32, 33, 100, 1001, 100000 })
+	{
+		for (size_t offset : { 0, 1 })
+		{
+			const Spheres spheres(count + offset, static_cast<uint32_t>(count), true);
+			const size_t words = (count + 31) / 32;
+
+			std::vector<uint32_t> visibility(words + 1, kSentinel);
+			frustum.SpheresInFrustum(spheres.x.data() + offset, spheres.y.data() + offset, spheres.z.data() + offset, spheres.radii.data() + offset, count, visibility.data());
+
+			uint32_t visibleCount = 0;
+
+			for (size_t i = 0; i < count; ++i)
+			{
+				const bool batched = (visibility[i / 32] >> (i % 32)) & 1u;
+				const bool single = frustum.SphereInFrustum(spheres.x[offset + i], spheres.y[offset + i], spheres.z[offset + i], spheres.radii[offset + i]);
+				OVTEST_CHECK(batched == single);
+				visibleCount += batched;
+			}
+
+			/* Bits past the last sphere are cleared, and nothing is written past the last word */
+			if (count % 32 != 0)
+				OVTEST_CHECK((visibility[words - 1] >> (count % 32)) == 0);
+
+			OVTEST_CHECK(visibility[words] == kSentinel);
+
+			if (count >= 1000)
+				OVTEST_CHECK(visibleCount > 0 && visibleCount < count);
+		}
+	}
+}
+
+OVBENCHMARK(Frustum, SpheresInFrustum)
+{
+	const auto frustum = CreateFrustum();
+	const size_t count = 100000;
+	const Spheres spheres(count, 1, false);
+	std::vector<uint32_t> visibility((count + 31) / 32);
+
+	const double scalar = OvTests::TestRegistry::Measure([&]
+	{
+		for (size_t i = 0; i < count; ++i)
+		{
+			if (frustum.SphereInFrustum(spheres.x[i], spheres.y[i], spheres.z[i], spheres.radii[i]))
+				visibility[i / 32] |= 1u << (i % 32);
+			else
+				visibility[i / 32] &= ~(1u << (i % 32));
+		}
+	}, 100);
+
+	const double batched = OvTests::TestRegistry::Measure([&]
+	{
+		frustum.SpheresInFrustum(spheres.x.data(), spheres.y.data(), spheres.z.data(), spheres.radii.data(), count, visibility.data());
+	}, 100);
+
+	std::cout << count << " spheres: SphereInFrustum loop " << scalar << " ms, SpheresInFrustum " << batched << " ms" << std::endl;
+}
@@ -0,0 +1,213 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#include <initializer_list>
+#include <string>
+#include <vector>
+
+#include <OvRendering/Core/GLStateCache.h>
+#include <OvRendering/Core/Renderer.h>
+
+#include "OvTests/TestRegistry.h"
+
+namespace
+{
+	using OvRendering::Buffers::EBufferTarget;
+	using OvRendering::Core::GLStateCache;
+	using OvRendering::Settings::ECullFace;
+	using OvRendering::Settings::ERenderingCapability;
+
+	/**
+	* Records the calls reaching it instead of sending them to OpenGL
+	*/
+	class RecordingGLCalls : public OvRendering::Context::IGLCalls
+	{
+	public:
+		void UseProgram(uint32_t p_program) override { Record("UseProgram", { p_program }); }
+		void BindVertexArray(uint32_t p_vertexArray) override { Record("BindVertexArray", { p_vertexArray }); }
+		void ActiveTexture(uint32_t p_unit) override { Record("ActiveTexture", { p_unit }); }
+		void BindTexture2D(uint32_t p_texture) override { Record("BindTexture2D", { p_texture }); }
+		void BindBufferBase(EBufferTarget p_target, uint32_t p_index, uint32_t p_buffer) override { Record("BindBufferBase", { static_cast<uint32_t>(p_target), p_index, p_buffer }); }
+		void SetCapability(ERenderingCapability p_capability, bool p_value) override { Record("SetCapability", { static_cast<uint32_t>(p_capability), p_value }); }
+		void DepthMask(bool p_enable) override { Record("DepthMask", { p_enable }); }
+		void ColorMask(bool p_red, bool p_green, bool p_blue, bool p_alpha) override { Record("ColorMask", { p_red, p_green, p_blue, p_alpha }); }
+		void CullFace(ECullFace p_cullFace) override { Record("CullFace", { static_cast<uint32_t>(p_cullFace) }); }
+
+		/* Returns the calls recorded since the last time they were taken */
+		std::vector<std::string> Take()
+		{
+			std::vector<std::string> calls;
+			calls.swap(m_calls);
+			return calls;
+		}
+
+	private:
+		void Record(const std::string& p_name, std::initializer_list<uint32_t> p_arguments)
+		{
+			std::string call = p_name;
+
+			for (const uint32_t argument : p_arguments)
+				call += " " + std::to_string(argument);
+
+			m_calls.push_back(std::move(call));
+		}
+
+	private:
+		std::vector<std::string> m_calls;
+	};
+
+	/* Sets one value of every tracked state, all of them being issued to a fresh (or invalidated) cache */
+	void SetEveryState(GLStateCache& p_cache)
+	{
+		p_cache.UseProgram(3);
+		p_cache.BindVertexArray(4);
+		p_cache.BindTexture(0, 5);
+		p_cache.BindTexture(1, 6);
+		p_cache.BindBufferBase(EBufferTarget::UNIFORM_BUFFER, 0, 7);
+		p_cache.BindBufferBase(EBufferTarget::SHADER_STORAGE_BUFFER, 0, 8);
+		p_cache.SetCapability(ERenderingCapability::DEPTH_TEST, true);
+		p_cache.SetCapability(ERenderingCapability::BLEND, false);
+		p_cache.SetDepthWriting(false);
+		p_cache.SetColorWriting(true, false, true, false);
+		p_cache.SetCullFace(ECullFace::FRONT);
+	}
+
+	const std::vector<std::string> kEveryStateCalls =
+	{
+		"UseProgram 3",
+		"BindVertexArray 4",
+		"ActiveTexture 0", "BindTexture2D 5",
+		"ActiveTexture 1", "BindTexture2D 6",
+		"BindBufferBase " + std::to_string(static_cast<uint32_t>(EBufferTarget::UNIFORM_BUFFER)) + " 0 7",
+		"BindBufferBase " + std::to_string(static_cast<uint32_t>(EBufferTarget::SHADER_STORAGE_BUFFER)) + " 0 8",
+		"SetCapability " + std::to_string(static_cast<uint32_t>(ERenderingCapability::DEPTH_TEST)) + " 1",
+		"SetCapability " + std::to_string(static_cast<uint32_t>(ERenderingCapability::BLEND)) + " 0",
+		"DepthMask 0",
+		"ColorMask 1 0 1 0",
+		"CullFace " + std::to_string(static_cast<uint32_t>(ECullFace::FRONT))
+	};
+}
+
+OVTEST(GLStateCache, RedundantCallsAreSkipped)
+{
+	RecordingGLCalls calls;
+	GLStateCache cache(calls);
+
+	/* Counted per call reaching the driver, a texture binding on another unit also counting its unit activation */
+	const uint64_t issued = kEveryStateCalls.size();
+
+	SetEveryState(cache);
+	OVTEST_CHECK(calls.Take() == kEveryStateCalls);
+	OVTEST_CHECK(cache.GetCounters().issuedCalls == issued && cache.GetCounters().skippedCalls == 0);
+
+	/* Setting the values already in place never reaches the driver, each skipped request being counted once */
+	SetEveryState(cache);
+	OVTEST_CHECK(calls.Take().empty());
+	OVTEST_CHECK(cache.GetCounters().issuedCalls == issued && cache.GetCounters().skippedCalls == 11);
+
+	/* A different value is issued, the texture unit being activated only when it changes */
+	cache.BindTexture(1, 9);
+	cache.BindTexture(0, 10);
+	cache.BindTexture(0, 11);
+	cache.BindBufferBase(EBufferTarget::UNIFORM_BUFFER, 0, 8);
+	cache.SetCapability(ERenderingCapability::DEPTH_TEST, false);
+	cache.SetColorWriting(true, true, true, true);
+
+	const std::vector<std::string> expected =
+	{
+		"BindTexture2D 9",
+		"ActiveTexture 0", "BindTexture2D 10",
+		"BindTexture2D 11",
+		"BindBufferBase " + std::to_string(static_cast<uint32_t>(EBufferTarget::UNIFORM_BUFFER)) + " 0 8",
+		"SetCapability " + std::to_string(static_cast<uint32_t>(ERenderingCapability::DEPTH_TEST)) + " 0",
+		"ColorMask 1 1 1 1"
+	};
+
+	/* The two unit activations avoided are skipped calls too */
+	OVTEST_CHECK(calls.Take() == expected);
+	OVTEST_CHECK(cache.GetCounters().issuedCalls == issued + expected.size() && cache.GetCounters().skippedCalls == 11 + 2);
+
+	cache.ResetCounters();
+	OVTEST_CHECK(cache.GetCounters().issuedCalls == 0 && cache.GetCounters().skippedCalls == 0);
+}
+
+OVTEST(GLStateCache, InvalidatedCallsAreIssuedAgain)
+{
+	RecordingGLCalls calls;
+	GLStateCache cache(calls);
+
+	SetEveryState(cache);
+	calls.Take();
+
+	/* The state may have been changed behind the cache, so every call is issued again */
+	cache.Invalidate();
+	SetEveryState(cache);
+	OVTEST_CHECK(calls.Take() == kEveryStateCalls);
+	OVTEST_CHECK(cache.GetCounters().issuedCalls == 2 * kEveryStateCalls.size() && cache.GetCounters().skippedCalls == 0);
+
+	/* And tracked again afterwards */
+	SetEveryState(cache);
+	OVTEST_CHECK(calls.Take().empty());
+}
+
+OVTEST(GLStateCache, UntrackedBindingsAlwaysReachTheDriver)
+{
+	RecordingGLCalls calls;
+	GLStateCache cache(calls);
+
+	const uint32_t untrackedUnit = GLStateCache::kTextureUnitCount;
+	const uint32_t untrackedIndex = GLStateCache::kBufferBindingCount;
+	const std::string uniformBuffer = std::to_string(static_cast<uint32_t>(EBufferTarget::UNIFORM_BUFFER));
+
+	cache.BindTexture(0, 1);
+	calls.Take();
+
+	for (uint32_t i = 0; i < 2; ++i)
+	{
+		cache.BindTexture(untrackedUnit, 2);
+		cache.BindBufferBase(EBufferTarget::UNIFORM_BUFFER, untrackedIndex, 3);
+
+		const std::vector<std::string> expected =
+		{
+			"ActiveTexture " + std::to_string(untrackedUnit), "BindTexture2D 2",
+			"BindBufferBase " + uniformBuffer + " " + std::to_string(untrackedIndex) + " 3"
+		};
+
+		OVTEST_CHECK(calls.Take() == expected);
+	}
+
+	OVTEST_CHECK(cache.GetCounters().issuedCalls == 2 + 2 * 3 && cache.GetCounters().skippedCalls == 0);
+
+	/* The untracked unit left another unit active, so a tracked binding activates its unit again */
+	cache.BindTexture(0, 4);
+	OVTEST_CHECK((calls.Take() == std::vector<std::string>{ "ActiveTexture 0", "BindTexture2D 4" }));
+}
+
+OVTEST(GLStateCache, RendererReportsTheCalls)
+{
+	RecordingGLCalls calls;
+	OvRendering::Core::Renderer renderer(calls);
+
+	renderer.ClearFrameInfo();
+
+	for (uint32_t i = 0; i < 3; ++i)
+	{
+		renderer.SetCapability(ERenderingCapability::CULL_FACE, true);
+		renderer.SetCullFace(ECullFace::BACK);
+		renderer.GetStateCache().UseProgram(1);
+	}
+
+	OVTEST_CHECK(calls.Take().size() == 3);
+	OVTEST_CHECK(renderer.GetFrameInfo().issuedGLCalls == 3 && renderer.GetFrameInfo().skippedGLCalls == 6);
+
+	renderer.ClearFrameInfo();
+	OVTEST_CHECK(renderer.GetFrameInfo().issuedGLCalls == 0 && renderer.GetFrameInfo().skippedGLCalls == 0);
+
+	/* Counters are gathered from the cache, so calls made after a request are reported by the next one */
+	renderer.SetDepthWriting(false);
+	renderer.SetDepthWriting(false);
+	OVTEST_CHECK(renderer.GetFrameInfo().issuedGLCalls == 1 && renderer.GetFrameInfo().skippedGLCalls == 1);
+}
@@ -0,0 +1,264 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include <OvRendering/Resources/ModelHierarchy.h>
+
+#include "OvTests/TestRegistry.h"
+
+namespace
+{
+	using namespace OvRendering::Resources;
+
+	constexpr double kTicksPerSecond = 30.0;
+
+	OvMaths::FQuaternion GetRotationAroundY(float p_degrees)
+	{
+		const float halfAngle = p_degrees * 3.14159265f / 360.0f;
+		return OvMaths::FQuaternion(0.0f, std::sin(halfAngle), 0.0f, std::cos(halfAngle));
+	}
+
+	/**
+	* Skeleton of the given number of bones (Each bone child of the bone at (index - 1) / 2), animated on every bone.
+	* Keys are irregularly spaced, and the three key types of a channel don't share their key times
+	*/
+	std::unique_ptr<ModelHierarchy> CreateSkeleton(uint32_t p_boneCount, uint32_t p_keyCount, uint32_t p_seed = 42)
+	{
+		std::mt19937 random(p_seed);
+		std::uniform_real_distribution<float> value(-1.0f, 1.0f);
+		std::uniform_real_distribution<double> spacing(0.5, 1.5);
+
+		auto hierarchy = std::make_unique<ModelHierarchy>();
+		hierarchy->nodes.resize(p_boneCount);
+
+		auto& animation = hierarchy->animations.emplace_back();
+		animation.m_animName = "Walk";
+		animation.m_ticksPerSecond = kTicksPerSecond;
+		animation.m_duration = 0.0;
+
+		for (uint32_t i = 0; i < p_boneCount; ++i)
+		{
+			auto& node = hierarchy->nodes[i];
+			node.m_name = "Bone" + std::to_string(i);
+			node.parent = i == 0 ? -1 : static_cast<int>((i - 1) / 2);
+			node.m_localTransform = OvMaths::FMatrix4::Translation({ 0.0f, 1.0f, 0.0f });
+
+			auto& channel = animation.m_modelNodeAnimations.emplace_back();
+			channel.m_hierarchyNodeName = node.m_name;
+
+			double positionTime = 0.0;
+			double rotationTime = 0.0;
+			double scaleTime = 0.0;
+
+			for (uint32_t j = 0; j < p_keyCount; ++j)
+			{
+				channel.positions.emplace_back(positionTime, OvMaths::FVector3{ value(random), 1.0f + value(random), value(random) });
+				channel.rotations.emplace_back(rotationTime, GetRotationAroundY(value(random) * 90.0f));
+				channel.scales.emplace_back(scaleTime, OvMaths::FVector3{ 1.0f + value(random) * 0.1f, 1.0f, 1.0f });
+
+				positionTime += spacing(random);
+				rotationTime += spacing(random);
+				scaleTime += spacing(random) * 2.0;
+			}
+
+			animation.m_duration = std::max({ animation.m_duration, positionTime, rotationTime });
+		}
+
+		hierarchy->BuildLookups();
+		return hierarchy;
+	}
+
+	/**
+	* Rig binding every bone of the hierarchy with an identity offset, so its skinning matrices are the bones world transforms
+	*/
+	MeshRigInfo CreateRig(const ModelHierarchy& p_hierarchy)
+	{
+		MeshRigInfo rig;
+		OvMaths::FMatrix4 offset = OvMaths::FMatrix4::Identity;
+
+		for (const auto& node : p_hierarchy.nodes)
+			rig.m_boneInfos.emplace_back(node.m_name, offset);
+
+		rig.ResolveNodeIndices(p_hierarchy);
+		return rig;
+	}
+
+	bool AreNearlyEqual(const OvMaths::FMatrix4& p_a, const OvMaths::FMatrix4& p_b, float p_tolerance = 1e-4f)
+	{
+		for (uint32_t i = 0; i < 16; ++i)
+		{
+			if (std::abs(p_a.data[i] - p_b.data[i]) > p_tolerance * std::max(1.0f, std::abs(p_b.data[i])))
+				return false;
+		}
+
+		return true;
+	}
+}
+
+OVTEST(ModelHierarchy, CursorSamplingMatchesSearchedKeys)
+{
+	const auto hierarchy = CreateSkeleton(4, 40);
+	const auto& animation = hierarchy->animations.front();
+
+	std::mt19937 random(7);
+	std::uniform_real_distribution<double> step(0.0, 2.0);
+	std::uniform_real_distribution<double> jump(-5.0, animation.m_duration + 5.0);
+
+	/* Cursors are kept between samples, the reference searches every key from scratch */
+	std::vector<uint32_t> cursors(animation.m_modelNodeAnimations.size() * 3, 0);
+	double time = -1.0;
+
+	for (uint32_t sample = 0; sample < 2000; ++sample)
+	{
+		/* Mostly forward (Sometimes skipping keys, sometimes staying on a key), with jumps anywhere (Backward, before the first key, after the last one) */
+		const uint32_t kind = sample % 10;
+		time = kind == 9 ? jump(random) : (kind == 8 ? std::floor(time + 1.0) : time + step(random) * (kind < 4 ? 0.1 : 1.0));
+
+		for (size_t i = 0; i < animation.m_modelNodeAnimations.size(); ++i)
+		{
+			const auto& channel = animation.m_modelNodeAnimations[i];
+			const OvMaths::FMatrix4 sampled = channel.GetAnimationTransform(time, &cursors[i * 3]);
+			const OvMaths::FMatrix4 searched = channel.GetAnimationTransform(time);
+
+			/* The same keys are interpolated with the same factors, so the results are identical */
+			OVTEST_CHECK(std::memcmp(sampled.data, searched.data, sizeof(sampled.data)) == 0);
+		}
+	}
+
+	/* Out of range cursors (e.g. kept after the keys changed) are reset */
+	uint32_t invalidCursors[3] = { 1000, 1000, 1000 };
+	const auto& channel = animation.m_modelNodeAnimations.front();
+	const OvMaths::FMatrix4 sampled = channel.GetAnimationTransform(3.0, invalidCursors);
+	const OvMaths::FMatrix4 searched = channel.GetAnimationTransform(3.0);
+	OVTEST_CHECK(std::memcmp(sampled.data, searched.data, sizeof(sampled.data)) == 0);
+}
+
+OVTEST(ModelHierarchy, KeysAreInterpolated)
+{
+	ModelNodeAnimation channel;
+	channel.positions = { { 0.0, { 0.0f, 0.0f, 0.0f } }, { 2.0, { 4.0f, 0.0f, -2.0f } } };
+	channel.rotations = { { 0.0, GetRotationAroundY(0.0f) }, { 2.0, GetRotationAroundY(90.0f) } };
+
+	/* A quarter of a 90 degrees rotation: a slerp turns by 22.5 degrees (A normalized lerp would turn by 21.6 degrees) */
+	const OvMaths::FMatrix4 expected = OvMaths::FMatrix4::Translation({ 1.0f, 0.0f, -0.5f }) * OvMaths::FQuaternion::ToMatrix4(GetRotationAroundY(22.5f));
+	OVTEST_CHECK(AreNearlyEqual(channel.GetAnimationTransform(0.5), expected));
+
+	/* The shortest path is taken, whatever the sign of the key quaternion is */
+	const OvMaths::FQuaternion opposite = GetRotationAroundY(90.0f);
+	std::get<1>(channel.rotations[1]) = OvMaths::FQuaternion(-opposite.x, -opposite.y, -opposite.z, -opposite.w);
+	OVTEST_CHECK(AreNearlyEqual(channel.GetAnimationTransform(0.5), expected));
+
+	/* Times outside of the keys are clamped to the first and last keys */
+	OVTEST_CHECK(AreNearlyEqual(channel.GetAnimationTransform(-1.0), OvMaths::FMatrix4::Identity));
+	OVTEST_CHECK(AreNearlyEqual(channel.GetAnimationTransform(5.0), OvMaths::FMatrix4::Translation({ 4.0f, 0.0f, -2.0f }) * OvMaths::FQuaternion::ToMatrix4(GetRotationAroundY(90.0f))));
+}
+
+OVTEST(ModelHierarchy, SamplingLoopsOverTheAnimation)
+{
+	const auto hierarchy = CreateSkeleton(15, 20);
+	const auto& animation = hierarchy->animations.front();
+	const MeshRigInfo rig = CreateRig(*hierarchy);
+	const double duration = animation.m_duration / animation.m_ticksPerSecond;
+
+	ModelNodeTransformCalculator looped(*hierarchy, animation);
+	std::vector<OvMaths::FMatrix4> loopedBones(rig.m_boneInfos.size());
+	std::vector<OvMaths::FMatrix4> expectedBones(rig.m_boneInfos.size());
+
+	for (const double time : { 0.05, duration * 0.5, duration - 0.05 })
+	{
+		ModelNodeTransformCalculator reference(*hierarchy, animation);
+		reference.SampleAnimation(time);
+		reference.GetRigBoneTransforms(rig, expectedBones.data());
+
+		/* Later loops (Cursors wrapping back to the first keys) and negative times give the same pose */
+		for (const double loop : { 1.0, 3.0, -1.0, -2.0 })
+		{
+			looped.SampleAnimation(time + loop * duration);
+			looped.GetRigBoneTransforms(rig, loopedBones.data());
+
+			for (size_t i = 0; i < loopedBones.size(); ++i)
+				OVTEST_CHECK(AreNearlyEqual(loopedBones[i], expectedBones[i], 1e-3f));
+		}
+	}
+
+	/* Calculators start at the beginning of the animation */
+	ModelNodeTransformCalculator start(*hierarchy, animation);
+	start.GetRigBoneTransforms(rig, expectedBones.data());
+
+	/* The bones of the rig are the hierarchy nodes, each following its parent */
+	OVTEST_CHECK(rig.m_boneNodeIndices.size() == hierarchy->nodes.size());
+	OVTEST_CHECK(AreNearlyEqual(expectedBones[0], animation.m_modelNodeAnimations[0].GetAnimationTransform(0.0)));
+	OVTEST_CHECK(AreNearlyEqual(expectedBones[1], expectedBones[0] * animation.m_modelNodeAnimations[1].GetAnimationTransform(0.0)));
+}
+
+OVBENCHMARK(ModelHierarchy, SampleCharacters)
+{
+	constexpr uint32_t kCharacterCount = 200;
+	constexpr uint32_t kBoneCount = 64;
+	constexpr uint32_t kFrameCount = 300;
+	constexpr double kFrameTime = 1.0 / 60.0;
+
+	/* 4 seconds of keys at 30 ticks per second */
+	const auto hierarchy = CreateSkeleton(kBoneCount, 120);
+	const auto& animation = hierarchy->animations.front();
+	const MeshRigInfo rig = CreateRig(*hierarchy);
+
+	std::vector<std::unique_ptr<ModelNodeTransformCalculator>> calculators;
+	for (uint32_t i = 0; i < kCharacterCount; ++i)
+		calculators.push_back(std::make_unique<ModelNodeTransformCalculator>(*hierarchy, animation));
+
+	std::vector<OvMaths::FMatrix4> palette(kBoneCount);
+	volatile float checksum = 0.0f;
+	uint32_t frame = 0;
+
+	/* Every character plays the animation at its own phase, and its skinning matrices are composed */
+	const double sampled = OvTests::TestRegistry::Measure([&]
+	{
+		++frame;
+
+		for (uint32_t i = 0; i < kCharacterCount; ++i)
+		{
+			calculators[i]->SampleAnimation(frame * kFrameTime + i * 0.037);
+			calculators[i]->GetRigBoneTransforms(rig, palette.data());
+			checksum = checksum + palette[kBoneCount - 1].data[3];
+		}
+	}, kFrameCount);
+
+	/* Same work, with the bones found by name and every key searched from scratch (How the pose was sampled before) */
+	std::vector<OvMaths::FMatrix4> worldTransforms(kBoneCount);
+	frame = 0;
+
+	const double searched = OvTests::TestRegistry::Measure([&]
+	{
+		++frame;
+
+		for (uint32_t i = 0; i < kCharacterCount; ++i)
+		{
+			const double ticks = std::fmod((frame * kFrameTime + i * 0.037) * animation.m_ticksPerSecond, animation.m_duration);
+
+			for (uint32_t j = 0; j < kBoneCount; ++j)
+			{
+				const auto& node = hierarchy->nodes[j];
+				const OvMaths::FMatrix4 local = animation.GetNodeAnimation(node.m_name)->GetAnimationTransform(ticks);
+				worldTransforms[j] = node.parent < 0 ? local : worldTransforms[node.parent] * local;
+			}
+
+			for (uint32_t j = 0; j < kBoneCount; ++j)
+				palette[j] = worldTransforms[hierarchy->GetNodeIndex(rig.m_boneInfos[j].m_boneName)] * rig.m_boneInfos[j].m_worldToRigSpaceMatrix;
+
+			checksum = checksum + palette[kBoneCount - 1].data[3];
+		}
+	}, kFrameCount);
+
+	std::cout << kCharacterCount << " characters, " << kBoneCount << " bones: " << sampled << " ms per frame (Cursors, resolved bones), " << searched << " ms per frame (Searched keys, bones found by name)" << std::endl;
+}
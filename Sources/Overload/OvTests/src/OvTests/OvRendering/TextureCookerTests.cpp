@@ -0,0 +1,471 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <memory>
+
+#include <OvRendering/Resources/Loaders/TextureCooker.h>
+#include <OvTools/Utils/ThreadPool.h>
+
+#include "OvTests/TestRegistry.h"
+
+namespace
+{
+	using namespace OvRendering::Resources::Loaders;
+	using OvRendering::Settings::ETextureCompression;
+	using OvRendering::Settings::ETextureFilteringMode;
+
+	constexpr auto kFirstFilter = ETextureFilteringMode::LINEAR_MIPMAP_LINEAR;
+	constexpr auto kSecondFilter = ETextureFilteringMode::LINEAR;
+
+	/**
+	* Uncompressed RGBA8 texture owning its pixels. The pattern mixes gradients (Smooth blocks) and noise
+	*/
+	TextureData CreateTexture(uint32_t p_width, uint32_t p_height, uint32_t p_seed = 1)
+	{
+		auto storage = std::make_shared<std::vector<uint8_t>>(static_cast<size_t>(p_width) * p_height * 4);
+		uint32_t state = p_seed;
+
+		for (uint32_t y = 0; y < p_height; ++y)
+		{
+			for (uint32_t x = 0; x < p_width; ++x)
+			{
+				state = state * 1664525u + 1013904223u;
+				uint8_t* pixel = storage->data() + (static_cast<size_t>(y) * p_width + x) * 4;
+				pixel[0] = static_cast<uint8_t>(x * 255 / std::max(p_width - 1, 1u));
+				pixel[1] = static_cast<uint8_t>(y * 255 / std::max(p_height - 1, 1u));
+				pixel[2] = static_cast<uint8_t>(state >> 24);
+				pixel[3] = static_cast<uint8_t>((x + y) * 255 / std::max(p_width + p_height - 2, 1u));
+			}
+		}
+
+		TextureData data;
+		data.width = p_width;
+		data.height = p_height;
+		data.bitsPerPixel = 32;
+		data.levels.push_back({ p_width, p_height, storage->data(), storage->size() });
+		data.storage = storage;
+		return data;
+	}
+
+	uint32_t ReadLittleEndian(const uint8_t* p_input, uint32_t p_byteCount)
+	{
+		uint32_t value = 0;
+
+		for (uint32_t i = 0; i < p_byteCount; ++i)
+			value |= static_cast<uint32_t>(p_input[i]) << (8 * i);
+
+		return value;
+	}
+
+	/* Reference decoders, following the BC1 and BC4 (RGTC1) specifications */
+	void DecodeColorBlock(const uint8_t* p_block, uint8_t* p_pixels)
+	{
+		const uint32_t packed[2] = { ReadLittleEndian(p_block, 2), ReadLittleEndian(p_block + 2, 2) };
+		int palette[4][3];
+
+		for (uint32_t i = 0; i < 2; ++i)
+		{
+			const int r = (packed[i] >> 11) & 31;
+			const int g = (packed[i] >> 5) & 63;
+			const int b = packed[i] & 31;
+			palette[i][0] = (r << 3) | (r >> 2);
+			palette[i][1] = (g << 2) | (g >> 4);
+			palette[i][2] = (b << 3) | (b >> 2);
+		}
+
+		for (uint32_t c = 0; c < 3; ++c)
+		{
+			if (packed[0] > packed[1])
+			{
+				palette[2][c] = (2 * palette[0][c] + palette[1][c]) / 3;
+				palette[3][c] = (palette[0][c] + 2 * palette[1][c]) / 3;
+			}
+			else
+			{
+				palette[2][c] = (palette[0][c] + palette[1][c]) / 2;
+				palette[3][c] = 0;
+			}
+		}
+
+		const uint32_t indices = ReadLittleEndian(p_block + 4, 4);
+
+		for (uint32_t i = 0; i < 16; ++i)
+		{
+			for (uint32_t c = 0; c < 3; ++c)
+				p_pixels[i * 4 + c] = static_cast<uint8_t>(palette[(indices >> (2 * i)) & 3][c]);
+		}
+	}
+
+	void DecodeChannelBlock(const uint8_t* p_block, uint32_t p_channel, uint8_t* p_pixels)
+	{
+		const int first = p_block[0];
+		const int second = p_block[1];
+		int palette[8] = { first, second };
+
+		for (int i = 2; i < 8; ++i)
+		{
+			if (first > second)
+				palette[i] = ((8 - i) * first + (i - 1) * second) / 7;
+			else
+				palette[i] = i < 6 ? ((6 - i) * first + (i - 1) * second) / 5 : (i == 6 ? 0 : 255);
+		}
+
+		uint64_t indices = 0;
+
+		for (uint32_t i = 0; i < 6; ++i)
+			indices |= static_cast<uint64_t>(p_block[2 + i]) << (8 * i);
+
+		for (uint32_t i = 0; i < 16; ++i)
+			p_pixels[i * 4 + p_channel] = static_cast<uint8_t>(palette[(indices >> (3 * i)) & 7]);
+	}
+
+	void DecodeBlock(const uint8_t* p_block, ETextureCompression p_compression, uint8_t* p_pixels)
+	{
+		std::fill_n(p_pixels, 16 * 4, uint8_t{ 0 });
+
+		switch (p_compression)
+		{
+		case ETextureCompression::BC1:
+			DecodeColorBlock(p_block, p_pixels);
+			break;
+
+		case ETextureCompression::BC3:
+			DecodeChannelBlock(p_block, 3, p_pixels);
+			DecodeColorBlock(p_block + 8, p_pixels);
+			break;
+
+		case ETextureCompression::BC5:
+			DecodeChannelBlock(p_block, 0, p_pixels);
+			DecodeChannelBlock(p_block + 8, 1, p_pixels);
+			break;
+
+		default:
+			break;
+		}
+	}
+
+	/**
+	* Returns the largest difference between the given block and its encoded/decoded version, on the channels
+	* stored by the given format
+	*/
+	int GetBlockError(const uint8_t* p_pixels, ETextureCompression p_compression)
+	{
+		uint8_t encoded[16];
+		uint8_t decoded[16 * 4];
+		TextureCooker::EncodeBlock(p_pixels, p_compression, encoded);
+		DecodeBlock(encoded, p_compression, decoded);
+
+		const uint32_t channelCount = p_compression == ETextureCompression::BC1 ? 3 : (p_compression == ETextureCompression::BC3 ? 4 : 2);
+		int error = 0;
+
+		for (uint32_t i = 0; i < 16; ++i)
+		{
+			for (uint32_t c = 0; c < channelCount; ++c)
+				error = std::max(error, std::abs(p_pixels[i * 4 + c] - decoded[i * 4 + c]));
+		}
+
+		return error;
+	}
+
+	bool HasSameLevels(const TextureData& p_first, const TextureData& p_second)
+	{
+		if (p_first.compression != p_second.compression || p_first.levels.size() != p_second.levels.size())
+			return false;
+
+		for (size_t i = 0; i < p_first.levels.size(); ++i)
+		{
+			const TextureLevel& first = p_first.levels[i];
+			const TextureLevel& second = p_second.levels[i];
+
+			if (first.width != second.width || first.height != second.height || first.size != second.size || std::memcmp(first.data, second.data, first.size) != 0)
+				return false;
+		}
+
+		return true;
+	}
+
+	/**
+	* Source file and its cooked texture, removed at the end of the test
+	*/
+	struct CookedSource
+	{
+		std::string path;
+
+		CookedSource(const std::string& p_name, const std::string& p_content)
+		{
+			path = OvTests::TestRegistry::GetTemporaryPath(p_name);
+			std::ofstream(path, std::ios::binary) << p_content;
+		}
+
+		~CookedSource()
+		{
+			std::filesystem::remove(TextureCooker::GetCookedPath(path));
+			std::filesystem::remove(path);
+		}
+
+		bool Load(TextureData& p_outData, ETextureCompression p_compression) const
+		{
+			return TextureCooker::LoadCooked(path, p_outData, kFirstFilter, kSecondFilter, true, p_compression);
+		}
+	};
+}
+
+OVTEST(TextureCooker, BlocksDecodeToTheirSource)
+{
+	for (const auto compression : { ETextureCompression::BC1, ETextureCompression::BC3, ETextureCompression::BC5 })
+	{
+		/* Solid blocks only lose the precision of the endpoints (5:6:5 for the colors, none for the channels) */
+		for (const uint8_t value : { 0, 1, 77, 128, 200, 255 })
+		{
+			uint8_t solid[16 * 4];
+			std::fill_n(solid, 16 * 4, value);
+			OVTEST_CHECK(GetBlockError(solid, compression) <= (compression == ETextureCompression::BC5 ? 0 : 4));
+		}
+
+		/*
+		* The 16 values of a gradient are approximated by 4 colors (BC1) or 8 values (BC4) evenly spread between the
+		* endpoints, so the error is bounded by half of a palette step (Plus the endpoint precision for the colors)
+		*/
+		uint8_t gradient[16 * 4];
+
+		for (uint32_t i = 0; i < 16; ++i)
+		{
+			gradient[i * 4 + 0] = static_cast<uint8_t>(40 + i * 3);
+			gradient[i * 4 + 1] = static_cast<uint8_t>(220 - i * 3);
+			gradient[i * 4 + 2] = static_cast<uint8_t>(100 + i);
+			gradient[i * 4 + 3] = static_cast<uint8_t>(60 + i * 3);
+		}
+
+		OVTEST_CHECK(GetBlockError(gradient, compression) <= (compression == ETextureCompression::BC5 ? 4 : 12));
+	}
+
+	/* The alpha of BC3 and both channels of BC5 are encoded independently: extreme values are kept exactly */
+	uint8_t extremes[16 * 4] = {};
+
+	for (uint32_t i = 0; i < 16; ++i)
+	{
+		extremes[i * 4 + 0] = i % 2 ? 255 : 0;
+		extremes[i * 4 + 1] = i % 3 ? 10 : 250;
+		extremes[i * 4 + 3] = i % 2 ? 0 : 255;
+	}
+
+	uint8_t encoded[16];
+	uint8_t decoded[16 * 4];
+	TextureCooker::EncodeBlock(extremes, ETextureCompression::BC5, encoded);
+	DecodeBlock(encoded, ETextureCompression::BC5, decoded);
+
+	for (uint32_t i = 0; i < 16; ++i)
+		OVTEST_CHECK(decoded[i * 4 + 0] == extremes[i * 4 + 0] && decoded[i * 4 + 1] == extremes[i * 4 + 1]);
+
+	TextureCooker::EncodeBlock(extremes, ETextureCompression::BC3, encoded);
+	DecodeBlock(encoded, ETextureCompression::BC3, decoded);
+
+	for (uint32_t i = 0; i < 16; ++i)
+		OVTEST_CHECK(decoded[i * 4 + 3] == extremes[i * 4 + 3]);
+}
+
+OVTEST(TextureCooker, MipChainIsBoxFiltered)
+{
+	TextureData data = CreateTexture(37, 10);
+	const std::vector<uint8_t> source(data.levels[0].data, data.levels[0].data + data.levels[0].size);
+
+	TextureCooker::GenerateMipChain(data);
+
+	/* 37x10, 18x5, 9x2, 4x1, 2x1, 1x1 */
+	const uint32_t expectedSizes[][2] = { { 37, 10 }, { 18, 5 }, { 9, 2 }, { 4, 1 }, { 2, 1 }, { 1, 1 } };
+	OVTEST_CHECK(data.levels.size() == std::size(expectedSizes));
+
+	for (size_t i = 0; i < data.levels.size(); ++i)
+	{
+		OVTEST_CHECK(data.levels[i].width == expectedSizes[i][0] && data.levels[i].height == expectedSizes[i][1]);
+		OVTEST_CHECK(data.levels[i].size == TextureCooker::GetLevelSize(expectedSizes[i][0], expectedSizes[i][1], ETextureCompression::NONE));
+	}
+
+	OVTEST_CHECK(std::memcmp(data.levels[0].data, source.data(), source.size()) == 0);
+
+	/* Every texel of the second level averages (Rounded) its 2x2 footprint of the first level */
+	for (uint32_t y = 0; y < 5; ++y)
+	{
+		for (uint32_t x = 0; x < 18; ++x)
+		{
+			for (uint32_t c = 0; c < 4; ++c)
+			{
+				uint32_t sum = 0;
+
+				for (uint32_t offset = 0; offset < 4; ++offset)
+					sum += source[((y * 2 + offset / 2) * 37 + x * 2 + offset % 2) * 4 + c];
+
+				OVTEST_CHECK(data.levels[1].data[(y * 18 + x) * 4 + c] == (sum + 2) / 4);
+			}
+		}
+	}
+
+	/* The last column of an odd level is repeated: the 1x1 level of a 3x1 texture averages 2 texels of the first */
+	TextureData odd = CreateTexture(3, 1);
+	TextureCooker::GenerateMipChain(odd);
+	OVTEST_CHECK(odd.levels.size() == 2 && odd.levels[1].width == 1 && odd.levels[1].height == 1);
+
+	for (uint32_t c = 0; c < 4; ++c)
+		OVTEST_CHECK(odd.levels[1].data[c] == (2 * odd.levels[0].data[c] + 2 * odd.levels[0].data[4 + c] + 2) / 4);
+
+	/* Compressed textures can't be filtered */
+	TextureData compressed = CreateTexture(8, 8);
+	TextureCooker::Compress(compressed, ETextureCompression::BC1);
+	TextureCooker::GenerateMipChain(compressed);
+	OVTEST_CHECK(compressed.levels.size() == 1);
+}
+
+OVTEST(TextureCooker, ThreadPoolMatchesSerialProcessing)
+{
+	OvTools::Utils::ThreadPool pool(3);
+
+	for (const auto compression : { ETextureCompression::BC1, ETextureCompression::BC3, ETextureCompression::BC5 })
+	{
+		TextureData serial = CreateTexture(301, 157);
+		TextureData parallel = CreateTexture(301, 157);
+
+		TextureCooker::GenerateMipChain(serial);
+		TextureCooker::GenerateMipChain(parallel, &pool);
+		OVTEST_CHECK(HasSameLevels(serial, parallel));
+
+		TextureCooker::Compress(serial, compression);
+		TextureCooker::Compress(parallel, compression, &pool);
+		OVTEST_CHECK(HasSameLevels(serial, parallel));
+
+		/* Borders are padded to whole blocks */
+		OVTEST_CHECK(serial.compression == compression && serial.levels[0].size == 76 * 40 * TextureCooker::GetBlockSize(compression));
+		OVTEST_CHECK(serial.levels.back().size == TextureCooker::GetBlockSize(compression));
+	}
+}
+
+OVTEST(TextureCooker, CookedTexturesRoundTrip)
+{
+	CookedSource source("RoundTrip.png", "Source image");
+
+	for (const auto compression : { ETextureCompression::NONE, ETextureCompression::BC1, ETextureCompression::BC3, ETextureCompression::BC5 })
+	{
+		TextureData data = CreateTexture(64, 48);
+		TextureCooker::GenerateMipChain(data);
+		TextureCooker::Compress(data, compression);
+		OVTEST_CHECK(TextureCooker::Cook(source.path, data, kFirstFilter, kSecondFilter, true));
+
+		TextureData loaded;
+		OVTEST_CHECK(source.Load(loaded, compression));
+		OVTEST_CHECK(loaded.width == 64 && loaded.height == 48 && loaded.bitsPerPixel == 32);
+		OVTEST_CHECK(HasSameLevels(data, loaded));
+
+		/* Other settings need another cooked texture */
+		TextureData rejected;
+		OVTEST_CHECK(!TextureCooker::LoadCooked(source.path, rejected, ETextureFilteringMode::NEAREST, kSecondFilter, true, compression));
+		OVTEST_CHECK(!TextureCooker::LoadCooked(source.path, rejected, kFirstFilter, kSecondFilter, false, compression));
+		OVTEST_CHECK(!source.Load(rejected, compression == ETextureCompression::BC1 ? ETextureCompression::BC3 : ETextureCompression::BC1));
+		OVTEST_CHECK(rejected.levels.empty());
+	}
+
+	/* A truncated cooked texture is rejected */
+	const std::string cookedPath = TextureCooker::GetCookedPath(source.path);
+	std::filesystem::resize_file(cookedPath, std::filesystem::file_size(cookedPath) - 1);
+
+	TextureData truncated;
+	OVTEST_CHECK(!source.Load(truncated, ETextureCompression::BC5));
+}
+
+OVTEST(TextureCooker, CookedTexturesAreKeyedOnSizeAndWriteTime)
+{
+	CookedSource source("Keyed.png", "Source image A");
+	const auto writeTime = std::filesystem::last_write_time(source.path);
+
+	TextureData data = CreateTexture(16, 16);
+	OVTEST_CHECK(TextureCooker::Cook(source.path, data, kFirstFilter, kSecondFilter, true));
+
+	TextureData loaded;
+	OVTEST_CHECK(source.Load(loaded, ETextureCompression::NONE));
+
+	/* Same size and write time: the content isn't hashed, so a change hidden by restoring the write time goes unnoticed */
+	std::ofstream(source.path, std::ios::binary) << "Source image B";
+	std::filesystem::last_write_time(source.path, writeTime);
+	OVTEST_CHECK(source.Load(loaded, ETextureCompression::NONE));
+
+	/* Same size but another write time: the content is hashed, and it changed */
+	std::filesystem::last_write_time(source.path, writeTime + std::chrono::seconds(10));
+	OVTEST_CHECK(!source.Load(loaded, ETextureCompression::NONE));
+
+	/* Touching the source without changing its content keeps the cooked texture valid, and stores the new write time */
+	std::ofstream(source.path, std::ios::binary) << "Source image A";
+	std::filesystem::last_write_time(source.path, writeTime + std::chrono::seconds(20));
+	OVTEST_CHECK(source.Load(loaded, ETextureCompression::NONE));
+
+	std::ofstream(source.path, std::ios::binary) << "Source image C";
+	std::filesystem::last_write_time(source.path, writeTime + std::chrono::seconds(20));
+	OVTEST_CHECK(source.Load(loaded, ETextureCompression::NONE));
+
+	/* Another size outdates the cooked texture whatever its write time */
+	std::ofstream(source.path, std::ios::binary) << "Larger source image";
+	std::filesystem::last_write_time(source.path, writeTime + std::chrono::seconds(20));
+	OVTEST_CHECK(!source.Load(loaded, ETextureCompression::NONE));
+	OVTEST_CHECK(HasSameLevels(data, loaded));
+}
+
+OVBENCHMARK(TextureCooker, Processing)
+{
+	constexpr uint32_t kSize = 2048;
+	OvTools::Utils::ThreadPool pool;
+
+	const auto mipChain = [](OvTools::Utils::ThreadPool* p_pool)
+	{
+		TextureData data = CreateTexture(kSize, kSize);
+		return OvTests::TestRegistry::Measure([&data, p_pool] { TextureCooker::GenerateMipChain(data, p_pool); });
+	};
+
+	std::cout << kSize << "x" << kSize << " mip chain: " << mipChain(nullptr) << " ms serial, " << mipChain(&pool) << " ms with " << pool.GetConcurrency() << " threads" << std::endl;
+
+	for (const auto compression : { ETextureCompression::BC1, ETextureCompression::BC3, ETextureCompression::BC5 })
+	{
+		const auto compress = [compression](OvTools::Utils::ThreadPool* p_pool)
+		{
+			TextureData data = CreateTexture(kSize, kSize);
+			TextureCooker::GenerateMipChain(data, p_pool);
+			return OvTests::TestRegistry::Measure([&data, compression, p_pool]
+			{
+				TextureData compressed = data;
+				TextureCooker::Compress(compressed, compression, p_pool);
+			});
+		};
+
+		std::cout << "Compression 0x" << std::hex << static_cast<uint32_t>(compression) << std::dec << " with mips: " << compress(nullptr) << " ms serial, " << compress(&pool) << " ms with " << pool.GetConcurrency() << " threads" << std::endl;
+	}
+
+	/* Loading a cooked texture of a 16 MB source, without and with hashing the source */
+	CookedSource source("Benchmark.png", std::string(16 * 1024 * 1024, 'x'));
+	TextureData data = CreateTexture(kSize, kSize);
+	TextureCooker::GenerateMipChain(data, &pool);
+	TextureCooker::Compress(data, ETextureCompression::BC1, &pool);
+	OVTEST_CHECK(TextureCooker::Cook(source.path, data, kFirstFilter, kSecondFilter, true));
+
+	const double stampMatch = OvTests::TestRegistry::Measure([&source]
+	{
+		TextureData loaded;
+		OVTEST_CHECK(source.Load(loaded, ETextureCompression::BC1));
+	}, 20);
+
+	uint32_t touchCount = 0;
+	const double hashed = OvTests::TestRegistry::Measure([&source, &touchCount]
+	{
+		std::filesystem::last_write_time(source.path, std::filesystem::last_write_time(source.path) + std::chrono::seconds(++touchCount));
+		TextureData loaded;
+		OVTEST_CHECK(source.Load(loaded, ETextureCompression::BC1));
+	}, 20);
+
+	std::cout << "LoadCooked: " << stampMatch << " ms with matching write time, " << hashed << " ms with a touched source (Hashed)" << std::endl;
+}
@@ -0,0 +1,40 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#include <filesystem>
+
+#include "OvTests/TestRegistry.h"
+
+bool OvTests::TestRegistry::Register(const std::string& p_suite, const std::string& p_name, ECaseType p_type, void(*p_function)())
+{
+	GetMutableCases().push_back({ p_suite, p_name, p_type, p_function });
+	return true;
+}
+
+const std::vector<OvTests::TestCase>& OvTests::TestRegistry::GetCases()
+{
+	return GetMutableCases();
+}
+
+void OvTests::TestRegistry::Check(bool p_condition, const char* p_expression, const char* p_file, int p_line)
+{
+	if (!p_condition)
+		throw TestFailure(std::string(p_file) + "(" + std::to_string(p_line) + "): check failed: " + p_expression);
+}
+
+std::string OvTests::TestRegistry::GetTemporaryPath(const std::string& p_fileName)
+{
+	/* Every run gets its own prefix, so concurrent runs never share files */
+	static const std::string runPrefix = "OvTests_" + std::to_string(std::chrono::steady_clock::now().time_since_epoch().count()) + "_";
+	return (std::filesystem::temp_directory_path() / (runPrefix + p_fileName)).string();
+}
+
+std::vector<OvTests::TestCase>& OvTests::TestRegistry::GetMutableCases()
+{
+	/* Function-local, so registration from other translation units never precedes its construction */
+	static std::vector<TestCase> cases;
+	return cases;
+}
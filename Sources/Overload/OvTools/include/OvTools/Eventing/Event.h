@@ -7,6 +7,7 @@
 #pragma once
 
 #include <functional>
+#include <map>
 
 
 namespace OvTools::Eventing
@@ -72,7 +73,7 @@ namespace OvTools::Eventing
 		void Invoke(ArgTypes... p_args);
 
 	private:
-		std::unordered_map<ListenerID, Callback>	m_callbacks;
+		std::map<ListenerID, Callback>				m_callbacks; // Ordered by ID, so listeners are called in the order they were added
 		ListenerID									m_availableListenerID = 0;
 	};
 }
@@ -14,7 +14,7 @@ namespace OvTools::Eventing
 	ListenerID Event<ArgTypes...>::AddListener(Callback p_callback)
 	{
 		ListenerID listenerID = m_availableListenerID++;
-		m_callbacks.emplace(listenerID, p_callback);
+		m_callbacks.emplace_hint(m_callbacks.end(), listenerID, std::move(p_callback));
 		return listenerID;
 	}
 
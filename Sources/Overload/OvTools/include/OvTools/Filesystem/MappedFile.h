@@ -0,0 +1,63 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace OvTools::Filesystem
+{
+	/**
+	* Read-only view of a whole file mapped in memory. Pages are loaded by the OS on first access,
+	* so opening a file doesn't read it
+	*/
+	class MappedFile
+	{
+	public:
+		/**
+		* Map the given file. Use IsOpen() to check if the mapping succeeded
+		* @param p_filePath
+		*/
+		MappedFile(const std::string& p_filePath);
+
+		/**
+		* Unmap the file
+		*/
+		~MappedFile();
+
+		MappedFile(const MappedFile&) = delete;
+		MappedFile& operator=(const MappedFile&) = delete;
+
+		/**
+		* Returns true if the file is mapped
+		*/
+		bool IsOpen() const;
+
+		/**
+		* Returns the first byte of the file (nullptr if the file isn't mapped)
+		*/
+		const uint8_t* GetData() const;
+
+		/**
+		* Returns the size of the file in bytes
+		*/
+		size_t GetSize() const;
+
+		/**
+		* Read one byte of every page, so the file is loaded by the calling thread instead of on first access
+		*/
+		void Prefetch() const;
+
+	private:
+		const uint8_t* m_data = nullptr;
+		size_t m_size = 0;
+
+		void* m_fileHandle = nullptr;
+		void* m_mappingHandle = nullptr;
+	};
+}
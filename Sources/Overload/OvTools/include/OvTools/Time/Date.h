@@ -7,6 +7,7 @@
 #pragma once
 
 #include <string>
+#include <ctime>
 
 
 namespace OvTools::Time
@@ -26,5 +27,11 @@ namespace OvTools::Time
 		* Return the current date in a string format
 		*/
 		static std::string GetDateAsString();
+
+		/*
+		* Return the given time in a string format
+		* @param p_time
+		*/
+		static std::string GetDateAsString(std::time_t p_time);
 	};
 }
\ No newline at end of file
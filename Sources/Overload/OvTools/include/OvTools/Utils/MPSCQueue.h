@@ -0,0 +1,65 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+
+namespace OvTools::Utils
+{
+	/**
+	* Bounded lock-free queue accepting any number of producer threads and a single consumer thread.
+	* Every slot is allocated at construction, so pushing and popping never allocate by themselves
+	*/
+	template<typename T>
+	class MPSCQueue
+	{
+	public:
+		/**
+		* Create the queue
+		* @param p_capacity (Rounded up to the next power of two)
+		*/
+		MPSCQueue(size_t p_capacity);
+
+		MPSCQueue(const MPSCQueue&) = delete;
+		MPSCQueue& operator=(const MPSCQueue&) = delete;
+
+		/**
+		* Add an element to the queue (Any thread). Returns false if the queue is full, in which case the element is left untouched
+		* @param p_element
+		*/
+		bool TryPush(T&& p_element);
+
+		/**
+		* Remove the oldest element of the queue (Consumer thread only). Returns false if the queue is empty
+		* @param p_element
+		*/
+		bool TryPop(T& p_element);
+
+		/**
+		* Returns the maximum number of elements the queue can hold
+		*/
+		size_t GetCapacity() const;
+
+	private:
+		struct Slot
+		{
+			std::atomic<size_t> sequence;
+			T element;
+		};
+
+		const size_t m_capacity;
+		std::unique_ptr<Slot[]> m_slots;
+
+		alignas(64) std::atomic<size_t> m_pushPosition = 0;
+		alignas(64) size_t m_popPosition = 0;
+	};
+}
+
+#include "OvTools/Utils/MPSCQueue.inl"
@@ -0,0 +1,82 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#pragma once
+
+#include "OvTools/Utils/MPSCQueue.h"
+
+namespace OvTools::Utils
+{
+	template<typename T>
+	MPSCQueue<T>::MPSCQueue(size_t p_capacity) :
+		m_capacity([p_capacity]
+		{
+			size_t capacity = 2;
+			while (capacity < p_capacity)
+				capacity <<= 1;
+			return capacity;
+		}()),
+		m_slots(std::make_unique<Slot[]>(m_capacity))
+	{
+		/* The sequence of a slot is the push position it expects next, it becomes position + 1 once filled */
+		for (size_t i = 0; i < m_capacity; ++i)
+			m_slots[i].sequence.store(i, std::memory_order_relaxed);
+	}
+
+	template<typename T>
+	bool MPSCQueue<T>::TryPush(T&& p_element)
+	{
+		size_t position = m_pushPosition.load(std::memory_order_relaxed);
+
+		while (true)
+		{
+			Slot& slot = m_slots[position & (m_capacity - 1)];
+			const size_t sequence = slot.sequence.load(std::memory_order_acquire);
+			const intptr_t difference = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position);
+
+			if (difference == 0)
+			{
+				/* The slot is free, try to claim it */
+				if (m_pushPosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+				{
+					slot.element = std::move(p_element);
+					slot.sequence.store(position + 1, std::memory_order_release);
+					return true;
+				}
+			}
+			else if (difference < 0)
+			{
+				/* The slot still holds an element from the previous lap, the queue is full */
+				return false;
+			}
+			else
+			{
+				/* Another producer claimed this position */
+				position = m_pushPosition.load(std::memory_order_relaxed);
+			}
+		}
+	}
+
+	template<typename T>
+	bool MPSCQueue<T>::TryPop(T& p_element)
+	{
+		Slot& slot = m_slots[m_popPosition & (m_capacity - 1)];
+
+		if (slot.sequence.load(std::memory_order_acquire) != m_popPosition + 1)
+			return false;
+
+		p_element = std::move(slot.element);
+		slot.sequence.store(m_popPosition + m_capacity, std::memory_order_release);
+		++m_popPosition;
+		return true;
+	}
+
+	template<typename T>
+	size_t MPSCQueue<T>::GetCapacity() const
+	{
+		return m_capacity;
+	}
+}
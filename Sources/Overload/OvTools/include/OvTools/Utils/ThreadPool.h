@@ -0,0 +1,75 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+
+namespace OvTools::Utils
+{
+	/*
+	* Fixed set of worker threads used to split a job into independent parts.
+	* The calling thread takes part in the work, so a pool without workers simply runs the job serially
+	*/
+	class ThreadPool
+	{
+	public:
+		/**
+		* Create the thread pool
+		* @param p_workerCount (Number of worker threads, uses the hardware concurrency minus the calling thread if set to 0)
+		*/
+		ThreadPool(uint32_t p_workerCount = 0);
+
+		/**
+		* Stop and join every worker thread
+		*/
+		~ThreadPool();
+
+		ThreadPool(const ThreadPool&) = delete;
+		ThreadPool& operator=(const ThreadPool&) = delete;
+
+		/**
+		* Returns the number of threads that can work on a job at the same time (Workers and calling thread)
+		*/
+		uint32_t GetConcurrency() const;
+
+		/**
+		* Call the given job once for every index in [0, p_jobCount) and wait until every call returned.
+		* Calls are spread over the workers and the calling thread in no particular order.
+		* Concurrent dispatches are serialized, and a job must not dispatch on the same pool
+		* @param p_jobCount
+		* @param p_job
+		*/
+		void Dispatch(uint32_t p_jobCount, const std::function<void(uint32_t)>& p_job);
+
+	private:
+		void WorkerLoop();
+		uint32_t RunJobs();
+
+	private:
+		std::vector<std::thread> m_workers;
+
+		std::mutex m_dispatchMutex;
+		std::mutex m_mutex;
+		std::condition_variable m_wakeCondition;
+		std::condition_variable m_doneCondition;
+
+		const std::function<void(uint32_t)>* m_job = nullptr;
+		uint32_t m_jobCount = 0;
+		std::atomic<uint32_t> m_nextJob = 0;
+		uint32_t m_pendingJobs = 0;
+		uint32_t m_activeWorkers = 0;
+		uint64_t m_generation = 0;
+		bool m_stopping = false;
+	};
+}
@@ -0,0 +1,105 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#include "OvTools/Filesystem/MappedFile.h"
+
+#ifdef _WIN32
+#define NOMINMAX
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+OvTools::Filesystem::MappedFile::MappedFile(const std::string& p_filePath)
+{
+#ifdef _WIN32
+	HANDLE file = CreateFileA(p_filePath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+
+	if (file == INVALID_HANDLE_VALUE)
+		return;
+
+	m_fileHandle = file;
+
+	LARGE_INTEGER size;
+
+	if (!GetFileSizeEx(file, &size) || size.QuadPart == 0)
+		return;
+
+	m_mappingHandle = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+
+	if (!m_mappingHandle)
+		return;
+
+	if (auto view = MapViewOfFile(m_mappingHandle, FILE_MAP_READ, 0, 0, 0))
+	{
+		m_data = static_cast<const uint8_t*>(view);
+		m_size = static_cast<size_t>(size.QuadPart);
+	}
+#else
+	const int file = open(p_filePath.c_str(), O_RDONLY);
+
+	if (file < 0)
+		return;
+
+	struct stat status;
+
+	if (fstat(file, &status) == 0 && status.st_size > 0)
+	{
+		if (void* view = mmap(nullptr, static_cast<size_t>(status.st_size), PROT_READ, MAP_PRIVATE, file, 0); view != MAP_FAILED)
+		{
+			m_data = static_cast<const uint8_t*>(view);
+			m_size = static_cast<size_t>(status.st_size);
+		}
+	}
+
+	close(file); // The mapping stays valid once the descriptor is closed
+#endif
+}
+
+OvTools::Filesystem::MappedFile::~MappedFile()
+{
+#ifdef _WIN32
+	if (m_data)
+		UnmapViewOfFile(m_data);
+
+	if (m_mappingHandle)
+		CloseHandle(m_mappingHandle);
+
+	if (m_fileHandle)
+		CloseHandle(m_fileHandle);
+#else
+	if (m_data)
+		munmap(const_cast<uint8_t*>(m_data), m_size);
+#endif
+}
+
+bool OvTools::Filesystem::MappedFile::IsOpen() const
+{
+	return m_data != nullptr;
+}
+
+const uint8_t* OvTools::Filesystem::MappedFile::GetData() const
+{
+	return m_data;
+}
+
+size_t OvTools::Filesystem::MappedFile::GetSize() const
+{
+	return m_size;
+}
+
+void OvTools::Filesystem::MappedFile::Prefetch() const
+{
+	constexpr size_t kPageSize = 4096;
+
+	volatile uint8_t sink = 0;
+
+	for (size_t offset = 0; offset < m_size; offset += kPageSize)
+		sink = sink + m_data[offset];
+}
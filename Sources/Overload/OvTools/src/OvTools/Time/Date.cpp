@@ -9,12 +9,16 @@
 #include "OvTools/Time/Date.h"
 
 std::string OvTools::Time::Date::GetDateAsString()
+{
+	return GetDateAsString(time(nullptr));
+}
+
+std::string OvTools::Time::Date::GetDateAsString(std::time_t p_time)
 {
 	std::string date;
-	const auto now = time(nullptr);
 	tm ltm;
 
-	localtime_s(&ltm, &now);
+	localtime_s(&ltm, &p_time);
 
 	std::string dateData[6] =
 	{
@@ -0,0 +1,116 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#include "OvTools/Utils/ThreadPool.h"
+
+OvTools::Utils::ThreadPool::ThreadPool(uint32_t p_workerCount)
+{
+	if (p_workerCount == 0)
+	{
+		const uint32_t hardwareThreads = std::thread::hardware_concurrency();
+		p_workerCount = hardwareThreads > 1 ? hardwareThreads - 1 : 0;
+	}
+
+	m_workers.reserve(p_workerCount);
+
+	for (uint32_t i = 0; i < p_workerCount; ++i)
+		m_workers.emplace_back(&ThreadPool::WorkerLoop, this);
+}
+
+OvTools::Utils::ThreadPool::~ThreadPool()
+{
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_stopping = true;
+	}
+
+	m_wakeCondition.notify_all();
+
+	for (auto& worker : m_workers)
+		worker.join();
+}
+
+uint32_t OvTools::Utils::ThreadPool::GetConcurrency() const
+{
+	return static_cast<uint32_t>(m_workers.size()) + 1;
+}
+
+void OvTools::Utils::ThreadPool::Dispatch(uint32_t p_jobCount, const std::function<void(uint32_t)>& p_job)
+{
+	if (p_jobCount == 0)
+		return;
+
+	if (m_workers.empty() || p_jobCount == 1)
+	{
+		for (uint32_t i = 0; i < p_jobCount; ++i)
+			p_job(i);
+
+		return;
+	}
+
+	std::lock_guard<std::mutex> dispatchLock(m_dispatchMutex);
+
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_job = &p_job;
+		m_jobCount = p_jobCount;
+		m_nextJob = 0;
+		m_pendingJobs = p_jobCount;
+		++m_generation;
+	}
+
+	m_wakeCondition.notify_all();
+
+	const uint32_t completed = RunJobs();
+
+	std::unique_lock<std::mutex> lock(m_mutex);
+	m_pendingJobs -= completed;
+
+	/* Workers still inside RunJobs() read the job, so wait for them to leave before returning */
+	m_doneCondition.wait(lock, [this] { return m_pendingJobs == 0 && m_activeWorkers == 0; });
+	m_job = nullptr;
+}
+
+void OvTools::Utils::ThreadPool::WorkerLoop()
+{
+	uint64_t lastGeneration = 0;
+
+	std::unique_lock<std::mutex> lock(m_mutex);
+
+	while (true)
+	{
+		m_wakeCondition.wait(lock, [this, lastGeneration] { return m_stopping || m_generation != lastGeneration; });
+
+		if (m_stopping)
+			return;
+
+		lastGeneration = m_generation;
+		++m_activeWorkers;
+
+		lock.unlock();
+		const uint32_t completed = RunJobs();
+		lock.lock();
+
+		m_pendingJobs -= completed;
+		--m_activeWorkers;
+
+		if (m_pendingJobs == 0 && m_activeWorkers == 0)
+			m_doneCondition.notify_all();
+	}
+}
+
+uint32_t OvTools::Utils::ThreadPool::RunJobs()
+{
+	uint32_t completed = 0;
+
+	for (uint32_t index = m_nextJob.fetch_add(1); index < m_jobCount; index = m_nextJob.fetch_add(1))
+	{
+		(*m_job)(index);
+		++completed;
+	}
+
+	return completed;
+}